@@ -0,0 +1,94 @@
+#include <benchmark/benchmark.h>
+
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+#include "math/math.h"
+
+namespace
+{
+
+using Point3f = Math::Point3<float>;
+
+constexpr size_t k_point_count = 4'000'000;
+
+const std::filesystem::path& FilePath()
+{
+    static const std::filesystem::path path = []
+    {
+        Math::RNG rng(1);
+        std::vector<Point3f> points(k_point_count);
+        for (Point3f& p : points)
+        {
+            p = Point3f(rng.UniformFloat(), rng.UniformFloat(), rng.UniformFloat());
+        }
+        const std::filesystem::path result =
+            std::filesystem::temp_directory_path() / "math-binary-file-bench.bin";
+        Math::BinaryFileWriter writer;
+        writer.Open(result);
+        writer.WriteArray<Point3f>("points", points);
+        writer.Close();
+        return result;
+    }();
+    return path;
+}
+
+float SumX(std::span<const Point3f> points)
+{
+    float sum = 0;
+    for (const Point3f& p : points)
+    {
+        sum += p.x;
+    }
+    return sum;
+}
+
+// Reading the array into memory, as a loader with fread does.
+void BM_LoadRead(benchmark::State& state)
+{
+    const std::filesystem::path& path = FilePath();
+    for (auto _ : state)
+    {
+        Math::MappedBinaryFile file;
+        file.Open(path);
+        const Math::BinaryArrayInfo& info = file.GetArrayInfo(0);
+        std::vector<Point3f> points(info.count);
+        std::ifstream stream(path, std::ios::binary);
+        stream.seekg(static_cast<std::streamoff>(info.offset));
+        stream.read(reinterpret_cast<char*>(points.data()),
+                    static_cast<std::streamsize>(points.size() * sizeof(Point3f)));
+        benchmark::DoNotOptimize(SumX(points));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * k_point_count));
+}
+
+void BM_LoadMapped(benchmark::State& state)
+{
+    const std::filesystem::path& path = FilePath();
+    for (auto _ : state)
+    {
+        Math::MappedBinaryFile file;
+        file.Open(path);
+        benchmark::DoNotOptimize(SumX(file.GetArray<Point3f>(0)));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * k_point_count));
+}
+
+// Opening only, the pages are loaded when the points are first used.
+void BM_OpenMapped(benchmark::State& state)
+{
+    const std::filesystem::path& path = FilePath();
+    for (auto _ : state)
+    {
+        Math::MappedBinaryFile file;
+        file.Open(path);
+        benchmark::DoNotOptimize(file.GetArray<Point3f>(0)[0]);
+    }
+}
+
+}  // namespace
+
+BENCHMARK(BM_LoadRead)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_LoadMapped)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_OpenMapped)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,226 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "math/math.h"
+
+namespace
+{
+
+using Bounds3f = Math::Bounds3<float>;
+using Point3f = Math::Point3<float>;
+
+struct Boxes
+{
+    std::vector<Bounds3f> aos;
+    std::vector<Point3f> points;
+    std::vector<float> soa[6];
+    std::vector<uint64_t> mask;
+
+    explicit Boxes(size_t count) : mask((count + 63) / 64)
+    {
+        Math::RNG rng(1);
+        for (size_t i = 0; i < count; ++i)
+        {
+            const Point3f p(rng.UniformFloatInRange(-100, 100), rng.UniformFloatInRange(-100, 100),
+                            rng.UniformFloatInRange(-100, 100));
+            aos.emplace_back(p, p + Math::Vector3<float>(1, 1, 1));
+            points.push_back(p);
+            const float components[] = {p.x, p.y, p.z, p.x + 1, p.y + 1, p.z + 1};
+            for (size_t c = 0; c < 6; ++c)
+            {
+                soa[c].push_back(components[c]);
+            }
+        }
+    }
+
+    Math::Bounds3SoA<const float> SoA() const
+    {
+        return Math::Bounds3SoA<const float>(soa[0], soa[1], soa[2], soa[3], soa[4], soa[5]);
+    }
+};
+
+const Bounds3f k_query(Point3f(-50, -50, -50), Point3f(50, 50, 50));
+
+void BM_UnionScalar(benchmark::State& state)
+{
+    const Boxes boxes(static_cast<size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        Bounds3f result = boxes.aos[0];
+        for (const Bounds3f& b : boxes.aos)
+        {
+            result = Math::Union(result, b);
+        }
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * boxes.aos.size()));
+}
+
+void BM_UnionBatch(benchmark::State& state)
+{
+    const Boxes boxes(static_cast<size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(Math::Union<float>(boxes.aos));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * boxes.aos.size()));
+}
+
+void BM_UnionBatchSoA(benchmark::State& state)
+{
+    const Boxes boxes(static_cast<size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(Math::Union<float>(boxes.SoA()));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * boxes.aos.size()));
+}
+
+void BM_OverlapsScalar(benchmark::State& state)
+{
+    Boxes boxes(static_cast<size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        std::fill(boxes.mask.begin(), boxes.mask.end(), 0);
+        for (size_t i = 0; i < boxes.aos.size(); ++i)
+        {
+            if (Math::Overlaps(k_query, boxes.aos[i]))
+            {
+                boxes.mask[i / 64] |= uint64_t{1} << (i % 64);
+            }
+        }
+        benchmark::DoNotOptimize(boxes.mask.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * boxes.aos.size()));
+}
+
+void BM_OverlapsBatch(benchmark::State& state)
+{
+    Boxes boxes(static_cast<size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(Math::Overlaps(k_query, boxes.aos, boxes.mask));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * boxes.aos.size()));
+}
+
+void BM_OverlapsBatchSoA(benchmark::State& state)
+{
+    Boxes boxes(static_cast<size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(Math::Overlaps(k_query, boxes.SoA(), boxes.mask));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * boxes.aos.size()));
+}
+
+void BM_InsideScalar(benchmark::State& state)
+{
+    Boxes boxes(static_cast<size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        std::fill(boxes.mask.begin(), boxes.mask.end(), 0);
+        for (size_t i = 0; i < boxes.points.size(); ++i)
+        {
+            if (Math::Inside(k_query, boxes.points[i]))
+            {
+                boxes.mask[i / 64] |= uint64_t{1} << (i % 64);
+            }
+        }
+        benchmark::DoNotOptimize(boxes.mask.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * boxes.points.size()));
+}
+
+void BM_InsideBatch(benchmark::State& state)
+{
+    Boxes boxes(static_cast<size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(Math::Inside(k_query, boxes.points, boxes.mask));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * boxes.points.size()));
+}
+
+// Instances with a random rotation, scale and translation each.
+std::vector<Math::Matrix4x4<float>> Transforms(size_t count)
+{
+    Math::RNG rng(2);
+    std::vector<Math::Matrix4x4<float>> result;
+    for (size_t i = 0; i < count; ++i)
+    {
+        const Math::Vector3<float> axis(rng.UniformFloatInRange(-1, 1),
+                                        rng.UniformFloatInRange(-1, 1), 1);
+        result.push_back(Math::Translate(Math::Vector3<float>(rng.UniformFloatInRange(-100, 100),
+                                                              rng.UniformFloatInRange(-100, 100),
+                                                              rng.UniformFloatInRange(-100, 100))) *
+                         Math::Rotate(rng.UniformFloatInRange(0, 360), Math::Normalize(axis)) *
+                         Math::Scale(rng.UniformFloatInRange(0.5f, 2)));
+    }
+    return result;
+}
+
+void BM_TransformBoundsCorners(benchmark::State& state)
+{
+    Boxes boxes(static_cast<size_t>(state.range(0)));
+    const std::vector<Math::Matrix4x4<float>> matrices = Transforms(boxes.aos.size());
+    std::vector<Bounds3f> result(boxes.aos.size());
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < boxes.aos.size(); ++i)
+        {
+            Bounds3f b(matrices[i] * Math::Corner(boxes.aos[i], 0));
+            for (uint8_t corner = 1; corner < 8; ++corner)
+            {
+                b = Math::Union(b, matrices[i] * Math::Corner(boxes.aos[i], corner));
+            }
+            result[i] = b;
+        }
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * boxes.aos.size()));
+}
+
+void BM_TransformBoundsScalar(benchmark::State& state)
+{
+    Boxes boxes(static_cast<size_t>(state.range(0)));
+    const std::vector<Math::Matrix4x4<float>> matrices = Transforms(boxes.aos.size());
+    std::vector<Bounds3f> result(boxes.aos.size());
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < boxes.aos.size(); ++i)
+        {
+            result[i] = Math::TransformBounds(matrices[i], boxes.aos[i]);
+        }
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * boxes.aos.size()));
+}
+
+void BM_TransformBoundsBatch(benchmark::State& state)
+{
+    Boxes boxes(static_cast<size_t>(state.range(0)));
+    const std::vector<Math::Matrix4x4<float>> matrices = Transforms(boxes.aos.size());
+    std::vector<Bounds3f> result(boxes.aos.size());
+    for (auto _ : state)
+    {
+        Math::TransformBounds<float>(matrices, boxes.aos, result);
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * boxes.aos.size()));
+}
+
+}  // namespace
+
+BENCHMARK(BM_UnionScalar)->Arg(1'000)->Arg(1'000'000);
+BENCHMARK(BM_UnionBatch)->Arg(1'000)->Arg(1'000'000);
+BENCHMARK(BM_UnionBatchSoA)->Arg(1'000)->Arg(1'000'000);
+BENCHMARK(BM_OverlapsScalar)->Arg(1'000)->Arg(1'000'000);
+BENCHMARK(BM_OverlapsBatch)->Arg(1'000)->Arg(1'000'000);
+BENCHMARK(BM_OverlapsBatchSoA)->Arg(1'000)->Arg(1'000'000);
+BENCHMARK(BM_InsideScalar)->Arg(1'000)->Arg(1'000'000);
+BENCHMARK(BM_InsideBatch)->Arg(1'000)->Arg(1'000'000);
+BENCHMARK(BM_TransformBoundsCorners)->Arg(1'000)->Arg(1'000'000);
+BENCHMARK(BM_TransformBoundsScalar)->Arg(1'000)->Arg(1'000'000);
+BENCHMARK(BM_TransformBoundsBatch)->Arg(1'000)->Arg(1'000'000);
@@ -0,0 +1,103 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "math/math.h"
+
+namespace
+{
+
+using Bounds3f = Math::Bounds3<float>;
+using Point3f = Math::Point3<float>;
+using Vector3f = Math::Vector3<float>;
+
+// Unit boxes at a density where every box overlaps about one other box.
+struct Bodies
+{
+    std::vector<Bounds3f> boxes;
+    std::vector<Vector3f> velocities;
+
+    explicit Bodies(size_t count)
+    {
+        Math::RNG rng(1);
+        const float half_size = 0.5f * std::cbrt(static_cast<float>(count) * 8);
+        for (size_t i = 0; i < count; ++i)
+        {
+            const Point3f p(rng.UniformFloatInRange(-half_size, half_size),
+                            rng.UniformFloatInRange(-half_size, half_size),
+                            rng.UniformFloatInRange(-half_size, half_size));
+            boxes.emplace_back(p, p + Vector3f(1, 1, 1));
+            velocities.emplace_back(rng.UniformFloatInRange(-0.05f, 0.05f),
+                                    rng.UniformFloatInRange(-0.05f, 0.05f),
+                                    rng.UniformFloatInRange(-0.05f, 0.05f));
+        }
+    }
+
+    void Step()
+    {
+        for (size_t i = 0; i < boxes.size(); ++i)
+        {
+            boxes[i] = Bounds3f(boxes[i].min + velocities[i], boxes[i].max + velocities[i]);
+        }
+    }
+};
+
+void BM_DynamicAABBTreeFrame(benchmark::State& state)
+{
+    Bodies bodies(static_cast<size_t>(state.range(0)));
+    Math::DynamicAABBTree<float> tree(0.2f);
+    std::vector<uint32_t> ids;
+    for (const Bounds3f& box : bodies.boxes)
+    {
+        ids.push_back(tree.Insert(box));
+    }
+    std::vector<Math::OverlapPair> pairs(bodies.boxes.size() * 4);
+    for (auto _ : state)
+    {
+        bodies.Step();
+        for (size_t i = 0; i < ids.size(); ++i)
+        {
+            tree.Move(ids[i], bodies.boxes[i]);
+        }
+        benchmark::DoNotOptimize(tree.FindOverlapPairs(pairs));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * bodies.boxes.size()));
+}
+
+void BM_SweepAndPruneFrame(benchmark::State& state)
+{
+    Bodies bodies(static_cast<size_t>(state.range(0)));
+    Math::SweepAndPrune<float> sap;
+    std::vector<Math::OverlapPair> pairs(bodies.boxes.size() * 4);
+    for (auto _ : state)
+    {
+        bodies.Step();
+        benchmark::DoNotOptimize(sap.FindOverlapPairs(bodies.boxes, pairs));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * bodies.boxes.size()));
+}
+
+void BM_BruteForceFrame(benchmark::State& state)
+{
+    Bodies bodies(static_cast<size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        bodies.Step();
+        size_t count = 0;
+        for (size_t i = 0; i < bodies.boxes.size(); ++i)
+        {
+            for (size_t j = i + 1; j < bodies.boxes.size(); ++j)
+            {
+                count += Math::Overlaps(bodies.boxes[i], bodies.boxes[j]) ? 1 : 0;
+            }
+        }
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * bodies.boxes.size()));
+}
+
+}  // namespace
+
+BENCHMARK(BM_DynamicAABBTreeFrame)->Arg(10'000)->Arg(100'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_SweepAndPruneFrame)->Arg(10'000)->Arg(100'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_BruteForceFrame)->Arg(10'000)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,86 @@
+#include <benchmark/benchmark.h>
+
+#include <filesystem>
+#include <vector>
+
+#include "math/math.h"
+
+namespace
+{
+
+using Bounds3f = Math::Bounds3<float>;
+using Point3f = Math::Point3<float>;
+
+constexpr size_t k_box_count = 1'000'000;
+
+const std::vector<Bounds3f>& Boxes()
+{
+    static const std::vector<Bounds3f> boxes = []
+    {
+        Math::RNG rng(1);
+        std::vector<Bounds3f> result;
+        result.reserve(k_box_count);
+        for (size_t i = 0; i < k_box_count; ++i)
+        {
+            const Point3f p(rng.UniformFloatInRange(-100, 100), rng.UniformFloatInRange(-100, 100),
+                            rng.UniformFloatInRange(-100, 100));
+            result.emplace_back(p, p + Math::Vector3<float>(0.5f, 0.5f, 0.5f));
+        }
+        return result;
+    }();
+    return boxes;
+}
+
+const std::filesystem::path& FilePath()
+{
+    static const std::filesystem::path path = []
+    {
+        Math::LinearBVH<float> bvh;
+        Math::Build<float>(Boxes(), bvh);
+        const std::filesystem::path result =
+            std::filesystem::temp_directory_path() / "math-bvh-file-bench.bin";
+        Math::BinaryFileWriter writer;
+        writer.Open(result);
+        Math::WriteBVH(writer, "scene", bvh);
+        writer.Close();
+        return result;
+    }();
+    return path;
+}
+
+// A query is included so that the loads touch the pages on the path to a leaf.
+const Bounds3f k_query(Point3f(0, 0, 0), Point3f(1, 1, 1));
+
+void BM_BVHBuild(benchmark::State& state)
+{
+    const std::vector<Bounds3f>& boxes = Boxes();
+    for (auto _ : state)
+    {
+        Math::LinearBVH<float> bvh;
+        Math::Build<float>(boxes, bvh);
+        Math::ForEachOverlap(bvh, k_query, [](uint32_t primitive)
+                             { benchmark::DoNotOptimize(primitive); });
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * k_box_count));
+}
+
+void BM_BVHLoad(benchmark::State& state)
+{
+    const std::filesystem::path& path = FilePath();
+    const bool verify_checksum = state.range(0) != 0;
+    for (auto _ : state)
+    {
+        Math::MappedBinaryFile file;
+        file.Open(path);
+        Math::BVHView<float> bvh;
+        Math::LoadBVH(file, "scene", bvh, verify_checksum);
+        Math::ForEachOverlap(bvh, k_query, [](uint32_t primitive)
+                             { benchmark::DoNotOptimize(primitive); });
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * k_box_count));
+}
+
+}  // namespace
+
+BENCHMARK(BM_BVHBuild)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_BVHLoad)->Arg(1)->Arg(0)->Unit(benchmark::kMillisecond)->UseRealTime();
@@ -0,0 +1,133 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "math/math.h"
+
+namespace
+{
+
+using Fixed = Math::Fixed<int32_t, 16>;
+
+constexpr size_t k_vector_count = 100'000;
+
+template <typename T>
+const std::vector<Math::Vector3<T>>& Vectors()
+{
+    static const std::vector<Math::Vector3<T>> vectors = []
+    {
+        Math::RNG rng(1);
+        std::vector<Math::Vector3<T>> result(k_vector_count);
+        for (Math::Vector3<T>& v : result)
+        {
+            v = Math::Vector3<T>(T(rng.UniformFloatInRange(-10, 10)),
+                                 T(rng.UniformFloatInRange(-10, 10)),
+                                 T(rng.UniformFloatInRange(-10, 10)));
+        }
+        return result;
+    }();
+    return vectors;
+}
+
+template <typename T>
+void BM_DotCross(benchmark::State& state)
+{
+    const std::vector<Math::Vector3<T>>& vectors = Vectors<T>();
+    std::vector<Math::Vector3<T>> result(vectors.size());
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i + 1 < vectors.size(); ++i)
+        {
+            result[i] = Math::Cross(vectors[i], vectors[i + 1]) * Math::Dot(vectors[i], vectors[i]);
+        }
+        benchmark::DoNotOptimize(result.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * vectors.size()));
+}
+
+template <typename T>
+void BM_Normalize(benchmark::State& state)
+{
+    const std::vector<Math::Vector3<T>>& vectors = Vectors<T>();
+    std::vector<Math::Vector3<T>> result(vectors.size());
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < vectors.size(); ++i)
+        {
+            result[i] = Math::Normalize(vectors[i]);
+        }
+        benchmark::DoNotOptimize(result.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * vectors.size()));
+}
+
+template <typename T>
+void BM_SinCos(benchmark::State& state)
+{
+    const std::vector<Math::Vector3<T>>& vectors = Vectors<T>();
+    std::vector<T> result(vectors.size());
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < vectors.size(); ++i)
+        {
+            result[i] = Math::Sin(vectors[i].x) + Math::Cos(vectors[i].y);
+        }
+        benchmark::DoNotOptimize(result.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * vectors.size()));
+}
+
+template <typename T>
+void BM_QuaternionRotate(benchmark::State& state)
+{
+    const std::vector<Math::Vector3<T>>& vectors = Vectors<T>();
+    const Math::Quaternion<T> rotation =
+        Math::Quaternion<T>::FromAxisAngleRadians(Math::Vector3<T>(0, 0, 1), T(0.5));
+    std::vector<Math::Vector3<T>> result(vectors.size());
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < vectors.size(); ++i)
+        {
+            result[i] = rotation * vectors[i];
+        }
+        benchmark::DoNotOptimize(result.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * vectors.size()));
+}
+
+template <typename T>
+void BM_MatrixMultiply(benchmark::State& state)
+{
+    const std::vector<Math::Vector3<T>>& vectors = Vectors<T>();
+    Math::Matrix4x4<T> result(1);
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i + 4 <= vectors.size(); i += 4)
+        {
+            const Math::Matrix4x4<T> m(vectors[i].x, vectors[i].y, vectors[i].z, 0,
+                                       vectors[i + 1].x, vectors[i + 1].y, vectors[i + 1].z, 0,
+                                       vectors[i + 2].x, vectors[i + 2].y, vectors[i + 2].z, 0,
+                                       vectors[i + 3].x, vectors[i + 3].y, vectors[i + 3].z, 1);
+            result = m * result;
+        }
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * (vectors.size() / 4)));
+}
+
+}  // namespace
+
+BENCHMARK(BM_DotCross<float>)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_DotCross<Fixed>)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Normalize<float>)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Normalize<Fixed>)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_SinCos<float>)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_SinCos<Fixed>)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_QuaternionRotate<float>)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_QuaternionRotate<Fixed>)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_MatrixMultiply<float>)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_MatrixMultiply<Fixed>)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,103 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "math/math.h"
+
+namespace
+{
+
+using Vector3f = Math::Vector3<float>;
+
+constexpr size_t k_vector_count = 1'000'000;
+
+const std::vector<Vector3f>& Vectors()
+{
+    static const std::vector<Vector3f> vectors = []
+    {
+        Math::RNG rng(1);
+        std::vector<Vector3f> result(k_vector_count);
+        for (Vector3f& v : result)
+        {
+            v = Vector3f(rng.UniformFloatInRange(-1000, 1000), rng.UniformFloatInRange(-1000, 1000),
+                         rng.UniformFloatInRange(-1000, 1000));
+        }
+        return result;
+    }();
+    return vectors;
+}
+
+template <typename T>
+void BM_ConvertToScalar(benchmark::State& state)
+{
+    const std::vector<Vector3f>& vectors = Vectors();
+    std::vector<Math::Vector3<T>> result(vectors.size());
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < vectors.size(); ++i)
+        {
+            result[i] = Math::Vector3<T>(vectors[i].x, vectors[i].y, vectors[i].z);
+        }
+        benchmark::DoNotOptimize(result.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * vectors.size()));
+}
+
+template <typename T>
+void BM_ConvertTo(benchmark::State& state)
+{
+    const std::vector<Vector3f>& vectors = Vectors();
+    std::vector<Math::Vector3<T>> result(vectors.size());
+    for (auto _ : state)
+    {
+        Math::ConvertVectors(vectors, result);
+        benchmark::DoNotOptimize(result.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * vectors.size()));
+}
+
+template <typename T>
+void BM_ConvertFromScalar(benchmark::State& state)
+{
+    std::vector<Math::Vector3<T>> vectors(Vectors().size());
+    Math::ConvertVectors(Vectors(), vectors);
+    std::vector<Vector3f> result(vectors.size());
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < vectors.size(); ++i)
+        {
+            result[i] = Vector3f(vectors[i].x, vectors[i].y, vectors[i].z);
+        }
+        benchmark::DoNotOptimize(result.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * vectors.size()));
+}
+
+template <typename T>
+void BM_ConvertFrom(benchmark::State& state)
+{
+    std::vector<Math::Vector3<T>> vectors(Vectors().size());
+    Math::ConvertVectors(Vectors(), vectors);
+    std::vector<Vector3f> result(vectors.size());
+    for (auto _ : state)
+    {
+        Math::ConvertVectors(vectors, result);
+        benchmark::DoNotOptimize(result.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * vectors.size()));
+}
+
+}  // namespace
+
+BENCHMARK(BM_ConvertToScalar<Math::Half>)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ConvertTo<Math::Half>)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ConvertFromScalar<Math::Half>)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ConvertFrom<Math::Half>)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ConvertToScalar<Math::BFloat16>)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ConvertTo<Math::BFloat16>)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ConvertFromScalar<Math::BFloat16>)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ConvertFrom<Math::BFloat16>)->Unit(benchmark::kMillisecond);
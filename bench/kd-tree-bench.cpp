@@ -0,0 +1,81 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "math/math.h"
+
+namespace
+{
+
+using Point3f = Math::Point3<float>;
+
+constexpr size_t k_query_count = 10'000;
+constexpr size_t k_neighbour_count = 8;
+
+std::vector<Point3f> RandomPoints(size_t count, uint64_t seed)
+{
+    Math::RNG rng(seed);
+    std::vector<Point3f> points;
+    points.reserve(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        points.emplace_back(rng.UniformFloat(), rng.UniformFloat(), rng.UniformFloat());
+    }
+    return points;
+}
+
+void BM_KdTreeBuild(benchmark::State& state)
+{
+    const std::vector<Point3f> points = RandomPoints(static_cast<size_t>(state.range(0)), 1);
+    Math::KdTree3<float> tree;
+    for (auto _ : state)
+    {
+        Math::Build(points, tree);
+        benchmark::DoNotOptimize(tree.indices.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * points.size()));
+}
+
+void BM_KdTreeNearest(benchmark::State& state)
+{
+    const std::vector<Point3f> points = RandomPoints(static_cast<size_t>(state.range(0)), 1);
+    const std::vector<Point3f> centers = RandomPoints(k_query_count, 2);
+    Math::KdTree3<float> tree;
+    Math::Build(points, tree);
+    std::vector<uint32_t> indices(k_neighbour_count);
+    std::vector<float> distances(k_neighbour_count);
+    for (auto _ : state)
+    {
+        for (const Point3f& center : centers)
+        {
+            benchmark::DoNotOptimize(Math::FindNearest(tree, center, indices, distances));
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * k_query_count));
+}
+
+void BM_KdTreeNearestBatch(benchmark::State& state)
+{
+    const std::vector<Point3f> points = RandomPoints(static_cast<size_t>(state.range(0)), 1);
+    const std::vector<Point3f> centers = RandomPoints(k_query_count, 2);
+    Math::KdTree3<float> tree;
+    Math::Build(points, tree);
+    std::vector<uint32_t> indices(k_query_count * k_neighbour_count);
+    std::vector<float> distances(indices.size());
+    for (auto _ : state)
+    {
+        Math::FindNearest(tree, centers, k_neighbour_count, indices, distances);
+        benchmark::DoNotOptimize(indices.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * k_query_count));
+}
+
+}  // namespace
+
+BENCHMARK(BM_KdTreeBuild)->Arg(100'000)->Arg(10'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_KdTreeNearest)->Arg(100'000)->Arg(10'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_KdTreeNearestBatch)
+    ->Arg(100'000)
+    ->Arg(10'000'000)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
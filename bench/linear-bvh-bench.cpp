@@ -0,0 +1,63 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "math/math.h"
+
+namespace
+{
+
+using Bounds3f = Math::Bounds3<float>;
+using Point3f = Math::Point3<float>;
+
+std::vector<Bounds3f> RandomBoxes(size_t count)
+{
+    Math::RNG rng(1);
+    std::vector<Bounds3f> boxes;
+    boxes.reserve(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        const Point3f p(rng.UniformFloatInRange(-100, 100), rng.UniformFloatInRange(-100, 100),
+                        rng.UniformFloatInRange(-100, 100));
+        boxes.emplace_back(p, p + Math::Vector3<float>(0.5f, 0.5f, 0.5f));
+    }
+    return boxes;
+}
+
+void BM_LinearBVHBuild(benchmark::State& state)
+{
+    const std::vector<Bounds3f> boxes = RandomBoxes(static_cast<size_t>(state.range(0)));
+    Math::LinearBVH<float> bvh;
+    for (auto _ : state)
+    {
+        Math::Build<float>(boxes, bvh);
+        benchmark::DoNotOptimize(bvh.nodes.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * boxes.size()));
+}
+
+void BM_LinearBVHRefit(benchmark::State& state)
+{
+    const std::vector<Bounds3f> boxes = RandomBoxes(static_cast<size_t>(state.range(0)));
+    Math::LinearBVH<float> bvh;
+    Math::Build<float>(boxes, bvh);
+    for (auto _ : state)
+    {
+        Math::Refit<float>(boxes, bvh);
+        benchmark::DoNotOptimize(bvh.nodes.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * boxes.size()));
+}
+
+}  // namespace
+
+BENCHMARK(BM_LinearBVHBuild)
+    ->Arg(10'000)
+    ->Arg(1'000'000)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK(BM_LinearBVHRefit)
+    ->Arg(10'000)
+    ->Arg(1'000'000)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
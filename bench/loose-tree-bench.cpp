@@ -0,0 +1,132 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "math/math.h"
+
+namespace
+{
+
+using Bounds3f = Math::Bounds3<float>;
+using Point3f = Math::Point3<float>;
+using Vector3f = Math::Vector3<float>;
+
+const Bounds3f k_world(Point3f(-100, -100, -100), Point3f(100, 100, 100));
+
+std::vector<Bounds3f> RandomBoxes(size_t count)
+{
+    Math::RNG rng(1);
+    std::vector<Bounds3f> boxes;
+    boxes.reserve(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        const Point3f p(rng.UniformFloatInRange(-100, 100), rng.UniformFloatInRange(-100, 100),
+                        rng.UniformFloatInRange(-100, 100));
+        boxes.emplace_back(p, p + Vector3f(0.5f, 0.5f, 0.5f));
+    }
+    return boxes;
+}
+
+std::vector<Vector3f> RandomSteps(size_t count)
+{
+    Math::RNG rng(2);
+    std::vector<Vector3f> steps;
+    steps.reserve(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        steps.emplace_back(rng.UniformFloatInRange(-0.05f, 0.05f),
+                           rng.UniformFloatInRange(-0.05f, 0.05f),
+                           rng.UniformFloatInRange(-0.05f, 0.05f));
+    }
+    return steps;
+}
+
+// Every object moves by a small amount per frame, the common case for a dynamic scene.
+void BM_LooseOctreeMove(benchmark::State& state)
+{
+    std::vector<Bounds3f> boxes = RandomBoxes(static_cast<size_t>(state.range(0)));
+    const std::vector<Vector3f> steps = RandomSteps(boxes.size());
+    Math::LooseOctree<float> tree(k_world);
+    std::vector<Math::LooseTreeHandle> handles;
+    for (const Bounds3f& box : boxes)
+    {
+        handles.push_back(tree.Insert(box));
+    }
+    float direction = 1;
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < boxes.size(); ++i)
+        {
+            boxes[i] = Bounds3f(boxes[i].min + steps[i] * direction,
+                                boxes[i].max + steps[i] * direction);
+            tree.Move(handles[i], boxes[i]);
+        }
+        direction = -direction;
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * boxes.size()));
+}
+
+// The same workload as BM_LooseOctreeMove but rebuilding a linear BVH every frame.
+void BM_LinearBVHRebuildMove(benchmark::State& state)
+{
+    std::vector<Bounds3f> boxes = RandomBoxes(static_cast<size_t>(state.range(0)));
+    const std::vector<Vector3f> steps = RandomSteps(boxes.size());
+    Math::LinearBVH<float> bvh;
+    float direction = 1;
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < boxes.size(); ++i)
+        {
+            boxes[i] = Bounds3f(boxes[i].min + steps[i] * direction,
+                                boxes[i].max + steps[i] * direction);
+        }
+        Math::Build<float>(boxes, bvh);
+        benchmark::DoNotOptimize(bvh.nodes.data());
+        direction = -direction;
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * boxes.size()));
+}
+
+void BM_LooseOctreeInsertRemove(benchmark::State& state)
+{
+    const std::vector<Bounds3f> boxes = RandomBoxes(static_cast<size_t>(state.range(0)));
+    Math::LooseOctree<float> tree(k_world);
+    std::vector<Math::LooseTreeHandle> handles(boxes.size());
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < boxes.size(); ++i)
+        {
+            handles[i] = tree.Insert(boxes[i]);
+        }
+        for (const Math::LooseTreeHandle handle : handles)
+        {
+            tree.Remove(handle);
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * boxes.size()));
+}
+
+void BM_LooseOctreeFrustum(benchmark::State& state)
+{
+    const std::vector<Bounds3f> boxes = RandomBoxes(static_cast<size_t>(state.range(0)));
+    Math::LooseOctree<float> tree(k_world);
+    for (const Bounds3f& box : boxes)
+    {
+        tree.Insert(box);
+    }
+    const Math::Frustum<float> frustum =
+        Math::Frustum<float>::FromMatrix_N0(Math::Perspective_LH_N0(60.0f, 1.5f, 1.0f, 100.0f));
+    for (auto _ : state)
+    {
+        uint32_t count = 0;
+        tree.ForEachInFrustum(frustum, [&](Math::LooseTreeHandle) { ++count; });
+        benchmark::DoNotOptimize(count);
+    }
+}
+
+}  // namespace
+
+BENCHMARK(BM_LooseOctreeMove)->Arg(10'000)->Arg(100'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_LinearBVHRebuildMove)->Arg(10'000)->Arg(100'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_LooseOctreeInsertRemove)->Arg(10'000)->Arg(100'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_LooseOctreeFrustum)->Arg(10'000)->Arg(100'000)->Unit(benchmark::kMicrosecond);
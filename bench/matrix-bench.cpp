@@ -0,0 +1,83 @@
+#include <benchmark/benchmark.h>
+
+#include "math/math.h"
+
+namespace
+{
+
+template <typename T, int N>
+Math::Matrix<T, N, N> MakeMatrix()
+{
+    // Diagonally dominant so that the matrix can be inverted.
+    Math::Matrix<T, N, N> m;
+    for (int32_t i = 0; i < N; ++i)
+    {
+        for (int32_t j = 0; j < N; ++j)
+        {
+            m(i, j) = static_cast<T>(i == j ? N + 1 : (i + 2 * j) % 3) / 4;
+        }
+    }
+    return m;
+}
+
+template <typename T, int N>
+void BM_Multiply(benchmark::State& state)
+{
+    Math::Matrix<T, N, N> m1 = MakeMatrix<T, N>();
+    const Math::Matrix<T, N, N> m2 = Math::Transpose(m1);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(m1);
+        benchmark::DoNotOptimize(m1 * m2);
+    }
+}
+
+template <typename T, int N>
+void BM_Transpose(benchmark::State& state)
+{
+    Math::Matrix<T, N, N> m = MakeMatrix<T, N>();
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(m);
+        benchmark::DoNotOptimize(Math::Transpose(m));
+    }
+}
+
+template <typename T, int N>
+void BM_Determinant(benchmark::State& state)
+{
+    Math::Matrix<T, N, N> m = MakeMatrix<T, N>();
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(m);
+        benchmark::DoNotOptimize(Math::Determinant(m));
+    }
+}
+
+template <typename T, int N>
+void BM_Inverse(benchmark::State& state)
+{
+    Math::Matrix<T, N, N> m = MakeMatrix<T, N>();
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(m);
+        benchmark::DoNotOptimize(Math::Inverse(m));
+    }
+}
+
+}  // namespace
+
+BENCHMARK(BM_Multiply<float, 2>);
+BENCHMARK(BM_Multiply<float, 3>);
+BENCHMARK(BM_Multiply<float, 4>);
+BENCHMARK(BM_Multiply<double, 4>);
+BENCHMARK(BM_Transpose<float, 2>);
+BENCHMARK(BM_Transpose<float, 3>);
+BENCHMARK(BM_Transpose<float, 4>);
+BENCHMARK(BM_Determinant<float, 2>);
+BENCHMARK(BM_Determinant<float, 3>);
+BENCHMARK(BM_Determinant<float, 4>);
+BENCHMARK(BM_Inverse<float, 2>);
+BENCHMARK(BM_Inverse<float, 3>);
+BENCHMARK(BM_Inverse<float, 4>);
+BENCHMARK(BM_Inverse<double, 4>);
@@ -0,0 +1,124 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <vector>
+
+#include "math/math.h"
+
+namespace
+{
+
+using Normal3f = Math::Normal3<float>;
+using Point2f = Math::Point2<float>;
+using Point3f = Math::Point3<float>;
+using Vector3f = Math::Vector3<float>;
+using Vector4f = Math::Vector4<float>;
+
+struct Mesh
+{
+    std::vector<uint32_t> indices;
+    std::vector<Point3f> positions;
+    std::vector<Point2f> uvs;
+};
+
+// A wavy square grid with about the given number of triangles.
+Mesh Grid(size_t triangle_count)
+{
+    const auto size = static_cast<uint32_t>(std::sqrt(static_cast<double>(triangle_count) / 2)) + 1;
+    Mesh mesh;
+    mesh.positions.reserve(size_t{size} * size);
+    mesh.uvs.reserve(size_t{size} * size);
+    for (uint32_t y = 0; y < size; ++y)
+    {
+        for (uint32_t x = 0; x < size; ++x)
+        {
+            const auto fx = static_cast<float>(x);
+            const auto fy = static_cast<float>(y);
+            mesh.positions.emplace_back(fx, fy, std::sin(0.1f * fx) * std::cos(0.1f * fy));
+            mesh.uvs.emplace_back(fx / static_cast<float>(size), fy / static_cast<float>(size));
+        }
+    }
+    mesh.indices.reserve(6 * size_t{size - 1} * (size - 1));
+    for (uint32_t y = 0; y + 1 < size; ++y)
+    {
+        for (uint32_t x = 0; x + 1 < size; ++x)
+        {
+            const uint32_t i = y * size + x;
+            mesh.indices.insert(mesh.indices.end(), {i, i + 1, i + size + 1});
+            mesh.indices.insert(mesh.indices.end(), {i, i + size + 1, i + size});
+        }
+    }
+    return mesh;
+}
+
+void BM_MeshBounds(benchmark::State& state)
+{
+    const Mesh mesh = Grid(static_cast<size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        const Math::Bounds3<float> bounds = Math::ComputeBounds<float>(mesh.positions);
+        benchmark::DoNotOptimize(bounds);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * mesh.indices.size() / 3));
+}
+
+void BM_MeshNormals(benchmark::State& state)
+{
+    const Mesh mesh = Grid(static_cast<size_t>(state.range(0)));
+    std::vector<Normal3f> normals(mesh.positions.size());
+    for (auto _ : state)
+    {
+        Math::ComputeNormals<float>(mesh.indices, mesh.positions, normals);
+        benchmark::DoNotOptimize(normals.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * mesh.indices.size() / 3));
+}
+
+// The usual hand written loop that adds the triangle normals to the vertices, single threaded.
+void BM_MeshNormalsScatter(benchmark::State& state)
+{
+    const Mesh mesh = Grid(static_cast<size_t>(state.range(0)));
+    std::vector<Vector3f> sums(mesh.positions.size());
+    std::vector<Normal3f> normals(mesh.positions.size());
+    for (auto _ : state)
+    {
+        std::fill(sums.begin(), sums.end(), Vector3f(0));
+        for (size_t i = 0; i < mesh.indices.size(); i += 3)
+        {
+            const Point3f& p0 = mesh.positions[mesh.indices[i]];
+            const Point3f& p1 = mesh.positions[mesh.indices[i + 1]];
+            const Point3f& p2 = mesh.positions[mesh.indices[i + 2]];
+            const Vector3f n = Math::Cross(p1 - p0, p2 - p0);
+            sums[mesh.indices[i]] += n;
+            sums[mesh.indices[i + 1]] += n;
+            sums[mesh.indices[i + 2]] += n;
+        }
+        for (size_t i = 0; i < sums.size(); ++i)
+        {
+            normals[i] = Normal3f(Math::Normalize(sums[i]));
+        }
+        benchmark::DoNotOptimize(normals.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * mesh.indices.size() / 3));
+}
+
+void BM_MeshTangents(benchmark::State& state)
+{
+    const Mesh mesh = Grid(static_cast<size_t>(state.range(0)));
+    std::vector<Normal3f> normals(mesh.positions.size());
+    Math::ComputeNormals<float>(mesh.indices, mesh.positions, normals);
+    std::vector<Vector4f> tangents(mesh.positions.size());
+    for (auto _ : state)
+    {
+        Math::ComputeTangents<float>(mesh.indices, mesh.positions, normals, mesh.uvs, tangents);
+        benchmark::DoNotOptimize(tangents.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * mesh.indices.size() / 3));
+}
+
+}  // namespace
+
+BENCHMARK(BM_MeshBounds)->Arg(100'000)->Arg(10'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_MeshNormals)->Arg(100'000)->Arg(10'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_MeshNormalsScatter)->Arg(100'000)->Arg(10'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_MeshTangents)->Arg(100'000)->Arg(10'000'000)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,120 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include "math/math.h"
+
+namespace
+{
+
+using Point3f = Math::Point3<float>;
+
+constexpr size_t k_point_count = 10'000'000;
+
+const std::vector<Point3f>& Points()
+{
+    static const std::vector<Point3f> points = []
+    {
+        Math::RNG rng(1);
+        std::vector<Point3f> result(k_point_count);
+        for (Point3f& p : result)
+        {
+            p = Point3f(rng.UniformFloat(), rng.UniformFloat(), rng.UniformFloat());
+        }
+        return result;
+    }();
+    return points;
+}
+
+const Math::Bounds3<float> k_unit_bounds(Point3f(0, 0, 0), Point3f(1, 1, 1));
+
+template <typename Code>
+void BM_EncodeMorton(benchmark::State& state)
+{
+    const std::vector<Point3f>& points = Points();
+    std::vector<Code> codes(points.size());
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < points.size(); ++i)
+        {
+            codes[i] = Math::EncodeMorton<Code>(k_unit_bounds, points[i]);
+        }
+        benchmark::DoNotOptimize(codes.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * points.size()));
+}
+
+template <typename Code>
+void BM_EncodeHilbert(benchmark::State& state)
+{
+    const std::vector<Point3f>& points = Points();
+    std::vector<Code> codes(points.size());
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < points.size(); ++i)
+        {
+            codes[i] = Math::EncodeHilbert<Code>(k_unit_bounds, points[i]);
+        }
+        benchmark::DoNotOptimize(codes.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * points.size()));
+}
+
+std::vector<uint32_t> MortonCodes()
+{
+    const std::vector<Point3f>& points = Points();
+    std::vector<uint32_t> codes(points.size());
+    for (size_t i = 0; i < points.size(); ++i)
+    {
+        codes[i] = Math::EncodeMorton<uint32_t>(k_unit_bounds, points[i]);
+    }
+    return codes;
+}
+
+void BM_RadixSort(benchmark::State& state)
+{
+    Math::SetThreadCount(static_cast<uint32_t>(state.range(0)));
+    const std::vector<uint32_t> codes = MortonCodes();
+    std::vector<uint32_t> keys(codes.size());
+    std::vector<uint32_t> values(codes.size());
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        keys = codes;
+        std::iota(values.begin(), values.end(), 0u);
+        state.ResumeTiming();
+        Math::RadixSort<uint32_t, uint32_t>(keys, values);
+        benchmark::DoNotOptimize(values.data());
+    }
+    Math::SetThreadCount(0);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * codes.size()));
+}
+
+void BM_StdSort(benchmark::State& state)
+{
+    const std::vector<uint32_t> codes = MortonCodes();
+    std::vector<uint32_t> values(codes.size());
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        std::iota(values.begin(), values.end(), 0u);
+        state.ResumeTiming();
+        std::sort(values.begin(), values.end(),
+                  [&](uint32_t a, uint32_t b) { return codes[a] < codes[b]; });
+        benchmark::DoNotOptimize(values.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * codes.size()));
+}
+
+}  // namespace
+
+BENCHMARK(BM_EncodeMorton<uint32_t>)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_EncodeMorton<uint64_t>)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_EncodeHilbert<uint32_t>)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_EncodeHilbert<uint64_t>)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_RadixSort)->Arg(1)->Arg(0)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_StdSort)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,131 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <vector>
+
+#include "math/math.h"
+
+namespace
+{
+
+using Normal3f = Math::Normal3<float>;
+
+constexpr size_t k_normal_count = 1'000'000;
+
+const std::vector<Normal3f>& Normals()
+{
+    static const std::vector<Normal3f> normals = []
+    {
+        Math::RNG rng(1);
+        std::vector<Normal3f> result(k_normal_count);
+        for (Normal3f& n : result)
+        {
+            const Math::Vector3<float> v =
+                Math::Normalize(Math::Vector3<float>(rng.UniformFloatInRange(-1, 1),
+                                                     rng.UniformFloatInRange(-1, 1),
+                                                     rng.UniformFloatInRange(-1, 1)));
+            n = Normal3f(v);
+        }
+        return result;
+    }();
+    return normals;
+}
+
+void BM_EncodeOctahedral32Scalar(benchmark::State& state)
+{
+    const std::vector<Normal3f>& normals = Normals();
+    std::vector<uint32_t> codes(normals.size());
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < normals.size(); ++i)
+        {
+            codes[i] = Math::EncodeOctahedral32(normals[i]);
+        }
+        benchmark::DoNotOptimize(codes.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * normals.size()));
+}
+
+void BM_EncodeOctahedral32(benchmark::State& state)
+{
+    const std::vector<Normal3f>& normals = Normals();
+    std::vector<uint32_t> codes(normals.size());
+    for (auto _ : state)
+    {
+        Math::EncodeOctahedral32<float>(normals, codes);
+        benchmark::DoNotOptimize(codes.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * normals.size()));
+}
+
+void BM_DecodeOctahedral32Scalar(benchmark::State& state)
+{
+    const std::vector<Normal3f>& normals = Normals();
+    std::vector<uint32_t> codes(normals.size());
+    Math::EncodeOctahedral32<float>(normals, codes);
+    std::vector<Normal3f> decoded(normals.size());
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < codes.size(); ++i)
+        {
+            decoded[i] = Math::DecodeOctahedral32<float>(codes[i]);
+        }
+        benchmark::DoNotOptimize(decoded.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * normals.size()));
+}
+
+void BM_DecodeOctahedral32(benchmark::State& state)
+{
+    const std::vector<Normal3f>& normals = Normals();
+    std::vector<uint32_t> codes(normals.size());
+    Math::EncodeOctahedral32<float>(normals, codes);
+    std::vector<Normal3f> decoded(normals.size());
+    for (auto _ : state)
+    {
+        Math::DecodeOctahedral32<float>(codes, decoded);
+        benchmark::DoNotOptimize(decoded.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * normals.size()));
+}
+
+void BM_EncodeSnorm10(benchmark::State& state)
+{
+    const std::vector<Normal3f>& normals = Normals();
+    std::vector<uint32_t> codes(normals.size());
+    for (auto _ : state)
+    {
+        Math::EncodeSnorm10<float>(normals, codes);
+        benchmark::DoNotOptimize(codes.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * normals.size()));
+}
+
+void BM_DecodeSnorm10(benchmark::State& state)
+{
+    const std::vector<Normal3f>& normals = Normals();
+    std::vector<uint32_t> codes(normals.size());
+    Math::EncodeSnorm10<float>(normals, codes);
+    std::vector<Normal3f> decoded(normals.size());
+    for (auto _ : state)
+    {
+        Math::DecodeSnorm10<float>(codes, decoded);
+        benchmark::DoNotOptimize(decoded.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * normals.size()));
+}
+
+}  // namespace
+
+BENCHMARK(BM_EncodeOctahedral32Scalar)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_EncodeOctahedral32)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_DecodeOctahedral32Scalar)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_DecodeOctahedral32)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_EncodeSnorm10)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_DecodeSnorm10)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,144 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "math/math.h"
+
+namespace
+{
+
+using OrientedBounds3f = Math::OrientedBounds3<float>;
+using Point3f = Math::Point3<float>;
+using Vector3f = Math::Vector3<float>;
+
+constexpr size_t k_box_count = 100'000;
+
+// Long boxes at random angles, the case where axis aligned boxes bound poorly.
+const std::vector<OrientedBounds3f>& Boxes()
+{
+    static const std::vector<OrientedBounds3f> boxes = []
+    {
+        Math::RNG rng(1);
+        std::vector<OrientedBounds3f> result;
+        for (size_t i = 0; i < k_box_count; ++i)
+        {
+            const Point3f center(rng.UniformFloatInRange(-100, 100),
+                                 rng.UniformFloatInRange(-100, 100),
+                                 rng.UniformFloatInRange(-100, 100));
+            const Math::Matrix4x4<float> m =
+                Math::Translate(center) *
+                Math::Rotate(rng.UniformFloatInRange(0, 360),
+                             Math::Normalize(Vector3f(rng.UniformFloatInRange(-1, 1),
+                                                      rng.UniformFloatInRange(-1, 1), 1)));
+            result.push_back(OrientedBounds3f::FromBounds(
+                Math::Bounds3<float>(Point3f(-4, -0.2f, -0.2f), Point3f(4, 0.2f, 0.2f)), m));
+        }
+        return result;
+    }();
+    return boxes;
+}
+
+const OrientedBounds3f k_query(Point3f(0, 0, 0),
+                               Vector3f(30, 2, 2),
+                               Math::Matrix3x3<float>(0.8f, -0.6f, 0, 0.6f, 0.8f, 0, 0, 0, 1));
+
+const Math::Frustum<float>& CullFrustum()
+{
+    static const Math::Frustum<float> f = Math::Frustum<float>::FromMatrix_N0(
+        Math::Perspective_LH_N0(60.0f, 1.0f, 1.0f, 150.0f) *
+        Math::LookAt_LH(Point3f(0, 0, -120), Point3f(30, 0, 0), Vector3f(0, 1, 0)));
+    return f;
+}
+
+const Math::Ray<float> k_ray(Point3f(-150, 1, 2), Vector3f(1, 0.01f, 0.02f));
+
+void BM_OrientedOverlapsScalar(benchmark::State& state)
+{
+    const std::vector<OrientedBounds3f>& boxes = Boxes();
+    for (auto _ : state)
+    {
+        size_t count = 0;
+        for (const OrientedBounds3f& b : boxes)
+        {
+            count += Math::Overlaps(k_query, b) ? 1 : 0;
+        }
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * k_box_count));
+}
+
+void BM_OrientedOverlapsBatch(benchmark::State& state)
+{
+    const std::vector<OrientedBounds3f>& boxes = Boxes();
+    std::vector<uint64_t> mask((k_box_count + 63) / 64);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(Math::Overlaps<float>(k_query, boxes, mask));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * k_box_count));
+}
+
+void BM_OrientedFrustumScalar(benchmark::State& state)
+{
+    const std::vector<OrientedBounds3f>& boxes = Boxes();
+    const Math::Frustum<float>& f = CullFrustum();
+    for (auto _ : state)
+    {
+        size_t count = 0;
+        for (const OrientedBounds3f& b : boxes)
+        {
+            count += Math::Overlaps(f, b) ? 1 : 0;
+        }
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * k_box_count));
+}
+
+void BM_OrientedFrustumBatch(benchmark::State& state)
+{
+    const std::vector<OrientedBounds3f>& boxes = Boxes();
+    const Math::Frustum<float>& f = CullFrustum();
+    std::vector<uint64_t> mask((k_box_count + 63) / 64);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(Math::Overlaps<float>(f, boxes, mask));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * k_box_count));
+}
+
+void BM_OrientedRayScalar(benchmark::State& state)
+{
+    const std::vector<OrientedBounds3f>& boxes = Boxes();
+    for (auto _ : state)
+    {
+        size_t count = 0;
+        for (const OrientedBounds3f& b : boxes)
+        {
+            float t0;
+            float t1;
+            count += Math::Intersect(k_ray, b, 1000.0f, t0, t1) ? 1 : 0;
+        }
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * k_box_count));
+}
+
+void BM_OrientedRayBatch(benchmark::State& state)
+{
+    const std::vector<OrientedBounds3f>& boxes = Boxes();
+    std::vector<uint64_t> mask((k_box_count + 63) / 64);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(Math::Intersect<float>(k_ray, boxes, 1000.0f, mask));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * k_box_count));
+}
+
+}  // namespace
+
+BENCHMARK(BM_OrientedOverlapsScalar);
+BENCHMARK(BM_OrientedOverlapsBatch);
+BENCHMARK(BM_OrientedFrustumScalar);
+BENCHMARK(BM_OrientedFrustumBatch);
+BENCHMARK(BM_OrientedRayScalar);
+BENCHMARK(BM_OrientedRayBatch);
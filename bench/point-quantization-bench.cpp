@@ -0,0 +1,161 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "math/math.h"
+
+namespace
+{
+
+using Point3f = Math::Point3<float>;
+
+constexpr size_t k_point_count = 1'000'000;
+
+const Math::Bounds3<float> k_bounds(Point3f(-100, 0, 20), Point3f(100, 50, 30));
+
+const std::vector<Point3f>& Points()
+{
+    static const std::vector<Point3f> points = []
+    {
+        Math::RNG rng(1);
+        std::vector<Point3f> result(k_point_count);
+        for (Point3f& p : result)
+        {
+            p = Math::Lerp(k_bounds,
+                           Point3f(rng.UniformFloat(), rng.UniformFloat(), rng.UniformFloat()));
+        }
+        return result;
+    }();
+    return points;
+}
+
+void BM_QuantizePoint16Scalar(benchmark::State& state)
+{
+    const std::vector<Point3f>& points = Points();
+    std::vector<Math::Point3<uint16_t>> quantized(points.size());
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < points.size(); ++i)
+        {
+            quantized[i] = Math::QuantizePoint16(k_bounds, points[i]);
+        }
+        benchmark::DoNotOptimize(quantized.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * points.size()));
+}
+
+void BM_QuantizePoint16(benchmark::State& state)
+{
+    const std::vector<Point3f>& points = Points();
+    std::vector<Math::Point3<uint16_t>> quantized(points.size());
+    for (auto _ : state)
+    {
+        Math::QuantizePoint16<float>(k_bounds, points, quantized);
+        benchmark::DoNotOptimize(quantized.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * points.size()));
+}
+
+void BM_DequantizePoint16Scalar(benchmark::State& state)
+{
+    std::vector<Math::Point3<uint16_t>> quantized(Points().size());
+    Math::QuantizePoint16<float>(k_bounds, Points(), quantized);
+    std::vector<Point3f> points(quantized.size());
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < quantized.size(); ++i)
+        {
+            points[i] = Math::DequantizePoint16(k_bounds, quantized[i]);
+        }
+        benchmark::DoNotOptimize(points.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * points.size()));
+}
+
+void BM_DequantizePoint16(benchmark::State& state)
+{
+    std::vector<Math::Point3<uint16_t>> quantized(Points().size());
+    Math::QuantizePoint16<float>(k_bounds, Points(), quantized);
+    std::vector<Point3f> points(quantized.size());
+    for (auto _ : state)
+    {
+        Math::DequantizePoint16<float>(k_bounds, quantized, points);
+        benchmark::DoNotOptimize(points.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * points.size()));
+}
+
+void BM_QuantizePoint21Scalar(benchmark::State& state)
+{
+    const std::vector<Point3f>& points = Points();
+    std::vector<uint64_t> quantized(points.size());
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < points.size(); ++i)
+        {
+            quantized[i] = Math::QuantizePoint21(k_bounds, points[i]);
+        }
+        benchmark::DoNotOptimize(quantized.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * points.size()));
+}
+
+void BM_QuantizePoint21(benchmark::State& state)
+{
+    const std::vector<Point3f>& points = Points();
+    std::vector<uint64_t> quantized(points.size());
+    for (auto _ : state)
+    {
+        Math::QuantizePoint21<float>(k_bounds, points, quantized);
+        benchmark::DoNotOptimize(quantized.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * points.size()));
+}
+
+void BM_DequantizePoint21Scalar(benchmark::State& state)
+{
+    std::vector<uint64_t> quantized(Points().size());
+    Math::QuantizePoint21<float>(k_bounds, Points(), quantized);
+    std::vector<Point3f> points(quantized.size());
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < quantized.size(); ++i)
+        {
+            points[i] = Math::DequantizePoint21(k_bounds, quantized[i]);
+        }
+        benchmark::DoNotOptimize(points.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * points.size()));
+}
+
+void BM_DequantizePoint21(benchmark::State& state)
+{
+    std::vector<uint64_t> quantized(Points().size());
+    Math::QuantizePoint21<float>(k_bounds, Points(), quantized);
+    std::vector<Point3f> points(quantized.size());
+    for (auto _ : state)
+    {
+        Math::DequantizePoint21<float>(k_bounds, quantized, points);
+        benchmark::DoNotOptimize(points.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * points.size()));
+}
+
+}  // namespace
+
+BENCHMARK(BM_QuantizePoint16Scalar)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_QuantizePoint16)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_DequantizePoint16Scalar)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_DequantizePoint16)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_QuantizePoint21Scalar)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_QuantizePoint21)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_DequantizePoint21Scalar)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_DequantizePoint21)->Unit(benchmark::kMillisecond);
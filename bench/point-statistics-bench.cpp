@@ -0,0 +1,88 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "math/math.h"
+
+namespace
+{
+
+using Point3f = Math::Point3<float>;
+
+constexpr size_t k_point_count = 4'000'000;
+
+const std::vector<Point3f>& Points()
+{
+    static const std::vector<Point3f> points = []
+    {
+        Math::RNG rng(1);
+        std::vector<Point3f> result(k_point_count);
+        for (Point3f& p : result)
+        {
+            p = Point3f(rng.UniformFloatInRange(-100, 100), rng.UniformFloatInRange(-100, 100),
+                        rng.UniformFloatInRange(-100, 100));
+        }
+        return result;
+    }();
+    return points;
+}
+
+// Per point union and Welford update, as a loop over the points would be written without the
+// accumulator.
+void BM_PointStatisticsNaive(benchmark::State& state)
+{
+    const std::vector<Point3f>& points = Points();
+    for (auto _ : state)
+    {
+        Math::Bounds3<float> bounds = Math::Internal::InvertedBounds<float>();
+        Math::Vector3<double> mean(0, 0, 0);
+        double deviations[6] = {};
+        double count = 0;
+        for (const Point3f& p : points)
+        {
+            bounds = Math::Union(bounds, p);
+            count += 1;
+            const Math::Vector3<double> delta = Math::Vector3<double>(p.x, p.y, p.z) - mean;
+            mean += delta / count;
+            const Math::Vector3<double> d = Math::Vector3<double>(p.x, p.y, p.z) - mean;
+            deviations[0] += delta.x * d.x;
+            deviations[1] += delta.x * d.y;
+            deviations[2] += delta.x * d.z;
+            deviations[3] += delta.y * d.y;
+            deviations[4] += delta.y * d.z;
+            deviations[5] += delta.z * d.z;
+        }
+        benchmark::DoNotOptimize(bounds);
+        benchmark::DoNotOptimize(mean);
+        benchmark::DoNotOptimize(deviations);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * k_point_count));
+}
+
+void BM_PointStatisticsAdd(benchmark::State& state)
+{
+    const std::vector<Point3f>& points = Points();
+    for (auto _ : state)
+    {
+        Math::PointStatistics<float> statistics;
+        statistics.Add(points);
+        benchmark::DoNotOptimize(statistics);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * k_point_count));
+}
+
+void BM_PointStatisticsParallel(benchmark::State& state)
+{
+    const std::vector<Point3f>& points = Points();
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(Math::ComputePointStatistics<float>(points));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * k_point_count));
+}
+
+}  // namespace
+
+BENCHMARK(BM_PointStatisticsNaive)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_PointStatisticsAdd)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_PointStatisticsParallel)->Unit(benchmark::kMillisecond)->UseRealTime();
@@ -0,0 +1,186 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "math/math.h"
+
+namespace
+{
+
+using Quatf = Math::Quaternion<float>;
+
+constexpr size_t k_count = 4096;
+
+struct BlendData
+{
+    std::vector<Quatf> q1;
+    std::vector<Quatf> q2;
+    std::vector<float> params;
+
+    std::vector<float> x1, y1, z1, w1;
+    std::vector<float> x2, y2, z2, w2;
+    std::vector<float> x, y, z, w;
+
+    BlendData()
+        : x1(k_count),
+          y1(k_count),
+          z1(k_count),
+          w1(k_count),
+          x2(k_count),
+          y2(k_count),
+          z2(k_count),
+          w2(k_count),
+          x(k_count),
+          y(k_count),
+          z(k_count),
+          w(k_count)
+    {
+        Math::RNG rng(1);
+        for (size_t i = 0; i < k_count; ++i)
+        {
+            const Math::Vector3<float> axis(rng.UniformFloatInRange(-1, 1),
+                                            rng.UniformFloatInRange(-1, 1),
+                                            rng.UniformFloatInRange(-1, 1));
+            const Quatf a = Quatf::FromAxisAngleDegrees(axis, rng.UniformFloatInRange(-180, 180));
+            // Keep the pairs in the same hemisphere since the scalar functions don't flip signs.
+            const Quatf b = a * Quatf::FromAxisAngleDegrees(axis, rng.UniformFloatInRange(0, 90));
+            q1.push_back(a);
+            q2.push_back(b);
+            params.push_back(rng.UniformFloat());
+            Q1().Set(i, a);
+            Q2().Set(i, b);
+        }
+    }
+
+    Math::QuaternionSoA<float> Q1() { return {x1, y1, z1, w1}; }
+    Math::QuaternionSoA<float> Q2() { return {x2, y2, z2, w2}; }
+    Math::QuaternionSoA<float> Result() { return {x, y, z, w}; }
+};
+
+void BM_SlerpScalar(benchmark::State& state)
+{
+    BlendData data;
+    std::vector<Quatf> result(k_count);
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < k_count; ++i)
+        {
+            result[i] = Math::Slerp(data.params[i], data.q1[i], data.q2[i]);
+        }
+        benchmark::DoNotOptimize(result.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * k_count));
+}
+
+void BM_SlerpBatch(benchmark::State& state)
+{
+    BlendData data;
+    for (auto _ : state)
+    {
+        Math::Slerp<float>(data.params, data.Q1(), data.Q2(), data.Result());
+        benchmark::DoNotOptimize(data.x.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * k_count));
+}
+
+void BM_LerpScalar(benchmark::State& state)
+{
+    BlendData data;
+    std::vector<Quatf> result(k_count);
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < k_count; ++i)
+        {
+            result[i] = Math::Lerp(data.params[i], data.q1[i], data.q2[i]);
+        }
+        benchmark::DoNotOptimize(result.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * k_count));
+}
+
+void BM_NlerpBatch(benchmark::State& state)
+{
+    BlendData data;
+    for (auto _ : state)
+    {
+        Math::Nlerp<float>(data.params, data.Q1(), data.Q2(), data.Result());
+        benchmark::DoNotOptimize(data.x.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * k_count));
+}
+
+template <typename T>
+void BM_MultiplyScalar(benchmark::State& state)
+{
+    BlendData data;
+    const std::vector<Math::Quaternion<T>> q1(data.q1.begin(), data.q1.end());
+    const std::vector<Math::Quaternion<T>> q2(data.q2.begin(), data.q2.end());
+    std::vector<Math::Quaternion<T>> result(k_count);
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < k_count; ++i)
+        {
+            result[i] = q1[i] * q2[i];
+        }
+        benchmark::DoNotOptimize(result.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * k_count));
+}
+
+void BM_MultiplyBatch(benchmark::State& state)
+{
+    BlendData data;
+    std::vector<Quatf> result(k_count);
+    for (auto _ : state)
+    {
+        Math::Multiply<float>(data.q1, data.q2, result);
+        benchmark::DoNotOptimize(result.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * k_count));
+}
+
+void BM_MultiplyBatchSoA(benchmark::State& state)
+{
+    BlendData data;
+    for (auto _ : state)
+    {
+        Math::Multiply<float>(data.Q1(), data.Q2(), data.Result());
+        benchmark::DoNotOptimize(data.x.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * k_count));
+}
+
+void BM_MultiplyChain(benchmark::State& state)
+{
+    // Latency bound, every product depends on the previous one.
+    BlendData data;
+    for (auto _ : state)
+    {
+        Quatf q = Quatf::Identity();
+        for (size_t i = 0; i < 64; ++i)
+        {
+            q *= data.q1[i];
+        }
+        benchmark::DoNotOptimize(q);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * 64));
+}
+
+}  // namespace
+
+BENCHMARK(BM_SlerpScalar);
+BENCHMARK(BM_SlerpBatch);
+BENCHMARK(BM_LerpScalar);
+BENCHMARK(BM_NlerpBatch);
+BENCHMARK(BM_MultiplyScalar<float>);
+BENCHMARK(BM_MultiplyScalar<double>);
+BENCHMARK(BM_MultiplyBatch);
+BENCHMARK(BM_MultiplyBatchSoA);
+BENCHMARK(BM_MultiplyChain);
@@ -0,0 +1,144 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "math/math.h"
+
+namespace
+{
+
+using Bounds3f = Math::Bounds3<float>;
+using Point3f = Math::Point3<float>;
+using Vector3f = Math::Vector3<float>;
+
+std::vector<Bounds3f> RandomBoxes(size_t count)
+{
+    Math::RNG rng(1);
+    std::vector<Bounds3f> boxes;
+    boxes.reserve(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        const Point3f p(rng.UniformFloatInRange(-10, 10), rng.UniformFloatInRange(-10, 10),
+                        rng.UniformFloatInRange(-10, 10));
+        boxes.emplace_back(p, p + Vector3f(1, 1, 1));
+    }
+    return boxes;
+}
+
+const Math::Ray<float> k_ray(Point3f(-20, -15, -12), Vector3f(1, 0.8f, 0.6f));
+
+void BM_RayBoundsFloat(benchmark::State& state)
+{
+    const std::vector<Bounds3f> boxes = RandomBoxes(4096);
+    const Vector3f inverse_direction(1 / k_ray.direction.x, 1 / k_ray.direction.y,
+                                     1 / k_ray.direction.z);
+    for (auto _ : state)
+    {
+        uint32_t hits = 0;
+        for (const Bounds3f& b : boxes)
+        {
+            hits += Math::Intersect(k_ray, inverse_direction, b, 100.0f) ? 1 : 0;
+        }
+        benchmark::DoNotOptimize(hits);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * 4096));
+}
+
+// The slab test evaluated in double precision, the usual fallback without error bounds.
+void BM_RayBoundsDouble(benchmark::State& state)
+{
+    const std::vector<Bounds3f> boxes = RandomBoxes(4096);
+    const Math::Ray<double> ray(
+        Math::Point3<double>(k_ray.origin.x, k_ray.origin.y, k_ray.origin.z),
+        Math::Vector3<double>(k_ray.direction.x, k_ray.direction.y, k_ray.direction.z));
+    const Math::Vector3<double> inverse_direction(1 / ray.direction.x, 1 / ray.direction.y,
+                                                  1 / ray.direction.z);
+    for (auto _ : state)
+    {
+        uint32_t hits = 0;
+        for (const Bounds3f& b : boxes)
+        {
+            const Math::Bounds3<double> bd(Math::Point3<double>(b.min.x, b.min.y, b.min.z),
+                                           Math::Point3<double>(b.max.x, b.max.y, b.max.z));
+            hits += Math::Intersect(ray, inverse_direction, bd, 100.0) ? 1 : 0;
+        }
+        benchmark::DoNotOptimize(hits);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * 4096));
+}
+
+struct Triangles
+{
+    std::vector<float> coordinates[9];
+
+    Math::TriangleSoA<const float> View() const
+    {
+        return Math::TriangleSoA<const float>(coordinates[0], coordinates[1], coordinates[2],
+                                              coordinates[3], coordinates[4], coordinates[5],
+                                              coordinates[6], coordinates[7], coordinates[8]);
+    }
+};
+
+Triangles RandomTriangles(size_t count)
+{
+    Math::RNG rng(2);
+    Triangles triangles;
+    for (std::vector<float>& c : triangles.coordinates)
+    {
+        c.resize(count);
+    }
+    for (size_t i = 0; i < count; ++i)
+    {
+        const Point3f center(rng.UniformFloatInRange(-10, 10), rng.UniformFloatInRange(-10, 10),
+                             rng.UniformFloatInRange(-10, 10));
+        for (size_t c = 0; c < 9; ++c)
+        {
+            triangles.coordinates[c][i] =
+                center[static_cast<int32_t>(c % 3)] + rng.UniformFloatInRange(-1, 1);
+        }
+    }
+    return triangles;
+}
+
+void BM_RayTriangleScalar(benchmark::State& state)
+{
+    const Triangles triangles = RandomTriangles(4096);
+    const Math::TriangleSoA<const float> view = triangles.View();
+    for (auto _ : state)
+    {
+        float t_max = 100;
+        size_t index = 0;
+        Math::TriangleIntersection<float> hit{};
+        for (size_t i = 0; i < view.Size(); ++i)
+        {
+            if (Math::Intersect(k_ray, view.Get(i, 0), view.Get(i, 1), view.Get(i, 2), t_max, hit))
+            {
+                t_max = hit.t;
+                index = i;
+            }
+        }
+        benchmark::DoNotOptimize(index);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * 4096));
+}
+
+void BM_RayTriangleNearest(benchmark::State& state)
+{
+    const Triangles triangles = RandomTriangles(4096);
+    for (auto _ : state)
+    {
+        size_t index = 0;
+        Math::TriangleIntersection<float> hit{};
+        const bool found = Math::IntersectNearest(k_ray, triangles.View(), 100.0f, hit, index);
+        benchmark::DoNotOptimize(found);
+        benchmark::DoNotOptimize(index);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * 4096));
+}
+
+}  // namespace
+
+BENCHMARK(BM_RayBoundsFloat);
+BENCHMARK(BM_RayBoundsDouble);
+BENCHMARK(BM_RayTriangleScalar);
+BENCHMARK(BM_RayTriangleNearest);
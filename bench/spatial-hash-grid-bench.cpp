@@ -0,0 +1,100 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "math/math.h"
+
+namespace
+{
+
+using Point3f = Math::Point3<float>;
+
+constexpr float k_radius = 1.0f;
+constexpr size_t k_query_count = 1000;
+
+// Points with about 16 neighbours within k_radius on average.
+std::vector<Point3f> RandomPoints(size_t count)
+{
+    const float range = Math::Power(static_cast<float>(count) / 4.0f, 1.0f / 3.0f) / 2.0f;
+    Math::RNG rng(1);
+    std::vector<Point3f> points;
+    points.reserve(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        points.emplace_back(rng.UniformFloatInRange(-range, range),
+                            rng.UniformFloatInRange(-range, range),
+                            rng.UniformFloatInRange(-range, range));
+    }
+    return points;
+}
+
+void BM_GridBuild(benchmark::State& state)
+{
+    const std::vector<Point3f> points = RandomPoints(static_cast<size_t>(state.range(0)));
+    Math::SpatialHashGrid<float> grid(k_radius);
+    for (auto _ : state)
+    {
+        Math::Build<float>(points, grid);
+        benchmark::DoNotOptimize(grid.points.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * points.size()));
+}
+
+void BM_GridRadius(benchmark::State& state)
+{
+    const std::vector<Point3f> points = RandomPoints(static_cast<size_t>(state.range(0)));
+    Math::SpatialHashGrid<float> grid(k_radius);
+    Math::Build<float>(points, grid);
+    for (auto _ : state)
+    {
+        size_t found = 0;
+        for (size_t i = 0; i < k_query_count; ++i)
+        {
+            Math::ForEachInRadius(grid, points[i], k_radius, [&](uint32_t, float) { ++found; });
+        }
+        benchmark::DoNotOptimize(found);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * k_query_count));
+}
+
+void BM_BruteForceRadius(benchmark::State& state)
+{
+    const std::vector<Point3f> points = RandomPoints(static_cast<size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        size_t found = 0;
+        for (size_t i = 0; i < k_query_count; ++i)
+        {
+            for (const Point3f& p : points)
+            {
+                found += Math::DistanceSquared(p, points[i]) <= k_radius * k_radius;
+            }
+        }
+        benchmark::DoNotOptimize(found);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * k_query_count));
+}
+
+void BM_GridNearest(benchmark::State& state)
+{
+    const std::vector<Point3f> points = RandomPoints(static_cast<size_t>(state.range(0)));
+    Math::SpatialHashGrid<float> grid(k_radius);
+    Math::Build<float>(points, grid);
+    std::vector<uint32_t> indices(8);
+    std::vector<float> distances(8);
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < k_query_count; ++i)
+        {
+            benchmark::DoNotOptimize(Math::FindNearest<float>(grid, points[i], indices, distances));
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * k_query_count));
+}
+
+}  // namespace
+
+BENCHMARK(BM_GridBuild)->Arg(100'000)->Arg(1'000'000)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_GridRadius)->Arg(10'000)->Arg(1'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_BruteForceRadius)->Arg(10'000)->Arg(1'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_GridNearest)->Arg(10'000)->Arg(1'000'000)->Unit(benchmark::kMillisecond);
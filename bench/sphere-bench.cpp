@@ -0,0 +1,171 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "math/math.h"
+
+namespace
+{
+
+using Point3f = Math::Point3<float>;
+using Sphere3f = Math::Sphere<float>;
+using Vector3f = Math::Vector3<float>;
+
+constexpr size_t k_sphere_count = 100'000;
+constexpr size_t k_point_count = 100'000;
+
+const std::vector<Sphere3f>& Spheres()
+{
+    static const std::vector<Sphere3f> spheres = []
+    {
+        Math::RNG rng(1);
+        std::vector<Sphere3f> result;
+        for (size_t i = 0; i < k_sphere_count; ++i)
+        {
+            result.emplace_back(Point3f(rng.UniformFloatInRange(-100, 100),
+                                        rng.UniformFloatInRange(-100, 100),
+                                        rng.UniformFloatInRange(-100, 100)),
+                                rng.UniformFloatInRange(0.5f, 4));
+        }
+        return result;
+    }();
+    return spheres;
+}
+
+const std::vector<Point3f>& Points()
+{
+    static const std::vector<Point3f> points = []
+    {
+        Math::RNG rng(2);
+        std::vector<Point3f> result(k_point_count);
+        for (Point3f& p : result)
+        {
+            p = Point3f(rng.UniformFloatInRange(-100, 100), rng.UniformFloatInRange(-20, 20),
+                        rng.UniformFloatInRange(-50, 50));
+        }
+        return result;
+    }();
+    return points;
+}
+
+const Sphere3f k_query(Point3f(10, 0, -5), 30);
+const Math::Bounds3<float> k_box(Point3f(-30, -10, -20), Point3f(20, 15, 25));
+
+const Math::Frustum<float>& CullFrustum()
+{
+    static const Math::Frustum<float> f = Math::Frustum<float>::FromMatrix_N0(
+        Math::Perspective_LH_N0(60.0f, 1.0f, 1.0f, 150.0f) *
+        Math::LookAt_LH(Point3f(0, 0, -120), Point3f(30, 0, 0), Vector3f(0, 1, 0)));
+    return f;
+}
+
+void BM_SphereFromPointsApproximate(benchmark::State& state)
+{
+    const std::vector<Point3f>& points = Points();
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(Sphere3f::FromPointsApproximate(points));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * k_point_count));
+}
+
+void BM_SphereFromPoints(benchmark::State& state)
+{
+    const std::vector<Point3f>& points = Points();
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(Sphere3f::FromPoints(points));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * k_point_count));
+}
+
+void BM_SphereOverlapsScalar(benchmark::State& state)
+{
+    const std::vector<Sphere3f>& spheres = Spheres();
+    for (auto _ : state)
+    {
+        size_t count = 0;
+        for (const Sphere3f& s : spheres)
+        {
+            count += Math::Overlaps(k_query, s) ? 1 : 0;
+        }
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * k_sphere_count));
+}
+
+void BM_SphereOverlapsBatch(benchmark::State& state)
+{
+    const std::vector<Sphere3f>& spheres = Spheres();
+    std::vector<uint64_t> mask((k_sphere_count + 63) / 64);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(Math::Overlaps<float>(k_query, spheres, mask));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * k_sphere_count));
+}
+
+void BM_SphereBoundsScalar(benchmark::State& state)
+{
+    const std::vector<Sphere3f>& spheres = Spheres();
+    for (auto _ : state)
+    {
+        size_t count = 0;
+        for (const Sphere3f& s : spheres)
+        {
+            count += Math::Overlaps(k_box, s) ? 1 : 0;
+        }
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * k_sphere_count));
+}
+
+void BM_SphereBoundsBatch(benchmark::State& state)
+{
+    const std::vector<Sphere3f>& spheres = Spheres();
+    std::vector<uint64_t> mask((k_sphere_count + 63) / 64);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(Math::Overlaps<float>(k_box, spheres, mask));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * k_sphere_count));
+}
+
+void BM_SphereFrustumScalar(benchmark::State& state)
+{
+    const std::vector<Sphere3f>& spheres = Spheres();
+    const Math::Frustum<float>& f = CullFrustum();
+    for (auto _ : state)
+    {
+        size_t count = 0;
+        for (const Sphere3f& s : spheres)
+        {
+            count += Math::Overlaps(f, s) ? 1 : 0;
+        }
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * k_sphere_count));
+}
+
+void BM_SphereFrustumBatch(benchmark::State& state)
+{
+    const std::vector<Sphere3f>& spheres = Spheres();
+    const Math::Frustum<float>& f = CullFrustum();
+    std::vector<uint64_t> mask((k_sphere_count + 63) / 64);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(Math::Overlaps<float>(f, spheres, mask));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * k_sphere_count));
+}
+
+}  // namespace
+
+BENCHMARK(BM_SphereFromPointsApproximate);
+BENCHMARK(BM_SphereFromPoints);
+BENCHMARK(BM_SphereOverlapsScalar);
+BENCHMARK(BM_SphereOverlapsBatch);
+BENCHMARK(BM_SphereBoundsScalar);
+BENCHMARK(BM_SphereBoundsBatch);
+BENCHMARK(BM_SphereFrustumScalar);
+BENCHMARK(BM_SphereFrustumBatch);
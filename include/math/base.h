@@ -1,8 +1,12 @@
 #pragma once
 
+#include <bit>
 #include <cmath>
+#include <concepts>
 #include <cstdint>
 #include <cassert>
+#include <limits>
+#include <type_traits>
 
 #include "constants.h"
 
@@ -19,6 +23,10 @@ inline constexpr bool k_is_floating_point_value<double> = true;
 template <typename T>
 concept FloatingPoint = k_is_floating_point_value<T>;
 
+// Number types other than float and double, such as Fixed, replace <cmath> in Sqrt, Sin, Cos, Tan,
+// ArcCos, ArcTan2, Floor, Ceil, Round and IsFinite with a static member function of the same name.
+// SumOfSquares can be replaced the same way by types whose products overflow.
+
 /**
  * @brief Returns the absolute value of the given value.
  * @tparam T Value type.
@@ -26,7 +34,7 @@ concept FloatingPoint = k_is_floating_point_value<T>;
  * @return The absolute value of the given value.
  */
 template <typename T>
-T Abs(T value);
+constexpr T Abs(T value);
 
 /**
  * @brief Checks if the given values are equal within the given epsilon.
@@ -37,7 +45,7 @@ T Abs(T value);
  * @return True if the values are equal within the given epsilon, false otherwise.
  */
 template <typename T>
-bool IsEqual(T a, T b, T epsilon);
+constexpr bool IsEqual(T a, T b, T epsilon);
 
 /**
  * @brief Returns the minimum of the given values.
@@ -47,7 +55,7 @@ bool IsEqual(T a, T b, T epsilon);
  * @return Returns the minimum of the given values.
  */
 template <typename T>
-T Min(T A, T B);
+constexpr T Min(T A, T B);
 
 /**
  * @brief Returns the maximum of the given values.
@@ -57,7 +65,7 @@ T Min(T A, T B);
  * @return Returns the maximum of the given values.
  */
 template <typename T>
-T Max(T A, T B);
+constexpr T Max(T A, T B);
 
 /**
  * Checks if the given value is NaN.
@@ -66,7 +74,7 @@ T Max(T A, T B);
  * @return True if the given value is NaN, false otherwise.
  */
 template <typename T>
-bool IsNaN(T value);
+constexpr bool IsNaN(T value);
 
 /**
  * @brief Checks if the given value is finite.
@@ -75,7 +83,7 @@ bool IsNaN(T value);
  * @return True if the given value is finite, false otherwise.
  */
 template <typename T>
-bool IsFinite(T value);
+constexpr bool IsFinite(T value);
 
 /**
  * @brief Converts the given degrees to radians.
@@ -84,7 +92,7 @@ bool IsFinite(T value);
  * @return The given degrees in radians.
  */
 template <FloatingPoint T>
-T Radians(T degrees);
+constexpr T Radians(T degrees);
 
 /**
  * @brief Converts the given radians to degrees.
@@ -93,7 +101,7 @@ T Radians(T degrees);
  * @return The given radians in degrees.
  */
 template <FloatingPoint T>
-T Degrees(T radians);
+constexpr T Degrees(T radians);
 
 /**
  * Clamps the given value between the given low and high values.
@@ -104,7 +112,7 @@ T Degrees(T radians);
  * @return The clamped value.
  */
 template <typename T>
-T Clamp(T value, T low, T high);
+constexpr T Clamp(T value, T low, T high);
 
 /**
  * @brief Returns the remainder of A / B.
@@ -123,7 +131,18 @@ T Mod(T a, T b);
  * @return The square root of the given value.
  */
 template <FloatingPoint T>
-T Sqrt(T value);
+constexpr T Sqrt(T value);
+
+/**
+ * @brief Returns the sum of the squares of the given values as a double, the squared length of a
+ * vector with these components.
+ * @tparam T Value type.
+ * @param value The first value.
+ * @param rest The other values.
+ * @return The sum of the squares, computed in T and converted to double.
+ */
+template <typename T, std::same_as<T>... Rest>
+constexpr double SumOfSquares(T value, Rest... rest);
 
 /**
  * Returns the linear interpolation between the given values.
@@ -134,7 +153,7 @@ T Sqrt(T value);
  * @return The linear interpolation between the given values.
  */
 template <FloatingPoint T>
-T Lerp(T t, T p0, T p1);
+constexpr T Lerp(T t, T p0, T p1);
 
 /**
  * @brief Returns the rounded value.
@@ -144,7 +163,7 @@ T Lerp(T t, T p0, T p1);
  * done away from zero.
  */
 template <FloatingPoint T>
-T Round(T value);
+constexpr T Round(T value);
 
 /**
  * @brief Returns the floor of the given value.
@@ -153,7 +172,7 @@ T Round(T value);
  * @return The floor of the given value.
  */
 template <FloatingPoint T>
-T Floor(T value);
+constexpr T Floor(T value);
 
 /**
  * @brief Returns the ceil of the given value.
@@ -162,7 +181,7 @@ T Floor(T value);
  * @return The ceil of the given value.
  */
 template <FloatingPoint T>
-T Ceil(T value);
+constexpr T Ceil(T value);
 
 /**
  * @brief Returns the sine of the given value.
@@ -171,7 +190,7 @@ T Ceil(T value);
  * @return The sine of the given value.
  */
 template <FloatingPoint T>
-T Sin(T radians);
+constexpr T Sin(T radians);
 
 /**
  * @brief Returns the cosine of the given value.
@@ -180,7 +199,7 @@ T Sin(T radians);
  * @return The cosine of the given value.
  */
 template <FloatingPoint T>
-T Cos(T radians);
+constexpr T Cos(T radians);
 
 /**
  * @brief Returns the tangent of the given value.
@@ -189,7 +208,7 @@ T Cos(T radians);
  * @return The tangent of the given value.
  */
 template <FloatingPoint T>
-T Tan(T radians);
+constexpr T Tan(T radians);
 
 /**
  * @brief Returns the base raised to the exponent power.
@@ -222,48 +241,219 @@ T LogNatural(T value);
 template <FloatingPoint T>
 T Log2(T value);
 
+/**
+ * @brief Returns e raised to the power of the given value.
+ * @tparam T Value type. Must be a floating point type.
+ * @param value The exponent.
+ * @return e raised to the power of the given value.
+ */
+template <FloatingPoint T>
+T Exp(T value);
+
+/**
+ * @brief Returns the arc cosine of the given value.
+ * @tparam T Value type. Must be a floating point type.
+ * @param value The value to take the arc cosine of. Should be in range [-1, 1].
+ * @return The arc cosine of the given value in radians, in range [0, pi]. If value is outside of
+ * range [-1, 1] it returns NaN.
+ */
+template <FloatingPoint T>
+T ArcCos(T value);
+
+/**
+ * @brief Returns the angle between the positive x-axis and the point (x, y).
+ * @tparam T Value type. Must be a floating point type.
+ * @param y The y coordinate.
+ * @param x The x coordinate.
+ * @return The angle in radians, in range [-pi, pi].
+ */
+template <FloatingPoint T>
+T ArcTan2(T y, T x);
+
+/**
+ * @brief Returns the bound on the relative rounding error after n floating point operations.
+ * Based on: Physically Based Rendering, 3rd edition, section 3.9.1.
+ * @tparam T Value type. Must be a floating point type.
+ * @param n The number of operations.
+ * @return n * u / (1 - n * u) where u is half the machine epsilon. The result of n additions or
+ * multiplications is within a factor of 1 +- Gamma(n) of the exact result.
+ */
+template <FloatingPoint T>
+constexpr T Gamma(int32_t n);
+
+/**
+ * @brief Returns the next representable value greater than the given value.
+ * @tparam T Value type. Must be a floating point type.
+ * @param value The value.
+ * @return The next value towards positive infinity. Positive infinity and NaN are returned
+ * unchanged, -0 is treated as +0.
+ */
+template <FloatingPoint T>
+constexpr T NextFloatUp(T value);
+
+/**
+ * @brief Returns the next representable value less than the given value.
+ * @tparam T Value type. Must be a floating point type.
+ * @param value The value.
+ * @return The next value towards negative infinity. Negative infinity and NaN are returned
+ * unchanged, +0 is treated as -0.
+ */
+template <FloatingPoint T>
+constexpr T NextFloatDown(T value);
+
 }  // namespace Math
 
 // Implementation //////////////////////////////////////////////////////////////////////////////////
 
+namespace Math::Internal
+{
+
+// Fallbacks used when the functions from <cmath> are evaluated at compile time, since they are not
+// constexpr in C++20. They are evaluated in double precision and are not meant for runtime use.
+
+constexpr double ConstexprSqrt(double value)
+{
+    if (value != value || value < 0)
+    {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+    if (value == 0 || value == std::numeric_limits<double>::infinity())
+    {
+        return value;
+    }
+    // Newton-Raphson, stops once the estimate stops changing or starts oscillating.
+    double current = value >= 1 ? value : 1;
+    double previous = 0;
+    double before_previous = 0;
+    while (current != previous && current != before_previous)
+    {
+        before_previous = previous;
+        previous = current;
+        current = 0.5 * (current + value / current);
+    }
+    return current;
+}
+
+constexpr double ConstexprTrunc(double value)
+{
+    // Values this large (and NaNs and infinities) are already integers.
+    constexpr double k_two_pow_52 = 4503599627370496.0;
+    if (!(value > -k_two_pow_52 && value < k_two_pow_52))
+    {
+        return value;
+    }
+    return static_cast<double>(static_cast<int64_t>(value));
+}
+
+constexpr double ConstexprFloor(double value)
+{
+    const double truncated = ConstexprTrunc(value);
+    return truncated > value ? truncated - 1 : truncated;
+}
+
+constexpr double ConstexprCeil(double value)
+{
+    const double truncated = ConstexprTrunc(value);
+    return truncated < value ? truncated + 1 : truncated;
+}
+
+constexpr double ConstexprRound(double value)
+{
+    return value >= 0 ? ConstexprFloor(value + 0.5) : -ConstexprFloor(-value + 0.5);
+}
+
+constexpr double ConstexprSinCosSeries(double radians, bool is_sine)
+{
+    if (radians != radians || radians == std::numeric_limits<double>::infinity() ||
+        radians == -std::numeric_limits<double>::infinity())
+    {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+    // Reduce to [-pi, pi] and sum the Taylor series until the terms stop contributing.
+    constexpr double k_two_pi = 2 * k_pi_double;
+    const double x = radians - k_two_pi * ConstexprRound(radians / k_two_pi);
+    const double x_squared = x * x;
+    double term = is_sine ? x : 1;
+    double sum = term;
+    for (int n = is_sine ? 2 : 1; n < 128; n += 2)
+    {
+        term *= -x_squared / (n * (n + 1));
+        const double next_sum = sum + term;
+        if (next_sum == sum)
+        {
+            break;
+        }
+        sum = next_sum;
+    }
+    return sum;
+}
+
+constexpr double ConstexprSin(double radians)
+{
+    return ConstexprSinCosSeries(radians, true);
+}
+
+constexpr double ConstexprCos(double radians)
+{
+    return ConstexprSinCosSeries(radians, false);
+}
+
+}  // namespace Math::Internal
+
 template <typename T>
-T Math::Abs(T value)
+constexpr T Math::Abs(T value)
 {
     return value >= 0 ? value : -value;
 }
 
 template <typename T>
-bool Math::IsEqual(T a, T b, T epsilon)
+constexpr bool Math::IsEqual(T a, T b, T epsilon)
 {
     return Abs(a - b) <= epsilon;
 }
 
 template <typename T>
-T Math::Min(T A, T B)
+constexpr T Math::Min(T A, T B)
 {
     return A < B ? A : B;
 }
 
 template <typename T>
-T Math::Max(T A, T B)
+constexpr T Math::Max(T A, T B)
 {
     return A > B ? A : B;
 }
 
 template <typename T>
-bool Math::IsNaN(T value)
+constexpr bool Math::IsNaN(T value)
 {
     return value != value;
 }
 
 template <typename T>
-bool Math::IsFinite(T value)
+constexpr bool Math::IsFinite(T value)
 {
-    return std::isfinite(value);
+    if constexpr (requires { T::IsFinite(value); })
+    {
+        return T::IsFinite(value);
+    }
+    else
+    {
+        if (std::is_constant_evaluated())
+        {
+            if constexpr (std::is_floating_point_v<T>)
+            {
+                return !IsNaN(value) && value != std::numeric_limits<T>::infinity() &&
+                       value != -std::numeric_limits<T>::infinity();
+            }
+            return true;
+        }
+        return std::isfinite(value);
+    }
 }
 
 template <Math::FloatingPoint T>
-T Math::Radians(T degrees)
+constexpr T Math::Radians(T degrees)
 {
     constexpr T k_half_circle_degrees = static_cast<T>(180.0);
     constexpr T k_pi = static_cast<T>(k_pi_double);
@@ -271,7 +461,7 @@ T Math::Radians(T degrees)
 }
 
 template <Math::FloatingPoint T>
-T Math::Degrees(T radians)
+constexpr T Math::Degrees(T radians)
 {
     constexpr T k_half_circle_degrees = static_cast<T>(180.0);
     constexpr T k_pi = static_cast<T>(k_pi_double);
@@ -279,7 +469,7 @@ T Math::Degrees(T radians)
 }
 
 template <typename T>
-T Math::Clamp(T value, T low, T high)
+constexpr T Math::Clamp(T value, T low, T high)
 {
     return Min(Max(value, low), high);
 }
@@ -302,51 +492,142 @@ T Math::Mod(T a, T b)
 }
 
 template <Math::FloatingPoint T>
-T Math::Sqrt(T value)
+constexpr T Math::Sqrt(T value)
 {
-    return std::sqrt(value);
+    if constexpr (requires { T::Sqrt(value); })
+    {
+        return T::Sqrt(value);
+    }
+    else
+    {
+        if (std::is_constant_evaluated())
+        {
+            return static_cast<T>(Internal::ConstexprSqrt(static_cast<double>(value)));
+        }
+        return std::sqrt(value);
+    }
+}
+
+template <typename T, std::same_as<T>... Rest>
+constexpr double Math::SumOfSquares(T value, Rest... rest)
+{
+    if constexpr (requires { T::SumOfSquares(value, rest...); })
+    {
+        return T::SumOfSquares(value, rest...);
+    }
+    else
+    {
+        return static_cast<double>(static_cast<T>(((value * value) + ... + (rest * rest))));
+    }
 }
 
 template <Math::FloatingPoint T>
-T Math::Lerp(T t, T p0, T p1)
+constexpr T Math::Lerp(T t, T p0, T p1)
 {
     return (1 - t) * p0 + t * p1;
 }
 
 template <Math::FloatingPoint T>
-T Math::Round(T value)
+constexpr T Math::Round(T value)
 {
-    return std::round(value);
+    if constexpr (requires { T::Round(value); })
+    {
+        return T::Round(value);
+    }
+    else
+    {
+        if (std::is_constant_evaluated())
+        {
+            return static_cast<T>(Internal::ConstexprRound(static_cast<double>(value)));
+        }
+        return std::round(value);
+    }
 }
 
 template <Math::FloatingPoint T>
-T Math::Floor(T value)
+constexpr T Math::Floor(T value)
 {
-    return std::floor(value);
+    if constexpr (requires { T::Floor(value); })
+    {
+        return T::Floor(value);
+    }
+    else
+    {
+        if (std::is_constant_evaluated())
+        {
+            return static_cast<T>(Internal::ConstexprFloor(static_cast<double>(value)));
+        }
+        return std::floor(value);
+    }
 }
 
 template <Math::FloatingPoint T>
-T Math::Ceil(T value)
+constexpr T Math::Ceil(T value)
 {
-    return std::ceil(value);
+    if constexpr (requires { T::Ceil(value); })
+    {
+        return T::Ceil(value);
+    }
+    else
+    {
+        if (std::is_constant_evaluated())
+        {
+            return static_cast<T>(Internal::ConstexprCeil(static_cast<double>(value)));
+        }
+        return std::ceil(value);
+    }
 }
 
 template <Math::FloatingPoint T>
-T Math::Sin(T radians)
+constexpr T Math::Sin(T radians)
 {
-    return std::sin(radians);
+    if constexpr (requires { T::Sin(radians); })
+    {
+        return T::Sin(radians);
+    }
+    else
+    {
+        if (std::is_constant_evaluated())
+        {
+            return static_cast<T>(Internal::ConstexprSin(static_cast<double>(radians)));
+        }
+        return std::sin(radians);
+    }
 }
 
 template <Math::FloatingPoint T>
-T Math::Cos(T radians)
+constexpr T Math::Cos(T radians)
 {
-    return std::cos(radians);
+    if constexpr (requires { T::Cos(radians); })
+    {
+        return T::Cos(radians);
+    }
+    else
+    {
+        if (std::is_constant_evaluated())
+        {
+            return static_cast<T>(Internal::ConstexprCos(static_cast<double>(radians)));
+        }
+        return std::cos(radians);
+    }
 }
 
 template <Math::FloatingPoint T>
-T Math::Tan(T radians)
+constexpr T Math::Tan(T radians)
 {
-    return std::tan(radians);
+    if constexpr (requires { T::Tan(radians); })
+    {
+        return T::Tan(radians);
+    }
+    else
+    {
+        if (std::is_constant_evaluated())
+        {
+            const double value = static_cast<double>(radians);
+            return static_cast<T>(Internal::ConstexprSin(value) / Internal::ConstexprCos(value));
+        }
+        return std::tan(radians);
+    }
 }
 
 template <Math::FloatingPoint T>
@@ -368,3 +649,67 @@ T Math::Log2(T value)
         static_cast<T>(1.4426950408889634073599246810018921374266459541529859341354494069);
     return std::log(value) * k_inv_log2;
 }
+
+template <Math::FloatingPoint T>
+T Math::Exp(T value)
+{
+    return std::exp(value);
+}
+
+template <Math::FloatingPoint T>
+T Math::ArcCos(T value)
+{
+    if constexpr (requires { T::ArcCos(value); })
+    {
+        return T::ArcCos(value);
+    }
+    else
+    {
+        return std::acos(value);
+    }
+}
+
+template <Math::FloatingPoint T>
+T Math::ArcTan2(T y, T x)
+{
+    if constexpr (requires { T::ArcTan2(y, x); })
+    {
+        return T::ArcTan2(y, x);
+    }
+    else
+    {
+        return std::atan2(y, x);
+    }
+}
+
+template <Math::FloatingPoint T>
+constexpr T Math::Gamma(int32_t n)
+{
+    constexpr T k_unit_roundoff = std::numeric_limits<T>::epsilon() / 2;
+    return (static_cast<T>(n) * k_unit_roundoff) / (1 - static_cast<T>(n) * k_unit_roundoff);
+}
+
+template <Math::FloatingPoint T>
+constexpr T Math::NextFloatUp(T value)
+{
+    using Bits = std::conditional_t<sizeof(T) == 2, uint16_t,
+                                    std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>>;
+    if (IsNaN(value) || value == std::numeric_limits<T>::infinity())
+    {
+        return value;
+    }
+    if (value == 0)
+    {
+        value = 0;
+    }
+    // Adjacent values of the same sign have adjacent bit patterns, ordered by magnitude.
+    const Bits bits = std::bit_cast<Bits>(value);
+    return std::bit_cast<T>(value > 0 || bits == 0 ? static_cast<Bits>(bits + 1)
+                                                   : static_cast<Bits>(bits - 1));
+}
+
+template <Math::FloatingPoint T>
+constexpr T Math::NextFloatDown(T value)
+{
+    return -NextFloatUp(-value);
+}
@@ -0,0 +1,286 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string_view>
+#include <type_traits>
+
+#include "math/bounds3.h"
+#include "math/export.h"
+#include "math/matrix4x4.h"
+#include "math/normal3.h"
+#include "math/point3.h"
+#include "math/vector3.h"
+
+namespace Math
+{
+
+/**
+ * Type of the elements of an array in a binary file. The values are stored in the files and never
+ * change.
+ */
+enum class BinaryType : uint32_t
+{
+    Unknown = 0,
+    Float = 1,
+    Double = 2,
+    UInt32 = 3,
+    UInt64 = 4,
+    Vector3f = 16,
+    Vector3d = 17,
+    Point3f = 18,
+    Point3d = 19,
+    Normal3f = 20,
+    Normal3d = 21,
+    Bounds3f = 22,
+    Bounds3d = 23,
+    Matrix4x4f = 24,
+    Matrix4x4d = 25,
+    BVHHeader = 32,
+    BVHNodef = 33,
+    BVHNoded = 34,
+    // Values from here on are free for the types of the application, see k_binary_type.
+    User = 0x10000,
+};
+
+/**
+ * The BinaryType of an element type. Specialize it to store other trivially copyable types.
+ */
+template <typename T>
+inline constexpr BinaryType k_binary_type = BinaryType::Unknown;
+template <>
+inline constexpr BinaryType k_binary_type<float> = BinaryType::Float;
+template <>
+inline constexpr BinaryType k_binary_type<double> = BinaryType::Double;
+template <>
+inline constexpr BinaryType k_binary_type<uint32_t> = BinaryType::UInt32;
+template <>
+inline constexpr BinaryType k_binary_type<uint64_t> = BinaryType::UInt64;
+template <>
+inline constexpr BinaryType k_binary_type<Vector3<float>> = BinaryType::Vector3f;
+template <>
+inline constexpr BinaryType k_binary_type<Vector3<double>> = BinaryType::Vector3d;
+template <>
+inline constexpr BinaryType k_binary_type<Point3<float>> = BinaryType::Point3f;
+template <>
+inline constexpr BinaryType k_binary_type<Point3<double>> = BinaryType::Point3d;
+template <>
+inline constexpr BinaryType k_binary_type<Normal3<float>> = BinaryType::Normal3f;
+template <>
+inline constexpr BinaryType k_binary_type<Normal3<double>> = BinaryType::Normal3d;
+template <>
+inline constexpr BinaryType k_binary_type<Bounds3<float>> = BinaryType::Bounds3f;
+template <>
+inline constexpr BinaryType k_binary_type<Bounds3<double>> = BinaryType::Bounds3d;
+template <>
+inline constexpr BinaryType k_binary_type<Matrix4x4<float>> = BinaryType::Matrix4x4f;
+template <>
+inline constexpr BinaryType k_binary_type<Matrix4x4<double>> = BinaryType::Matrix4x4d;
+
+template <typename T>
+concept BinaryElement =
+    std::is_trivially_copyable_v<T> && k_binary_type<T> != BinaryType::Unknown;
+
+/** The data of every array starts at a multiple of this offset in the file. */
+inline constexpr size_t k_binary_file_alignment = 64;
+
+/**
+ * Description of an array in a binary file, as stored in the directory at the end of the file.
+ */
+struct BinaryArrayInfo
+{
+    static constexpr size_t k_max_name_length = 39;
+
+    BinaryType type;
+    uint32_t element_size;
+    uint64_t count;
+    /** Offset of the first element from the start of the file. */
+    uint64_t offset;
+    /** Null terminated. */
+    char name[k_max_name_length + 1];
+};
+static_assert(sizeof(BinaryArrayInfo) == 64);
+
+/**
+ * Writes arrays to a binary file that MappedBinaryFile maps into memory. The file starts with a
+ * header with the format version and the endianness, followed by the data of every array aligned
+ * to k_binary_file_alignment, followed by a directory with the name, type, element size, count and
+ * offset of every array. The elements are written as they are in memory, the files are only read
+ * on machines with the same endianness. Arrays are written whole or streamed in chunks, so the
+ * writer never holds more than a chunk. The header is written by Close, a file that was not closed
+ * does not open.
+ */
+class MATH_EXPORT BinaryFileWriter
+{
+public:
+    BinaryFileWriter();
+    ~BinaryFileWriter();
+    BinaryFileWriter(BinaryFileWriter&& other) noexcept;
+    BinaryFileWriter& operator=(BinaryFileWriter&& other) noexcept;
+    BinaryFileWriter(const BinaryFileWriter&) = delete;
+    BinaryFileWriter& operator=(const BinaryFileWriter&) = delete;
+
+    /**
+     * Create the file, replacing an existing one.
+     * @param path The path of the file.
+     * @return False if the file could not be created.
+     */
+    bool Open(const std::filesystem::path& path);
+
+    /**
+     * Write an array.
+     * @param name The name of the array, at most BinaryArrayInfo::k_max_name_length characters.
+     * @param elements The elements.
+     * @return False if the name is too long or writing failed.
+     */
+    template <BinaryElement T>
+    bool WriteArray(std::string_view name, std::span<const T> elements);
+
+    /**
+     * Start an array whose elements are added by AppendChunk, until EndArray.
+     * @param name The name of the array, at most BinaryArrayInfo::k_max_name_length characters.
+     * @return False if the name is too long, no array is started then, or if writing failed.
+     */
+    template <BinaryElement T>
+    bool BeginArray(std::string_view name);
+
+    /**
+     * Add elements to the array started by BeginArray.
+     * @param elements The elements, of the type given to BeginArray.
+     * @return False if writing failed.
+     */
+    template <BinaryElement T>
+    bool AppendChunk(std::span<const T> elements);
+
+    /**
+     * End the array started by BeginArray.
+     */
+    void EndArray();
+
+    /**
+     * Write the directory and the header and close the file.
+     * @return False if writing failed, at any point since Open.
+     */
+    bool Close();
+
+private:
+    bool BeginArray(BinaryType type, uint32_t element_size, std::string_view name);
+    bool AppendBytes(BinaryType type, const void* data, size_t size);
+
+    struct Impl;
+    Impl* m_impl;
+};
+
+/**
+ * Read only memory mapping of a file written by BinaryFileWriter. The arrays are returned as spans
+ * into the mapping, nothing is copied or parsed, the pages are loaded when they are first touched.
+ * Open checks the header and that every array is inside the file, so a truncated or corrupt file
+ * fails to open instead of being read out of bounds.
+ */
+class MATH_EXPORT MappedBinaryFile
+{
+public:
+    static constexpr size_t k_invalid_array = SIZE_MAX;
+
+    MappedBinaryFile();
+    ~MappedBinaryFile();
+    MappedBinaryFile(MappedBinaryFile&& other) noexcept;
+    MappedBinaryFile& operator=(MappedBinaryFile&& other) noexcept;
+    MappedBinaryFile(const MappedBinaryFile&) = delete;
+    MappedBinaryFile& operator=(const MappedBinaryFile&) = delete;
+
+    /**
+     * Map a file, closing the file mapped before.
+     * @param path The path of the file.
+     * @return False if the file could not be mapped, or is not a valid binary file of this version
+     * and endianness.
+     */
+    bool Open(const std::filesystem::path& path);
+
+    /**
+     * Unmap the file, the spans returned before are no longer valid.
+     */
+    void Close();
+
+    [[nodiscard]] bool IsOpen() const;
+
+    /**
+     * Get the number of arrays in the file.
+     * @return The number of arrays, 0 if no file is open.
+     */
+    [[nodiscard]] size_t ArrayCount() const;
+
+    /**
+     * Get the description of an array.
+     * @param index The index of the array, in the order they were written.
+     * @return The description.
+     */
+    [[nodiscard]] const BinaryArrayInfo& GetArrayInfo(size_t index) const;
+
+    /**
+     * Find an array by name.
+     * @param name The name of the array.
+     * @return The index of the first array with the name, k_invalid_array if there is none.
+     */
+    [[nodiscard]] size_t FindArray(std::string_view name) const;
+
+    /**
+     * Get the elements of an array.
+     * @param index The index of the array.
+     * @return The elements, valid until the file is closed. Empty if there is no array with the
+     * index or if it was not written with elements of type T.
+     */
+    template <BinaryElement T>
+    [[nodiscard]] std::span<const T> GetArray(size_t index) const;
+
+private:
+    [[nodiscard]] const std::byte* Data() const;
+
+    struct Impl;
+    Impl* m_impl;
+};
+
+}  // namespace Math
+
+// Implementation //////////////////////////////////////////////////////////////////////////////////
+
+template <Math::BinaryElement T>
+bool Math::BinaryFileWriter::WriteArray(std::string_view name, std::span<const T> elements)
+{
+    if (!BeginArray<T>(name) || !AppendChunk(elements))
+    {
+        return false;
+    }
+    EndArray();
+    return true;
+}
+
+template <Math::BinaryElement T>
+bool Math::BinaryFileWriter::BeginArray(std::string_view name)
+{
+    static_assert(alignof(T) <= k_binary_file_alignment);
+    return BeginArray(k_binary_type<T>, static_cast<uint32_t>(sizeof(T)), name);
+}
+
+template <Math::BinaryElement T>
+bool Math::BinaryFileWriter::AppendChunk(std::span<const T> elements)
+{
+    return AppendBytes(k_binary_type<T>, elements.data(), elements.size_bytes());
+}
+
+template <Math::BinaryElement T>
+std::span<const T> Math::MappedBinaryFile::GetArray(size_t index) const
+{
+    if (index >= ArrayCount())
+    {
+        return {};
+    }
+    const BinaryArrayInfo& info = GetArrayInfo(index);
+    if (info.type != k_binary_type<T> || info.element_size != sizeof(T))
+    {
+        return {};
+    }
+    return {reinterpret_cast<const T*>(Data() + info.offset), static_cast<size_t>(info.count)};
+}
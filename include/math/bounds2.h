@@ -33,19 +33,19 @@ struct Bounds2
      * @param p1 First point.
      * @param p2 Second point.
      */
-    Bounds2(const Point2<T>& p1, const Point2<T>& p2);
+    constexpr Bounds2(const Point2<T>& p1, const Point2<T>& p2);
 
     /**
      * Access min or max by index.
      * @param index 0 for min, 1 for max.
      * @return The min or max point.
      */
-    Point2<T>& operator[](int32_t index);
-    const Point2<T>& operator[](int32_t index) const;
+    constexpr Point2<T>& operator[](int32_t index);
+    constexpr const Point2<T>& operator[](int32_t index) const;
 
     /** Operators. */
-    bool operator==(const Bounds2& other) const;
-    bool operator!=(const Bounds2& other) const;
+    constexpr bool operator==(const Bounds2& other) const;
+    constexpr bool operator!=(const Bounds2& other) const;
 };
 
 /**
@@ -58,7 +58,7 @@ struct Bounds2
  * @return The corner of the bounding box specified by the mask.
  */
 template <typename T>
-[[nodiscard]] Point2<T> Corner(const Bounds2<T>& b, uint8_t mask);
+[[nodiscard]] constexpr Point2<T> Corner(const Bounds2<T>& b, uint8_t mask);
 
 /**
  * Returns the diagonal of the bounding box.
@@ -67,7 +67,7 @@ template <typename T>
  * @return The diagonal of the bounding box pointing from min to max point.
  */
 template <typename T>
-[[nodiscard]] Vector2<T> Diagonal(const Bounds2<T>& b);
+[[nodiscard]] constexpr Vector2<T> Diagonal(const Bounds2<T>& b);
 
 /**
  * Calculates the surface area of the bounding box.
@@ -76,7 +76,7 @@ template <typename T>
  * @return The surface area of the bounding box.
  */
 template <typename T>
-[[nodiscard]] T SurfaceArea(const Bounds2<T>& b);
+[[nodiscard]] constexpr T SurfaceArea(const Bounds2<T>& b);
 
 /**
  * Returns the index of the axis with the maximum extent.
@@ -85,7 +85,7 @@ template <typename T>
  * @return The index of the axis with the maximum extent.
  */
 template <typename T>
-[[nodiscard]] int32_t MaximumExtent(const Bounds2<T>& b);
+[[nodiscard]] constexpr int32_t MaximumExtent(const Bounds2<T>& b);
 
 /**
  * Calculate linear interpolation between the min and max point of the bounding box.
@@ -95,7 +95,7 @@ template <typename T>
  * @return The interpolated point.
  */
 template <FloatingPoint T>
-[[nodiscard]] Point2<T> Lerp(const Bounds2<T>& b, const Point2<T>& t);
+[[nodiscard]] constexpr Point2<T> Lerp(const Bounds2<T>& b, const Point2<T>& t);
 
 /**
  * Calculate the offset of a point from the minimum corner of the bounding box scaled by
@@ -107,7 +107,7 @@ template <FloatingPoint T>
  * of the bounding box extent.
  */
 template <FloatingPoint T>
-[[nodiscard]] Vector2<T> Offset(const Bounds2<T>& b, const Point2<T>& p);
+[[nodiscard]] constexpr Vector2<T> Offset(const Bounds2<T>& b, const Point2<T>& p);
 
 /**
  * Calculates a sphere that bounds the bounding box.
@@ -117,7 +117,7 @@ template <FloatingPoint T>
  * @param out_radius The radius of the sphere.
  */
 template <FloatingPoint T>
-void BoundingSphere(const Bounds2<T>& b, Point2<T>& out_center, T& out_radius);
+constexpr void BoundingSphere(const Bounds2<T>& b, Point2<T>& out_center, T& out_radius);
 
 /**
  * Calculates the extent of the bounding box.
@@ -126,7 +126,7 @@ void BoundingSphere(const Bounds2<T>& b, Point2<T>& out_center, T& out_radius);
  * @return The extent of the bounding box.
  */
 template <typename T>
-[[nodiscard]] Vector2<T> Extent(const Bounds2<T>& b);
+[[nodiscard]] constexpr Vector2<T> Extent(const Bounds2<T>& b);
 
 /**
  * Calculates the union of a bounding box and a point.
@@ -136,7 +136,7 @@ template <typename T>
  * @return The union of the bounding box and the point.
  */
 template <typename T>
-[[nodiscard]] Bounds2<T> Union(const Bounds2<T>& b, const Point2<T>& p);
+[[nodiscard]] constexpr Bounds2<T> Union(const Bounds2<T>& b, const Point2<T>& p);
 
 /**
  * Calculates the union of two bounding boxes.
@@ -146,7 +146,7 @@ template <typename T>
  * @return The union of the two bounding boxes.
  */
 template <typename T>
-[[nodiscard]] Bounds2<T> Union(const Bounds2<T>& b1, const Bounds2<T>& b2);
+[[nodiscard]] constexpr Bounds2<T> Union(const Bounds2<T>& b1, const Bounds2<T>& b2);
 
 /**
  * Expands the bounding box by a constant amount in all directions.
@@ -156,7 +156,7 @@ template <typename T>
  * @return The expanded bounding box.
  */
 template <typename T>
-[[nodiscard]] Bounds2<T> Expand(const Bounds2<T>& b, T delta);
+[[nodiscard]] constexpr Bounds2<T> Expand(const Bounds2<T>& b, T delta);
 
 /**
  * Checks if two bounding boxes overlap.
@@ -166,7 +166,7 @@ template <typename T>
  * @return True if the bounding boxes overlap, false otherwise.
  */
 template <typename T>
-bool Overlaps(const Bounds2<T>& b1, const Bounds2<T>& b2);
+constexpr bool Overlaps(const Bounds2<T>& b1, const Bounds2<T>& b2);
 
 /**
  * Calculates the intersection of two bounding boxes.
@@ -177,7 +177,7 @@ bool Overlaps(const Bounds2<T>& b1, const Bounds2<T>& b2);
  * result is undefined. Use Overlaps() to check if the bounding boxes overlap.
  */
 template <typename T>
-[[nodiscard]] Bounds2<T> Intersect(const Bounds2<T>& b1, const Bounds2<T>& b2);
+[[nodiscard]] constexpr Bounds2<T> Intersect(const Bounds2<T>& b1, const Bounds2<T>& b2);
 
 /**
  * Checks if a point is inside a bounding box. Note that the point is not counted if it is on the
@@ -188,7 +188,7 @@ template <typename T>
  * @return True if the point is inside the bounding box, false otherwise.
  */
 template <typename T>
-bool Inside(const Bounds2<T>& b, const Point2<T>& p);
+constexpr bool Inside(const Bounds2<T>& b, const Point2<T>& p);
 
 /**
  * Checks if a point is inside a bounding box. Note that the point is counted if it is on the
@@ -199,7 +199,7 @@ bool Inside(const Bounds2<T>& b, const Point2<T>& p);
  * @return True if the point is inside the bounding box, false otherwise.
  */
 template <typename T>
-bool InsideInclusive(const Bounds2<T>& b, const Point2<T>& p);
+constexpr bool InsideInclusive(const Bounds2<T>& b, const Point2<T>& p);
 
 }  // namespace Math
 
@@ -217,70 +217,70 @@ constexpr Math::Bounds2<T>::Bounds2(const Point2<T>& p) : min(p), max(p)
 }
 
 template <typename T>
-Math::Bounds2<T>::Bounds2(const Point2<T>& p1, const Point2<T>& p2)
+constexpr Math::Bounds2<T>::Bounds2(const Point2<T>& p1, const Point2<T>& p2)
 {
     min = Point2<T>(Math::Min(p1.x, p2.x), Math::Min(p1.y, p2.y));
     max = Point2<T>(Math::Max(p1.x, p2.x), Math::Max(p1.y, p2.y));
 }
 
 template <typename T>
-Math::Point2<T>& Math::Bounds2<T>::operator[](int32_t index)
+constexpr Math::Point2<T>& Math::Bounds2<T>::operator[](int32_t index)
 {
-    return (&min)[index];
+    return index == 0 ? min : max;
 }
 
 template <typename T>
-const Math::Point2<T>& Math::Bounds2<T>::operator[](int32_t index) const
+constexpr const Math::Point2<T>& Math::Bounds2<T>::operator[](int32_t index) const
 {
-    return (&min)[index];
+    return index == 0 ? min : max;
 }
 
 template <typename T>
-bool Math::Bounds2<T>::operator==(const Bounds2& other) const
+constexpr bool Math::Bounds2<T>::operator==(const Bounds2& other) const
 {
     return min == other.min && max == other.max;
 }
 
 template <typename T>
-bool Math::Bounds2<T>::operator!=(const Bounds2& other) const
+constexpr bool Math::Bounds2<T>::operator!=(const Bounds2& other) const
 {
     return min != other.min || max != other.max;
 }
 
 template <typename T>
-Math::Point2<T> Math::Corner(const Bounds2<T>& b, uint8_t mask)
+constexpr Math::Point2<T> Math::Corner(const Bounds2<T>& b, uint8_t mask)
 {
     return Point2<T>((mask & 1) ? b.max.x : b.min.x, (mask & 2) ? b.max.y : b.min.y);
 }
 
 template <typename T>
-Math::Vector2<T> Math::Diagonal(const Bounds2<T>& b)
+constexpr Math::Vector2<T> Math::Diagonal(const Bounds2<T>& b)
 {
     return b.max - b.min;
 }
 
 template <typename T>
-T Math::SurfaceArea(const Bounds2<T>& b)
+constexpr T Math::SurfaceArea(const Bounds2<T>& b)
 {
     const Vector2<T> diag = Diagonal(b);
     return diag.x * diag.y;
 }
 
 template <typename T>
-int32_t Math::MaximumExtent(const Bounds2<T>& b)
+constexpr int32_t Math::MaximumExtent(const Bounds2<T>& b)
 {
     const Vector2<T> diag = Diagonal(b);
     return (diag.x > diag.y) ? 0 : 1;
 }
 
 template <Math::FloatingPoint T>
-Math::Point2<T> Math::Lerp(const Bounds2<T>& b, const Point2<T>& t)
+constexpr Math::Point2<T> Math::Lerp(const Bounds2<T>& b, const Point2<T>& t)
 {
     return Point2<T>(Math::Lerp(t.x, b.min.x, b.max.x), Math::Lerp(t.y, b.min.y, b.max.y));
 }
 
 template <Math::FloatingPoint T>
-Math::Vector2<T> Math::Offset(const Bounds2<T>& b, const Point2<T>& p)
+constexpr Math::Vector2<T> Math::Offset(const Bounds2<T>& b, const Point2<T>& p)
 {
     Vector2<T> o = p - b.min;
     if (b.max.x > b.min.x)
@@ -295,40 +295,40 @@ Math::Vector2<T> Math::Offset(const Bounds2<T>& b, const Point2<T>& p)
 }
 
 template <Math::FloatingPoint T>
-void Math::BoundingSphere(const Bounds2<T>& b, Point2<T>& out_center, T& out_radius)
+constexpr void Math::BoundingSphere(const Bounds2<T>& b, Point2<T>& out_center, T& out_radius)
 {
     out_center = b.min + (b.max - b.min) / static_cast<T>(2);
     out_radius = Inside(b, out_center) ? static_cast<T>(Distance(out_center, b.max)) : 0;
 }
 
 template <typename T>
-Math::Vector2<T> Math::Extent(const Bounds2<T>& b)
+constexpr Math::Vector2<T> Math::Extent(const Bounds2<T>& b)
 {
     return Math::Abs(b.max - b.min);
 }
 
 template <typename T>
-Math::Bounds2<T> Math::Union(const Bounds2<T>& b, const Point2<T>& p)
+constexpr Math::Bounds2<T> Math::Union(const Bounds2<T>& b, const Point2<T>& p)
 {
     return Bounds2<T>(Point2<T>(Math::Min(b.min.x, p.x), Math::Min(b.min.y, p.y)),
                       Point2<T>(Math::Max(b.max.x, p.x), Math::Max(b.max.y, p.y)));
 }
 
 template <typename T>
-Math::Bounds2<T> Math::Union(const Bounds2<T>& b1, const Bounds2<T>& b2)
+constexpr Math::Bounds2<T> Math::Union(const Bounds2<T>& b1, const Bounds2<T>& b2)
 {
     return Bounds2<T>(Point2<T>(Math::Min(b1.min.x, b2.min.x), Math::Min(b1.min.y, b2.min.y)),
                       Point2<T>(Math::Max(b1.max.x, b2.max.x), Math::Max(b1.max.y, b2.max.y)));
 }
 
 template <typename T>
-Math::Bounds2<T> Math::Expand(const Bounds2<T>& b, T delta)
+constexpr Math::Bounds2<T> Math::Expand(const Bounds2<T>& b, T delta)
 {
     return Bounds2<T>(b.min - Vector2<T>(delta, delta), b.max + Vector2<T>(delta, delta));
 }
 
 template <typename T>
-bool Math::Overlaps(const Bounds2<T>& b1, const Bounds2<T>& b2)
+constexpr bool Math::Overlaps(const Bounds2<T>& b1, const Bounds2<T>& b2)
 {
     bool x = (b1.max.x >= b2.min.x) && (b1.min.x <= b2.max.x);
     bool y = (b1.max.y >= b2.min.y) && (b1.min.y <= b2.max.y);
@@ -336,20 +336,20 @@ bool Math::Overlaps(const Bounds2<T>& b1, const Bounds2<T>& b2)
 }
 
 template <typename T>
-Math::Bounds2<T> Math::Intersect(const Bounds2<T>& b1, const Bounds2<T>& b2)
+constexpr Math::Bounds2<T> Math::Intersect(const Bounds2<T>& b1, const Bounds2<T>& b2)
 {
     return Bounds2<T>(Point2<T>(Math::Max(b1.min.x, b2.min.x), Math::Max(b1.min.y, b2.min.y)),
                       Point2<T>(Math::Min(b1.max.x, b2.max.x), Math::Min(b1.max.y, b2.max.y)));
 }
 
 template <typename T>
-bool Math::Inside(const Bounds2<T>& b, const Point2<T>& p)
+constexpr bool Math::Inside(const Bounds2<T>& b, const Point2<T>& p)
 {
     return (p.x >= b.min.x && p.x < b.max.x && p.y >= b.min.y && p.y < b.max.y);
 }
 
 template <typename T>
-bool Math::InsideInclusive(const Bounds2<T>& b, const Point2<T>& p)
+constexpr bool Math::InsideInclusive(const Bounds2<T>& b, const Point2<T>& p)
 {
     return (p.x >= b.min.x && p.x <= b.max.x && p.y >= b.min.y && p.y <= b.max.y);
 }
@@ -0,0 +1,676 @@
+#pragma once
+
+#include <bit>
+#include <cassert>
+#include <limits>
+#include <span>
+#include <type_traits>
+
+#include "math/bounds3.h"
+#include "math/matrix.h"
+#include "math/simd.h"
+
+namespace Math
+{
+
+/**
+ * Non-owning view of Bounds3 stored as a structure of arrays, one contiguous array per component.
+ * All the arrays need to have the same size.
+ * @tparam T Type of the components. Use a const type for a read-only view.
+ */
+template <typename T>
+struct Bounds3SoA
+{
+    std::span<T> min_x;
+    std::span<T> min_y;
+    std::span<T> min_z;
+    std::span<T> max_x;
+    std::span<T> max_y;
+    std::span<T> max_z;
+
+    /**
+     * Constructs an empty view.
+     */
+    constexpr Bounds3SoA() = default;
+
+    /**
+     * Constructs a view of the component arrays.
+     */
+    constexpr Bounds3SoA(std::span<T> min_x_values,
+                         std::span<T> min_y_values,
+                         std::span<T> min_z_values,
+                         std::span<T> max_x_values,
+                         std::span<T> max_y_values,
+                         std::span<T> max_z_values);
+
+    /**
+     * Constructs a read-only view from a mutable view.
+     */
+    template <typename U>
+        requires std::is_same_v<T, const U>
+    constexpr Bounds3SoA(const Bounds3SoA<U>& other);
+
+    /**
+     * @return The number of bounds in the view.
+     */
+    [[nodiscard]] constexpr size_t Size() const;
+
+    /**
+     * Gather the components of one bounds.
+     * @param index The index of the bounds.
+     * @return The bounds at the index.
+     */
+    [[nodiscard]] constexpr Bounds3<std::remove_const_t<T>> Get(size_t index) const;
+
+    /**
+     * Scatter the components of one bounds.
+     * @param index The index of the bounds.
+     * @param b The bounds to store at the index.
+     */
+    constexpr void Set(size_t index, const Bounds3<std::remove_const_t<T>>& b) const
+        requires(!std::is_const_v<T>);
+};
+
+/**
+ * Non-owning view of Point3 stored as a structure of arrays, one contiguous array per component.
+ * All the arrays need to have the same size.
+ * @tparam T Type of the components. Use a const type for a read-only view.
+ */
+template <typename T>
+struct Point3SoA
+{
+    std::span<T> x;
+    std::span<T> y;
+    std::span<T> z;
+
+    /**
+     * Constructs an empty view.
+     */
+    constexpr Point3SoA() = default;
+
+    /**
+     * Constructs a view of the component arrays.
+     */
+    constexpr Point3SoA(std::span<T> x_values, std::span<T> y_values, std::span<T> z_values);
+
+    /**
+     * Constructs a read-only view from a mutable view.
+     */
+    template <typename U>
+        requires std::is_same_v<T, const U>
+    constexpr Point3SoA(const Point3SoA<U>& other);
+
+    /**
+     * @return The number of points in the view.
+     */
+    [[nodiscard]] constexpr size_t Size() const;
+
+    /**
+     * Gather the components of one point.
+     * @param index The index of the point.
+     * @return The point at the index.
+     */
+    [[nodiscard]] constexpr Point3<std::remove_const_t<T>> Get(size_t index) const;
+};
+
+/**
+ * Reduce the bounding boxes to one bounding box containing all of them.
+ * @tparam T Type of the bounds.
+ * @param boxes The bounding boxes.
+ * @return The union of the bounding boxes. Without boxes this is the inverted box from +infinity to
+ * -infinity, which doesn't change the result of a Union with it.
+ * @see Union
+ */
+template <FloatingPoint T>
+[[nodiscard]] Bounds3<T> Union(std::span<const Bounds3<T>> boxes);
+
+/**
+ * Reduce the bounding boxes to one bounding box containing all of them.
+ * @tparam T Type of the bounds.
+ * @param boxes The bounding boxes.
+ * @return The union of the bounding boxes, the inverted box from +infinity to -infinity without
+ * boxes.
+ */
+template <FloatingPoint T>
+[[nodiscard]] Bounds3<T> Union(std::type_identity_t<Bounds3SoA<const T>> boxes);
+
+/**
+ * Test one bounding box against many. Bit i % 64 of mask[i / 64] is set if boxes[i] overlaps the
+ * query, the bits after the last box are cleared.
+ * @tparam T Type of the bounds.
+ * @param query The bounding box to test against.
+ * @param boxes The bounding boxes to test.
+ * @param mask Where to write the bits. Needs at least (boxes.size() + 63) / 64 elements.
+ * @return The number of overlapping boxes.
+ * @see Overlaps
+ */
+template <FloatingPoint T>
+size_t Overlaps(const Bounds3<T>& query,
+                std::type_identity_t<std::span<const Bounds3<T>>> boxes,
+                std::span<uint64_t> mask);
+
+/**
+ * Test one bounding box against many. Bit i % 64 of mask[i / 64] is set if box i overlaps the
+ * query, the bits after the last box are cleared.
+ * @tparam T Type of the bounds.
+ * @param query The bounding box to test against.
+ * @param boxes The bounding boxes to test.
+ * @param mask Where to write the bits. Needs at least (boxes.Size() + 63) / 64 elements.
+ * @return The number of overlapping boxes.
+ */
+template <FloatingPoint T>
+size_t Overlaps(const Bounds3<T>& query,
+                std::type_identity_t<Bounds3SoA<const T>> boxes,
+                std::span<uint64_t> mask);
+
+/**
+ * Test many points against one bounding box. Bit i % 64 of mask[i / 64] is set if points[i] is
+ * inside the box, the bits after the last point are cleared.
+ * @tparam T Type of the bounds.
+ * @param b The bounding box.
+ * @param points The points to test.
+ * @param mask Where to write the bits. Needs at least (points.size() + 63) / 64 elements.
+ * @return The number of points inside.
+ * @see Inside
+ */
+template <FloatingPoint T>
+size_t Inside(const Bounds3<T>& b,
+              std::type_identity_t<std::span<const Point3<T>>> points,
+              std::span<uint64_t> mask);
+
+/**
+ * Test many points against one bounding box. Bit i % 64 of mask[i / 64] is set if point i is
+ * inside the box, the bits after the last point are cleared.
+ * @tparam T Type of the bounds.
+ * @param b The bounding box.
+ * @param points The points to test.
+ * @param mask Where to write the bits. Needs at least (points.Size() + 63) / 64 elements.
+ * @return The number of points inside.
+ */
+template <FloatingPoint T>
+size_t Inside(const Bounds3<T>& b,
+              std::type_identity_t<Point3SoA<const T>> points,
+              std::span<uint64_t> mask);
+
+/**
+ * Bound every box transformed by its own affine transform, such as the local bounds of instances
+ * and their transforms, with the center and extent method of TransformBounds.
+ * @tparam T Type of the bounds.
+ * @param matrices The transforms, the last row of each needs to be 0, 0, 0, 1.
+ * @param boxes The boxes, boxes[i] is transformed by matrices[i].
+ * @param out_boxes Where to write the transformed boxes, can be the same array as boxes. All three
+ * spans need to have the same size.
+ * @see TransformBounds
+ */
+template <FloatingPoint T>
+void TransformBounds(std::type_identity_t<std::span<const Matrix4x4<T>>> matrices,
+                     std::type_identity_t<std::span<const Bounds3<T>>> boxes,
+                     std::type_identity_t<std::span<Bounds3<T>>> out_boxes);
+
+}  // namespace Math
+
+// Implementation //////////////////////////////////////////////////////////////////////////////////
+
+namespace Math::Internal
+{
+
+/**
+ * Write the bits of test(i) for i below count, test_block(i) returns the bits of Width elements
+ * starting at i and is used where a whole block fits.
+ */
+template <size_t Width, typename TestBlock, typename Test>
+size_t FillMask(size_t count, std::span<uint64_t> mask, TestBlock&& test_block, Test&& test)
+{
+    assert(mask.size() >= (count + 63) / 64);
+    size_t hits = 0;
+    for (size_t begin = 0; begin < count; begin += 64)
+    {
+        const size_t end = Math::Min(begin + 64, count);
+        uint64_t bits = 0;
+        size_t i = begin;
+        for (; i + Width <= end; i += Width)
+        {
+            bits |= static_cast<uint64_t>(test_block(i)) << (i - begin);
+        }
+        for (; i < end; ++i)
+        {
+            bits |= static_cast<uint64_t>(test(i)) << (i - begin);
+        }
+        mask[begin / 64] = bits;
+        hits += static_cast<size_t>(std::popcount(bits));
+    }
+    return hits;
+}
+
+template <typename Test>
+size_t FillMask(size_t count, std::span<uint64_t> mask, Test&& test)
+{
+    return FillMask<1>(count, mask, test, test);
+}
+
+template <FloatingPoint T>
+constexpr Bounds3<T> InvertedBounds()
+{
+    Bounds3<T> b;
+    b.min = Point3<T>(std::numeric_limits<T>::infinity(), std::numeric_limits<T>::infinity(),
+                      std::numeric_limits<T>::infinity());
+    b.max = -b.min;
+    return b;
+}
+
+template <FloatingPoint T>
+constexpr bool OverlapsBranchless(const Bounds3<T>& b1, const Bounds3<T>& b2)
+{
+    return (b1.max.x >= b2.min.x) & (b1.min.x <= b2.max.x) & (b1.max.y >= b2.min.y) &
+           (b1.min.y <= b2.max.y) & (b1.max.z >= b2.min.z) & (b1.min.z <= b2.max.z);
+}
+
+template <FloatingPoint T>
+constexpr bool InsideBranchless(const Bounds3<T>& b, const Point3<T>& p)
+{
+    return (p.x >= b.min.x) & (p.x < b.max.x) & (p.y >= b.min.y) & (p.y < b.max.y) &
+           (p.z >= b.min.z) & (p.z < b.max.z);
+}
+
+#if MATH_SIMD_SSE2
+
+// A Bounds3<float> is min.xyz followed by max.xyz, so the four floats starting at min.x hold min in
+// lanes 0 to 2 and the four floats starting at min.z hold max in lanes 1 to 3. Both loads stay
+// inside the bounds.
+static_assert(sizeof(Bounds3<float>) == 6 * sizeof(float));
+
+inline __m128 LoadMinSSE(const Bounds3<float>& b)
+{
+    return _mm_loadu_ps(&b.min.x);
+}
+
+inline __m128 LoadMaxSSE(const Bounds3<float>& b)
+{
+    return _mm_loadu_ps(&b.min.z);
+}
+
+/**
+ * Store min and max from lanes 0 to 2, the reverse of LoadMinSSE and LoadMaxSSE. The second store
+ * overwrites the lane of the first that falls on max.x.
+ */
+inline void StoreBoundsSSE(Bounds3<float>& b, __m128 min, __m128 max)
+{
+    const __m128 z_x = _mm_shuffle_ps(min, max, _MM_SHUFFLE(0, 0, 2, 2));
+    _mm_storeu_ps(&b.min.x, min);
+    _mm_storeu_ps(&b.min.z, _mm_shuffle_ps(z_x, max, _MM_SHUFFLE(2, 1, 2, 0)));
+}
+
+inline float HorizontalMinSSE(__m128 v)
+{
+    v = _mm_min_ps(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1)));
+    v = _mm_min_ps(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 0, 3, 2)));
+    return _mm_cvtss_f32(v);
+}
+
+inline float HorizontalMaxSSE(__m128 v)
+{
+    v = _mm_max_ps(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1)));
+    v = _mm_max_ps(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 0, 3, 2)));
+    return _mm_cvtss_f32(v);
+}
+
+/**
+ * Bits of the four points with coordinates x, y, z inside the box.
+ */
+inline int InsideSSE(const Bounds3<float>& b, __m128 x, __m128 y, __m128 z)
+{
+    __m128 inside = _mm_and_ps(_mm_cmpge_ps(x, _mm_set1_ps(b.min.x)),
+                               _mm_cmplt_ps(x, _mm_set1_ps(b.max.x)));
+    inside = _mm_and_ps(inside, _mm_cmpge_ps(y, _mm_set1_ps(b.min.y)));
+    inside = _mm_and_ps(inside, _mm_cmplt_ps(y, _mm_set1_ps(b.max.y)));
+    inside = _mm_and_ps(inside, _mm_cmpge_ps(z, _mm_set1_ps(b.min.z)));
+    inside = _mm_and_ps(inside, _mm_cmplt_ps(z, _mm_set1_ps(b.max.z)));
+    return _mm_movemask_ps(inside);
+}
+
+#endif
+
+}  // namespace Math::Internal
+
+template <typename T>
+constexpr Math::Bounds3SoA<T>::Bounds3SoA(std::span<T> min_x_values,
+                                          std::span<T> min_y_values,
+                                          std::span<T> min_z_values,
+                                          std::span<T> max_x_values,
+                                          std::span<T> max_y_values,
+                                          std::span<T> max_z_values)
+    : min_x(min_x_values),
+      min_y(min_y_values),
+      min_z(min_z_values),
+      max_x(max_x_values),
+      max_y(max_y_values),
+      max_z(max_z_values)
+{
+    assert(min_x.size() == min_y.size() && min_x.size() == min_z.size() &&
+           min_x.size() == max_x.size() && min_x.size() == max_y.size() &&
+           min_x.size() == max_z.size());
+}
+
+template <typename T>
+template <typename U>
+    requires std::is_same_v<T, const U>
+constexpr Math::Bounds3SoA<T>::Bounds3SoA(const Bounds3SoA<U>& other)
+    : min_x(other.min_x),
+      min_y(other.min_y),
+      min_z(other.min_z),
+      max_x(other.max_x),
+      max_y(other.max_y),
+      max_z(other.max_z)
+{
+}
+
+template <typename T>
+constexpr size_t Math::Bounds3SoA<T>::Size() const
+{
+    return min_x.size();
+}
+
+template <typename T>
+constexpr Math::Bounds3<std::remove_const_t<T>> Math::Bounds3SoA<T>::Get(size_t index) const
+{
+    Bounds3<std::remove_const_t<T>> b;
+    b.min = Point3<std::remove_const_t<T>>(min_x[index], min_y[index], min_z[index]);
+    b.max = Point3<std::remove_const_t<T>>(max_x[index], max_y[index], max_z[index]);
+    return b;
+}
+
+template <typename T>
+constexpr void Math::Bounds3SoA<T>::Set(size_t index,
+                                        const Bounds3<std::remove_const_t<T>>& b) const
+    requires(!std::is_const_v<T>)
+{
+    min_x[index] = b.min.x;
+    min_y[index] = b.min.y;
+    min_z[index] = b.min.z;
+    max_x[index] = b.max.x;
+    max_y[index] = b.max.y;
+    max_z[index] = b.max.z;
+}
+
+template <typename T>
+constexpr Math::Point3SoA<T>::Point3SoA(std::span<T> x_values,
+                                        std::span<T> y_values,
+                                        std::span<T> z_values)
+    : x(x_values), y(y_values), z(z_values)
+{
+    assert(x.size() == y.size() && x.size() == z.size());
+}
+
+template <typename T>
+template <typename U>
+    requires std::is_same_v<T, const U>
+constexpr Math::Point3SoA<T>::Point3SoA(const Point3SoA<U>& other)
+    : x(other.x), y(other.y), z(other.z)
+{
+}
+
+template <typename T>
+constexpr size_t Math::Point3SoA<T>::Size() const
+{
+    return x.size();
+}
+
+template <typename T>
+constexpr Math::Point3<std::remove_const_t<T>> Math::Point3SoA<T>::Get(size_t index) const
+{
+    return Point3<std::remove_const_t<T>>(x[index], y[index], z[index]);
+}
+
+template <Math::FloatingPoint T>
+Math::Bounds3<T> Math::Union(std::span<const Bounds3<T>> boxes)
+{
+    Bounds3<T> result = Internal::InvertedBounds<T>();
+#if MATH_SIMD_SSE2
+    if constexpr (std::is_same_v<T, float>)
+    {
+        // Two accumulators per side to hide the latency of min and max.
+        __m128 min0 = Internal::LoadMinSSE(result);
+        __m128 max0 = Internal::LoadMaxSSE(result);
+        __m128 min1 = min0;
+        __m128 max1 = max0;
+        size_t i = 0;
+        for (; i + 2 <= boxes.size(); i += 2)
+        {
+            min0 = _mm_min_ps(min0, Internal::LoadMinSSE(boxes[i]));
+            max0 = _mm_max_ps(max0, Internal::LoadMaxSSE(boxes[i]));
+            min1 = _mm_min_ps(min1, Internal::LoadMinSSE(boxes[i + 1]));
+            max1 = _mm_max_ps(max1, Internal::LoadMaxSSE(boxes[i + 1]));
+        }
+        if (i < boxes.size())
+        {
+            min0 = _mm_min_ps(min0, Internal::LoadMinSSE(boxes[i]));
+            max0 = _mm_max_ps(max0, Internal::LoadMaxSSE(boxes[i]));
+        }
+        alignas(16) float mins[4];
+        alignas(16) float maxs[4];
+        _mm_store_ps(mins, _mm_min_ps(min0, min1));
+        _mm_store_ps(maxs, _mm_max_ps(max0, max1));
+        result.min = Point3<T>(mins[0], mins[1], mins[2]);
+        result.max = Point3<T>(maxs[1], maxs[2], maxs[3]);
+        return result;
+    }
+    else
+#endif
+    {
+        for (const Bounds3<T>& b : boxes)
+        {
+            result = Union(result, b);
+        }
+        return result;
+    }
+}
+
+template <Math::FloatingPoint T>
+Math::Bounds3<T> Math::Union(std::type_identity_t<Bounds3SoA<const T>> boxes)
+{
+    const size_t count = boxes.Size();
+    Bounds3<T> result = Internal::InvertedBounds<T>();
+    size_t i = 0;
+#if MATH_SIMD_SSE2
+    if constexpr (std::is_same_v<T, float>)
+    {
+        __m128 min_x = _mm_set1_ps(result.min.x);
+        __m128 min_y = min_x;
+        __m128 min_z = min_x;
+        __m128 max_x = _mm_set1_ps(result.max.x);
+        __m128 max_y = max_x;
+        __m128 max_z = max_x;
+        for (; i + 4 <= count; i += 4)
+        {
+            min_x = _mm_min_ps(min_x, _mm_loadu_ps(&boxes.min_x[i]));
+            min_y = _mm_min_ps(min_y, _mm_loadu_ps(&boxes.min_y[i]));
+            min_z = _mm_min_ps(min_z, _mm_loadu_ps(&boxes.min_z[i]));
+            max_x = _mm_max_ps(max_x, _mm_loadu_ps(&boxes.max_x[i]));
+            max_y = _mm_max_ps(max_y, _mm_loadu_ps(&boxes.max_y[i]));
+            max_z = _mm_max_ps(max_z, _mm_loadu_ps(&boxes.max_z[i]));
+        }
+        result.min = Point3<T>(Internal::HorizontalMinSSE(min_x), Internal::HorizontalMinSSE(min_y),
+                               Internal::HorizontalMinSSE(min_z));
+        result.max = Point3<T>(Internal::HorizontalMaxSSE(max_x), Internal::HorizontalMaxSSE(max_y),
+                               Internal::HorizontalMaxSSE(max_z));
+    }
+#endif
+    for (; i < count; ++i)
+    {
+        result = Union(result, boxes.Get(i));
+    }
+    return result;
+}
+
+template <Math::FloatingPoint T>
+size_t Math::Overlaps(const Bounds3<T>& query,
+                      std::type_identity_t<std::span<const Bounds3<T>>> boxes,
+                      std::span<uint64_t> mask)
+{
+#if MATH_SIMD_SSE2
+    if constexpr (std::is_same_v<T, float>)
+    {
+        // box.min <= query.max in lanes 0 to 2 and box.max >= query.min in lanes 1 to 3, the unused
+        // lane is compared against an infinity so it always passes.
+        const float inf = std::numeric_limits<float>::infinity();
+        const __m128 query_max = _mm_setr_ps(query.max.x, query.max.y, query.max.z, inf);
+        const __m128 query_min = _mm_setr_ps(-inf, query.min.x, query.min.y, query.min.z);
+        auto overlap = [&](size_t i)
+        {
+            return _mm_and_ps(_mm_cmple_ps(Internal::LoadMinSSE(boxes[i]), query_max),
+                              _mm_cmpge_ps(Internal::LoadMaxSSE(boxes[i]), query_min));
+        };
+        // Transpose the lanes of four boxes so one movemask gives the result of all four.
+        auto test_block = [&](size_t i)
+        {
+            __m128 o0 = overlap(i);
+            __m128 o1 = overlap(i + 1);
+            __m128 o2 = overlap(i + 2);
+            __m128 o3 = overlap(i + 3);
+            _MM_TRANSPOSE4_PS(o0, o1, o2, o3);
+            return _mm_movemask_ps(_mm_and_ps(_mm_and_ps(o0, o1), _mm_and_ps(o2, o3)));
+        };
+        auto test = [&](size_t i) { return _mm_movemask_ps(overlap(i)) == 0xF; };
+        return Internal::FillMask<4>(boxes.size(), mask, test_block, test);
+    }
+    else
+#endif
+    {
+        return Internal::FillMask(boxes.size(), mask, [&](size_t i)
+                                  { return Internal::OverlapsBranchless(query, boxes[i]); });
+    }
+}
+
+template <Math::FloatingPoint T>
+size_t Math::Overlaps(const Bounds3<T>& query,
+                      std::type_identity_t<Bounds3SoA<const T>> boxes,
+                      std::span<uint64_t> mask)
+{
+    auto test = [&](size_t i) { return Internal::OverlapsBranchless(query, boxes.Get(i)); };
+#if MATH_SIMD_SSE2
+    if constexpr (std::is_same_v<T, float>)
+    {
+        const __m128 query_min_x = _mm_set1_ps(query.min.x);
+        const __m128 query_min_y = _mm_set1_ps(query.min.y);
+        const __m128 query_min_z = _mm_set1_ps(query.min.z);
+        const __m128 query_max_x = _mm_set1_ps(query.max.x);
+        const __m128 query_max_y = _mm_set1_ps(query.max.y);
+        const __m128 query_max_z = _mm_set1_ps(query.max.z);
+        auto test_block = [&](size_t i)
+        {
+            __m128 overlap = _mm_and_ps(_mm_cmpge_ps(_mm_loadu_ps(&boxes.max_x[i]), query_min_x),
+                                        _mm_cmple_ps(_mm_loadu_ps(&boxes.min_x[i]), query_max_x));
+            overlap = _mm_and_ps(overlap, _mm_cmpge_ps(_mm_loadu_ps(&boxes.max_y[i]), query_min_y));
+            overlap = _mm_and_ps(overlap, _mm_cmple_ps(_mm_loadu_ps(&boxes.min_y[i]), query_max_y));
+            overlap = _mm_and_ps(overlap, _mm_cmpge_ps(_mm_loadu_ps(&boxes.max_z[i]), query_min_z));
+            overlap = _mm_and_ps(overlap, _mm_cmple_ps(_mm_loadu_ps(&boxes.min_z[i]), query_max_z));
+            return _mm_movemask_ps(overlap);
+        };
+        return Internal::FillMask<4>(boxes.Size(), mask, test_block, test);
+    }
+    else
+#endif
+    {
+        return Internal::FillMask(boxes.Size(), mask, test);
+    }
+}
+
+template <Math::FloatingPoint T>
+size_t Math::Inside(const Bounds3<T>& b,
+                    std::type_identity_t<std::span<const Point3<T>>> points,
+                    std::span<uint64_t> mask)
+{
+    auto test = [&](size_t i) { return Internal::InsideBranchless(b, points[i]); };
+#if MATH_SIMD_SSE2
+    if constexpr (std::is_same_v<T, float>)
+    {
+        auto test_block = [&](size_t i)
+        {
+            __m128 x, y, z;
+            static_assert(sizeof(Point3<float>) == 3 * sizeof(float));
+            Internal::Load3x4SSE(&points[i].x, x, y, z);
+            return Internal::InsideSSE(b, x, y, z);
+        };
+        return Internal::FillMask<4>(points.size(), mask, test_block, test);
+    }
+    else
+#endif
+    {
+        return Internal::FillMask(points.size(), mask, test);
+    }
+}
+
+template <Math::FloatingPoint T>
+size_t Math::Inside(const Bounds3<T>& b,
+                    std::type_identity_t<Point3SoA<const T>> points,
+                    std::span<uint64_t> mask)
+{
+    auto test = [&](size_t i) { return Internal::InsideBranchless(b, points.Get(i)); };
+#if MATH_SIMD_SSE2
+    if constexpr (std::is_same_v<T, float>)
+    {
+        auto test_block = [&](size_t i)
+        {
+            return Internal::InsideSSE(b, _mm_loadu_ps(&points.x[i]), _mm_loadu_ps(&points.y[i]),
+                                       _mm_loadu_ps(&points.z[i]));
+        };
+        return Internal::FillMask<4>(points.Size(), mask, test_block, test);
+    }
+    else
+#endif
+    {
+        return Internal::FillMask(points.Size(), mask, test);
+    }
+}
+
+template <Math::FloatingPoint T>
+void Math::TransformBounds(std::type_identity_t<std::span<const Matrix4x4<T>>> matrices,
+                           std::type_identity_t<std::span<const Bounds3<T>>> boxes,
+                           std::type_identity_t<std::span<Bounds3<T>>> out_boxes)
+{
+    assert(matrices.size() == boxes.size() && boxes.size() == out_boxes.size());
+#if MATH_SIMD_SSE2
+    if constexpr (std::is_same_v<T, float>)
+    {
+        static_assert(sizeof(Matrix4x4<float>) == 16 * sizeof(float));
+        const __m128 half = _mm_set1_ps(0.5f);
+        for (size_t i = 0; i < boxes.size(); ++i)
+        {
+            // Transpose the rows so that lanes 0 to 2 of column j are the column j of the matrix.
+            const auto& rows = matrices[i].elements;
+            __m128 column0 = _mm_loadu_ps(rows[0].data());
+            __m128 column1 = _mm_loadu_ps(rows[1].data());
+            __m128 column2 = _mm_loadu_ps(rows[2].data());
+            __m128 column3 = _mm_loadu_ps(rows[3].data());
+            _MM_TRANSPOSE4_PS(column0, column1, column2, column3);
+
+            const __m128 min = Internal::LoadMinSSE(boxes[i]);
+            const __m128 max = Internal::LoadMaxSSE(boxes[i]);
+            const __m128 max_low = _mm_shuffle_ps(max, max, _MM_SHUFFLE(3, 3, 2, 1));
+            const __m128 center = _mm_mul_ps(_mm_add_ps(min, max_low), half);
+            const __m128 extent = _mm_mul_ps(_mm_sub_ps(max_low, min), half);
+
+            // The same order of operations as TransformBounds, so the results are identical.
+            const __m128 center_x = _mm_shuffle_ps(center, center, _MM_SHUFFLE(0, 0, 0, 0));
+            const __m128 center_y = _mm_shuffle_ps(center, center, _MM_SHUFFLE(1, 1, 1, 1));
+            const __m128 center_z = _mm_shuffle_ps(center, center, _MM_SHUFFLE(2, 2, 2, 2));
+            const __m128 xy = Internal::MulAdd(column1, center_y, _mm_mul_ps(column0, center_x));
+            const __m128 new_center = _mm_add_ps(Internal::MulAdd(column2, center_z, xy), column3);
+            const __m128 extent_x = _mm_shuffle_ps(extent, extent, _MM_SHUFFLE(0, 0, 0, 0));
+            const __m128 extent_y = _mm_shuffle_ps(extent, extent, _MM_SHUFFLE(1, 1, 1, 1));
+            const __m128 extent_z = _mm_shuffle_ps(extent, extent, _MM_SHUFFLE(2, 2, 2, 2));
+            const __m128 new_extent = Internal::MulAdd(
+                Internal::AbsSSE(column2), extent_z,
+                Internal::MulAdd(Internal::AbsSSE(column1), extent_y,
+                                 _mm_mul_ps(Internal::AbsSSE(column0), extent_x)));
+            Internal::StoreBoundsSSE(out_boxes[i], _mm_sub_ps(new_center, new_extent),
+                                     _mm_add_ps(new_center, new_extent));
+        }
+        return;
+    }
+#endif
+    for (size_t i = 0; i < boxes.size(); ++i)
+    {
+        out_boxes[i] = TransformBounds(matrices[i], boxes[i]);
+    }
+}
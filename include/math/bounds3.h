@@ -33,19 +33,19 @@ struct Bounds3
      * @param p1 First point.
      * @param p2 Second point.
      */
-    Bounds3(const Point3<T>& p1, const Point3<T>& p2);
+    constexpr Bounds3(const Point3<T>& p1, const Point3<T>& p2);
 
     /**
      * Access min or max by index.
      * @param index 0 for min, 1 for max.
      * @return The min or max point.
      */
-    Point3<T>& operator[](int32_t index);
-    const Point3<T>& operator[](int32_t index) const;
+    constexpr Point3<T>& operator[](int32_t index);
+    constexpr const Point3<T>& operator[](int32_t index) const;
 
     /** Operators. */
-    bool operator==(const Bounds3& other) const;
-    bool operator!=(const Bounds3& other) const;
+    constexpr bool operator==(const Bounds3& other) const;
+    constexpr bool operator!=(const Bounds3& other) const;
 };
 
 /**
@@ -58,7 +58,7 @@ struct Bounds3
  * @return The corner of the bounding box specified by the mask.
  */
 template <typename T>
-[[nodiscard]] Point3<T> Corner(const Bounds3<T>& b, uint8_t mask);
+[[nodiscard]] constexpr Point3<T> Corner(const Bounds3<T>& b, uint8_t mask);
 
 /**
  * Returns the diagonal of the bounding box.
@@ -67,7 +67,7 @@ template <typename T>
  * @return The diagonal of the bounding box pointing from min to max point.
  */
 template <typename T>
-[[nodiscard]] Vector3<T> Diagonal(const Bounds3<T>& b);
+[[nodiscard]] constexpr Vector3<T> Diagonal(const Bounds3<T>& b);
 
 /**
  * Calculates the surface area of the bounding box.
@@ -76,7 +76,7 @@ template <typename T>
  * @return The surface area of the bounding box.
  */
 template <typename T>
-[[nodiscard]] T SurfaceArea(const Bounds3<T>& b);
+[[nodiscard]] constexpr T SurfaceArea(const Bounds3<T>& b);
 
 /**
  * Calculates the volume of the bounding box.
@@ -85,7 +85,7 @@ template <typename T>
  * @return The volume of the bounding box.
  */
 template <typename T>
-[[nodiscard]] T Volume(const Bounds3<T>& b);
+[[nodiscard]] constexpr T Volume(const Bounds3<T>& b);
 
 /**
  * Returns the index of the axis with the maximum extent.
@@ -94,7 +94,7 @@ template <typename T>
  * @return The index of the axis with the maximum extent.
  */
 template <typename T>
-[[nodiscard]] int32_t MaximumExtent(const Bounds3<T>& b);
+[[nodiscard]] constexpr int32_t MaximumExtent(const Bounds3<T>& b);
 
 /**
  * Calculate linear interpolation between the min and max point of the bounding box.
@@ -104,7 +104,7 @@ template <typename T>
  * @return The interpolated point.
  */
 template <FloatingPoint T>
-[[nodiscard]] Point3<T> Lerp(const Bounds3<T>& b, const Point3<T>& t);
+[[nodiscard]] constexpr Point3<T> Lerp(const Bounds3<T>& b, const Point3<T>& t);
 
 /**
  * Calculate the offset of a point from the minimum corner of the bounding box scaled by
@@ -116,7 +116,7 @@ template <FloatingPoint T>
  * of the bounding box extent.
  */
 template <FloatingPoint T>
-[[nodiscard]] Vector3<T> Offset(const Bounds3<T>& b, const Point3<T>& p);
+[[nodiscard]] constexpr Vector3<T> Offset(const Bounds3<T>& b, const Point3<T>& p);
 
 /**
  * Calculates a sphere that bounds the bounding box.
@@ -126,7 +126,7 @@ template <FloatingPoint T>
  * @param out_radius The radius of the sphere.
  */
 template <FloatingPoint T>
-void BoundingSphere(const Bounds3<T>& b, Point3<T>& out_center, T& out_radius);
+constexpr void BoundingSphere(const Bounds3<T>& b, Point3<T>& out_center, T& out_radius);
 
 /**
  * Calculates the extent of the bounding box.
@@ -135,7 +135,7 @@ void BoundingSphere(const Bounds3<T>& b, Point3<T>& out_center, T& out_radius);
  * @return The extent of the bounding box.
  */
 template <typename T>
-[[nodiscard]] Vector3<T> Extent(const Bounds3<T>& b);
+[[nodiscard]] constexpr Vector3<T> Extent(const Bounds3<T>& b);
 
 /**
  * Calculates the union of a bounding box and a point.
@@ -145,7 +145,7 @@ template <typename T>
  * @return The union of the bounding box and the point.
  */
 template <typename T>
-[[nodiscard]] Bounds3<T> Union(const Bounds3<T>& b, const Point3<T>& p);
+[[nodiscard]] constexpr Bounds3<T> Union(const Bounds3<T>& b, const Point3<T>& p);
 
 /**
  * Calculates the union of two bounding boxes.
@@ -155,7 +155,7 @@ template <typename T>
  * @return The union of the two bounding boxes.
  */
 template <typename T>
-[[nodiscard]] Bounds3<T> Union(const Bounds3<T>& b1, const Bounds3<T>& b2);
+[[nodiscard]] constexpr Bounds3<T> Union(const Bounds3<T>& b1, const Bounds3<T>& b2);
 
 /**
  * Expands the bounding box by a constant amount in all directions.
@@ -165,7 +165,7 @@ template <typename T>
  * @return The expanded bounding box.
  */
 template <typename T>
-[[nodiscard]] Bounds3<T> Expand(const Bounds3<T>& b, T delta);
+[[nodiscard]] constexpr Bounds3<T> Expand(const Bounds3<T>& b, T delta);
 
 /**
  * Checks if two bounding boxes overlap.
@@ -175,7 +175,7 @@ template <typename T>
  * @return True if the bounding boxes overlap, false otherwise.
  */
 template <typename T>
-bool Overlaps(const Bounds3<T>& b1, const Bounds3<T>& b2);
+constexpr bool Overlaps(const Bounds3<T>& b1, const Bounds3<T>& b2);
 
 /**
  * Calculates the intersection of two bounding boxes.
@@ -186,7 +186,7 @@ bool Overlaps(const Bounds3<T>& b1, const Bounds3<T>& b2);
  * result is undefined. Use Overlaps() to check if the bounding boxes overlap.
  */
 template <typename T>
-[[nodiscard]] Bounds3<T> Intersect(const Bounds3<T>& b1, const Bounds3<T>& b2);
+[[nodiscard]] constexpr Bounds3<T> Intersect(const Bounds3<T>& b1, const Bounds3<T>& b2);
 
 /**
  * Checks if a point is inside a bounding box. Note that the point is not counted if it is on the
@@ -197,7 +197,7 @@ template <typename T>
  * @return True if the point is inside the bounding box, false otherwise.
  */
 template <typename T>
-bool Inside(const Bounds3<T>& b, const Point3<T>& p);
+constexpr bool Inside(const Bounds3<T>& b, const Point3<T>& p);
 
 /**
  * Checks if a point is inside a bounding box. Note that the point is counted if it is on the
@@ -208,7 +208,7 @@ bool Inside(const Bounds3<T>& b, const Point3<T>& p);
  * @return True if the point is inside the bounding box, false otherwise.
  */
 template <typename T>
-bool InsideInclusive(const Bounds3<T>& b, const Point3<T>& p);
+constexpr bool InsideInclusive(const Bounds3<T>& b, const Point3<T>& p);
 
 }  // namespace Math
 
@@ -226,65 +226,65 @@ constexpr Math::Bounds3<T>::Bounds3(const Point3<T>& p) : min(p), max(p)
 }
 
 template <typename T>
-Math::Bounds3<T>::Bounds3(const Point3<T>& p1, const Point3<T>& p2)
+constexpr Math::Bounds3<T>::Bounds3(const Point3<T>& p1, const Point3<T>& p2)
 {
     min = Point3<T>(Math::Min(p1.x, p2.x), Math::Min(p1.y, p2.y), Math::Min(p1.z, p2.z));
     max = Point3<T>(Math::Max(p1.x, p2.x), Math::Max(p1.y, p2.y), Math::Max(p1.z, p2.z));
 }
 
 template <typename T>
-Math::Point3<T>& Math::Bounds3<T>::operator[](int32_t index)
+constexpr Math::Point3<T>& Math::Bounds3<T>::operator[](int32_t index)
 {
-    return (&min)[index];
+    return index == 0 ? min : max;
 }
 
 template <typename T>
-const Math::Point3<T>& Math::Bounds3<T>::operator[](int32_t index) const
+constexpr const Math::Point3<T>& Math::Bounds3<T>::operator[](int32_t index) const
 {
-    return (&min)[index];
+    return index == 0 ? min : max;
 }
 
 template <typename T>
-bool Math::Bounds3<T>::operator==(const Bounds3& other) const
+constexpr bool Math::Bounds3<T>::operator==(const Bounds3& other) const
 {
     return min == other.min && max == other.max;
 }
 
 template <typename T>
-bool Math::Bounds3<T>::operator!=(const Bounds3& other) const
+constexpr bool Math::Bounds3<T>::operator!=(const Bounds3& other) const
 {
     return min != other.min || max != other.max;
 }
 
 template <typename T>
-Math::Point3<T> Math::Corner(const Bounds3<T>& b, uint8_t mask)
+constexpr Math::Point3<T> Math::Corner(const Bounds3<T>& b, uint8_t mask)
 {
     return Point3<T>((mask & 1) ? b.max.x : b.min.x, (mask & 2) ? b.max.y : b.min.y,
                       (mask & 4) ? b.max.z : b.min.z);
 }
 
 template <typename T>
-Math::Vector3<T> Math::Diagonal(const Bounds3<T>& b)
+constexpr Math::Vector3<T> Math::Diagonal(const Bounds3<T>& b)
 {
     return b.max - b.min;
 }
 
 template <typename T>
-T Math::SurfaceArea(const Bounds3<T>& b)
+constexpr T Math::SurfaceArea(const Bounds3<T>& b)
 {
     const Vector3<T> diag = Diagonal(b);
     return 2 * (diag.x * diag.y + diag.x * diag.z + diag.y * diag.z);
 }
 
 template <typename T>
-T Math::Volume(const Bounds3<T>& b)
+constexpr T Math::Volume(const Bounds3<T>& b)
 {
     const Vector3<T> diag = Diagonal(b);
     return diag.x * diag.y * diag.z;
 }
 
 template <typename T>
-int32_t Math::MaximumExtent(const Bounds3<T>& b)
+constexpr int32_t Math::MaximumExtent(const Bounds3<T>& b)
 {
     const Vector3<T> diag = Diagonal(b);
     if (diag.x > diag.y && diag.x > diag.z)
@@ -299,14 +299,14 @@ int32_t Math::MaximumExtent(const Bounds3<T>& b)
 }
 
 template <Math::FloatingPoint T>
-Math::Point3<T> Math::Lerp(const Bounds3<T>& b, const Point3<T>& t)
+constexpr Math::Point3<T> Math::Lerp(const Bounds3<T>& b, const Point3<T>& t)
 {
     return Point3<T>(Math::Lerp(t.x, b.min.x, b.max.x), Math::Lerp(t.y, b.min.y, b.max.y),
                       Math::Lerp(t.z, b.min.z, b.max.z));
 }
 
 template <Math::FloatingPoint T>
-Math::Vector3<T> Math::Offset(const Bounds3<T>& b, const Point3<T>& p)
+constexpr Math::Vector3<T> Math::Offset(const Bounds3<T>& b, const Point3<T>& p)
 {
     Vector3<T> o = p - b.min;
     if (b.max.x > b.min.x)
@@ -325,20 +325,20 @@ Math::Vector3<T> Math::Offset(const Bounds3<T>& b, const Point3<T>& p)
 }
 
 template <Math::FloatingPoint T>
-void Math::BoundingSphere(const Bounds3<T>& b, Point3<T>& out_center, T& out_radius)
+constexpr void Math::BoundingSphere(const Bounds3<T>& b, Point3<T>& out_center, T& out_radius)
 {
     out_center = b.min + (b.max - b.min) / static_cast<T>(2);
     out_radius = Inside(b, out_center) ? static_cast<T>(Distance(out_center, b.max)) : 0;
 }
 
 template <typename T>
-Math::Vector3<T> Math::Extent(const Bounds3<T>& b)
+constexpr Math::Vector3<T> Math::Extent(const Bounds3<T>& b)
 {
     return Math::Abs(b.max - b.min);
 }
 
 template <typename T>
-Math::Bounds3<T> Math::Union(const Bounds3<T>& b, const Point3<T>& p)
+constexpr Math::Bounds3<T> Math::Union(const Bounds3<T>& b, const Point3<T>& p)
 {
     return Bounds3<T>(
         Point3<T>(Math::Min(b.min.x, p.x), Math::Min(b.min.y, p.y),
@@ -348,7 +348,7 @@ Math::Bounds3<T> Math::Union(const Bounds3<T>& b, const Point3<T>& p)
 }
 
 template <typename T>
-Math::Bounds3<T> Math::Union(const Bounds3<T>& b1, const Bounds3<T>& b2)
+constexpr Math::Bounds3<T> Math::Union(const Bounds3<T>& b1, const Bounds3<T>& b2)
 {
     return Bounds3<T>(Point3<T>(Math::Min(b1.min.x, b2.min.x), Math::Min(b1.min.y, b2.min.y),
                                  Math::Min(b1.min.z, b2.min.z)),
@@ -357,14 +357,14 @@ Math::Bounds3<T> Math::Union(const Bounds3<T>& b1, const Bounds3<T>& b2)
 }
 
 template <typename T>
-Math::Bounds3<T> Math::Expand(const Bounds3<T>& b, T delta)
+constexpr Math::Bounds3<T> Math::Expand(const Bounds3<T>& b, T delta)
 {
     return Bounds3<T>(b.min - Vector3<T>(delta, delta, delta),
                       b.max + Vector3<T>(delta, delta, delta));
 }
 
 template <typename T>
-bool Math::Overlaps(const Bounds3<T>& b1, const Bounds3<T>& b2)
+constexpr bool Math::Overlaps(const Bounds3<T>& b1, const Bounds3<T>& b2)
 {
     bool x = (b1.max.x >= b2.min.x) && (b1.min.x <= b2.max.x);
     bool y = (b1.max.y >= b2.min.y) && (b1.min.y <= b2.max.y);
@@ -373,7 +373,7 @@ bool Math::Overlaps(const Bounds3<T>& b1, const Bounds3<T>& b2)
 }
 
 template <typename T>
-Math::Bounds3<T> Math::Intersect(const Bounds3<T>& b1, const Bounds3<T>& b2)
+constexpr Math::Bounds3<T> Math::Intersect(const Bounds3<T>& b1, const Bounds3<T>& b2)
 {
     return Bounds3<T>(Point3<T>(Math::Max(b1.min.x, b2.min.x), Math::Max(b1.min.y, b2.min.y),
                                  Math::Max(b1.min.z, b2.min.z)),
@@ -382,14 +382,14 @@ Math::Bounds3<T> Math::Intersect(const Bounds3<T>& b1, const Bounds3<T>& b2)
 }
 
 template <typename T>
-bool Math::Inside(const Bounds3<T>& b, const Point3<T>& p)
+constexpr bool Math::Inside(const Bounds3<T>& b, const Point3<T>& p)
 {
     return (p.x >= b.min.x && p.x < b.max.x && p.y >= b.min.y && p.y < b.max.y &&
             p.z >= b.min.z && p.z < b.max.z);
 }
 
 template <typename T>
-bool Math::InsideInclusive(const Bounds3<T>& b, const Point3<T>& p)
+constexpr bool Math::InsideInclusive(const Bounds3<T>& b, const Point3<T>& p)
 {
     return (p.x >= b.min.x && p.x <= b.max.x && p.y >= b.min.y && p.y <= b.max.y &&
             p.z >= b.min.z && p.z <= b.max.z);
@@ -0,0 +1,286 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "math/binary-file.h"
+#include "math/linear-bvh.h"
+
+namespace Math
+{
+
+/**
+ * How the primitives of a hierarchy were split into its nodes.
+ */
+enum class BVHSplitMethod : uint32_t
+{
+    /** Not recorded, for hierarchies built outside of this library. */
+    Unknown = 0,
+    /** Split on the bits of the Morton codes of the centroids, as LinearBVH is built. */
+    Morton = 1,
+};
+
+/**
+ * Description of a hierarchy stored in a binary file, followed in the file by the array of its
+ * nodes.
+ */
+struct BVHFileHeader
+{
+    static constexpr uint32_t k_version = 2;
+
+    uint32_t version;
+    /** BinaryType of the nodes, BVHNodef or BVHNoded. */
+    BinaryType node_type;
+    uint32_t primitive_count;
+    uint32_t node_count;
+    /** Longest path from the root to a leaf, bounds the traversal stack. */
+    uint32_t depth;
+    /** Largest number of primitives in a leaf, 1 since a BVHNode refers to a single primitive. */
+    uint32_t max_leaf_size;
+    /** How the builder split the primitives. */
+    BVHSplitMethod split_method;
+    uint32_t reserved;
+    /** Checksum of the bytes of the nodes. */
+    uint64_t checksum;
+};
+
+template <>
+inline constexpr BinaryType k_binary_type<BVHFileHeader> = BinaryType::BVHHeader;
+template <>
+inline constexpr BinaryType k_binary_type<BVHNode<float>> = BinaryType::BVHNodef;
+template <>
+inline constexpr BinaryType k_binary_type<BVHNode<double>> = BinaryType::BVHNoded;
+
+/**
+ * Write a hierarchy to a binary file, as an array with a BVHFileHeader followed by the array of the
+ * nodes. The nodes refer to each other and to the primitives by index, so they are used in place
+ * when the file is mapped, without rebuilding the hierarchy.
+ * @param writer The open writer.
+ * @param name The name of the header array.
+ * @param bvh The hierarchy.
+ * @param split_method How the hierarchy was built, recorded in the header.
+ * @return False if writing failed.
+ */
+template <FloatingPoint T>
+bool WriteBVH(BinaryFileWriter& writer,
+              std::string_view name,
+              BVHView<T> bvh,
+              BVHSplitMethod split_method = BVHSplitMethod::Unknown);
+
+/**
+ * Write a hierarchy to a binary file, with BVHSplitMethod::Morton in the header.
+ * @see WriteBVH(BinaryFileWriter&, std::string_view, BVHView<T>, BVHSplitMethod)
+ */
+template <FloatingPoint T>
+bool WriteBVH(BinaryFileWriter& writer, std::string_view name, const LinearBVH<T>& bvh);
+
+/**
+ * Get a view of a hierarchy in a mapped binary file, to query it with ForEachOverlap.
+ * @param file The mapped file.
+ * @param name The name given to WriteBVH.
+ * @param bvh The view of the nodes in the mapping, valid until the file is closed.
+ * @param verify_checksum Compare the checksum of the nodes. Without it a corrupted file can still
+ * give wrong bounds, but the indices of the nodes are always checked, so queries stay in the node
+ * array and within the depth of the traversal stack.
+ * @return False if the file has no hierarchy with the name and type, or it fails the checks.
+ */
+template <FloatingPoint T>
+bool LoadBVH(const MappedBinaryFile& file,
+             std::string_view name,
+             BVHView<T>& bvh,
+             bool verify_checksum = true);
+
+}  // namespace Math
+
+// Implementation //////////////////////////////////////////////////////////////////////////////////
+
+namespace Math::Internal
+{
+
+/**
+ * 64-bit checksum of the bytes, with four independent lanes of XXH64 rounds so that the
+ * multiplications overlap.
+ */
+inline uint64_t BVHChecksum(std::span<const std::byte> bytes)
+{
+    constexpr uint64_t k_prime1 = 0x9e3779b185ebca87;
+    constexpr uint64_t k_prime2 = 0xc2b2ae3d27d4eb4f;
+    auto round = [](uint64_t lane, uint64_t word)
+    { return std::rotl(lane + word * k_prime2, 31) * k_prime1; };
+    auto load = [&](size_t offset)
+    {
+        uint64_t word;
+        std::memcpy(&word, bytes.data() + offset, sizeof(word));
+        return word;
+    };
+
+    uint64_t lanes[4] = {k_prime1 + k_prime2, k_prime2, 0, 0 - k_prime1};
+    size_t offset = 0;
+    for (; offset + 32 <= bytes.size(); offset += 32)
+    {
+        for (size_t lane = 0; lane < 4; ++lane)
+        {
+            lanes[lane] = round(lanes[lane], load(offset + 8 * lane));
+        }
+    }
+    uint64_t hash = std::rotl(lanes[0], 1) + std::rotl(lanes[1], 7) + std::rotl(lanes[2], 12) +
+                    std::rotl(lanes[3], 18) + bytes.size();
+    for (; offset + 8 <= bytes.size(); offset += 8)
+    {
+        hash = round(hash, load(offset));
+    }
+    for (; offset < bytes.size(); ++offset)
+    {
+        hash = round(hash, static_cast<uint64_t>(bytes[offset]));
+    }
+    hash ^= hash >> 33;
+    hash *= k_prime2;
+    hash ^= hash >> 29;
+    return hash;
+}
+
+template <FloatingPoint T>
+uint32_t BVHDepth(BVHView<T> bvh)
+{
+    if (bvh.nodes.empty())
+    {
+        return 0;
+    }
+    uint32_t depth = 0;
+    std::vector<std::pair<uint32_t, uint32_t>> stack = {{0, 0}};
+    while (!stack.empty())
+    {
+        const auto [node, node_depth] = stack.back();
+        stack.pop_back();
+        depth = Math::Max(depth, node_depth);
+        if (!bvh.IsLeaf(node))
+        {
+            stack.emplace_back(bvh.nodes[node].left, node_depth + 1);
+            stack.emplace_back(bvh.nodes[node].right, node_depth + 1);
+        }
+    }
+    return depth;
+}
+
+/**
+ * Check that a traversal from the root stays in the node array, finds primitive indices below
+ * primitive_count, goes no deeper than max_depth and visits as many nodes as the array holds.
+ * Cycles and most shared subtrees fail the last two checks, and whatever passes is as safe to
+ * traverse as a valid hierarchy.
+ */
+template <FloatingPoint T>
+bool ValidBVHIndices(std::span<const BVHNode<T>> nodes,
+                     uint32_t primitive_count,
+                     uint32_t max_depth)
+{
+    if (nodes.empty())
+    {
+        return true;
+    }
+    std::array<std::pair<uint32_t, uint32_t>, k_bvh_max_depth + 1> stack;
+    size_t stack_size = 0;
+    stack[stack_size++] = {0, 0};
+    size_t visited = 0;
+    while (stack_size > 0)
+    {
+        const auto [node, node_depth] = stack[--stack_size];
+        if (++visited > nodes.size())
+        {
+            return false;
+        }
+        const BVHNode<T>& n = nodes[node];
+        if (n.right == k_bvh_leaf)
+        {
+            if (n.left >= primitive_count)
+            {
+                return false;
+            }
+            continue;
+        }
+        if (node_depth >= max_depth || n.left >= nodes.size() || n.right >= nodes.size())
+        {
+            return false;
+        }
+        stack[stack_size++] = {n.right, node_depth + 1};
+        stack[stack_size++] = {n.left, node_depth + 1};
+    }
+    return visited == nodes.size();
+}
+
+}  // namespace Math::Internal
+
+template <Math::FloatingPoint T>
+bool Math::WriteBVH(BinaryFileWriter& writer,
+                    std::string_view name,
+                    BVHView<T> bvh,
+                    BVHSplitMethod split_method)
+{
+    BVHFileHeader header = {};
+    header.version = BVHFileHeader::k_version;
+    header.node_type = k_binary_type<BVHNode<T>>;
+    header.primitive_count = static_cast<uint32_t>((bvh.nodes.size() + 1) / 2);
+    header.node_count = static_cast<uint32_t>(bvh.nodes.size());
+    header.depth = Internal::BVHDepth(bvh);
+    header.max_leaf_size = 1;
+    header.split_method = split_method;
+    header.checksum = Internal::BVHChecksum(std::as_bytes(bvh.nodes));
+    return writer.WriteArray<BVHFileHeader>(name, std::span(&header, 1)) &&
+           writer.WriteArray<BVHNode<T>>(name, bvh.nodes);
+}
+
+template <Math::FloatingPoint T>
+bool Math::WriteBVH(BinaryFileWriter& writer, std::string_view name, const LinearBVH<T>& bvh)
+{
+    return WriteBVH(writer, name, BVHView<T>{bvh.nodes}, BVHSplitMethod::Morton);
+}
+
+template <Math::FloatingPoint T>
+bool Math::LoadBVH(const MappedBinaryFile& file,
+                   std::string_view name,
+                   BVHView<T>& bvh,
+                   bool verify_checksum)
+{
+    // The nodes are the array after the header.
+    const size_t index = file.FindArray(name);
+    if (index == MappedBinaryFile::k_invalid_array || index + 1 >= file.ArrayCount())
+    {
+        return false;
+    }
+    const BinaryArrayInfo& header_info = file.GetArrayInfo(index);
+    const BinaryArrayInfo& nodes_info = file.GetArrayInfo(index + 1);
+    if (header_info.type != BinaryType::BVHHeader || header_info.count != 1 ||
+        header_info.element_size != sizeof(BVHFileHeader) ||
+        nodes_info.type != k_binary_type<BVHNode<T>> ||
+        nodes_info.element_size != sizeof(BVHNode<T>))
+    {
+        return false;
+    }
+
+    const BVHFileHeader& header = file.GetArray<BVHFileHeader>(index)[0];
+    const std::span<const BVHNode<T>> nodes = file.GetArray<BVHNode<T>>(index + 1);
+    const uint64_t expected_nodes =
+        header.primitive_count == 0 ? 0 : 2 * uint64_t{header.primitive_count} - 1;
+    if (header.version != BVHFileHeader::k_version || header.node_type != nodes_info.type ||
+        header.node_count != nodes.size() || expected_nodes != nodes.size() ||
+        header.depth > Internal::k_bvh_max_depth || header.max_leaf_size != 1)
+    {
+        return false;
+    }
+    if (verify_checksum && Internal::BVHChecksum(std::as_bytes(nodes)) != header.checksum)
+    {
+        return false;
+    }
+    if (!Internal::ValidBVHIndices(nodes, header.primitive_count, header.depth))
+    {
+        return false;
+    }
+    bvh.nodes = nodes;
+    return true;
+}
@@ -0,0 +1,490 @@
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "math/base.h"
+#include "math/bounds3.h"
+#include "math/spatial-types.h"
+
+namespace Math
+{
+
+/**
+ * Bounding volume hierarchy that is updated incrementally, for a broadphase where objects move a
+ * bit every frame. Every object is stored as a leaf with its bounds expanded by a margin, moving
+ * the object only changes the tree when its bounds leave the expanded bounds. Leaves are inserted
+ * next to the sibling that increases the surface area of the tree the least, and the tree is kept
+ * balanced with rotations on the path to the root. Nodes live in a pool that reuses their slots.
+ * Based on: Box2D b2DynamicTree, Erin Catto.
+ * @tparam T Data type of the bounds.
+ */
+template <FloatingPoint T>
+class DynamicAABBTree
+{
+public:
+    /**
+     * Constructs an empty tree.
+     * @param margin The distance the bounds of the objects are expanded by.
+     */
+    explicit DynamicAABBTree(T margin = static_cast<T>(0.1));
+
+    /**
+     * Insert an object.
+     * @param bounds The bounds of the object.
+     * @return The id of the object, valid until the object is removed.
+     */
+    uint32_t Insert(const Bounds3<T>& bounds);
+
+    /**
+     * Remove an object, its id can be reused by the next insertion.
+     * @param id The id of the object.
+     */
+    void Remove(uint32_t id);
+
+    /**
+     * Update the bounds of an object.
+     * @param id The id of the object.
+     * @param bounds The new bounds of the object.
+     * @return True if the object was reinserted, false if the bounds are still inside the expanded
+     * bounds of the object and the tree did not change.
+     */
+    bool Move(uint32_t id, const Bounds3<T>& bounds);
+
+    /**
+     * Get the expanded bounds of an object that the queries are tested against.
+     * @param id The id of the object.
+     * @return The expanded bounds.
+     */
+    [[nodiscard]] const Bounds3<T>& GetFatBounds(uint32_t id) const;
+
+    /**
+     * Visit the objects whose expanded bounds overlap the query.
+     * @param query The bounds to test against.
+     * @param func Function called with the id of each overlapping object.
+     */
+    template <typename Func>
+    void ForEachOverlap(const Bounds3<T>& query, Func&& func) const;
+
+    /**
+     * Find all pairs of objects whose expanded bounds overlap, by traversing the tree against
+     * itself.
+     * @param pairs Preallocated output, filled with the first pairs found.
+     * @return The total number of overlapping pairs, which is larger than the size of the output if
+     * it was too small.
+     */
+    size_t FindOverlapPairs(std::span<OverlapPair> pairs) const;
+
+    /**
+     * @return The number of objects in the tree.
+     */
+    [[nodiscard]] size_t Size() const;
+
+    /**
+     * @return The height of the tree, 0 for a tree with a single object.
+     */
+    [[nodiscard]] int32_t Height() const;
+
+private:
+    static constexpr uint32_t k_invalid = UINT32_MAX;
+    static constexpr size_t k_max_height = 64;
+
+    struct Node
+    {
+        Bounds3<T> bounds;
+        // Next free node when the node is in the pool.
+        uint32_t parent;
+        // Both children are invalid for a leaf.
+        uint32_t left;
+        uint32_t right;
+        // 0 for a leaf, -1 when the node is in the pool.
+        int32_t height;
+
+        [[nodiscard]] bool IsLeaf() const { return left == k_invalid; }
+    };
+
+    uint32_t AllocateNode();
+    void FreeNode(uint32_t node);
+    void InsertLeaf(uint32_t leaf);
+    void RemoveLeaf(uint32_t leaf);
+    /** Update the bounds and heights from the node to the root, balancing every node on the way. */
+    void RefitToRoot(uint32_t node);
+    uint32_t Balance(uint32_t node);
+    void ReplaceChild(uint32_t parent, uint32_t old_child, uint32_t new_child);
+    void SelfPairs(uint32_t node, std::span<OverlapPair> pairs, size_t& count) const;
+    void CrossPairs(uint32_t a, uint32_t b, std::span<OverlapPair> pairs, size_t& count) const;
+
+    std::vector<Node> m_nodes;
+    uint32_t m_root = k_invalid;
+    uint32_t m_free_node = k_invalid;
+    size_t m_size = 0;
+    T m_margin;
+};
+
+}  // namespace Math
+
+// Implementation //////////////////////////////////////////////////////////////////////////////////
+
+template <Math::FloatingPoint T>
+Math::DynamicAABBTree<T>::DynamicAABBTree(T margin) : m_margin(margin)
+{
+    assert(margin >= 0);
+}
+
+template <Math::FloatingPoint T>
+uint32_t Math::DynamicAABBTree<T>::Insert(const Bounds3<T>& bounds)
+{
+    const uint32_t leaf = AllocateNode();
+    m_nodes[leaf].bounds = Expand(bounds, m_margin);
+    InsertLeaf(leaf);
+    ++m_size;
+    return leaf;
+}
+
+template <Math::FloatingPoint T>
+void Math::DynamicAABBTree<T>::Remove(uint32_t id)
+{
+    assert(id < m_nodes.size() && m_nodes[id].height == 0);
+    RemoveLeaf(id);
+    FreeNode(id);
+    --m_size;
+}
+
+template <Math::FloatingPoint T>
+bool Math::DynamicAABBTree<T>::Move(uint32_t id, const Bounds3<T>& bounds)
+{
+    assert(id < m_nodes.size() && m_nodes[id].height == 0);
+    const Bounds3<T>& fat = m_nodes[id].bounds;
+    if (fat.min.x <= bounds.min.x && fat.min.y <= bounds.min.y && fat.min.z <= bounds.min.z &&
+        bounds.max.x <= fat.max.x && bounds.max.y <= fat.max.y && bounds.max.z <= fat.max.z)
+    {
+        return false;
+    }
+
+    RemoveLeaf(id);
+    m_nodes[id].bounds = Expand(bounds, m_margin);
+    InsertLeaf(id);
+    return true;
+}
+
+template <Math::FloatingPoint T>
+const Math::Bounds3<T>& Math::DynamicAABBTree<T>::GetFatBounds(uint32_t id) const
+{
+    assert(id < m_nodes.size() && m_nodes[id].height == 0);
+    return m_nodes[id].bounds;
+}
+
+template <Math::FloatingPoint T>
+template <typename Func>
+void Math::DynamicAABBTree<T>::ForEachOverlap(const Bounds3<T>& query, Func&& func) const
+{
+    if (m_root == k_invalid)
+    {
+        return;
+    }
+
+    std::array<uint32_t, k_max_height + 1> stack;
+    size_t stack_size = 0;
+    stack[stack_size++] = m_root;
+    while (stack_size > 0)
+    {
+        const uint32_t index = stack[--stack_size];
+        const Node& node = m_nodes[index];
+        if (!Overlaps(node.bounds, query))
+        {
+            continue;
+        }
+        if (node.IsLeaf())
+        {
+            func(index);
+        }
+        else
+        {
+            assert(stack_size + 2 <= stack.size());
+            stack[stack_size++] = node.right;
+            stack[stack_size++] = node.left;
+        }
+    }
+}
+
+template <Math::FloatingPoint T>
+size_t Math::DynamicAABBTree<T>::FindOverlapPairs(std::span<OverlapPair> pairs) const
+{
+    size_t count = 0;
+    if (m_root != k_invalid)
+    {
+        SelfPairs(m_root, pairs, count);
+    }
+    return count;
+}
+
+template <Math::FloatingPoint T>
+size_t Math::DynamicAABBTree<T>::Size() const
+{
+    return m_size;
+}
+
+template <Math::FloatingPoint T>
+int32_t Math::DynamicAABBTree<T>::Height() const
+{
+    return m_root == k_invalid ? 0 : m_nodes[m_root].height;
+}
+
+template <Math::FloatingPoint T>
+uint32_t Math::DynamicAABBTree<T>::AllocateNode()
+{
+    uint32_t node = m_free_node;
+    if (node != k_invalid)
+    {
+        m_free_node = m_nodes[node].parent;
+    }
+    else
+    {
+        node = static_cast<uint32_t>(m_nodes.size());
+        m_nodes.push_back({});
+    }
+    m_nodes[node].parent = k_invalid;
+    m_nodes[node].left = k_invalid;
+    m_nodes[node].right = k_invalid;
+    m_nodes[node].height = 0;
+    return node;
+}
+
+template <Math::FloatingPoint T>
+void Math::DynamicAABBTree<T>::FreeNode(uint32_t node)
+{
+    m_nodes[node].parent = m_free_node;
+    m_nodes[node].height = -1;
+    m_free_node = node;
+}
+
+template <Math::FloatingPoint T>
+void Math::DynamicAABBTree<T>::InsertLeaf(uint32_t leaf)
+{
+    if (m_root == k_invalid)
+    {
+        m_root = leaf;
+        m_nodes[leaf].parent = k_invalid;
+        return;
+    }
+
+    // Descend to the sibling with the lowest cost, where the cost of a node is the surface area of
+    // the new parent plus the growth of the ancestors that is inherited by all choices below it.
+    const Bounds3<T> leaf_bounds = m_nodes[leaf].bounds;
+    uint32_t sibling = m_root;
+    while (!m_nodes[sibling].IsLeaf())
+    {
+        const Node& node = m_nodes[sibling];
+        const T area = SurfaceArea(node.bounds);
+        const T combined_area = SurfaceArea(Union(node.bounds, leaf_bounds));
+        const T cost = 2 * combined_area;
+        const T inherited_cost = 2 * (combined_area - area);
+
+        auto descend_cost = [&](uint32_t child)
+        {
+            const Node& c = m_nodes[child];
+            const T enlarged = SurfaceArea(Union(c.bounds, leaf_bounds));
+            return (c.IsLeaf() ? enlarged : enlarged - SurfaceArea(c.bounds)) + inherited_cost;
+        };
+        const T left_cost = descend_cost(node.left);
+        const T right_cost = descend_cost(node.right);
+        if (cost < left_cost && cost < right_cost)
+        {
+            break;
+        }
+        sibling = left_cost < right_cost ? node.left : node.right;
+    }
+
+    const uint32_t old_parent = m_nodes[sibling].parent;
+    const uint32_t new_parent = AllocateNode();
+    Node& parent = m_nodes[new_parent];
+    parent.parent = old_parent;
+    parent.bounds = Union(leaf_bounds, m_nodes[sibling].bounds);
+    parent.height = m_nodes[sibling].height + 1;
+    parent.left = sibling;
+    parent.right = leaf;
+    m_nodes[sibling].parent = new_parent;
+    m_nodes[leaf].parent = new_parent;
+    if (old_parent != k_invalid)
+    {
+        ReplaceChild(old_parent, sibling, new_parent);
+    }
+    else
+    {
+        m_root = new_parent;
+    }
+
+    RefitToRoot(m_nodes[leaf].parent);
+}
+
+template <Math::FloatingPoint T>
+void Math::DynamicAABBTree<T>::RemoveLeaf(uint32_t leaf)
+{
+    if (leaf == m_root)
+    {
+        m_root = k_invalid;
+        return;
+    }
+
+    const uint32_t parent = m_nodes[leaf].parent;
+    const uint32_t grand_parent = m_nodes[parent].parent;
+    const uint32_t sibling =
+        m_nodes[parent].left == leaf ? m_nodes[parent].right : m_nodes[parent].left;
+    m_nodes[sibling].parent = grand_parent;
+    FreeNode(parent);
+    if (grand_parent != k_invalid)
+    {
+        ReplaceChild(grand_parent, parent, sibling);
+        RefitToRoot(grand_parent);
+    }
+    else
+    {
+        m_root = sibling;
+    }
+}
+
+template <Math::FloatingPoint T>
+void Math::DynamicAABBTree<T>::RefitToRoot(uint32_t node)
+{
+    while (node != k_invalid)
+    {
+        node = Balance(node);
+        Node& n = m_nodes[node];
+        const Node& left = m_nodes[n.left];
+        const Node& right = m_nodes[n.right];
+        n.bounds = Union(left.bounds, right.bounds);
+        n.height = 1 + Math::Max(left.height, right.height);
+        node = n.parent;
+    }
+}
+
+/**
+ * If the heights of the children of a differ by more than one, rotate the higher child up:
+ *
+ *         a                 c
+ *       /   \             /   \
+ *      b     c    ->     a     f
+ *           / \         / \
+ *          f   g       b   g
+ *
+ * where the higher grandchild f stays below c. Returns the node that took the place of a.
+ */
+template <Math::FloatingPoint T>
+uint32_t Math::DynamicAABBTree<T>::Balance(uint32_t a)
+{
+    Node& node_a = m_nodes[a];
+    if (node_a.IsLeaf() || node_a.height < 2)
+    {
+        return a;
+    }
+
+    const int32_t balance = m_nodes[node_a.right].height - m_nodes[node_a.left].height;
+    if (balance >= -1 && balance <= 1)
+    {
+        return a;
+    }
+
+    // The child that is rotated up, and the child of a that stays.
+    const uint32_t c = balance > 1 ? node_a.right : node_a.left;
+    const uint32_t b = balance > 1 ? node_a.left : node_a.right;
+    Node& node_c = m_nodes[c];
+    const uint32_t f =
+        m_nodes[node_c.left].height > m_nodes[node_c.right].height ? node_c.left : node_c.right;
+    const uint32_t g = f == node_c.left ? node_c.right : node_c.left;
+
+    node_c.parent = node_a.parent;
+    if (node_c.parent != k_invalid)
+    {
+        ReplaceChild(node_c.parent, a, c);
+    }
+    else
+    {
+        m_root = c;
+    }
+    node_a.parent = c;
+    node_c.left = a;
+    node_c.right = f;
+    if (balance > 1)
+    {
+        node_a.right = g;
+    }
+    else
+    {
+        node_a.left = g;
+    }
+    m_nodes[g].parent = a;
+
+    node_a.bounds = Union(m_nodes[b].bounds, m_nodes[g].bounds);
+    node_a.height = 1 + Math::Max(m_nodes[b].height, m_nodes[g].height);
+    node_c.bounds = Union(node_a.bounds, m_nodes[f].bounds);
+    node_c.height = 1 + Math::Max(node_a.height, m_nodes[f].height);
+    return c;
+}
+
+template <Math::FloatingPoint T>
+void Math::DynamicAABBTree<T>::ReplaceChild(uint32_t parent, uint32_t old_child, uint32_t new_child)
+{
+    Node& node = m_nodes[parent];
+    if (node.left == old_child)
+    {
+        node.left = new_child;
+    }
+    else
+    {
+        assert(node.right == old_child);
+        node.right = new_child;
+    }
+}
+
+template <Math::FloatingPoint T>
+void Math::DynamicAABBTree<T>::SelfPairs(uint32_t node,
+                                         std::span<OverlapPair> pairs,
+                                         size_t& count) const
+{
+    const Node& n = m_nodes[node];
+    if (n.IsLeaf())
+    {
+        return;
+    }
+    SelfPairs(n.left, pairs, count);
+    SelfPairs(n.right, pairs, count);
+    CrossPairs(n.left, n.right, pairs, count);
+}
+
+template <Math::FloatingPoint T>
+void Math::DynamicAABBTree<T>::CrossPairs(uint32_t a,
+                                          uint32_t b,
+                                          std::span<OverlapPair> pairs,
+                                          size_t& count) const
+{
+    const Node& node_a = m_nodes[a];
+    const Node& node_b = m_nodes[b];
+    if (!Overlaps(node_a.bounds, node_b.bounds))
+    {
+        return;
+    }
+
+    if (node_a.IsLeaf() && node_b.IsLeaf())
+    {
+        if (count < pairs.size())
+        {
+            pairs[count] = {Math::Min(a, b), Math::Max(a, b)};
+        }
+        ++count;
+    }
+    // Descend into the larger node.
+    else if (node_b.IsLeaf() ||
+             (!node_a.IsLeaf() && SurfaceArea(node_a.bounds) > SurfaceArea(node_b.bounds)))
+    {
+        CrossPairs(node_a.left, b, pairs, count);
+        CrossPairs(node_a.right, b, pairs, count);
+    }
+    else
+    {
+        CrossPairs(a, node_b.left, pairs, count);
+        CrossPairs(a, node_b.right, pairs, count);
+    }
+}
@@ -0,0 +1,544 @@
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include "math/base.h"
+
+namespace Math
+{
+
+/**
+ * Signed fixed point number with FracBits fractional bits stored in an Int, for example
+ * Fixed<int32_t, 16> covers [-32768, 32768) in steps of 1 / 65536. Every operation is done with
+ * integers, so the results are bit identical on every machine and compiler, unlike float, which is
+ * what deterministic lockstep simulations need. The type satisfies FloatingPoint, so Vector3,
+ * Point3, Matrix4x4, Quaternion and the other templates work with it; Sqrt, Sin, Cos, Tan, ArcCos,
+ * ArcTan2, Floor, Ceil and Round have integer implementations, the functions without one (Exp,
+ * LogNatural, Power) do not compile for Fixed. Length and Normalize of the vectors go through
+ * double, whose square root and division are exactly rounded and so deterministic as well.
+ *
+ * Addition, subtraction, multiplication and division wrap around when the result is out of range,
+ * keeping its low bits; multiplication and division round to nearest. Integers convert implicitly,
+ * floating point values only explicitly since the conversion rounds.
+ * @tparam Int The storage type, a signed integer of at most 32 bits.
+ * @tparam FracBits The number of fractional bits, leaving at least one integer bit and the sign.
+ */
+template <std::signed_integral Int, int32_t FracBits>
+class Fixed
+{
+    static_assert(sizeof(Int) <= 4, "Products of wider types don't fit in int64_t.");
+    static_assert(FracBits > 0 && FracBits <= 8 * static_cast<int32_t>(sizeof(Int)) - 2,
+                  "At least one integer bit and the sign are needed to represent one.");
+
+public:
+    /** The integer type wide enough for the products and quotients. */
+    using Wide = std::conditional_t<sizeof(Int) == 4, int64_t, int32_t>;
+
+    static constexpr int32_t k_frac_bits = FracBits;
+
+    /**
+     * Default constructor. No initialization is performed.
+     */
+    Fixed() = default;
+
+    /**
+     * Constructs the fixed point number equal to an integer, or closest to a floating point value.
+     * Values out of range are clamped.
+     * @param value The value.
+     */
+    template <typename U>
+        requires std::is_arithmetic_v<U>
+    constexpr explicit(std::is_floating_point_v<U>) Fixed(U value);
+
+    /**
+     * Constructs a fixed point number from its integer representation, the value times
+     * 2^FracBits.
+     * @param raw The integer representation.
+     * @return The fixed point number.
+     */
+    static constexpr Fixed FromRaw(Int raw);
+
+    /**
+     * Returns the integer representation, the value times 2^FracBits.
+     * @return The integer representation.
+     */
+    constexpr Int Raw() const;
+
+    /** Operators **/
+    template <typename U>
+        requires std::is_arithmetic_v<U>
+    constexpr explicit operator U() const;
+
+    constexpr Fixed operator-() const;
+
+    constexpr Fixed& operator+=(Fixed other);
+    constexpr Fixed& operator-=(Fixed other);
+    constexpr Fixed& operator*=(Fixed other);
+    constexpr Fixed& operator/=(Fixed other);
+
+    // Friends defined in the class so that integers convert implicitly on both sides, as in 1 - t.
+    friend constexpr Fixed operator+(Fixed a, Fixed b) { return a += b; }
+    friend constexpr Fixed operator-(Fixed a, Fixed b) { return a -= b; }
+    friend constexpr Fixed operator*(Fixed a, Fixed b) { return a *= b; }
+    friend constexpr Fixed operator/(Fixed a, Fixed b) { return a /= b; }
+    friend constexpr bool operator==(Fixed a, Fixed b) = default;
+    friend constexpr auto operator<=>(Fixed a, Fixed b) = default;
+
+    /** Replacements of the base functions, called by them. **/
+    static constexpr Fixed Sqrt(Fixed value);
+    static constexpr Fixed Sin(Fixed radians);
+    static constexpr Fixed Cos(Fixed radians);
+    static constexpr Fixed Tan(Fixed radians);
+    // ArcCos and ArcTan2 return angles up to pi, which needs two integer bits besides the sign.
+    static constexpr Fixed ArcCos(Fixed value);
+    static constexpr Fixed ArcTan2(Fixed y, Fixed x);
+    static constexpr Fixed Floor(Fixed value);
+    static constexpr Fixed Ceil(Fixed value);
+    static constexpr Fixed Round(Fixed value);
+    static constexpr bool IsFinite(Fixed value);
+
+    /**
+     * The sum of the squares computed in double from the integer representations, so the squared
+     * length of a vector doesn't wrap around like the product of two Fixed values would.
+     */
+    template <std::same_as<Fixed>... Rest>
+    static constexpr double SumOfSquares(Fixed value, Rest... rest);
+
+private:
+    Int m_raw;
+};
+
+template <std::signed_integral Int, int32_t FracBits>
+inline constexpr bool k_is_floating_point_value<Fixed<Int, FracBits>> = true;
+
+}  // namespace Math
+
+/**
+ * Fixed has no infinity or not a number, infinity() returns max() so that the code that starts a
+ * minimum search with it works.
+ */
+template <std::signed_integral Int, int32_t FracBits>
+class std::numeric_limits<Math::Fixed<Int, FracBits>>
+{
+    using Fixed = Math::Fixed<Int, FracBits>;
+
+public:
+    static constexpr bool is_specialized = true;
+    static constexpr bool is_signed = true;
+    static constexpr bool is_integer = false;
+    static constexpr bool is_exact = true;
+    static constexpr bool has_infinity = false;
+    static constexpr bool has_quiet_NaN = false;
+    static constexpr bool has_signaling_NaN = false;
+    static constexpr float_denorm_style has_denorm = denorm_absent;
+    static constexpr bool has_denorm_loss = false;
+    static constexpr bool is_iec559 = false;
+    static constexpr bool is_bounded = true;
+    static constexpr bool is_modulo = true;
+    static constexpr float_round_style round_style = round_to_nearest;
+    static constexpr int digits = std::numeric_limits<Int>::digits;
+    static constexpr int digits10 = std::numeric_limits<Int>::digits10;
+    static constexpr int max_digits10 = 2 + digits * 30103 / 100000;
+    static constexpr int radix = 2;
+    // There is no exponent, the range is fixed by FracBits.
+    static constexpr int min_exponent = 0;
+    static constexpr int min_exponent10 = 0;
+    static constexpr int max_exponent = 0;
+    static constexpr int max_exponent10 = 0;
+    static constexpr bool traps = false;
+    static constexpr bool tinyness_before = false;
+
+    static constexpr Fixed min() { return Fixed::FromRaw(1); }
+    static constexpr Fixed lowest() { return Fixed::FromRaw(std::numeric_limits<Int>::min()); }
+    static constexpr Fixed max() { return Fixed::FromRaw(std::numeric_limits<Int>::max()); }
+    static constexpr Fixed epsilon() { return Fixed::FromRaw(1); }
+    static constexpr Fixed round_error() { return Fixed::FromRaw(1); }
+    static constexpr Fixed infinity() { return max(); }
+    static constexpr Fixed quiet_NaN() { return Fixed::FromRaw(0); }
+    static constexpr Fixed signaling_NaN() { return Fixed::FromRaw(0); }
+    static constexpr Fixed denorm_min() { return Fixed::FromRaw(1); }
+};
+
+// Implementation //////////////////////////////////////////////////////////////////////////////////
+
+namespace Math::Internal
+{
+
+// The trigonometric functions work on Q30 integers, 30 fractional bits, and look up tables with
+// linear interpolation. 1024 intervals keep the interpolation error below 2^-21.
+inline constexpr int32_t k_fixed_table_bits = 10;
+inline constexpr int32_t k_fixed_table_size = 1 << k_fixed_table_bits;
+inline constexpr int64_t k_fixed_q30_one = int64_t{1} << 30;
+inline constexpr int64_t k_fixed_q30_pi = 3373259426;  // Round(pi * 2^30)
+
+/**
+ * Round to the nearest integer, ties away from zero. Only used at compile time to build tables.
+ */
+constexpr int64_t FixedRoundToInt(double value)
+{
+    return static_cast<int64_t>(value >= 0 ? value + 0.5 : value - 0.5);
+}
+
+/**
+ * sin(x) in Q30 for x in [0, pi / 2], at every 1 / 1024 of the interval.
+ */
+inline constexpr std::array<int32_t, k_fixed_table_size + 1> k_fixed_sine_table = []
+{
+    std::array<int32_t, k_fixed_table_size + 1> table{};
+    for (int32_t i = 0; i <= k_fixed_table_size; ++i)
+    {
+        const double x = k_pi_double / 2 * static_cast<double>(i) / k_fixed_table_size;
+        table[static_cast<size_t>(i)] =
+            static_cast<int32_t>(FixedRoundToInt(ConstexprSin(x) * k_fixed_q30_one));
+    }
+    return table;
+}();
+
+/**
+ * atan(x) in Q30 for x in [0, 1], at every 1 / 1024 of the interval. The series converges slowly
+ * near 1, so it is summed for the smaller argument x / (1 + sqrt(1 + x^2)) and doubled.
+ */
+inline constexpr std::array<int32_t, k_fixed_table_size + 1> k_fixed_arctan_table = []
+{
+    std::array<int32_t, k_fixed_table_size + 1> table{};
+    for (int32_t i = 0; i <= k_fixed_table_size; ++i)
+    {
+        const double x = static_cast<double>(i) / k_fixed_table_size;
+        const double half = x / (1 + ConstexprSqrt(1 + x * x));
+        double term = half;
+        double sum = 0;
+        for (int32_t n = 1; n < 200; n += 2)
+        {
+            sum += term / n;
+            term *= -half * half;
+        }
+        table[static_cast<size_t>(i)] =
+            static_cast<int32_t>(FixedRoundToInt(2 * sum * k_fixed_q30_one));
+    }
+    return table;
+}();
+
+/**
+ * Look up a table at a Q30 position in [0, 1] with linear interpolation.
+ */
+constexpr int64_t FixedLookup(const std::array<int32_t, k_fixed_table_size + 1>& table,
+                              int64_t position)
+{
+    constexpr int32_t k_frac_bits = 30 - k_fixed_table_bits;
+    const int64_t index = position >> k_frac_bits;
+    const int64_t frac = position & ((int64_t{1} << k_frac_bits) - 1);
+    if (index >= k_fixed_table_size)
+    {
+        return table[k_fixed_table_size];
+    }
+    const int64_t a = table[static_cast<size_t>(index)];
+    const int64_t b = table[static_cast<size_t>(index + 1)];
+    return a + (((b - a) * frac) >> k_frac_bits);
+}
+
+/**
+ * Convert radians with FracBits fractional bits to a binary angle, where 2^32 is a full turn. The
+ * product is done modulo 2^64 and the turns above bit 64 drop out, which reduces the angle to one
+ * turn without the error of a rounded 2 pi.
+ */
+template <int32_t FracBits>
+constexpr uint32_t FixedBinaryAngle(int64_t radians)
+{
+    constexpr auto k_scale = static_cast<uint64_t>(
+        FixedRoundToInt(static_cast<double>(uint64_t{1} << (64 - FracBits - 1)) / k_pi_double));
+    return static_cast<uint32_t>((static_cast<uint64_t>(radians) * k_scale) >> 32);
+}
+
+/**
+ * sin of a binary angle, where 2^32 is a full turn, in Q30.
+ */
+constexpr int64_t FixedSinQ30(uint32_t angle)
+{
+    const uint32_t quadrant = angle >> 30;
+    int64_t position = angle & 0x3fffffffu;
+    if (quadrant & 1)
+    {
+        position = k_fixed_q30_one - position;
+    }
+    const int64_t value = FixedLookup(k_fixed_sine_table, position);
+    return quadrant >= 2 ? -value : value;
+}
+
+/**
+ * Shift right with rounding to nearest, ties up.
+ */
+constexpr int64_t FixedRoundShift(int64_t value, int32_t shift)
+{
+    return shift == 0 ? value : (value + (int64_t{1} << (shift - 1))) >> shift;
+}
+
+/**
+ * The integer square root rounded to nearest, bit by bit.
+ */
+constexpr uint64_t FixedIntegerSqrt(uint64_t value)
+{
+    uint64_t result = 0;
+    uint64_t bit = uint64_t{1} << 62;
+    while (bit > value)
+    {
+        bit >>= 2;
+    }
+    while (bit != 0)
+    {
+        if (value >= result + bit)
+        {
+            value -= result + bit;
+            result = (result >> 1) + bit;
+        }
+        else
+        {
+            result >>= 1;
+        }
+        bit >>= 2;
+    }
+    // value is now the remainder n - result^2, round up past the midpoint result + 1/2.
+    return value > result ? result + 1 : result;
+}
+
+}  // namespace Math::Internal
+
+template <std::signed_integral Int, int32_t FracBits>
+template <typename U>
+    requires std::is_arithmetic_v<U>
+constexpr Math::Fixed<Int, FracBits>::Fixed(U value)
+{
+    if constexpr (std::is_floating_point_v<U>)
+    {
+        constexpr double k_scale = static_cast<double>(int64_t{1} << FracBits);
+        const double scaled =
+            Math::Clamp(static_cast<double>(value) * k_scale,
+                        static_cast<double>(std::numeric_limits<Int>::min()),
+                        static_cast<double>(std::numeric_limits<Int>::max()));
+        m_raw = static_cast<Int>(Internal::FixedRoundToInt(scaled));
+    }
+    else
+    {
+        // Integers out of range are clamped too, the shift would overflow.
+        constexpr Int k_min_integer = std::numeric_limits<Int>::min() >> FracBits;
+        constexpr Int k_max_integer = std::numeric_limits<Int>::max() >> FracBits;
+        bool above = false;
+        bool below = false;
+        if constexpr (std::is_signed_v<U>)
+        {
+            above = static_cast<int64_t>(value) > k_max_integer;
+            below = static_cast<int64_t>(value) < k_min_integer;
+        }
+        else
+        {
+            above = static_cast<uint64_t>(value) > static_cast<uint64_t>(k_max_integer);
+        }
+        m_raw = above   ? std::numeric_limits<Int>::max()
+                : below ? std::numeric_limits<Int>::min()
+                        : static_cast<Int>(static_cast<Wide>(value) * (Wide{1} << FracBits));
+    }
+}
+
+template <std::signed_integral Int, int32_t FracBits>
+constexpr Math::Fixed<Int, FracBits> Math::Fixed<Int, FracBits>::FromRaw(Int raw)
+{
+    Fixed result;
+    result.m_raw = raw;
+    return result;
+}
+
+template <std::signed_integral Int, int32_t FracBits>
+constexpr Int Math::Fixed<Int, FracBits>::Raw() const
+{
+    return m_raw;
+}
+
+template <std::signed_integral Int, int32_t FracBits>
+template <typename U>
+    requires std::is_arithmetic_v<U>
+constexpr Math::Fixed<Int, FracBits>::operator U() const
+{
+    if constexpr (std::is_floating_point_v<U>)
+    {
+        return static_cast<U>(static_cast<double>(m_raw) /
+                              static_cast<double>(int64_t{1} << FracBits));
+    }
+    else if constexpr (std::is_same_v<U, bool>)
+    {
+        return m_raw != 0;
+    }
+    else
+    {
+        // Rounds towards negative infinity, like Floor.
+        return static_cast<U>(m_raw >> FracBits);
+    }
+}
+
+template <std::signed_integral Int, int32_t FracBits>
+constexpr Math::Fixed<Int, FracBits> Math::Fixed<Int, FracBits>::operator-() const
+{
+    return Fixed() - *this;
+}
+
+template <std::signed_integral Int, int32_t FracBits>
+constexpr Math::Fixed<Int, FracBits>& Math::Fixed<Int, FracBits>::operator+=(Fixed other)
+{
+    // Unsigned arithmetic wraps around instead of overflowing, which is undefined for signed.
+    using Unsigned = std::make_unsigned_t<Wide>;
+    m_raw = static_cast<Int>(static_cast<Unsigned>(m_raw) + static_cast<Unsigned>(other.m_raw));
+    return *this;
+}
+
+template <std::signed_integral Int, int32_t FracBits>
+constexpr Math::Fixed<Int, FracBits>& Math::Fixed<Int, FracBits>::operator-=(Fixed other)
+{
+    using Unsigned = std::make_unsigned_t<Wide>;
+    m_raw = static_cast<Int>(static_cast<Unsigned>(m_raw) - static_cast<Unsigned>(other.m_raw));
+    return *this;
+}
+
+template <std::signed_integral Int, int32_t FracBits>
+constexpr Math::Fixed<Int, FracBits>& Math::Fixed<Int, FracBits>::operator*=(Fixed other)
+{
+    constexpr Wide k_half = Wide{1} << (FracBits - 1);
+    m_raw = static_cast<Int>(
+        (static_cast<Wide>(m_raw) * static_cast<Wide>(other.m_raw) + k_half) >> FracBits);
+    return *this;
+}
+
+template <std::signed_integral Int, int32_t FracBits>
+constexpr Math::Fixed<Int, FracBits>& Math::Fixed<Int, FracBits>::operator/=(Fixed other)
+{
+    assert(other.m_raw != 0);
+    // Round to nearest like the product, by moving the numerator half the divisor away from zero
+    // before the division truncates towards zero.
+    const Wide numerator = static_cast<Wide>(m_raw) * (Wide{1} << FracBits);
+    const auto divisor = static_cast<Wide>(other.m_raw);
+    const Wide half = (divisor < 0 ? -divisor : divisor) / 2;
+    m_raw = static_cast<Int>((numerator < 0 ? numerator - half : numerator + half) / divisor);
+    return *this;
+}
+
+template <std::signed_integral Int, int32_t FracBits>
+constexpr Math::Fixed<Int, FracBits> Math::Fixed<Int, FracBits>::Sqrt(Fixed value)
+{
+    // sqrt(raw / 2^F) * 2^F = sqrt(raw * 2^F).
+    assert(value.m_raw >= 0);
+    if (value.m_raw <= 0)
+    {
+        return FromRaw(0);
+    }
+    const uint64_t scaled = static_cast<uint64_t>(value.m_raw) << FracBits;
+    return FromRaw(static_cast<Int>(Internal::FixedIntegerSqrt(scaled)));
+}
+
+template <std::signed_integral Int, int32_t FracBits>
+constexpr Math::Fixed<Int, FracBits> Math::Fixed<Int, FracBits>::Sin(Fixed radians)
+{
+    const uint32_t angle = Internal::FixedBinaryAngle<FracBits>(radians.m_raw);
+    return FromRaw(static_cast<Int>(
+        Internal::FixedRoundShift(Internal::FixedSinQ30(angle), 30 - FracBits)));
+}
+
+template <std::signed_integral Int, int32_t FracBits>
+constexpr Math::Fixed<Int, FracBits> Math::Fixed<Int, FracBits>::Cos(Fixed radians)
+{
+    // A quarter turn ahead, the binary angle wraps around exactly.
+    constexpr uint32_t k_quarter_turn = uint32_t{1} << 30;
+    const uint32_t angle = Internal::FixedBinaryAngle<FracBits>(radians.m_raw) + k_quarter_turn;
+    return FromRaw(static_cast<Int>(
+        Internal::FixedRoundShift(Internal::FixedSinQ30(angle), 30 - FracBits)));
+}
+
+template <std::signed_integral Int, int32_t FracBits>
+constexpr Math::Fixed<Int, FracBits> Math::Fixed<Int, FracBits>::Tan(Fixed radians)
+{
+    return Sin(radians) / Cos(radians);
+}
+
+template <std::signed_integral Int, int32_t FracBits>
+constexpr Math::Fixed<Int, FracBits> Math::Fixed<Int, FracBits>::ArcCos(Fixed value)
+{
+    // acos(x) = atan2(sqrt(1 - x^2), x), with x clamped to [-1, 1]. The square root is taken of
+    // the exact product with 2 * FracBits fractional bits, which keeps the precision near |x| = 1.
+    constexpr int64_t k_one = int64_t{1} << FracBits;
+    const int64_t x = Math::Clamp(static_cast<int64_t>(value.m_raw), -k_one, k_one);
+    const uint64_t product = static_cast<uint64_t>((k_one - x) * (k_one + x));
+    return ArcTan2(FromRaw(static_cast<Int>(Internal::FixedIntegerSqrt(product))),
+                   FromRaw(static_cast<Int>(x)));
+}
+
+template <std::signed_integral Int, int32_t FracBits>
+constexpr Math::Fixed<Int, FracBits> Math::Fixed<Int, FracBits>::ArcTan2(Fixed y, Fixed x)
+{
+    static_assert(FracBits <= 8 * static_cast<int32_t>(sizeof(Int)) - 3,
+                  "Angles up to pi need two integer bits besides the sign.");
+    // Look up the angle of the first octant and mirror it to the octant of (x, y).
+    const int64_t abs_x = Math::Abs(static_cast<int64_t>(x.m_raw));
+    const int64_t abs_y = Math::Abs(static_cast<int64_t>(y.m_raw));
+    if (abs_x == 0 && abs_y == 0)
+    {
+        return FromRaw(0);
+    }
+    const bool steep = abs_y > abs_x;
+    const int64_t ratio = ((steep ? abs_x : abs_y) << 30) / (steep ? abs_y : abs_x);
+    int64_t angle = Internal::FixedLookup(Internal::k_fixed_arctan_table, ratio);
+    if (steep)
+    {
+        angle = Internal::k_fixed_q30_pi / 2 - angle;
+    }
+    if (x.m_raw < 0)
+    {
+        angle = Internal::k_fixed_q30_pi - angle;
+    }
+    if (y.m_raw < 0)
+    {
+        angle = -angle;
+    }
+    return FromRaw(static_cast<Int>(Internal::FixedRoundShift(angle, 30 - FracBits)));
+}
+
+template <std::signed_integral Int, int32_t FracBits>
+constexpr Math::Fixed<Int, FracBits> Math::Fixed<Int, FracBits>::Floor(Fixed value)
+{
+    constexpr Wide k_frac_mask = (Wide{1} << FracBits) - 1;
+    return FromRaw(static_cast<Int>(static_cast<Wide>(value.m_raw) & ~k_frac_mask));
+}
+
+template <std::signed_integral Int, int32_t FracBits>
+constexpr Math::Fixed<Int, FracBits> Math::Fixed<Int, FracBits>::Ceil(Fixed value)
+{
+    return -Floor(-value);
+}
+
+template <std::signed_integral Int, int32_t FracBits>
+constexpr Math::Fixed<Int, FracBits> Math::Fixed<Int, FracBits>::Round(Fixed value)
+{
+    // Halfway values are rounded away from zero, as Math::Round does.
+    const Fixed half = FromRaw(static_cast<Int>(Wide{1} << (FracBits - 1)));
+    return value >= 0 ? Floor(value + half) : -Floor(half - value);
+}
+
+template <std::signed_integral Int, int32_t FracBits>
+constexpr bool Math::Fixed<Int, FracBits>::IsFinite(Fixed)
+{
+    return true;
+}
+
+template <std::signed_integral Int, int32_t FracBits>
+template <std::same_as<Math::Fixed<Int, FracBits>>... Rest>
+constexpr double Math::Fixed<Int, FracBits>::SumOfSquares(Fixed value, Rest... rest)
+{
+    // The squares of the integer representations are scaled by 2^(2 * FracBits).
+    constexpr double k_scale = 1.0 / static_cast<double>(int64_t{1} << (2 * FracBits));
+    auto square = [](Fixed v)
+    {
+        const auto raw = static_cast<double>(v.m_raw);
+        return raw * raw;
+    };
+    return (square(value) + ... + square(rest)) * k_scale;
+}
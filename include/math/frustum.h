@@ -0,0 +1,142 @@
+#pragma once
+
+#include <array>
+
+#include "math/base.h"
+#include "math/bounds3.h"
+#include "math/matrix.h"
+#include "math/vector4.h"
+
+namespace Math
+{
+
+/**
+ * View frustum as six planes. A plane is stored as the normal in xyz pointing inside and the
+ * offset in w, a point p is on the inner side if dot(xyz, p) + w >= 0. The planes do not need to
+ * be normalized.
+ */
+template <FloatingPoint T>
+struct Frustum
+{
+    /** Left, right, bottom, top, near and far planes. */
+    std::array<Vector4<T>, 6> planes;
+
+    /**
+     * Extract the planes from a view projection matrix where Z maps between 0 and 1 (DirectX
+     * style). The planes are in the space that the matrix transforms from.
+     * Based on: Fast Extraction of Viewing Frustum Planes from the World-View-Projection Matrix,
+     * Gribb and Hartmann, 2001.
+     * @param m The view projection matrix.
+     * @return The frustum.
+     */
+    static constexpr Frustum FromMatrix_N0(const Matrix4x4<T>& m);
+
+    /**
+     * Extract the planes from a view projection matrix where Z maps between -1 and 1 (OpenGL
+     * style).
+     * @param m The view projection matrix.
+     * @return The frustum.
+     */
+    static constexpr Frustum FromMatrix_N1(const Matrix4x4<T>& m);
+};
+
+/**
+ * Checks if the bounding box overlaps the frustum. The test is conservative, a box near a corner of
+ * the frustum can be reported as overlapping while being outside.
+ * @param f The frustum.
+ * @param b The bounding box.
+ * @return True if the bounding box overlaps the frustum.
+ */
+template <FloatingPoint T>
+[[nodiscard]] constexpr bool Overlaps(const Frustum<T>& f, const Bounds3<T>& b);
+
+/**
+ * Checks if the bounding box is completely inside the frustum.
+ * @param f The frustum.
+ * @param b The bounding box.
+ * @return True if the bounding box is inside the frustum.
+ */
+template <FloatingPoint T>
+[[nodiscard]] constexpr bool Inside(const Frustum<T>& f, const Bounds3<T>& b);
+
+}  // namespace Math
+
+// Implementation //////////////////////////////////////////////////////////////////////////////////
+
+namespace Math::Internal
+{
+
+enum class Containment
+{
+    Outside,
+    Intersects,
+    Inside
+};
+
+template <FloatingPoint T>
+constexpr Vector4<T> MatrixRow(const Matrix4x4<T>& m, int row)
+{
+    return Vector4<T>(m.elements[row][0], m.elements[row][1], m.elements[row][2],
+                      m.elements[row][3]);
+}
+
+/**
+ * Test the box against the planes using the corners farthest along and against every normal.
+ */
+template <FloatingPoint T>
+constexpr Containment Classify(const Frustum<T>& f, const Bounds3<T>& b)
+{
+    Containment result = Containment::Inside;
+    for (const Vector4<T>& plane : f.planes)
+    {
+        const T far_distance = plane.x * (plane.x >= 0 ? b.max.x : b.min.x) +
+                               plane.y * (plane.y >= 0 ? b.max.y : b.min.y) +
+                               plane.z * (plane.z >= 0 ? b.max.z : b.min.z) + plane.w;
+        if (far_distance < 0)
+        {
+            return Containment::Outside;
+        }
+        const T near_distance = plane.x * (plane.x >= 0 ? b.min.x : b.max.x) +
+                                plane.y * (plane.y >= 0 ? b.min.y : b.max.y) +
+                                plane.z * (plane.z >= 0 ? b.min.z : b.max.z) + plane.w;
+        if (near_distance < 0)
+        {
+            result = Containment::Intersects;
+        }
+    }
+    return result;
+}
+
+}  // namespace Math::Internal
+
+template <Math::FloatingPoint T>
+constexpr Math::Frustum<T> Math::Frustum<T>::FromMatrix_N0(const Matrix4x4<T>& m)
+{
+    const Vector4<T> row0 = Internal::MatrixRow(m, 0);
+    const Vector4<T> row1 = Internal::MatrixRow(m, 1);
+    const Vector4<T> row2 = Internal::MatrixRow(m, 2);
+    const Vector4<T> row3 = Internal::MatrixRow(m, 3);
+    return Frustum{{row3 + row0, row3 - row0, row3 + row1, row3 - row1, row2, row3 - row2}};
+}
+
+template <Math::FloatingPoint T>
+constexpr Math::Frustum<T> Math::Frustum<T>::FromMatrix_N1(const Matrix4x4<T>& m)
+{
+    const Vector4<T> row0 = Internal::MatrixRow(m, 0);
+    const Vector4<T> row1 = Internal::MatrixRow(m, 1);
+    const Vector4<T> row2 = Internal::MatrixRow(m, 2);
+    const Vector4<T> row3 = Internal::MatrixRow(m, 3);
+    return Frustum{{row3 + row0, row3 - row0, row3 + row1, row3 - row1, row3 + row2, row3 - row2}};
+}
+
+template <Math::FloatingPoint T>
+constexpr bool Math::Overlaps(const Frustum<T>& f, const Bounds3<T>& b)
+{
+    return Internal::Classify(f, b) != Internal::Containment::Outside;
+}
+
+template <Math::FloatingPoint T>
+constexpr bool Math::Inside(const Frustum<T>& f, const Bounds3<T>& b)
+{
+    return Internal::Classify(f, b) == Internal::Containment::Inside;
+}
@@ -0,0 +1,582 @@
+#pragma once
+
+#include <bit>
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <type_traits>
+
+#include "math/base.h"
+#include "math/simd.h"
+#include "math/vector3.h"
+
+namespace Math
+{
+
+/**
+ * IEEE 754 half precision floating point number, 1 sign bit, 5 exponent bits and 10 mantissa bits.
+ * A storage type: it converts implicitly to and from float and all the arithmetic is done in float,
+ * so Vector3<Half> and the other templates work with it at half the memory of float. Values are
+ * rounded to nearest even when stored, the largest finite value is 65504 and the relative precision
+ * is about 3 decimal digits.
+ */
+class Half
+{
+public:
+    /**
+     * Default constructor. No initialization is performed.
+     */
+    Half() = default;
+
+    /**
+     * Constructs the half closest to the given value, rounding to nearest even. Values too large
+     * for a half become infinities. Types other than float go through double, so integers wider
+     * than 53 bits and long double values are rounded twice.
+     * @param value The value.
+     */
+    template <typename U>
+        requires std::is_arithmetic_v<U>
+    constexpr Half(U value);
+
+    /**
+     * Constructs a half from its bit pattern.
+     * @param bits The bits.
+     * @return The half.
+     */
+    static constexpr Half FromBits(uint16_t bits);
+
+    /**
+     * Returns the bit pattern.
+     * @return The bits.
+     */
+    constexpr uint16_t Bits() const;
+
+    /** Operators **/
+    constexpr operator float() const;
+
+    constexpr Half operator-() const;
+
+    template <typename U>
+    constexpr Half& operator+=(U other);
+    template <typename U>
+    constexpr Half& operator-=(U other);
+    template <typename U>
+    constexpr Half& operator*=(U other);
+    template <typename U>
+    constexpr Half& operator/=(U other);
+
+private:
+    uint16_t m_bits;
+};
+
+/**
+ * Brain floating point number, the upper 16 bits of a float: 1 sign bit, 8 exponent bits and 7
+ * mantissa bits. The same range as float with about 2 decimal digits of precision, used the same
+ * way as Half.
+ */
+class BFloat16
+{
+public:
+    /**
+     * Default constructor. No initialization is performed.
+     */
+    BFloat16() = default;
+
+    /**
+     * Constructs the bfloat16 closest to the given value, rounding to nearest even. Types other
+     * than float go through double, as for Half.
+     * @param value The value.
+     */
+    template <typename U>
+        requires std::is_arithmetic_v<U>
+    constexpr BFloat16(U value);
+
+    /**
+     * Constructs a bfloat16 from its bit pattern.
+     * @param bits The bits.
+     * @return The bfloat16.
+     */
+    static constexpr BFloat16 FromBits(uint16_t bits);
+
+    /**
+     * Returns the bit pattern.
+     * @return The bits.
+     */
+    constexpr uint16_t Bits() const;
+
+    /** Operators **/
+    constexpr operator float() const;
+
+    constexpr BFloat16 operator-() const;
+
+    template <typename U>
+    constexpr BFloat16& operator+=(U other);
+    template <typename U>
+    constexpr BFloat16& operator-=(U other);
+    template <typename U>
+    constexpr BFloat16& operator*=(U other);
+    template <typename U>
+    constexpr BFloat16& operator/=(U other);
+
+private:
+    uint16_t m_bits;
+};
+
+template <>
+inline constexpr bool k_is_floating_point_value<Half> = true;
+template <>
+inline constexpr bool k_is_floating_point_value<BFloat16> = true;
+
+/**
+ * Convert vectors to half precision, with F16C when available.
+ * @param vectors The vectors.
+ * @param result Where to store the converted vectors. Must have the same size as vectors.
+ */
+void ConvertVectors(std::span<const Vector3<float>> vectors, std::span<Vector3<Half>> result);
+
+/**
+ * Convert half precision vectors to float, with F16C when available.
+ * @param vectors The vectors.
+ * @param result Where to store the converted vectors. Must have the same size as vectors.
+ */
+void ConvertVectors(std::span<const Vector3<Half>> vectors, std::span<Vector3<float>> result);
+
+/**
+ * Convert vectors to bfloat16, with SSE2 when available.
+ * @param vectors The vectors.
+ * @param result Where to store the converted vectors. Must have the same size as vectors.
+ */
+void ConvertVectors(std::span<const Vector3<float>> vectors, std::span<Vector3<BFloat16>> result);
+
+/**
+ * Convert bfloat16 vectors to float, with SSE2 when available.
+ * @param vectors The vectors.
+ * @param result Where to store the converted vectors. Must have the same size as vectors.
+ */
+void ConvertVectors(std::span<const Vector3<BFloat16>> vectors, std::span<Vector3<float>> result);
+
+}  // namespace Math
+
+template <>
+class std::numeric_limits<Math::Half>
+{
+public:
+    static constexpr bool is_specialized = true;
+    static constexpr bool is_signed = true;
+    static constexpr bool is_integer = false;
+    static constexpr bool is_exact = false;
+    static constexpr bool has_infinity = true;
+    static constexpr bool has_quiet_NaN = true;
+    static constexpr bool has_signaling_NaN = true;
+    static constexpr float_denorm_style has_denorm = denorm_present;
+    static constexpr bool has_denorm_loss = false;
+    static constexpr bool is_iec559 = true;
+    static constexpr bool is_bounded = true;
+    static constexpr bool is_modulo = false;
+    static constexpr float_round_style round_style = round_to_nearest;
+    static constexpr int digits = 11;
+    static constexpr int digits10 = 3;
+    static constexpr int max_digits10 = 5;
+    static constexpr int radix = 2;
+    static constexpr int min_exponent = -13;
+    static constexpr int min_exponent10 = -4;
+    static constexpr int max_exponent = 16;
+    static constexpr int max_exponent10 = 4;
+    static constexpr bool traps = false;
+    static constexpr bool tinyness_before = false;
+
+    static constexpr Math::Half min() { return Math::Half::FromBits(0x0400); }
+    static constexpr Math::Half lowest() { return Math::Half::FromBits(0xfbff); }
+    static constexpr Math::Half max() { return Math::Half::FromBits(0x7bff); }
+    static constexpr Math::Half epsilon() { return Math::Half::FromBits(0x1400); }
+    static constexpr Math::Half round_error() { return Math::Half::FromBits(0x3800); }
+    static constexpr Math::Half infinity() { return Math::Half::FromBits(0x7c00); }
+    static constexpr Math::Half quiet_NaN() { return Math::Half::FromBits(0x7e00); }
+    static constexpr Math::Half signaling_NaN() { return Math::Half::FromBits(0x7d00); }
+    static constexpr Math::Half denorm_min() { return Math::Half::FromBits(0x0001); }
+};
+
+template <>
+class std::numeric_limits<Math::BFloat16>
+{
+public:
+    static constexpr bool is_specialized = true;
+    static constexpr bool is_signed = true;
+    static constexpr bool is_integer = false;
+    static constexpr bool is_exact = false;
+    static constexpr bool has_infinity = true;
+    static constexpr bool has_quiet_NaN = true;
+    static constexpr bool has_signaling_NaN = true;
+    static constexpr float_denorm_style has_denorm = denorm_present;
+    static constexpr bool has_denorm_loss = false;
+    static constexpr bool is_iec559 = false;
+    static constexpr bool is_bounded = true;
+    static constexpr bool is_modulo = false;
+    static constexpr float_round_style round_style = round_to_nearest;
+    static constexpr int digits = 8;
+    static constexpr int digits10 = 2;
+    static constexpr int max_digits10 = 4;
+    static constexpr int radix = 2;
+    static constexpr int min_exponent = -125;
+    static constexpr int min_exponent10 = -37;
+    static constexpr int max_exponent = 128;
+    static constexpr int max_exponent10 = 38;
+    static constexpr bool traps = false;
+    static constexpr bool tinyness_before = false;
+
+    static constexpr Math::BFloat16 min() { return Math::BFloat16::FromBits(0x0080); }
+    static constexpr Math::BFloat16 lowest() { return Math::BFloat16::FromBits(0xff7f); }
+    static constexpr Math::BFloat16 max() { return Math::BFloat16::FromBits(0x7f7f); }
+    static constexpr Math::BFloat16 epsilon() { return Math::BFloat16::FromBits(0x3c00); }
+    static constexpr Math::BFloat16 round_error() { return Math::BFloat16::FromBits(0x3f00); }
+    static constexpr Math::BFloat16 infinity() { return Math::BFloat16::FromBits(0x7f80); }
+    static constexpr Math::BFloat16 quiet_NaN() { return Math::BFloat16::FromBits(0x7fc0); }
+    static constexpr Math::BFloat16 signaling_NaN() { return Math::BFloat16::FromBits(0x7fa0); }
+    static constexpr Math::BFloat16 denorm_min() { return Math::BFloat16::FromBits(0x0001); }
+};
+
+// Implementation //////////////////////////////////////////////////////////////////////////////////
+
+namespace Math::Internal
+{
+
+/**
+ * Round a float to the nearest half, the same as F16C including the NaN payloads.
+ * Based on: float_to_half_fast3_rtne, Fabian Giesen, 2016.
+ */
+constexpr uint16_t FloatToHalfBits(float value)
+{
+    uint32_t bits = std::bit_cast<uint32_t>(value);
+    const uint32_t sign = bits & 0x80000000u;
+    bits ^= sign;
+    uint32_t result;
+    if (bits >= 0x47800000u)
+    {
+        // At least 65536 or not a number, the values from 65520 on round to infinity below.
+        result = bits > 0x7f800000u ? 0x7e00u | ((bits >> 13) & 0x3ffu) : 0x7c00u;
+    }
+    else if (bits < 0x38800000u)
+    {
+        // Zero or subnormal, adding 0.5 puts the bits at the right place and lets the float
+        // addition do the rounding.
+        constexpr uint32_t k_half_bits = 0x3f000000u;
+        result = std::bit_cast<uint32_t>(std::bit_cast<float>(bits) +
+                                         std::bit_cast<float>(k_half_bits)) -
+                 k_half_bits;
+    }
+    else
+    {
+        // Rebias the exponent and round the 13 dropped mantissa bits to nearest even.
+        const uint32_t odd_mantissa = (bits >> 13) & 1;
+        bits += (static_cast<uint32_t>(15 - 127) << 23) + 0xfffu + odd_mantissa;
+        result = bits >> 13;
+    }
+    return static_cast<uint16_t>(result | (sign >> 16));
+}
+
+/**
+ * Convert a double to a float rounding to odd: a result that isn't exact is truncated and gets its
+ * lowest mantissa bit set. Rounding that float to nearest with at least two bits fewer, as a half
+ * or a bfloat16, gives the same result as rounding the double directly.
+ */
+constexpr float DoubleToFloatRoundToOdd(double value)
+{
+    if (value != value)
+    {
+        return static_cast<float>(value);
+    }
+    constexpr double k_float_max = std::numeric_limits<float>::max();
+    if (value > k_float_max || value < -k_float_max)
+    {
+        // Infinities stay infinite, finite values rest on the largest float, which is odd.
+        if (Math::Abs(value) == std::numeric_limits<double>::infinity())
+        {
+            return static_cast<float>(value);
+        }
+        return value > 0 ? std::numeric_limits<float>::max() : -std::numeric_limits<float>::max();
+    }
+    const auto result = static_cast<float>(value);
+    if (static_cast<double>(result) == value)
+    {
+        return result;
+    }
+    uint32_t bits = std::bit_cast<uint32_t>(result);
+    if (Math::Abs(static_cast<double>(result)) > Math::Abs(value))
+    {
+        --bits;
+    }
+    return std::bit_cast<float>(bits | 1u);
+}
+
+/**
+ * Round a value of any arithmetic type to a float that rounds to the same half or bfloat16.
+ */
+template <typename U>
+constexpr float ToFloatForRounding(U value)
+{
+    if constexpr (std::is_same_v<U, float>)
+    {
+        return value;
+    }
+    else
+    {
+        return DoubleToFloatRoundToOdd(static_cast<double>(value));
+    }
+}
+
+/**
+ * The float equal to a half, subnormal halves become normal floats.
+ */
+constexpr float HalfBitsToFloat(uint16_t half)
+{
+    constexpr uint32_t k_exponent_mask = 0x7c00u << 13;
+    uint32_t bits = (half & 0x7fffu) << 13;
+    const uint32_t exponent = bits & k_exponent_mask;
+    bits += static_cast<uint32_t>(127 - 15) << 23;
+    if (exponent == k_exponent_mask)
+    {
+        // Infinity or not a number, the exponent is all ones.
+        bits += static_cast<uint32_t>(128 - 16) << 23;
+    }
+    else if (exponent == 0)
+    {
+        // Zero or subnormal, renormalize with a float subtraction.
+        bits += 1u << 23;
+        bits = std::bit_cast<uint32_t>(std::bit_cast<float>(bits) -
+                                       std::bit_cast<float>(uint32_t{113} << 23));
+    }
+    return std::bit_cast<float>(bits | ((half & 0x8000u) << 16));
+}
+
+/**
+ * Round a float to the nearest bfloat16, not a numbers stay quiet not a numbers.
+ */
+constexpr uint16_t FloatToBFloat16Bits(float value)
+{
+    const uint32_t bits = std::bit_cast<uint32_t>(value);
+    if ((bits & 0x7fffffffu) > 0x7f800000u)
+    {
+        return static_cast<uint16_t>((bits | 0x00400000u) >> 16);
+    }
+    return static_cast<uint16_t>((bits + 0x7fffu + ((bits >> 16) & 1)) >> 16);
+}
+
+constexpr float BFloat16BitsToFloat(uint16_t value)
+{
+    return std::bit_cast<float>(uint32_t{value} << 16);
+}
+
+}  // namespace Math::Internal
+
+template <typename U>
+    requires std::is_arithmetic_v<U>
+constexpr Math::Half::Half(U value)
+    : m_bits(Internal::FloatToHalfBits(Internal::ToFloatForRounding(value)))
+{
+}
+
+constexpr Math::Half Math::Half::FromBits(uint16_t bits)
+{
+    Half result;
+    result.m_bits = bits;
+    return result;
+}
+
+constexpr uint16_t Math::Half::Bits() const
+{
+    return m_bits;
+}
+
+constexpr Math::Half::operator float() const
+{
+    return Internal::HalfBitsToFloat(m_bits);
+}
+
+constexpr Math::Half Math::Half::operator-() const
+{
+    return FromBits(static_cast<uint16_t>(m_bits ^ 0x8000u));
+}
+
+template <typename U>
+constexpr Math::Half& Math::Half::operator+=(U other)
+{
+    return *this = Half(static_cast<float>(*this) + static_cast<float>(other));
+}
+
+template <typename U>
+constexpr Math::Half& Math::Half::operator-=(U other)
+{
+    return *this = Half(static_cast<float>(*this) - static_cast<float>(other));
+}
+
+template <typename U>
+constexpr Math::Half& Math::Half::operator*=(U other)
+{
+    return *this = Half(static_cast<float>(*this) * static_cast<float>(other));
+}
+
+template <typename U>
+constexpr Math::Half& Math::Half::operator/=(U other)
+{
+    return *this = Half(static_cast<float>(*this) / static_cast<float>(other));
+}
+
+template <typename U>
+    requires std::is_arithmetic_v<U>
+constexpr Math::BFloat16::BFloat16(U value)
+    : m_bits(Internal::FloatToBFloat16Bits(Internal::ToFloatForRounding(value)))
+{
+}
+
+constexpr Math::BFloat16 Math::BFloat16::FromBits(uint16_t bits)
+{
+    BFloat16 result;
+    result.m_bits = bits;
+    return result;
+}
+
+constexpr uint16_t Math::BFloat16::Bits() const
+{
+    return m_bits;
+}
+
+constexpr Math::BFloat16::operator float() const
+{
+    return Internal::BFloat16BitsToFloat(m_bits);
+}
+
+constexpr Math::BFloat16 Math::BFloat16::operator-() const
+{
+    return FromBits(static_cast<uint16_t>(m_bits ^ 0x8000u));
+}
+
+template <typename U>
+constexpr Math::BFloat16& Math::BFloat16::operator+=(U other)
+{
+    return *this = BFloat16(static_cast<float>(*this) + static_cast<float>(other));
+}
+
+template <typename U>
+constexpr Math::BFloat16& Math::BFloat16::operator-=(U other)
+{
+    return *this = BFloat16(static_cast<float>(*this) - static_cast<float>(other));
+}
+
+template <typename U>
+constexpr Math::BFloat16& Math::BFloat16::operator*=(U other)
+{
+    return *this = BFloat16(static_cast<float>(*this) * static_cast<float>(other));
+}
+
+template <typename U>
+constexpr Math::BFloat16& Math::BFloat16::operator/=(U other)
+{
+    return *this = BFloat16(static_cast<float>(*this) / static_cast<float>(other));
+}
+
+inline void Math::ConvertVectors(std::span<const Vector3<float>> vectors,
+                                 std::span<Vector3<Half>> result)
+{
+    static_assert(sizeof(Vector3<float>) == 3 * sizeof(float));
+    static_assert(sizeof(Vector3<Half>) == 3 * sizeof(Half));
+    assert(vectors.size() == result.size());
+    // The components are contiguous, so convert them as one flat array.
+    const float* source = vectors.empty() ? nullptr : &vectors[0].x;
+    Half* destination = result.empty() ? nullptr : &result[0].x;
+    const size_t count = 3 * vectors.size();
+    size_t i = 0;
+#if MATH_SIMD_F16C
+    for (; i + 8 <= count; i += 8)
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i),
+                         _mm256_cvtps_ph(_mm256_loadu_ps(source + i), _MM_FROUND_TO_NEAREST_INT));
+    }
+#endif
+    for (; i < count; ++i)
+    {
+        destination[i] = Half(source[i]);
+    }
+}
+
+inline void Math::ConvertVectors(std::span<const Vector3<Half>> vectors,
+                                 std::span<Vector3<float>> result)
+{
+    assert(vectors.size() == result.size());
+    const Half* source = vectors.empty() ? nullptr : &vectors[0].x;
+    float* destination = result.empty() ? nullptr : &result[0].x;
+    const size_t count = 3 * vectors.size();
+    size_t i = 0;
+#if MATH_SIMD_F16C
+    for (; i + 8 <= count; i += 8)
+    {
+        _mm256_storeu_ps(destination + i,
+                         _mm256_cvtph_ps(_mm_loadu_si128(
+                             reinterpret_cast<const __m128i*>(source + i))));
+    }
+#endif
+    for (; i < count; ++i)
+    {
+        destination[i] = source[i];
+    }
+}
+
+inline void Math::ConvertVectors(std::span<const Vector3<float>> vectors,
+                                 std::span<Vector3<BFloat16>> result)
+{
+    static_assert(sizeof(Vector3<BFloat16>) == 3 * sizeof(BFloat16));
+    assert(vectors.size() == result.size());
+    const float* source = vectors.empty() ? nullptr : &vectors[0].x;
+    BFloat16* destination = result.empty() ? nullptr : &result[0].x;
+    const size_t count = 3 * vectors.size();
+    size_t i = 0;
+#if MATH_SIMD_SSE2
+    // FloatToBFloat16Bits on four lanes, the arithmetic shift keeps the upper halves in the range
+    // of the saturating pack.
+    auto to_bfloat16 = [](__m128 value)
+    {
+        const __m128i bits = _mm_castps_si128(value);
+        const __m128i odd = _mm_and_si128(_mm_srli_epi32(bits, 16), _mm_set1_epi32(1));
+        const __m128i rounded = _mm_add_epi32(bits, _mm_add_epi32(_mm_set1_epi32(0x7fff), odd));
+        const __m128i quiet = _mm_or_si128(bits, _mm_set1_epi32(0x00400000));
+        const __m128i nan = _mm_castps_si128(_mm_cmpunord_ps(value, value));
+        return _mm_srai_epi32(
+            _mm_or_si128(_mm_and_si128(nan, quiet), _mm_andnot_si128(nan, rounded)), 16);
+    };
+    for (; i + 8 <= count; i += 8)
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i),
+                         _mm_packs_epi32(to_bfloat16(_mm_loadu_ps(source + i)),
+                                         to_bfloat16(_mm_loadu_ps(source + i + 4))));
+    }
+#endif
+    for (; i < count; ++i)
+    {
+        destination[i] = BFloat16(source[i]);
+    }
+}
+
+inline void Math::ConvertVectors(std::span<const Vector3<BFloat16>> vectors,
+                                 std::span<Vector3<float>> result)
+{
+    assert(vectors.size() == result.size());
+    const BFloat16* source = vectors.empty() ? nullptr : &vectors[0].x;
+    float* destination = result.empty() ? nullptr : &result[0].x;
+    const size_t count = 3 * vectors.size();
+    size_t i = 0;
+#if MATH_SIMD_SSE2
+    for (; i + 8 <= count; i += 8)
+    {
+        // Interleaving zeros below the bfloat16s shifts them to the upper halves of the floats.
+        const __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i));
+        _mm_storeu_ps(destination + i,
+                      _mm_castsi128_ps(_mm_unpacklo_epi16(_mm_setzero_si128(), values)));
+        _mm_storeu_ps(destination + i + 4,
+                      _mm_castsi128_ps(_mm_unpackhi_epi16(_mm_setzero_si128(), values)));
+    }
+#endif
+    for (; i < count; ++i)
+    {
+        destination[i] = source[i];
+    }
+}
@@ -0,0 +1,435 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "math/base.h"
+#include "math/parallel.h"
+#include "math/spatial-types.h"
+
+namespace Math
+{
+
+/**
+ * Static kd-tree over 2D or 3D points for nearest neighbour and radius queries. The tree is
+ * implicit: it is a permutation of the point indices where the median of every range is the split
+ * point and the two halves are the children. The split axis of a node is the maximum extent of its
+ * cell, which queries recompute from the root bounds, so the only storage is one index per point.
+ * Ranges of up to 8 points are leaves that queries scan linearly.
+ * @tparam T Data type of the points.
+ * @tparam N Number of dimensions, 2 or 3.
+ */
+template <FloatingPoint T, int N>
+    requires(N == 2 || N == 3)
+struct KdTree
+{
+    using Point = typename Internal::SpatialTypes<T, N>::Point;
+    using Bounds = typename Internal::SpatialTypes<T, N>::Bounds;
+
+    /** The points the tree was built for, they must outlive the tree. */
+    std::span<const Point> points;
+    /** Indices of the points in tree order. */
+    std::vector<uint32_t> indices;
+    /** Bounds of the points, the cell of the root. */
+    Bounds bounds;
+};
+
+template <typename T>
+using KdTree2 = KdTree<T, 2>;
+template <typename T>
+using KdTree3 = KdTree<T, 3>;
+
+/**
+ * Build the tree for the points, the storage of the tree is reused. The subtrees are built in
+ * parallel on ThreadCount() threads.
+ * @param points The points, the tree refers to them so they must outlive it.
+ * @param tree The tree to build.
+ */
+template <FloatingPoint T, int N>
+void Build(std::type_identity_t<std::span<const typename KdTree<T, N>::Point>> points,
+           KdTree<T, N>& tree);
+
+/**
+ * Call func(index, distance_squared) for every point within the radius around the center. The
+ * order of the points is unspecified.
+ * @param tree The tree.
+ * @param center Center of the query.
+ * @param radius Radius of the query, points at exactly this distance are included.
+ * @param func The function to call with the index of the point and its squared distance.
+ */
+template <FloatingPoint T, int N, typename Func>
+void ForEachInRadius(const KdTree<T, N>& tree,
+                     const typename KdTree<T, N>::Point& center,
+                     T radius,
+                     Func&& func);
+
+/**
+ * Find the nearest points to the center, k is the size of the output spans.
+ * @param tree The tree.
+ * @param center Center of the query.
+ * @param indices Output for the indices of the nearest points, sorted by distance.
+ * @param distances_squared Output for the squared distances. Must have the same size as indices.
+ * @return The number of points found, which is k unless the tree has fewer points.
+ */
+template <FloatingPoint T, int N>
+size_t FindNearest(const KdTree<T, N>& tree,
+                   const typename KdTree<T, N>::Point& center,
+                   std::span<uint32_t> indices,
+                   std::type_identity_t<std::span<T>> distances_squared);
+
+/**
+ * Find the k nearest points for every query point, the queries run in parallel on ThreadCount()
+ * threads.
+ * @param tree The tree.
+ * @param centers Centers of the queries.
+ * @param k Number of points to find per query.
+ * @param indices Output for the indices, k per query sorted by distance. Must have the size
+ * centers.size() * k.
+ * @param distances_squared Output for the squared distances. Must have the same size as indices.
+ * @return The number of points found per query, which is k unless the tree has fewer points. The
+ * remaining outputs of every query are left unchanged.
+ */
+template <FloatingPoint T, int N>
+size_t FindNearest(const KdTree<T, N>& tree,
+                   std::type_identity_t<std::span<const typename KdTree<T, N>::Point>> centers,
+                   size_t k,
+                   std::span<uint32_t> indices,
+                   std::type_identity_t<std::span<T>> distances_squared);
+
+}  // namespace Math
+
+// Implementation //////////////////////////////////////////////////////////////////////////////////
+
+namespace Math::Internal
+{
+
+inline constexpr size_t k_kd_min_batch_size = 64 * 1024;
+inline constexpr size_t k_kd_query_batch_size = 256;
+// Ranges up to this size are leaves that are not split any further.
+inline constexpr uint32_t k_kd_leaf_size = 8;
+
+/**
+ * Range of the indices that forms a subtree, with the cell of the subtree.
+ */
+template <typename Bounds>
+struct KdRange
+{
+    uint32_t begin;
+    uint32_t end;
+    Bounds cell;
+};
+
+/**
+ * Point with its index, the build sorts these so that the comparisons read contiguous memory.
+ */
+template <typename Point>
+struct KdEntry
+{
+    Point point;
+    uint32_t index;
+};
+
+/**
+ * Split the range at the median along the maximum extent of the cell, the ranges before and after
+ * the median are the children.
+ */
+template <typename Point, typename Bounds>
+void SplitKdRange(std::span<KdEntry<Point>> entries,
+                  const KdRange<Bounds>& range,
+                  KdRange<Bounds>& left,
+                  KdRange<Bounds>& right)
+{
+    const int32_t axis = MaximumExtent(range.cell);
+    const uint32_t mid = range.begin + (range.end - range.begin) / 2;
+    const auto first = entries.begin();
+    std::nth_element(first + range.begin, first + mid, first + range.end,
+                     [axis](const KdEntry<Point>& a, const KdEntry<Point>& b)
+                     { return Coordinate(a.point, axis) < Coordinate(b.point, axis); });
+    const auto split = Coordinate(entries[mid].point, axis);
+    left = {range.begin, mid, range.cell};
+    right = {mid + 1, range.end, range.cell};
+    Coordinate(left.cell.max, axis) = split;
+    Coordinate(right.cell.min, axis) = split;
+}
+
+template <typename Point, typename Bounds>
+void BuildKdSubtree(std::span<KdEntry<Point>> entries, KdRange<Bounds> range)
+{
+    while (range.end - range.begin > k_kd_leaf_size)
+    {
+        KdRange<Bounds> left;
+        KdRange<Bounds> right;
+        SplitKdRange(entries, range, left, right);
+        BuildKdSubtree(entries, left);
+        range = right;
+    }
+}
+
+/**
+ * Visit the subtree nearest child first, skipping the cells farther than max_distance_squared.
+ * visit(index, distance_squared) is called for the points within it and returns the new maximum
+ * distance.
+ */
+template <FloatingPoint T, int N, typename Visit>
+void TraverseKdSubtree(const KdTree<T, N>& tree,
+                       const typename KdTree<T, N>::Point& center,
+                       const KdRange<typename KdTree<T, N>::Bounds>& range,
+                       T& max_distance_squared,
+                       Visit& visit)
+{
+    if (range.begin >= range.end ||
+        DistanceSquaredToBounds<N>(center, range.cell) > max_distance_squared)
+    {
+        return;
+    }
+
+    if (range.end - range.begin <= k_kd_leaf_size)
+    {
+        for (uint32_t i = range.begin; i < range.end; ++i)
+        {
+            const uint32_t index = tree.indices[i];
+            const T distance_squared = DistanceSquared(tree.points[index], center);
+            if (distance_squared <= max_distance_squared)
+            {
+                max_distance_squared = visit(index, distance_squared);
+            }
+        }
+        return;
+    }
+
+    const int32_t axis = MaximumExtent(range.cell);
+    const uint32_t mid = range.begin + (range.end - range.begin) / 2;
+    const uint32_t index = tree.indices[mid];
+    const typename KdTree<T, N>::Point& p = tree.points[index];
+    const T distance_squared = DistanceSquared(p, center);
+    if (distance_squared <= max_distance_squared)
+    {
+        max_distance_squared = visit(index, distance_squared);
+    }
+
+    const T split = Coordinate(p, axis);
+    KdRange<typename KdTree<T, N>::Bounds> left{range.begin, mid, range.cell};
+    KdRange<typename KdTree<T, N>::Bounds> right{mid + 1, range.end, range.cell};
+    Coordinate(left.cell.max, axis) = split;
+    Coordinate(right.cell.min, axis) = split;
+    if (Coordinate(center, axis) < split)
+    {
+        TraverseKdSubtree(tree, center, left, max_distance_squared, visit);
+        TraverseKdSubtree(tree, center, right, max_distance_squared, visit);
+    }
+    else
+    {
+        TraverseKdSubtree(tree, center, right, max_distance_squared, visit);
+        TraverseKdSubtree(tree, center, left, max_distance_squared, visit);
+    }
+}
+
+/**
+ * Max heap of the nearest points found so far, stored in the output spans.
+ */
+template <typename T>
+struct NearestHeap
+{
+    std::span<uint32_t> indices;
+    std::span<T> distances_squared;
+    size_t size = 0;
+
+    void Swap(size_t a, size_t b)
+    {
+        std::swap(indices[a], indices[b]);
+        std::swap(distances_squared[a], distances_squared[b]);
+    }
+
+    void SiftDown(size_t node, size_t count)
+    {
+        for (size_t child = 2 * node + 1; child < count; node = child, child = 2 * node + 1)
+        {
+            if (child + 1 < count && distances_squared[child + 1] > distances_squared[child])
+            {
+                ++child;
+            }
+            if (distances_squared[node] >= distances_squared[child])
+            {
+                return;
+            }
+            Swap(node, child);
+        }
+    }
+
+    /**
+     * Add the point, replacing the farthest one if the heap is full. Returns the distance that a
+     * point has to beat to be added.
+     */
+    T Push(uint32_t index, T distance_squared)
+    {
+        const size_t capacity = indices.size();
+        if (size < capacity)
+        {
+            size_t node = size++;
+            indices[node] = index;
+            distances_squared[node] = distance_squared;
+            while (node > 0 && distances_squared[(node - 1) / 2] < distances_squared[node])
+            {
+                Swap(node, (node - 1) / 2);
+                node = (node - 1) / 2;
+            }
+        }
+        else if (distance_squared < distances_squared[0])
+        {
+            indices[0] = index;
+            distances_squared[0] = distance_squared;
+            SiftDown(0, size);
+        }
+        return size < capacity ? std::numeric_limits<T>::infinity() : distances_squared[0];
+    }
+
+    /**
+     * Sort the points by distance, the heap is invalid afterwards.
+     */
+    void Sort()
+    {
+        for (size_t count = size; count > 1; --count)
+        {
+            Swap(0, count - 1);
+            SiftDown(0, count - 1);
+        }
+    }
+};
+
+}  // namespace Math::Internal
+
+template <Math::FloatingPoint T, int N>
+void Math::Build(std::type_identity_t<std::span<const typename KdTree<T, N>::Point>> points,
+                 KdTree<T, N>& tree)
+{
+    using Bounds = typename KdTree<T, N>::Bounds;
+    assert(points.size() < UINT32_MAX);
+    const auto count = static_cast<uint32_t>(points.size());
+    tree.points = points;
+    tree.indices.resize(count);
+    if (count == 0)
+    {
+        return;
+    }
+
+    // The build sorts copies of the points, only the indices are kept.
+    using Entry = Internal::KdEntry<typename KdTree<T, N>::Point>;
+    std::vector<Entry> entry_storage(count);
+    const std::span<Entry> entries = entry_storage;
+    tree.bounds = Bounds(points[0]);
+    std::mutex bounds_mutex;
+    ParallelFor(count, Internal::k_kd_min_batch_size,
+                [&](size_t begin, size_t end)
+                {
+                    Bounds batch_bounds(points[begin]);
+                    for (size_t i = begin; i < end; ++i)
+                    {
+                        entries[i] = {points[i], static_cast<uint32_t>(i)};
+                        batch_bounds = Union(batch_bounds, points[i]);
+                    }
+                    const std::lock_guard lock(bounds_mutex);
+                    tree.bounds = Union(tree.bounds, batch_bounds);
+                });
+
+    // Split the top of the tree on this thread until there is a subtree per thread.
+    std::vector<Internal::KdRange<Bounds>> subtrees = {{0, count, tree.bounds}};
+    std::vector<Internal::KdRange<Bounds>> next_subtrees;
+    while (subtrees.size() < ThreadCount() &&
+           count / subtrees.size() > Internal::k_kd_min_batch_size)
+    {
+        next_subtrees.clear();
+        for (const Internal::KdRange<Bounds>& range : subtrees)
+        {
+            Internal::KdRange<Bounds> left;
+            Internal::KdRange<Bounds> right;
+            Internal::SplitKdRange(entries, range, left, right);
+            next_subtrees.push_back(left);
+            next_subtrees.push_back(right);
+        }
+        std::swap(subtrees, next_subtrees);
+    }
+    ParallelFor(subtrees.size(), 1,
+                [&](size_t begin, size_t end)
+                {
+                    for (size_t i = begin; i < end; ++i)
+                    {
+                        Internal::BuildKdSubtree(entries, subtrees[i]);
+                    }
+                });
+
+    ParallelFor(count, Internal::k_kd_min_batch_size,
+                [&](size_t begin, size_t end)
+                {
+                    for (size_t i = begin; i < end; ++i)
+                    {
+                        tree.indices[i] = entries[i].index;
+                    }
+                });
+}
+
+template <Math::FloatingPoint T, int N, typename Func>
+void Math::ForEachInRadius(const KdTree<T, N>& tree,
+                           const typename KdTree<T, N>::Point& center,
+                           T radius,
+                           Func&& func)
+{
+    const auto count = static_cast<uint32_t>(tree.indices.size());
+    T radius_squared = radius * radius;
+    auto visit = [&](uint32_t index, T distance_squared)
+    {
+        func(index, distance_squared);
+        return radius_squared;
+    };
+    Internal::TraverseKdSubtree(tree, center, {0, count, tree.bounds}, radius_squared, visit);
+}
+
+template <Math::FloatingPoint T, int N>
+size_t Math::FindNearest(const KdTree<T, N>& tree,
+                         const typename KdTree<T, N>::Point& center,
+                         std::span<uint32_t> indices,
+                         std::type_identity_t<std::span<T>> distances_squared)
+{
+    assert(indices.size() == distances_squared.size());
+    const size_t k = Math::Min(indices.size(), tree.indices.size());
+    Internal::NearestHeap<T> heap{indices.first(k), distances_squared.first(k)};
+    if (k == 0)
+    {
+        return 0;
+    }
+
+    const auto count = static_cast<uint32_t>(tree.indices.size());
+    T max_distance_squared = std::numeric_limits<T>::infinity();
+    auto visit = [&](uint32_t index, T distance_squared)
+    { return heap.Push(index, distance_squared); };
+    Internal::TraverseKdSubtree(tree, center, {0, count, tree.bounds}, max_distance_squared, visit);
+    heap.Sort();
+    return k;
+}
+
+template <Math::FloatingPoint T, int N>
+size_t Math::FindNearest(
+    const KdTree<T, N>& tree,
+    std::type_identity_t<std::span<const typename KdTree<T, N>::Point>> centers,
+    size_t k,
+    std::span<uint32_t> indices,
+    std::type_identity_t<std::span<T>> distances_squared)
+{
+    assert(indices.size() == centers.size() * k);
+    assert(distances_squared.size() == indices.size());
+    ParallelFor(centers.size(), Internal::k_kd_query_batch_size,
+                [&](size_t begin, size_t end)
+                {
+                    for (size_t i = begin; i < end; ++i)
+                    {
+                        FindNearest<T, N>(tree, centers[i], indices.subspan(i * k, k),
+                                          distances_squared.subspan(i * k, k));
+                    }
+                });
+    return Math::Min(k, tree.indices.size());
+}
@@ -0,0 +1,354 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <cstdint>
+#include <mutex>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "math/base.h"
+#include "math/bounds3.h"
+#include "math/morton.h"
+#include "math/parallel.h"
+#include "math/radix-sort.h"
+
+namespace Math
+{
+
+/**
+ * Marks a leaf in BVHNode::right.
+ */
+inline constexpr uint32_t k_bvh_leaf = UINT32_MAX;
+
+/**
+ * Node of a bounding volume hierarchy.
+ */
+template <typename T>
+struct BVHNode
+{
+    Bounds3<T> bounds;
+    /** Index of the first child for internal nodes, index of the primitive for leaves. */
+    uint32_t left;
+    /** Index of the second child for internal nodes, k_bvh_leaf for leaves. */
+    uint32_t right;
+};
+
+/**
+ * Binary bounding volume hierarchy built from the Morton order of the primitive centroids. The
+ * build is much faster than a SAH build at the cost of some query performance, which makes it
+ * suitable for scenes that change completely every frame.
+ * The n - 1 internal nodes come first with the root at index 0, followed by the n leaves in Morton
+ * order. With a single primitive the root is a leaf.
+ */
+template <FloatingPoint T>
+struct LinearBVH
+{
+    std::vector<BVHNode<T>> nodes;
+    /** Index of the parent of every node, k_bvh_leaf for the root. */
+    std::vector<uint32_t> parents;
+
+    /**
+     * Check if a node is a leaf.
+     * @param node Index of the node.
+     * @return True if the node is a leaf.
+     */
+    [[nodiscard]] bool IsLeaf(uint32_t node) const;
+};
+
+/**
+ * Read only view of the nodes of a hierarchy with the layout of LinearBVH, the root at index 0 and
+ * the leaves marked with k_bvh_leaf, for hierarchies stored elsewhere such as a mapped file.
+ */
+template <FloatingPoint T>
+struct BVHView
+{
+    std::span<const BVHNode<T>> nodes;
+
+    /**
+     * Check if a node is a leaf.
+     * @param node Index of the node.
+     * @return True if the node is a leaf.
+     */
+    [[nodiscard]] bool IsLeaf(uint32_t node) const;
+};
+
+/**
+ * Build the hierarchy for the bounds, the storage of the hierarchy is reused. Runs in parallel on
+ * ThreadCount() threads.
+ * Based on: Maximizing Parallelism in the Construction of BVHs, Octrees, and k-d Trees, Tero
+ * Karras, 2012.
+ * @param bounds The bounds of the primitives, the leaves store the indices into it.
+ * @param bvh The hierarchy to build.
+ */
+template <FloatingPoint T>
+void Build(std::type_identity_t<std::span<const Bounds3<T>>> bounds, LinearBVH<T>& bvh);
+
+/**
+ * Update the bounds of the nodes after the primitives moved, without changing the topology. The
+ * quality degrades as the primitives move away from their original Morton order.
+ * @param bounds The bounds of the primitives, in the same order as when the hierarchy was built.
+ * @param bvh The hierarchy to update.
+ */
+template <FloatingPoint T>
+void Refit(std::type_identity_t<std::span<const Bounds3<T>>> bounds, LinearBVH<T>& bvh);
+
+/**
+ * Call func(primitive) for every primitive whose bounds overlap the query bounds.
+ * @param bvh The hierarchy.
+ * @param query The query bounds.
+ * @param func The function to call with the index of the primitive.
+ */
+template <FloatingPoint T, typename Func>
+void ForEachOverlap(const LinearBVH<T>& bvh, const Bounds3<T>& query, Func&& func);
+
+/**
+ * Call func(primitive) for every primitive whose bounds overlap the query bounds.
+ * @param bvh The view of the hierarchy.
+ * @param query The query bounds.
+ * @param func The function to call with the index of the primitive.
+ */
+template <FloatingPoint T, typename Func>
+void ForEachOverlap(BVHView<T> bvh, const Bounds3<T>& query, Func&& func);
+
+}  // namespace Math
+
+// Implementation //////////////////////////////////////////////////////////////////////////////////
+
+namespace Math::Internal
+{
+
+inline constexpr size_t k_bvh_min_batch_size = 16 * 1024;
+// Every level of the hierarchy splits on one bit of the Morton code or of the index.
+inline constexpr size_t k_bvh_max_depth = 64;
+
+/**
+ * Length of the common prefix of the keys at i and j, where the index is appended to the Morton
+ * code to make the keys unique. Returns -1 when j is out of range.
+ */
+inline int32_t CommonPrefix(std::span<const uint32_t> codes, int64_t i, int64_t j)
+{
+    if (j < 0 || j >= static_cast<int64_t>(codes.size()))
+    {
+        return -1;
+    }
+    const uint32_t code_i = codes[static_cast<size_t>(i)];
+    const uint32_t code_j = codes[static_cast<size_t>(j)];
+    if (code_i == code_j)
+    {
+        return 32 + std::countl_zero(static_cast<uint32_t>(i ^ j));
+    }
+    return std::countl_zero(code_i ^ code_j);
+}
+
+/**
+ * Find the range of leaves covered by the internal node and the split position in it, and link the
+ * node to its children.
+ */
+template <FloatingPoint T>
+void EmitInternalNode(std::span<const uint32_t> codes, uint32_t node, LinearBVH<T>& bvh)
+{
+    const int64_t i = node;
+    const uint32_t internal_count = static_cast<uint32_t>(codes.size()) - 1;
+
+    // The direction of the range is towards the neighbour with the longer common prefix.
+    const int64_t d = CommonPrefix(codes, i, i + 1) > CommonPrefix(codes, i, i - 1) ? 1 : -1;
+    const int32_t prefix_min = CommonPrefix(codes, i, i - d);
+
+    // Find the other end of the range by exponential and then binary search.
+    int64_t max_length = 2;
+    while (CommonPrefix(codes, i, i + max_length * d) > prefix_min)
+    {
+        max_length *= 2;
+    }
+    int64_t length = 0;
+    for (int64_t step = max_length / 2; step >= 1; step /= 2)
+    {
+        if (CommonPrefix(codes, i, i + (length + step) * d) > prefix_min)
+        {
+            length += step;
+        }
+    }
+    const int64_t j = i + length * d;
+
+    // The split is where the common prefix of the range gets longer.
+    const int32_t prefix_node = CommonPrefix(codes, i, j);
+    int64_t split = 0;
+    int64_t step = length;
+    do
+    {
+        step = (step + 1) / 2;
+        if (CommonPrefix(codes, i, i + (split + step) * d) > prefix_node)
+        {
+            split += step;
+        }
+    } while (step > 1);
+    const auto gamma = static_cast<uint32_t>(i + split * d + Math::Min<int64_t>(d, 0));
+
+    const bool left_is_leaf = Math::Min<int64_t>(i, j) == gamma;
+    const bool right_is_leaf = Math::Max<int64_t>(i, j) == gamma + 1;
+    const uint32_t left = left_is_leaf ? internal_count + gamma : gamma;
+    const uint32_t right = right_is_leaf ? internal_count + gamma + 1 : gamma + 1;
+    bvh.nodes[node].left = left;
+    bvh.nodes[node].right = right;
+    bvh.parents[left] = node;
+    bvh.parents[right] = node;
+}
+
+}  // namespace Math::Internal
+
+template <Math::FloatingPoint T>
+bool Math::LinearBVH<T>::IsLeaf(uint32_t node) const
+{
+    return nodes[node].right == k_bvh_leaf;
+}
+
+template <Math::FloatingPoint T>
+bool Math::BVHView<T>::IsLeaf(uint32_t node) const
+{
+    return nodes[node].right == k_bvh_leaf;
+}
+
+template <Math::FloatingPoint T>
+void Math::Build(std::type_identity_t<std::span<const Bounds3<T>>> bounds, LinearBVH<T>& bvh)
+{
+    assert(bounds.size() < k_bvh_leaf);
+    const auto count = static_cast<uint32_t>(bounds.size());
+    bvh.nodes.resize(count == 0 ? 0 : 2 * count - 1);
+    bvh.parents.resize(bvh.nodes.size());
+    if (count == 0)
+    {
+        return;
+    }
+
+    auto centroid = [](const Bounds3<T>& b) { return b.min + (b.max - b.min) / static_cast<T>(2); };
+
+    // Bounds of the centroids, the Morton codes are relative to it.
+    Bounds3<T> centroid_bounds(centroid(bounds[0]));
+    std::mutex centroid_bounds_mutex;
+    ParallelFor(count, Internal::k_bvh_min_batch_size,
+                [&](size_t begin, size_t end)
+                {
+                    Bounds3<T> batch_bounds(centroid(bounds[begin]));
+                    for (size_t i = begin + 1; i < end; ++i)
+                    {
+                        batch_bounds = Union(batch_bounds, centroid(bounds[i]));
+                    }
+                    const std::lock_guard lock(centroid_bounds_mutex);
+                    centroid_bounds = Union(centroid_bounds, batch_bounds);
+                });
+
+    std::vector<uint32_t> codes(count);
+    std::vector<uint32_t> primitives(count);
+    ParallelFor(count, Internal::k_bvh_min_batch_size,
+                [&](size_t begin, size_t end)
+                {
+                    for (size_t i = begin; i < end; ++i)
+                    {
+                        codes[i] = EncodeMorton<uint32_t>(centroid_bounds, centroid(bounds[i]));
+                        primitives[i] = static_cast<uint32_t>(i);
+                    }
+                });
+    RadixSort<uint32_t, uint32_t>(codes, primitives);
+
+    // Every internal node only depends on the codes, so they are all emitted in parallel.
+    const uint32_t internal_count = count - 1;
+    bvh.parents[0] = k_bvh_leaf;
+    ParallelFor(count, Internal::k_bvh_min_batch_size,
+                [&](size_t begin, size_t end)
+                {
+                    for (size_t i = begin; i < end; ++i)
+                    {
+                        const auto index = static_cast<uint32_t>(i);
+                        if (index < internal_count)
+                        {
+                            Internal::EmitInternalNode(std::span<const uint32_t>(codes), index,
+                                                       bvh);
+                        }
+                        BVHNode<T>& leaf = bvh.nodes[internal_count + index];
+                        leaf.left = primitives[i];
+                        leaf.right = k_bvh_leaf;
+                    }
+                });
+
+    Refit<T>(bounds, bvh);
+}
+
+template <Math::FloatingPoint T>
+void Math::Refit(std::type_identity_t<std::span<const Bounds3<T>>> bounds, LinearBVH<T>& bvh)
+{
+    assert(bvh.nodes.size() == (bounds.empty() ? 0 : 2 * bounds.size() - 1));
+    if (bounds.empty())
+    {
+        return;
+    }
+
+    // Every leaf walks up the tree, the second child to arrive at a node computes its bounds so
+    // that both children are done.
+    const auto count = static_cast<uint32_t>(bounds.size());
+    const uint32_t internal_count = count - 1;
+    std::vector<uint32_t> arrivals(internal_count, 0);
+    ParallelFor(count, Internal::k_bvh_min_batch_size,
+                [&](size_t begin, size_t end)
+                {
+                    for (size_t i = begin; i < end; ++i)
+                    {
+                        BVHNode<T>& leaf = bvh.nodes[internal_count + i];
+                        leaf.bounds = bounds[leaf.left];
+                        uint32_t node = bvh.parents[internal_count + i];
+                        while (node != k_bvh_leaf)
+                        {
+                            std::atomic_ref<uint32_t> arrived(arrivals[node]);
+                            if (arrived.fetch_add(1, std::memory_order_acq_rel) == 0)
+                            {
+                                break;
+                            }
+                            BVHNode<T>& parent = bvh.nodes[node];
+                            parent.bounds = Union(bvh.nodes[parent.left].bounds,
+                                                  bvh.nodes[parent.right].bounds);
+                            node = bvh.parents[node];
+                        }
+                    }
+                });
+}
+
+template <Math::FloatingPoint T, typename Func>
+void Math::ForEachOverlap(const LinearBVH<T>& bvh, const Bounds3<T>& query, Func&& func)
+{
+    ForEachOverlap(BVHView<T>{bvh.nodes}, query, std::forward<Func>(func));
+}
+
+template <Math::FloatingPoint T, typename Func>
+void Math::ForEachOverlap(BVHView<T> bvh, const Bounds3<T>& query, Func&& func)
+{
+    if (bvh.nodes.empty())
+    {
+        return;
+    }
+
+    std::array<uint32_t, Internal::k_bvh_max_depth + 1> stack;
+    size_t stack_size = 0;
+    stack[stack_size++] = 0;
+    while (stack_size > 0)
+    {
+        const BVHNode<T>& node = bvh.nodes[stack[--stack_size]];
+        if (!Overlaps(node.bounds, query))
+        {
+            continue;
+        }
+        if (node.right == k_bvh_leaf)
+        {
+            func(node.left);
+        }
+        else
+        {
+            assert(stack_size + 2 <= stack.size());
+            stack[stack_size++] = node.right;
+            stack[stack_size++] = node.left;
+        }
+    }
+}
@@ -0,0 +1,544 @@
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+#include "math/base.h"
+#include "math/frustum.h"
+#include "math/spatial-types.h"
+
+namespace Math
+{
+
+/**
+ * Handle of an object in a LooseTree. Handles stay valid until the object is removed, a handle of a
+ * removed object is detected even if its slot is reused.
+ */
+struct LooseTreeHandle
+{
+    uint32_t index = UINT32_MAX;
+    uint32_t generation = 0;
+
+    constexpr bool operator==(const LooseTreeHandle& other) const = default;
+};
+
+/**
+ * Loose octree (N = 3) or quadtree (N = 2) for objects that are inserted, moved and removed
+ * incrementally. Every node covers twice the size of its cell, so an object is stored in the single
+ * node at the depth that matches its size, in the cell that contains its center. Finding the node
+ * does not depend on the other objects, and moving an object that stays in its node only updates
+ * its bounds. Nodes are created on demand and released when they become empty, nodes and objects
+ * live in pools that reuse their slots.
+ * Based on: Loose Octrees, Thatcher Ulrich, Game Programming Gems, 2000.
+ * @tparam T Data type of the bounds.
+ * @tparam N Number of dimensions, 2 or 3.
+ */
+template <FloatingPoint T, int N>
+    requires(N == 2 || N == 3)
+class LooseTree
+{
+public:
+    using Point = typename Internal::SpatialTypes<T, N>::Point;
+    using Bounds = typename Internal::SpatialTypes<T, N>::Bounds;
+
+    /**
+     * Constructs an empty tree.
+     * @param world_bounds The bounds of the root cell. Objects with their center outside of it are
+     * kept in the root and tested by every query.
+     * @param max_depth The depth of the smallest cells, at most 16.
+     */
+    explicit LooseTree(const Bounds& world_bounds, int32_t max_depth = 8);
+
+    /**
+     * Insert an object.
+     * @param bounds The bounds of the object.
+     * @return Handle of the object.
+     */
+    LooseTreeHandle Insert(const Bounds& bounds);
+
+    /**
+     * Remove an object, its handle becomes invalid.
+     * @param handle Handle of the object.
+     */
+    void Remove(LooseTreeHandle handle);
+
+    /**
+     * Update the bounds of an object. This is O(1) when the object stays in the same node.
+     * @param handle Handle of the object.
+     * @param bounds The new bounds of the object.
+     */
+    void Move(LooseTreeHandle handle, const Bounds& bounds);
+
+    /**
+     * Check if the handle refers to an object in the tree.
+     * @param handle The handle.
+     * @return True if the object has not been removed.
+     */
+    [[nodiscard]] bool IsValid(LooseTreeHandle handle) const;
+
+    /**
+     * Get the bounds of an object.
+     * @param handle Handle of the object.
+     * @return The bounds of the object.
+     */
+    [[nodiscard]] const Bounds& GetBounds(LooseTreeHandle handle) const;
+
+    /** @return The number of objects in the tree. */
+    [[nodiscard]] size_t Size() const;
+
+    /** @return The number of nodes in use, including the root. */
+    [[nodiscard]] size_t NodeCount() const;
+
+    /**
+     * Call func(handle) for every object whose bounds overlap the query bounds.
+     * @param query The query bounds.
+     * @param func The function to call.
+     */
+    template <typename Func>
+    void ForEachOverlap(const Bounds& query, Func&& func) const;
+
+    /**
+     * Call func(handle) for every object whose bounds are completely inside the query bounds.
+     * @param query The query bounds.
+     * @param func The function to call.
+     */
+    template <typename Func>
+    void ForEachInside(const Bounds& query, Func&& func) const;
+
+    /**
+     * Call func(handle) for every object whose bounds overlap the frustum. The test is
+     * conservative, see Overlaps(const Frustum<T>&, const Bounds3<T>&).
+     * @param frustum The frustum.
+     * @param func The function to call.
+     */
+    template <typename Func>
+    void ForEachInFrustum(const Frustum<T>& frustum, Func&& func) const
+        requires(N == 3);
+
+private:
+    static constexpr uint32_t k_invalid = UINT32_MAX;
+    static constexpr uint32_t k_child_count = 1u << N;
+    static constexpr uint32_t k_root = 0;
+
+    struct Node
+    {
+        /** The cell expanded by half its size on every side. */
+        Bounds loose_bounds;
+        std::array<uint32_t, N> cell;
+        int32_t depth;
+        uint32_t parent;
+        uint32_t first_object;
+        uint32_t child_count;
+        std::array<uint32_t, k_child_count> children;
+    };
+
+    struct Object
+    {
+        Bounds bounds;
+        uint32_t node;
+        /** Links of the object list of the node, next is also the link of the free list. */
+        uint32_t previous;
+        uint32_t next;
+        uint32_t generation;
+    };
+
+    struct Location
+    {
+        std::array<uint32_t, N> cell;
+        int32_t depth;
+    };
+
+    [[nodiscard]] Location FindLocation(const Bounds& bounds) const;
+    uint32_t FindOrCreateNode(const Location& location);
+    void Link(uint32_t object, uint32_t node);
+    void Unlink(uint32_t object);
+    void ReleaseEmptyNodes(uint32_t node);
+
+    /**
+     * Visit the objects of the subtree. test(bounds) classifies the loose bounds of the nodes,
+     * accept(bounds) tests the objects of the nodes that intersect the query.
+     */
+    template <typename Test, typename Accept, typename Func>
+    void Traverse(uint32_t node, bool inside, Test& test, Accept& accept, Func& func) const;
+
+    std::vector<Node> m_nodes;
+    std::vector<Object> m_objects;
+    uint32_t m_free_node = k_invalid;
+    uint32_t m_free_object = k_invalid;
+    size_t m_node_count = 1;
+    size_t m_size = 0;
+    Bounds m_world_bounds;
+    int32_t m_max_depth;
+};
+
+template <typename T>
+using LooseOctree = LooseTree<T, 3>;
+template <typename T>
+using LooseQuadtree = LooseTree<T, 2>;
+
+}  // namespace Math
+
+// Implementation //////////////////////////////////////////////////////////////////////////////////
+
+template <Math::FloatingPoint T, int N>
+    requires(N == 2 || N == 3)
+Math::LooseTree<T, N>::LooseTree(const Bounds& world_bounds, int32_t max_depth)
+    : m_world_bounds(world_bounds), m_max_depth(max_depth)
+{
+    assert(max_depth >= 0 && max_depth <= 16);
+    Node root;
+    root.loose_bounds = world_bounds;
+    root.cell.fill(0);
+    root.depth = 0;
+    root.parent = k_invalid;
+    root.first_object = k_invalid;
+    root.child_count = 0;
+    root.children.fill(k_invalid);
+    m_nodes.push_back(root);
+}
+
+template <Math::FloatingPoint T, int N>
+    requires(N == 2 || N == 3)
+Math::LooseTreeHandle Math::LooseTree<T, N>::Insert(const Bounds& bounds)
+{
+    uint32_t object = m_free_object;
+    if (object != k_invalid)
+    {
+        m_free_object = m_objects[object].next;
+    }
+    else
+    {
+        object = static_cast<uint32_t>(m_objects.size());
+        m_objects.push_back({});
+    }
+    m_objects[object].bounds = bounds;
+    Link(object, FindOrCreateNode(FindLocation(bounds)));
+    ++m_size;
+    return {object, m_objects[object].generation};
+}
+
+template <Math::FloatingPoint T, int N>
+    requires(N == 2 || N == 3)
+void Math::LooseTree<T, N>::Remove(LooseTreeHandle handle)
+{
+    assert(IsValid(handle));
+    const uint32_t node = m_objects[handle.index].node;
+    Unlink(handle.index);
+    ReleaseEmptyNodes(node);
+    Object& object = m_objects[handle.index];
+    ++object.generation;
+    object.node = k_invalid;
+    object.next = m_free_object;
+    m_free_object = handle.index;
+    --m_size;
+}
+
+template <Math::FloatingPoint T, int N>
+    requires(N == 2 || N == 3)
+void Math::LooseTree<T, N>::Move(LooseTreeHandle handle, const Bounds& bounds)
+{
+    assert(IsValid(handle));
+    Object& object = m_objects[handle.index];
+    object.bounds = bounds;
+    const Location location = FindLocation(bounds);
+    const Node& current = m_nodes[object.node];
+    if (current.depth == location.depth && current.cell == location.cell)
+    {
+        return;
+    }
+
+    const uint32_t previous_node = object.node;
+    Unlink(handle.index);
+    Link(handle.index, FindOrCreateNode(location));
+    ReleaseEmptyNodes(previous_node);
+}
+
+template <Math::FloatingPoint T, int N>
+    requires(N == 2 || N == 3)
+bool Math::LooseTree<T, N>::IsValid(LooseTreeHandle handle) const
+{
+    return handle.index < m_objects.size() &&
+           m_objects[handle.index].generation == handle.generation &&
+           m_objects[handle.index].node != k_invalid;
+}
+
+template <Math::FloatingPoint T, int N>
+    requires(N == 2 || N == 3)
+const typename Math::LooseTree<T, N>::Bounds& Math::LooseTree<T, N>::GetBounds(
+    LooseTreeHandle handle) const
+{
+    assert(IsValid(handle));
+    return m_objects[handle.index].bounds;
+}
+
+template <Math::FloatingPoint T, int N>
+    requires(N == 2 || N == 3)
+size_t Math::LooseTree<T, N>::Size() const
+{
+    return m_size;
+}
+
+template <Math::FloatingPoint T, int N>
+    requires(N == 2 || N == 3)
+size_t Math::LooseTree<T, N>::NodeCount() const
+{
+    return m_node_count;
+}
+
+template <Math::FloatingPoint T, int N>
+    requires(N == 2 || N == 3)
+template <typename Func>
+void Math::LooseTree<T, N>::ForEachOverlap(const Bounds& query, Func&& func) const
+{
+    auto test = [&](const Bounds& bounds)
+    {
+        if (!Overlaps(bounds, query))
+        {
+            return Internal::Containment::Outside;
+        }
+        return Internal::ContainsBounds<N>(query, bounds) ? Internal::Containment::Inside
+                                                          : Internal::Containment::Intersects;
+    };
+    auto accept = [&](const Bounds& bounds) { return Overlaps(bounds, query); };
+    Traverse(k_root, false, test, accept, func);
+}
+
+template <Math::FloatingPoint T, int N>
+    requires(N == 2 || N == 3)
+template <typename Func>
+void Math::LooseTree<T, N>::ForEachInside(const Bounds& query, Func&& func) const
+{
+    auto test = [&](const Bounds& bounds)
+    {
+        if (!Overlaps(bounds, query))
+        {
+            return Internal::Containment::Outside;
+        }
+        return Internal::ContainsBounds<N>(query, bounds) ? Internal::Containment::Inside
+                                                          : Internal::Containment::Intersects;
+    };
+    auto accept = [&](const Bounds& bounds) { return Internal::ContainsBounds<N>(query, bounds); };
+    Traverse(k_root, false, test, accept, func);
+}
+
+template <Math::FloatingPoint T, int N>
+    requires(N == 2 || N == 3)
+template <typename Func>
+void Math::LooseTree<T, N>::ForEachInFrustum(const Frustum<T>& frustum, Func&& func) const
+    requires(N == 3)
+{
+    auto test = [&](const Bounds& bounds) { return Internal::Classify(frustum, bounds); };
+    auto accept = [&](const Bounds& bounds) { return Overlaps(frustum, bounds); };
+    Traverse(k_root, false, test, accept, func);
+}
+
+template <Math::FloatingPoint T, int N>
+    requires(N == 2 || N == 3)
+typename Math::LooseTree<T, N>::Location Math::LooseTree<T, N>::FindLocation(
+    const Bounds& bounds) const
+{
+    Location location;
+    location.cell.fill(0);
+    location.depth = 0;
+    const Point center = bounds.min + (bounds.max - bounds.min) / static_cast<T>(2);
+    if (!InsideInclusive(m_world_bounds, center))
+    {
+        return location;
+    }
+
+    // The deepest level where the object is not larger than the cell, it then extends at most
+    // half a cell out of its cell.
+    T cell_scale = 1;
+    while (location.depth < m_max_depth)
+    {
+        bool fits = true;
+        for (int32_t axis = 0; axis < N; ++axis)
+        {
+            const T world_size = Internal::Coordinate(m_world_bounds.max, axis) -
+                                 Internal::Coordinate(m_world_bounds.min, axis);
+            const T size =
+                Internal::Coordinate(bounds.max, axis) - Internal::Coordinate(bounds.min, axis);
+            fits = fits && size <= world_size * cell_scale / 2;
+        }
+        if (!fits)
+        {
+            break;
+        }
+        ++location.depth;
+        cell_scale /= 2;
+    }
+
+    const auto cells = static_cast<T>(1u << location.depth);
+    for (int32_t axis = 0; axis < N; ++axis)
+    {
+        const T world_min = Internal::Coordinate(m_world_bounds.min, axis);
+        const T world_size = Internal::Coordinate(m_world_bounds.max, axis) - world_min;
+        const T offset =
+            world_size > 0 ? (Internal::Coordinate(center, axis) - world_min) / world_size : 0;
+        const T cell = Math::Clamp(offset * cells, T{0}, cells - 1);
+        location.cell[static_cast<size_t>(axis)] = static_cast<uint32_t>(cell);
+    }
+    return location;
+}
+
+template <Math::FloatingPoint T, int N>
+    requires(N == 2 || N == 3)
+uint32_t Math::LooseTree<T, N>::FindOrCreateNode(const Location& location)
+{
+    uint32_t node = k_root;
+    for (int32_t depth = 1; depth <= location.depth; ++depth)
+    {
+        // The bit of the cell coordinates at this depth selects the child.
+        const int32_t shift = location.depth - depth;
+        uint32_t slot = 0;
+        for (int32_t axis = 0; axis < N; ++axis)
+        {
+            slot |= ((location.cell[static_cast<size_t>(axis)] >> shift) & 1) << axis;
+        }
+
+        uint32_t child = m_nodes[node].children[slot];
+        if (child == k_invalid)
+        {
+            child = m_free_node;
+            if (child != k_invalid)
+            {
+                m_free_node = m_nodes[child].parent;
+            }
+            else
+            {
+                child = static_cast<uint32_t>(m_nodes.size());
+                m_nodes.push_back({});
+            }
+
+            Node& parent = m_nodes[node];
+            Node& created = m_nodes[child];
+            created.depth = depth;
+            created.parent = node;
+            created.first_object = k_invalid;
+            created.child_count = 0;
+            created.children.fill(k_invalid);
+            // Cell and loose bounds of the child.
+            const T cell_scale = static_cast<T>(1) / static_cast<T>(1u << depth);
+            for (int32_t axis = 0; axis < N; ++axis)
+            {
+                const auto a = static_cast<size_t>(axis);
+                created.cell[a] = (parent.cell[a] << 1) | ((slot >> axis) & 1);
+                const T world_min = Internal::Coordinate(m_world_bounds.min, axis);
+                const T cell_size =
+                    (Internal::Coordinate(m_world_bounds.max, axis) - world_min) * cell_scale;
+                const T cell_min = world_min + static_cast<T>(created.cell[a]) * cell_size;
+                Internal::Coordinate(created.loose_bounds.min, axis) = cell_min - cell_size / 2;
+                Internal::Coordinate(created.loose_bounds.max, axis) =
+                    cell_min + cell_size * static_cast<T>(1.5);
+            }
+            parent.children[slot] = child;
+            ++parent.child_count;
+            ++m_node_count;
+        }
+        node = child;
+    }
+    return node;
+}
+
+template <Math::FloatingPoint T, int N>
+    requires(N == 2 || N == 3)
+void Math::LooseTree<T, N>::Link(uint32_t object, uint32_t node)
+{
+    Object& o = m_objects[object];
+    Node& n = m_nodes[node];
+    o.node = node;
+    o.previous = k_invalid;
+    o.next = n.first_object;
+    if (n.first_object != k_invalid)
+    {
+        m_objects[n.first_object].previous = object;
+    }
+    n.first_object = object;
+}
+
+template <Math::FloatingPoint T, int N>
+    requires(N == 2 || N == 3)
+void Math::LooseTree<T, N>::Unlink(uint32_t object)
+{
+    const Object& o = m_objects[object];
+    if (o.previous != k_invalid)
+    {
+        m_objects[o.previous].next = o.next;
+    }
+    else
+    {
+        m_nodes[o.node].first_object = o.next;
+    }
+    if (o.next != k_invalid)
+    {
+        m_objects[o.next].previous = o.previous;
+    }
+}
+
+template <Math::FloatingPoint T, int N>
+    requires(N == 2 || N == 3)
+void Math::LooseTree<T, N>::ReleaseEmptyNodes(uint32_t node)
+{
+    while (node != k_root && m_nodes[node].first_object == k_invalid &&
+           m_nodes[node].child_count == 0)
+    {
+        Node& parent = m_nodes[m_nodes[node].parent];
+        for (uint32_t& child : parent.children)
+        {
+            if (child == node)
+            {
+                child = k_invalid;
+            }
+        }
+        --parent.child_count;
+        const uint32_t parent_index = m_nodes[node].parent;
+        m_nodes[node].parent = m_free_node;
+        m_free_node = node;
+        --m_node_count;
+        node = parent_index;
+    }
+}
+
+template <Math::FloatingPoint T, int N>
+    requires(N == 2 || N == 3)
+template <typename Test, typename Accept, typename Func>
+void Math::LooseTree<T, N>::Traverse(uint32_t node,
+                                     bool inside,
+                                     Test& test,
+                                     Accept& accept,
+                                     Func& func) const
+{
+    const Node& n = m_nodes[node];
+    // The root also holds the objects outside of the world bounds, so it is always entered.
+    if (!inside && node != k_root)
+    {
+        const Internal::Containment result = test(n.loose_bounds);
+        if (result == Internal::Containment::Outside)
+        {
+            return;
+        }
+        inside = result == Internal::Containment::Inside;
+    }
+
+    for (uint32_t object = n.first_object; object != k_invalid; object = m_objects[object].next)
+    {
+        const Object& o = m_objects[object];
+        if (inside || accept(o.bounds))
+        {
+            func(LooseTreeHandle{object, o.generation});
+        }
+    }
+    if (n.child_count == 0)
+    {
+        return;
+    }
+    for (const uint32_t child : n.children)
+    {
+        if (child != k_invalid)
+        {
+            Traverse(child, inside, test, accept, func);
+        }
+    }
+}
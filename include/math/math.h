@@ -1,18 +1,43 @@
 #pragma once
 
 #include "math/base.h"
+#include "math/binary-file.h"
 #include "math/bounds2.h"
 #include "math/bounds3.h"
+#include "math/bounds3-batch.h"
+#include "math/bvh-file.h"
+#include "math/dynamic-aabb-tree.h"
+#include "math/fixed.h"
+#include "math/frustum.h"
+#include "math/half.h"
+#include "math/kd-tree.h"
+#include "math/linear-bvh.h"
+#include "math/loose-tree.h"
+#include "math/matrix.h"
 #include "math/matrix4x4.h"
+#include "math/mesh.h"
+#include "math/morton.h"
+#include "math/normal-encoding.h"
+#include "math/parallel.h"
+#include "math/point-quantization.h"
+#include "math/point-statistics.h"
 #include "math/projections.h"
+#include "math/radix-sort.h"
+#include "math/ray.h"
 #include "math/rng.h"
 #include "math/rotator.h"
+#include "math/spatial-hash-grid.h"
+#include "math/spatial-types.h"
+#include "math/sphere.h"
+#include "math/sweep-and-prune.h"
 #include "math/transform.h"
 #include "math/vector2.h"
 #include "math/vector3.h"
 #include "math/vector4.h"
 #include "math/normal3.h"
+#include "math/oriented-bounds3.h"
 #include "math/point2.h"
 #include "math/point3.h"
 #include "math/point4.h"
 #include "math/quaternion.h"
+#include "math/quaternion-batch.h"
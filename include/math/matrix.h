@@ -0,0 +1,760 @@
+﻿#pragma once
+
+#include <array>
+#include <utility>
+
+#include "math/base.h"
+#include "math/bounds3.h"
+#include "math/normal3.h"
+#include "math/point2.h"
+#include "math/point3.h"
+#include "math/point4.h"
+#include "math/vector2.h"
+#include "math/vector3.h"
+#include "math/vector4.h"
+
+namespace Math
+{
+
+template <typename T, int N, int M>
+using Array2D = std::array<std::array<T, M>, N>;
+
+/**
+ * A matrix with a size known at compile time. All the kernels are unrolled at compile time so small
+ * matrices don't pay for loops or for the padding to a bigger size.
+ * @tparam T The type of the matrix elements.
+ * @tparam R The number of rows.
+ * @tparam C The number of columns.
+ */
+template <typename T, int R, int C>
+struct Matrix
+{
+    static_assert(R > 0 && C > 0, "Matrix needs to have at least one row and one column!");
+
+    constexpr static int32_t k_row_count = R;
+    constexpr static int32_t k_column_count = C;
+
+    Array2D<T, k_row_count, k_column_count> elements;
+
+    /**
+     * Constructs a matrix with elements not initialized.
+     */
+    constexpr Matrix();
+
+    /**
+     * Constructs a matrix with elements on the main diagonal equal to the value while other
+     * elements are set to 0.
+     * @param value The value to set the main diagonal elements to.
+     */
+    constexpr explicit Matrix(T value);
+
+    /**
+     * Constructs a matrix with elements set to the values in the array. The array is expected
+     * to be in row-major order.
+     * @param mat_elements The array of values to set the matrix elements to.
+     */
+    constexpr explicit Matrix(const Array2D<T, R, C>& mat_elements);
+
+    // clang-format off
+    /**
+     * Constructs a 2x2 matrix with elements set to the values passed in.
+     */
+    constexpr Matrix(T t00, T t01,
+                     T t10, T t11) requires(R == 2 && C == 2);
+
+    /**
+     * Constructs a 3x3 matrix with elements set to the values passed in.
+     */
+    constexpr Matrix(T t00, T t01, T t02,
+                     T t10, T t11, T t12,
+                     T t20, T t21, T t22) requires(R == 3 && C == 3);
+
+    /**
+     * Constructs a 4x4 matrix with elements set to the values passed in.
+     */
+    constexpr Matrix(T t00, T t01, T t02, T t03,
+                     T t10, T t11, T t12, T t13,
+                     T t20, T t21, T t22, T t23,
+                     T t30, T t31, T t32, T t33) requires(R == 4 && C == 4);
+    // clang-format on
+
+    /**
+     * Create a zero matrix.
+     * @return The zero matrix.
+     */
+    static constexpr Matrix Zero();
+
+    /** Operators **/
+    constexpr T& operator()(int32_t row, int32_t column);
+    constexpr const T& operator()(int32_t row, int32_t column) const;
+
+    constexpr bool operator==(const Matrix& other) const;
+    constexpr bool operator!=(const Matrix& other) const;
+
+    template <int K>
+    constexpr Matrix<T, R, K> operator*(const Matrix<T, C, K>& other) const;
+    constexpr Matrix& operator*=(const Matrix& other) requires(R == C);
+    constexpr Matrix operator+(const Matrix& other) const;
+    constexpr Matrix& operator+=(const Matrix& other);
+    constexpr Matrix operator-(const Matrix& other) const;
+    constexpr Matrix& operator-=(const Matrix& other);
+
+    template <typename U>
+    constexpr Matrix operator*(U scalar) const;
+    template <typename U>
+    constexpr Matrix& operator*=(U scalar);
+    template <typename U>
+    constexpr Matrix operator/(U scalar) const;
+    template <typename U>
+    constexpr Matrix& operator/=(U scalar);
+
+    /**
+     * Transforms using the upper left 2x2 part of the matrix, so the translation of a 3x3 affine
+     * transform is not applied.
+     */
+    constexpr Vector2<T> operator*(const Vector2<T>& v) const
+        requires(R == C && (R == 2 || R == 3));
+
+    /**
+     * Transforms a point by a 3x3 matrix representing a 2D homogeneous transform.
+     */
+    constexpr Point2<T> operator*(const Point2<T>& p) const requires(R == 3 && C == 3);
+
+    /**
+     * Transforms using the upper left 3x3 part of the matrix, so the translation of a 4x4 affine
+     * transform is not applied.
+     */
+    constexpr Vector3<T> operator*(const Vector3<T>& v) const
+        requires(R == C && (R == 3 || R == 4));
+
+    /**
+     * Transforms the normal using the transpose of the upper left 3x3 part of the matrix. To
+     * transform a normal by a transform pass the inverse of that transform.
+     */
+    constexpr Normal3<T> operator*(const Normal3<T>& n) const
+        requires(R == C && (R == 3 || R == 4));
+
+    constexpr Point3<T> operator*(const Point3<T>& p) const requires(R == 4 && C == 4);
+    constexpr Point4<T> operator*(const Point4<T>& p) const requires(R == 4 && C == 4);
+    constexpr Vector4<T> operator*(const Vector4<T>& v) const requires(R == 4 && C == 4);
+};
+
+template <typename T>
+using Matrix2x2 = Matrix<T, 2, 2>;
+template <typename T>
+using Matrix3x3 = Matrix<T, 3, 3>;
+template <typename T>
+using Matrix4x4 = Matrix<T, 4, 4>;
+
+template <typename T>
+concept integral_or_floating_point = std::integral<T> || Math::FloatingPoint<T>;
+
+template <typename T, int R, int C, integral_or_floating_point U>
+constexpr Matrix<T, R, C> operator*(U scalar, const Matrix<T, R, C>& m);
+
+/**
+ * Check if two matrices are equal.
+ * @param m1 The first matrix.
+ * @param m2 The second matrix.
+ * @param epsilon The epsilon value to use for comparison.
+ * @return True if the matrices are equal, false otherwise.
+ */
+template <typename T, int R, int C>
+constexpr bool IsEqual(const Matrix<T, R, C>& m1, const Matrix<T, R, C>& m2, T epsilon);
+
+/**
+ * Transpose the matrix.
+ * @param m The matrix to transpose.
+ * @return The transposed matrix.
+ */
+template <typename T, int R, int C>
+[[nodiscard]] constexpr Matrix<T, C, R> Transpose(const Matrix<T, R, C>& m);
+
+/**
+ * Calculate the determinant of the matrix.
+ * @param m The matrix. Supported sizes are 2x2, 3x3 and 4x4.
+ * @return The determinant of the matrix.
+ */
+template <typename T, int N>
+    requires(N >= 2 && N <= 4)
+[[nodiscard]] constexpr T Determinant(const Matrix<T, N, N>& m);
+
+/**
+ * Invert the matrix.
+ * @param m The matrix to invert. Supported sizes are 2x2, 3x3 and 4x4. Must not be singular.
+ * @return The inverted matrix.
+ */
+template <Math::FloatingPoint T, int N>
+    requires(N >= 2 && N <= 4)
+[[nodiscard]] constexpr Matrix<T, N, N> Inverse(const Matrix<T, N, N>& m);
+
+/**
+ * Transform the point by an affine transform and bound the rounding error of the result.
+ * Based on: Physically Based Rendering, 3rd edition, section 3.9.4.
+ * @param m The transform. The last row needs to be 0, 0, 0, 1.
+ * @param p The point to transform.
+ * @param out_error The bound on the absolute error of each coordinate of the result.
+ * @return The transformed point.
+ */
+template <Math::FloatingPoint T>
+constexpr Point3<T> TransformPoint(const Matrix4x4<T>& m,
+                                   const Point3<T>& p,
+                                   Vector3<T>& out_error);
+
+/**
+ * Transform a point that already carries an error by an affine transform and bound the error of
+ * the result, which includes the transformed error of the point.
+ * @param m The transform. The last row needs to be 0, 0, 0, 1.
+ * @param p The point to transform.
+ * @param p_error The bound on the absolute error of each coordinate of the point.
+ * @param out_error The bound on the absolute error of each coordinate of the result.
+ * @return The transformed point.
+ */
+template <Math::FloatingPoint T>
+constexpr Point3<T> TransformPoint(const Matrix4x4<T>& m,
+                                   const Point3<T>& p,
+                                   const Vector3<T>& p_error,
+                                   Vector3<T>& out_error);
+
+/**
+ * Bound a box transformed by an affine transform, from the center and extent of the box instead of
+ * its eight corners. The new center is the transformed center and every new extent is the sum of
+ * the extents weighted by the absolute values of a row of the matrix. The result is the same box
+ * as the union of the transformed corners, up to rounding.
+ * Based on: Transforming Axis-Aligned Bounding Boxes, Arvo, Graphics Gems, 1990.
+ * @param m The transform. The last row needs to be 0, 0, 0, 1.
+ * @param b The box, with min not greater than max.
+ * @return The axis aligned box containing the transformed box.
+ */
+template <Math::FloatingPoint T>
+[[nodiscard]] constexpr Bounds3<T> TransformBounds(const Matrix4x4<T>& m, const Bounds3<T>& b);
+
+}  // namespace Math
+
+// Implementation //////////////////////////////////////////////////////////////////////////////////
+
+namespace Math::Internal
+{
+
+template <typename Func, int... k_indices>
+constexpr void UnrollImpl(Func& func, std::integer_sequence<int, k_indices...>)
+{
+    (func(std::integral_constant<int, k_indices>{}), ...);
+}
+
+/**
+ * Calls func with std::integral_constant<int, I> for every I in [0, N). The calls are expanded at
+ * compile time so the indices are constants inside of func.
+ */
+template <int N, typename Func>
+constexpr void Unroll(Func&& func)
+{
+    UnrollImpl(func, std::make_integer_sequence<int, N>{});
+}
+
+}  // namespace Math::Internal
+
+template <typename T, int R, int C>
+constexpr Math::Matrix<T, R, C>::Matrix()
+{
+    // Do nothing
+}
+
+template <typename T, int R, int C>
+constexpr Math::Matrix<T, R, C>::Matrix(T value)
+{
+    Internal::Unroll<R>(
+        [&](auto i)
+        { Internal::Unroll<C>([&](auto j) { elements[i][j] = (i == j) ? value : 0; }); });
+}
+
+template <typename T, int R, int C>
+constexpr Math::Matrix<T, R, C>::Matrix(const Array2D<T, R, C>& mat_elements)
+    : elements(mat_elements)
+{
+}
+
+template <typename T, int R, int C>
+constexpr Math::Matrix<T, R, C>::Matrix(T t00, T t01, T t10, T t11)
+    requires(R == 2 && C == 2)
+{
+    // clang-format off
+    elements[0][0] = t00; elements[0][1] = t01;
+    elements[1][0] = t10; elements[1][1] = t11;
+    // clang-format on
+}
+
+template <typename T, int R, int C>
+constexpr Math::Matrix<T, R, C>::Matrix(T t00,
+                                        T t01,
+                                        T t02,
+                                        T t10,
+                                        T t11,
+                                        T t12,
+                                        T t20,
+                                        T t21,
+                                        T t22)
+    requires(R == 3 && C == 3)
+{
+    // clang-format off
+    elements[0][0] = t00; elements[0][1] = t01; elements[0][2] = t02;
+    elements[1][0] = t10; elements[1][1] = t11; elements[1][2] = t12;
+    elements[2][0] = t20; elements[2][1] = t21; elements[2][2] = t22;
+    // clang-format on
+}
+
+template <typename T, int R, int C>
+constexpr Math::Matrix<T, R, C>::Matrix(T t00,
+                                        T t01,
+                                        T t02,
+                                        T t03,
+                                        T t10,
+                                        T t11,
+                                        T t12,
+                                        T t13,
+                                        T t20,
+                                        T t21,
+                                        T t22,
+                                        T t23,
+                                        T t30,
+                                        T t31,
+                                        T t32,
+                                        T t33)
+    requires(R == 4 && C == 4)
+{
+    // clang-format off
+    elements[0][0] = t00; elements[0][1] = t01; elements[0][2] = t02; elements[0][3] = t03;
+    elements[1][0] = t10; elements[1][1] = t11; elements[1][2] = t12; elements[1][3] = t13;
+    elements[2][0] = t20; elements[2][1] = t21; elements[2][2] = t22; elements[2][3] = t23;
+    elements[3][0] = t30; elements[3][1] = t31; elements[3][2] = t32; elements[3][3] = t33;
+    // clang-format on
+}
+
+template <typename T, int R, int C>
+constexpr Math::Matrix<T, R, C> Math::Matrix<T, R, C>::Zero()
+{
+    return Matrix(0);
+}
+
+template <typename T, int R, int C>
+constexpr bool Math::Matrix<T, R, C>::operator==(const Matrix& other) const
+{
+    for (int32_t i = 0; i < k_row_count; ++i)
+    {
+        for (int32_t j = 0; j < k_column_count; ++j)
+        {
+            if (elements[i][j] != other.elements[i][j])
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+template <typename T, int R, int C>
+constexpr bool Math::Matrix<T, R, C>::operator!=(const Matrix& other) const
+{
+    return !(*this == other);
+}
+
+template <typename T, int R, int C>
+constexpr T& Math::Matrix<T, R, C>::operator()(int32_t row, int32_t column)
+{
+    assert(row >= 0 && row < k_row_count);
+    assert(column >= 0 && column < k_column_count);
+    return elements[row][column];
+}
+
+template <typename T, int R, int C>
+constexpr const T& Math::Matrix<T, R, C>::operator()(int32_t row, int32_t column) const
+{
+    assert(row >= 0 && row < k_row_count);
+    assert(column >= 0 && column < k_column_count);
+    return elements[row][column];
+}
+
+template <typename T, int R, int C>
+template <int K>
+constexpr Math::Matrix<T, R, K> Math::Matrix<T, R, C>::operator*(const Matrix<T, C, K>& other) const
+{
+    Matrix<T, R, K> result;
+    Internal::Unroll<R>(
+        [&](auto i)
+        {
+            Internal::Unroll<K>(
+                [&](auto j)
+                {
+                    T sum = elements[i][0] * other.elements[0][j];
+                    Internal::Unroll<C - 1>(
+                        [&](auto k) { sum += elements[i][k + 1] * other.elements[k + 1][j]; });
+                    result.elements[i][j] = sum;
+                });
+        });
+    return result;
+}
+
+template <typename T, int R, int C>
+constexpr Math::Matrix<T, R, C>& Math::Matrix<T, R, C>::operator*=(const Matrix& other)
+    requires(R == C)
+{
+    *this = *this * other;
+    return *this;
+}
+
+template <typename T, int R, int C>
+constexpr Math::Matrix<T, R, C> Math::Matrix<T, R, C>::operator+(const Matrix& other) const
+{
+    Matrix result;
+    Internal::Unroll<R>(
+        [&](auto i)
+        {
+            Internal::Unroll<C>([&](auto j)
+                                { result.elements[i][j] = elements[i][j] + other.elements[i][j]; });
+        });
+    return result;
+}
+
+template <typename T, int R, int C>
+constexpr Math::Matrix<T, R, C>& Math::Matrix<T, R, C>::operator+=(const Matrix& other)
+{
+    *this = *this + other;
+    return *this;
+}
+
+template <typename T, int R, int C>
+constexpr Math::Matrix<T, R, C> Math::Matrix<T, R, C>::operator-(const Matrix& other) const
+{
+    Matrix result;
+    Internal::Unroll<R>(
+        [&](auto i)
+        {
+            Internal::Unroll<C>([&](auto j)
+                                { result.elements[i][j] = elements[i][j] - other.elements[i][j]; });
+        });
+    return result;
+}
+
+template <typename T, int R, int C>
+constexpr Math::Matrix<T, R, C>& Math::Matrix<T, R, C>::operator-=(const Matrix& other)
+{
+    *this = *this - other;
+    return *this;
+}
+
+template <typename T, int R, int C>
+template <typename U>
+constexpr Math::Matrix<T, R, C> Math::Matrix<T, R, C>::operator*(U scalar) const
+{
+    const T sc = static_cast<T>(scalar);
+    Matrix result;
+    Internal::Unroll<R>(
+        [&](auto i)
+        { Internal::Unroll<C>([&](auto j) { result.elements[i][j] = elements[i][j] * sc; }); });
+    return result;
+}
+
+template <typename T, int R, int C>
+template <typename U>
+constexpr Math::Matrix<T, R, C>& Math::Matrix<T, R, C>::operator*=(U scalar)
+{
+    *this = *this * scalar;
+    return *this;
+}
+
+template <typename T, int R, int C>
+template <typename U>
+constexpr Math::Matrix<T, R, C> Math::Matrix<T, R, C>::operator/(U scalar) const
+{
+    const T sc = static_cast<T>(scalar);
+    Matrix result;
+    Internal::Unroll<R>(
+        [&](auto i)
+        { Internal::Unroll<C>([&](auto j) { result.elements[i][j] = elements[i][j] / sc; }); });
+    return result;
+}
+
+template <typename T, int R, int C>
+template <typename U>
+constexpr Math::Matrix<T, R, C>& Math::Matrix<T, R, C>::operator/=(U scalar)
+{
+    *this = *this / scalar;
+    return *this;
+}
+
+template <typename T, int R, int C>
+constexpr Math::Vector2<T> Math::Matrix<T, R, C>::operator*(const Vector2<T>& v) const
+    requires(R == C && (R == 2 || R == 3))
+{
+    const T x = elements[0][0] * v.x + elements[0][1] * v.y;
+    const T y = elements[1][0] * v.x + elements[1][1] * v.y;
+    return Vector2<T>(x, y);
+}
+
+template <typename T, int R, int C>
+constexpr Math::Point2<T> Math::Matrix<T, R, C>::operator*(const Point2<T>& p) const
+    requires(R == 3 && C == 3)
+{
+    const T x = elements[0][0] * p.x + elements[0][1] * p.y + elements[0][2];
+    const T y = elements[1][0] * p.x + elements[1][1] * p.y + elements[1][2];
+    const T w = elements[2][0] * p.x + elements[2][1] * p.y + elements[2][2];
+    return Point2<T>(x / w, y / w);
+}
+
+template <typename T, int R, int C>
+constexpr Math::Vector3<T> Math::Matrix<T, R, C>::operator*(const Vector3<T>& v) const
+    requires(R == C && (R == 3 || R == 4))
+{
+    const T x = elements[0][0] * v.x + elements[0][1] * v.y + elements[0][2] * v.z;
+    const T y = elements[1][0] * v.x + elements[1][1] * v.y + elements[1][2] * v.z;
+    const T z = elements[2][0] * v.x + elements[2][1] * v.y + elements[2][2] * v.z;
+    return Vector3<T>(x, y, z);
+}
+
+template <typename T, int R, int C>
+constexpr Math::Normal3<T> Math::Matrix<T, R, C>::operator*(const Normal3<T>& n) const
+    requires(R == C && (R == 3 || R == 4))
+{
+    const T x = elements[0][0] * n.x + elements[1][0] * n.y + elements[2][0] * n.z;
+    const T y = elements[0][1] * n.x + elements[1][1] * n.y + elements[2][1] * n.z;
+    const T z = elements[0][2] * n.x + elements[1][2] * n.y + elements[2][2] * n.z;
+    return Normal3<T>(x, y, z);
+}
+
+template <typename T, int R, int C>
+constexpr Math::Point3<T> Math::Matrix<T, R, C>::operator*(const Point3<T>& p) const
+    requires(R == 4 && C == 4)
+{
+    const T x = elements[0][0] * p.x + elements[0][1] * p.y + elements[0][2] * p.z + elements[0][3];
+    const T y = elements[1][0] * p.x + elements[1][1] * p.y + elements[1][2] * p.z + elements[1][3];
+    const T z = elements[2][0] * p.x + elements[2][1] * p.y + elements[2][2] * p.z + elements[2][3];
+    const T w = elements[3][0] * p.x + elements[3][1] * p.y + elements[3][2] * p.z + elements[3][3];
+    return Point3<T>(x / w, y / w, z / w);
+}
+
+template <typename T, int R, int C>
+constexpr Math::Point4<T> Math::Matrix<T, R, C>::operator*(const Point4<T>& p) const
+    requires(R == 4 && C == 4)
+{
+    const T x =
+        elements[0][0] * p.x + elements[0][1] * p.y + elements[0][2] * p.z + elements[0][3] * p.w;
+    const T y =
+        elements[1][0] * p.x + elements[1][1] * p.y + elements[1][2] * p.z + elements[1][3] * p.w;
+    const T z =
+        elements[2][0] * p.x + elements[2][1] * p.y + elements[2][2] * p.z + elements[2][3] * p.w;
+    const T w =
+        elements[3][0] * p.x + elements[3][1] * p.y + elements[3][2] * p.z + elements[3][3] * p.w;
+    return Point4<T>(x, y, z, w);
+}
+
+template <typename T, int R, int C>
+constexpr Math::Vector4<T> Math::Matrix<T, R, C>::operator*(const Vector4<T>& v) const
+    requires(R == 4 && C == 4)
+{
+    const T x =
+        elements[0][0] * v.x + elements[0][1] * v.y + elements[0][2] * v.z + elements[0][3] * v.w;
+    const T y =
+        elements[1][0] * v.x + elements[1][1] * v.y + elements[1][2] * v.z + elements[1][3] * v.w;
+    const T z =
+        elements[2][0] * v.x + elements[2][1] * v.y + elements[2][2] * v.z + elements[2][3] * v.w;
+    const T w =
+        elements[3][0] * v.x + elements[3][1] * v.y + elements[3][2] * v.z + elements[3][3] * v.w;
+    return Vector4<T>(x, y, z, w);
+}
+
+template <typename T, int R, int C, Math::integral_or_floating_point U>
+constexpr Math::Matrix<T, R, C> Math::operator*(U scalar, const Matrix<T, R, C>& m)
+{
+    return m * static_cast<T>(scalar);
+}
+
+template <typename T, int R, int C>
+constexpr bool Math::IsEqual(const Matrix<T, R, C>& m1, const Matrix<T, R, C>& m2, T epsilon)
+{
+    for (int32_t i = 0; i < R; ++i)
+    {
+        for (int32_t j = 0; j < C; ++j)
+        {
+            if (!Math::IsEqual(m1.elements[i][j], m2.elements[i][j], epsilon))
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+template <typename T, int R, int C>
+constexpr Math::Matrix<T, C, R> Math::Transpose(const Matrix<T, R, C>& m)
+{
+    Matrix<T, C, R> result;
+    Internal::Unroll<R>(
+        [&](auto i)
+        { Internal::Unroll<C>([&](auto j) { result.elements[j][i] = m.elements[i][j]; }); });
+    return result;
+}
+
+template <typename T, int N>
+    requires(N >= 2 && N <= 4)
+constexpr T Math::Determinant(const Matrix<T, N, N>& m)
+{
+    const Array2D<T, N, N>& a = m.elements;
+    if constexpr (N == 2)
+    {
+        return a[0][0] * a[1][1] - a[0][1] * a[1][0];
+    }
+    else if constexpr (N == 3)
+    {
+        return a[0][0] * (a[1][1] * a[2][2] - a[1][2] * a[2][1]) +
+               a[0][1] * (a[1][2] * a[2][0] - a[1][0] * a[2][2]) +
+               a[0][2] * (a[1][0] * a[2][1] - a[1][1] * a[2][0]);
+    }
+    else
+    {
+        // Laplace expansion using the 2x2 minors of the top two and the bottom two rows.
+        const T s0 = a[0][0] * a[1][1] - a[1][0] * a[0][1];
+        const T s1 = a[0][0] * a[1][2] - a[1][0] * a[0][2];
+        const T s2 = a[0][0] * a[1][3] - a[1][0] * a[0][3];
+        const T s3 = a[0][1] * a[1][2] - a[1][1] * a[0][2];
+        const T s4 = a[0][1] * a[1][3] - a[1][1] * a[0][3];
+        const T s5 = a[0][2] * a[1][3] - a[1][2] * a[0][3];
+        const T c5 = a[2][2] * a[3][3] - a[3][2] * a[2][3];
+        const T c4 = a[2][1] * a[3][3] - a[3][1] * a[2][3];
+        const T c3 = a[2][1] * a[3][2] - a[3][1] * a[2][2];
+        const T c2 = a[2][0] * a[3][3] - a[3][0] * a[2][3];
+        const T c1 = a[2][0] * a[3][2] - a[3][0] * a[2][2];
+        const T c0 = a[2][0] * a[3][1] - a[3][0] * a[2][1];
+        return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+    }
+}
+
+template <Math::FloatingPoint T, int N>
+    requires(N >= 2 && N <= 4)
+constexpr Math::Matrix<T, N, N> Math::Inverse(const Matrix<T, N, N>& m)
+{
+    const Array2D<T, N, N>& a = m.elements;
+    if constexpr (N == 2)
+    {
+        const T det = Determinant(m);
+        // Singular matrix
+        assert(det != 0);
+        const T inv_det = 1 / det;
+        return Matrix<T, 2, 2>(a[1][1] * inv_det, -a[0][1] * inv_det, -a[1][0] * inv_det,
+                               a[0][0] * inv_det);
+    }
+    else if constexpr (N == 3)
+    {
+        const T c00 = a[1][1] * a[2][2] - a[1][2] * a[2][1];
+        const T c01 = a[1][2] * a[2][0] - a[1][0] * a[2][2];
+        const T c02 = a[1][0] * a[2][1] - a[1][1] * a[2][0];
+        const T det = a[0][0] * c00 + a[0][1] * c01 + a[0][2] * c02;
+        // Singular matrix
+        assert(det != 0);
+        const T inv_det = 1 / det;
+
+        // clang-format off
+        return Matrix<T, 3, 3>{
+            c00 * inv_det, (a[0][2] * a[2][1] - a[0][1] * a[2][2]) * inv_det, (a[0][1] * a[1][2] - a[0][2] * a[1][1]) * inv_det,
+            c01 * inv_det, (a[0][0] * a[2][2] - a[0][2] * a[2][0]) * inv_det, (a[0][2] * a[1][0] - a[0][0] * a[1][2]) * inv_det,
+            c02 * inv_det, (a[0][1] * a[2][0] - a[0][0] * a[2][1]) * inv_det, (a[0][0] * a[1][1] - a[0][1] * a[1][0]) * inv_det
+        };
+        // clang-format on
+    }
+    else
+    {
+        // Adjugate built from the same 2x2 minors that are used for the determinant.
+        const T s0 = a[0][0] * a[1][1] - a[1][0] * a[0][1];
+        const T s1 = a[0][0] * a[1][2] - a[1][0] * a[0][2];
+        const T s2 = a[0][0] * a[1][3] - a[1][0] * a[0][3];
+        const T s3 = a[0][1] * a[1][2] - a[1][1] * a[0][2];
+        const T s4 = a[0][1] * a[1][3] - a[1][1] * a[0][3];
+        const T s5 = a[0][2] * a[1][3] - a[1][2] * a[0][3];
+        const T c5 = a[2][2] * a[3][3] - a[3][2] * a[2][3];
+        const T c4 = a[2][1] * a[3][3] - a[3][1] * a[2][3];
+        const T c3 = a[2][1] * a[3][2] - a[3][1] * a[2][2];
+        const T c2 = a[2][0] * a[3][3] - a[3][0] * a[2][3];
+        const T c1 = a[2][0] * a[3][2] - a[3][0] * a[2][2];
+        const T c0 = a[2][0] * a[3][1] - a[3][0] * a[2][1];
+        const T det = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+        // Singular matrix
+        assert(det != 0);
+        const T inv_det = 1 / det;
+
+        // clang-format off
+        return Matrix<T, 4, 4>{
+            ( a[1][1] * c5 - a[1][2] * c4 + a[1][3] * c3) * inv_det,
+            (-a[0][1] * c5 + a[0][2] * c4 - a[0][3] * c3) * inv_det,
+            ( a[3][1] * s5 - a[3][2] * s4 + a[3][3] * s3) * inv_det,
+            (-a[2][1] * s5 + a[2][2] * s4 - a[2][3] * s3) * inv_det,
+
+            (-a[1][0] * c5 + a[1][2] * c2 - a[1][3] * c1) * inv_det,
+            ( a[0][0] * c5 - a[0][2] * c2 + a[0][3] * c1) * inv_det,
+            (-a[3][0] * s5 + a[3][2] * s2 - a[3][3] * s1) * inv_det,
+            ( a[2][0] * s5 - a[2][2] * s2 + a[2][3] * s1) * inv_det,
+
+            ( a[1][0] * c4 - a[1][1] * c2 + a[1][3] * c0) * inv_det,
+            (-a[0][0] * c4 + a[0][1] * c2 - a[0][3] * c0) * inv_det,
+            ( a[3][0] * s4 - a[3][1] * s2 + a[3][3] * s0) * inv_det,
+            (-a[2][0] * s4 + a[2][1] * s2 - a[2][3] * s0) * inv_det,
+
+            (-a[1][0] * c3 + a[1][1] * c1 - a[1][2] * c0) * inv_det,
+            ( a[0][0] * c3 - a[0][1] * c1 + a[0][2] * c0) * inv_det,
+            (-a[3][0] * s3 + a[3][1] * s1 - a[3][2] * s0) * inv_det,
+            ( a[2][0] * s3 - a[2][1] * s1 + a[2][2] * s0) * inv_det
+        };
+        // clang-format on
+    }
+}
+
+template <Math::FloatingPoint T>
+constexpr Math::Point3<T> Math::TransformPoint(const Matrix4x4<T>& m,
+                                               const Point3<T>& p,
+                                               Vector3<T>& out_error)
+{
+    return TransformPoint(m, p, Vector3<T>(0, 0, 0), out_error);
+}
+
+template <Math::FloatingPoint T>
+constexpr Math::Point3<T> Math::TransformPoint(const Matrix4x4<T>& m,
+                                               const Point3<T>& p,
+                                               const Vector3<T>& p_error,
+                                               Vector3<T>& out_error)
+{
+    assert(m.elements[3][0] == 0 && m.elements[3][1] == 0 && m.elements[3][2] == 0 &&
+           m.elements[3][3] == 1);
+    // Each coordinate is three multiplications and three additions. The error of the input is
+    // transformed by the absolute values of the matrix and can be rounded once more.
+    const T gamma = Gamma<T>(3);
+    T result[3];
+    T error[3];
+    for (int32_t row = 0; row < 3; ++row)
+    {
+        const auto& e = m.elements[static_cast<size_t>(row)];
+        result[row] = e[0] * p.x + e[1] * p.y + e[2] * p.z + e[3];
+        error[row] = gamma * (Abs(e[0] * p.x) + Abs(e[1] * p.y) + Abs(e[2] * p.z) + Abs(e[3])) +
+                     (gamma + 1) * (Abs(e[0]) * p_error.x + Abs(e[1]) * p_error.y +
+                                    Abs(e[2]) * p_error.z);
+    }
+    out_error = Vector3<T>(error[0], error[1], error[2]);
+    return Point3<T>(result[0], result[1], result[2]);
+}
+
+template <Math::FloatingPoint T>
+constexpr Math::Bounds3<T> Math::TransformBounds(const Matrix4x4<T>& m, const Bounds3<T>& b)
+{
+    assert(m.elements[3][0] == 0 && m.elements[3][1] == 0 && m.elements[3][2] == 0 &&
+           m.elements[3][3] == 1);
+    const Vector3<T> center((b.min.x + b.max.x) / 2, (b.min.y + b.max.y) / 2,
+                            (b.min.z + b.max.z) / 2);
+    const Vector3<T> extent = (b.max - b.min) / static_cast<T>(2);
+    Bounds3<T> result;
+    for (int32_t row = 0; row < 3; ++row)
+    {
+        const auto& e = m.elements[static_cast<size_t>(row)];
+        const T new_center = e[0] * center.x + e[1] * center.y + e[2] * center.z + e[3];
+        const T new_extent = Abs(e[0]) * extent.x + Abs(e[1]) * extent.y + Abs(e[2]) * extent.z;
+        result.min[row] = new_center - new_extent;
+        result.max[row] = new_center + new_extent;
+    }
+    return result;
+}
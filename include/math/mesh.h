@@ -0,0 +1,376 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "math/base.h"
+#include "math/bounds3.h"
+#include "math/normal3.h"
+#include "math/parallel.h"
+#include "math/point2.h"
+#include "math/point3.h"
+#include "math/vector3.h"
+#include "math/vector4.h"
+
+namespace Math
+{
+
+/**
+ * Compute the bounding box of the vertices of a mesh, in parallel.
+ * @param positions The vertex positions.
+ * @return The bounding box. Inverted, with min larger than max, when there are no vertices.
+ */
+template <FloatingPoint T>
+Bounds3<T> ComputeBounds(std::type_identity_t<std::span<const Point3<T>>> positions);
+
+/**
+ * Compute smooth vertex normals, the average of the normals of the triangles that use the vertex
+ * weighted by the triangle areas. Every thread owns a range of vertices and only adds the triangles
+ * to the vertices it owns, so there are no atomics or locks and every vertex adds its triangles in
+ * the same order for any number of threads.
+ * @param indices Three vertex indices per triangle. The normal of a triangle faces the side from
+ * which its vertices are counter-clockwise.
+ * @param positions The vertex positions.
+ * @param out_normals One unit normal per vertex. Zero for the vertices that are not used by a
+ * triangle with a non-zero area.
+ */
+template <FloatingPoint T>
+void ComputeNormals(std::span<const uint32_t> indices,
+                    std::type_identity_t<std::span<const Point3<T>>> positions,
+                    std::type_identity_t<std::span<Normal3<T>>> out_normals);
+
+/**
+ * Compute vertex tangents for normal mapping, following the MikkTSpace conventions: the tangent of
+ * a triangle points along increasing u, it is projected on the plane of the vertex normal at every
+ * corner and the corners are weighted by their angles. The vertices are not split, vertices on UV
+ * seams or with mirrored UVs on one side need to be separate vertices already, as they are in
+ * meshes prepared for rendering. The vertices are split between the threads as in ComputeNormals.
+ * @param indices Three vertex indices per triangle.
+ * @param positions The vertex positions.
+ * @param normals The vertex normals, of unit length.
+ * @param uvs The texture coordinates of the vertices.
+ * @param out_tangents One tangent per vertex. The xyz components are a unit vector orthogonal to
+ * the normal, w is the handedness: the bitangent is w * Cross(normal, tangent).
+ */
+template <FloatingPoint T>
+void ComputeTangents(std::span<const uint32_t> indices,
+                     std::type_identity_t<std::span<const Point3<T>>> positions,
+                     std::type_identity_t<std::span<const Normal3<T>>> normals,
+                     std::type_identity_t<std::span<const Point2<T>>> uvs,
+                     std::type_identity_t<std::span<Vector4<T>>> out_tangents);
+
+}  // namespace Math
+
+// Implementation //////////////////////////////////////////////////////////////////////////////////
+
+namespace Math::Internal
+{
+
+// Below this many vertices per thread starting the threads costs more than it saves.
+inline constexpr size_t k_mesh_min_batch_size = 64 * 1024;
+
+template <FloatingPoint T>
+Vector3<T> NormalizeOrZero(const Vector3<T>& vec)
+{
+    const T length_squared = LengthSquared(vec);
+    return length_squared > 0 ? vec / std::sqrt(length_squared) : Vector3<T>(0);
+}
+
+/**
+ * A unit vector orthogonal to the unit vector n.
+ * Based on: Building an Orthonormal Basis, Revisited, Duff et al., 2017.
+ */
+template <FloatingPoint T>
+Vector3<T> OrthogonalVector(const Vector3<T>& n)
+{
+    const T sign = std::copysign(static_cast<T>(1), n.z);
+    const T a = -1 / (sign + n.z);
+    return Vector3<T>(1 + sign * n.x * n.x * a, sign * n.x * n.y * a, -sign * n.x);
+}
+
+/**
+ * Split the vertices into ranges that run in parallel and call func(begin, end, for_each_triangle)
+ * for every range. for_each_triangle(triangle_func) calls triangle_func(triangle, owned) for every
+ * triangle with a vertex in [begin, end), in order, where bit k of owned is set if vertex k of the
+ * triangle is in the range.
+ * With more than one thread the triangles are first grouped by blocks of vertices with a parallel
+ * counting sort, a triangle with vertices in several blocks is in the group of each. Every range
+ * then reads only the groups of its blocks, and every vertex still sees its triangles in order.
+ */
+template <typename Func>
+void ForEachVertexRange(std::span<const uint32_t> indices, size_t vertex_count, Func&& func)
+{
+    const size_t thread_count = ThreadCount();
+    if (thread_count == 1 || vertex_count <= k_mesh_min_batch_size)
+    {
+        auto for_each_triangle = [&](auto&& triangle_func)
+        {
+            for (size_t i = 0; i < indices.size(); i += 3)
+            {
+                triangle_func(i / 3, 7u);
+            }
+        };
+        func(size_t{0}, vertex_count, for_each_triangle);
+        return;
+    }
+
+    // About four blocks per thread. The sizes are powers of two so the block of a vertex is a
+    // shift, and large so that few triangles are in two groups.
+    assert(indices.size() < UINT32_MAX);
+    const int min_shift = static_cast<int>(std::bit_width(k_mesh_min_batch_size)) - 3;
+    const int shift = Math::Max(
+        static_cast<int>(std::bit_width(vertex_count / (4 * thread_count))) - 1, min_shift);
+    const size_t block_size = size_t{1} << shift;
+    const size_t block_count = (vertex_count + block_size - 1) >> shift;
+    auto for_each_block = [&](size_t triangle, auto&& block_func)
+    {
+        const uint32_t b0 = indices[3 * triangle] >> shift;
+        const uint32_t b1 = indices[3 * triangle + 1] >> shift;
+        const uint32_t b2 = indices[3 * triangle + 2] >> shift;
+        block_func(b0);
+        if (b1 != b0)
+        {
+            block_func(b1);
+        }
+        if (b2 != b0 && b2 != b1)
+        {
+            block_func(b2);
+        }
+    };
+
+    // Count the triangles of every block in every chunk of triangles, then place the chunks one
+    // after the other in the group of every block, which keeps every group in triangle order.
+    const size_t triangle_count = indices.size() / 3;
+    const size_t chunk_count = Math::Max<size_t>(Math::Min(thread_count, triangle_count), 1);
+    auto chunk_begin = [&](size_t chunk) { return triangle_count * chunk / chunk_count; };
+    std::vector<uint32_t> offsets(block_count * chunk_count);
+    ParallelFor(chunk_count, 1,
+                [&](size_t first_chunk, size_t end_chunk)
+                {
+                    std::vector<uint32_t> counts(block_count, 0);
+                    for (size_t chunk = first_chunk; chunk < end_chunk; ++chunk)
+                    {
+                        std::fill(counts.begin(), counts.end(), 0);
+                        for (size_t t = chunk_begin(chunk); t < chunk_begin(chunk + 1); ++t)
+                        {
+                            for_each_block(t, [&](uint32_t block) { ++counts[block]; });
+                        }
+                        for (size_t block = 0; block < block_count; ++block)
+                        {
+                            offsets[block * chunk_count + chunk] = counts[block];
+                        }
+                    }
+                });
+    std::vector<uint32_t> block_start(block_count + 1);
+    uint32_t total = 0;
+    for (size_t i = 0; i < offsets.size(); ++i)
+    {
+        if (i % chunk_count == 0)
+        {
+            block_start[i / chunk_count] = total;
+        }
+        const uint32_t count = offsets[i];
+        offsets[i] = total;
+        total += count;
+    }
+    block_start[block_count] = total;
+    std::vector<uint32_t> triangles(total);
+    ParallelFor(chunk_count, 1,
+                [&](size_t first_chunk, size_t end_chunk)
+                {
+                    std::vector<uint32_t> next(block_count);
+                    for (size_t chunk = first_chunk; chunk < end_chunk; ++chunk)
+                    {
+                        for (size_t block = 0; block < block_count; ++block)
+                        {
+                            next[block] = offsets[block * chunk_count + chunk];
+                        }
+                        for (size_t t = chunk_begin(chunk); t < chunk_begin(chunk + 1); ++t)
+                        {
+                            const auto triangle = static_cast<uint32_t>(t);
+                            for_each_block(t, [&](uint32_t block)
+                                           { triangles[next[block]++] = triangle; });
+                        }
+                    }
+                });
+
+    const size_t min_batch_blocks = Math::Max<size_t>(k_mesh_min_batch_size >> shift, 1);
+    ParallelFor(block_count, min_batch_blocks,
+                [&](size_t first_block, size_t end_block)
+                {
+                    auto for_each_triangle = [&](auto&& triangle_func)
+                    {
+                        for (size_t block = first_block; block < end_block; ++block)
+                        {
+                            const size_t begin = block << shift;
+                            const size_t size = Math::Min(block_size, vertex_count - begin);
+                            for (uint32_t j = block_start[block]; j < block_start[block + 1]; ++j)
+                            {
+                                // Unsigned wrap around makes the vertices before the block large.
+                                const uint32_t* vertices = &indices[3 * size_t{triangles[j]}];
+                                const uint32_t owned = (vertices[0] - begin < size ? 1u : 0u) |
+                                                       (vertices[1] - begin < size ? 2u : 0u) |
+                                                       (vertices[2] - begin < size ? 4u : 0u);
+                                triangle_func(size_t{triangles[j]}, owned);
+                            }
+                        }
+                    };
+                    func(first_block << shift, Math::Min(end_block << shift, vertex_count),
+                         for_each_triangle);
+                });
+}
+
+}  // namespace Math::Internal
+
+template <Math::FloatingPoint T>
+Math::Bounds3<T> Math::ComputeBounds(std::type_identity_t<std::span<const Point3<T>>> positions)
+{
+    Bounds3<T> result;
+    result.min = Point3<T>(std::numeric_limits<T>::infinity(), std::numeric_limits<T>::infinity(),
+                           std::numeric_limits<T>::infinity());
+    result.max = -result.min;
+    std::mutex result_mutex;
+    ParallelFor(positions.size(), Internal::k_mesh_min_batch_size,
+                [&](size_t begin, size_t end)
+                {
+                    Bounds3<T> batch_bounds(positions[begin]);
+                    for (size_t i = begin + 1; i < end; ++i)
+                    {
+                        batch_bounds = Union(batch_bounds, positions[i]);
+                    }
+                    const std::lock_guard lock(result_mutex);
+                    result = Union(result, batch_bounds);
+                });
+    return result;
+}
+
+template <Math::FloatingPoint T>
+void Math::ComputeNormals(std::span<const uint32_t> indices,
+                          std::type_identity_t<std::span<const Point3<T>>> positions,
+                          std::type_identity_t<std::span<Normal3<T>>> out_normals)
+{
+    assert(indices.size() % 3 == 0);
+    assert(out_normals.size() == positions.size());
+    Internal::ForEachVertexRange(
+        indices, positions.size(),
+        [&](size_t begin, size_t end, auto&& for_each_triangle)
+        {
+            std::fill(out_normals.begin() + begin, out_normals.begin() + end, Normal3<T>(0));
+            // The length of the cross product is twice the area, which gives the area weighting.
+            for_each_triangle(
+                [&](size_t triangle, uint32_t owned)
+                {
+                    const uint32_t* vertices = &indices[3 * triangle];
+                    const Point3<T>& p0 = positions[vertices[0]];
+                    const Normal3<T> n(
+                        Cross(positions[vertices[1]] - p0, positions[vertices[2]] - p0));
+                    if (owned == 7)
+                    {
+                        out_normals[vertices[0]] += n;
+                        out_normals[vertices[1]] += n;
+                        out_normals[vertices[2]] += n;
+                        return;
+                    }
+                    for (uint32_t k = 0; k < 3; ++k)
+                    {
+                        if ((owned >> k) & 1)
+                        {
+                            out_normals[vertices[k]] += n;
+                        }
+                    }
+                });
+            for (size_t v = begin; v < end; ++v)
+            {
+                const Normal3<T>& sum = out_normals[v];
+                out_normals[v] =
+                    Normal3<T>(Internal::NormalizeOrZero(Vector3<T>(sum.x, sum.y, sum.z)));
+            }
+        });
+}
+
+template <Math::FloatingPoint T>
+void Math::ComputeTangents(std::span<const uint32_t> indices,
+                           std::type_identity_t<std::span<const Point3<T>>> positions,
+                           std::type_identity_t<std::span<const Normal3<T>>> normals,
+                           std::type_identity_t<std::span<const Point2<T>>> uvs,
+                           std::type_identity_t<std::span<Vector4<T>>> out_tangents)
+{
+    assert(indices.size() % 3 == 0);
+    assert(normals.size() == positions.size() && uvs.size() == positions.size());
+    assert(out_tangents.size() == positions.size());
+
+    // Project on the plane of the normal and normalize.
+    auto project = [](const Vector3<T>& vec, const Normal3<T>& n)
+    {
+        const Vector3<T> normal(n.x, n.y, n.z);
+        return Internal::NormalizeOrZero(vec - Dot(normal, vec) * normal);
+    };
+
+    Internal::ForEachVertexRange(
+        indices, positions.size(),
+        [&](size_t begin, size_t end, auto&& for_each_triangle)
+        {
+            // Accumulate the tangent in xyz and the angles of the orientation preserving corners
+            // minus the others in w.
+            std::fill(out_tangents.begin() + begin, out_tangents.begin() + end, Vector4<T>(0));
+            for_each_triangle(
+                [&](size_t triangle, uint32_t owned)
+                {
+                    // Solve the position edges as a linear combination of the directions of u and
+                    // v, the tangent is the direction of u.
+                    const uint32_t* vertices = &indices[3 * triangle];
+                    const Vector3<T> d1 = positions[vertices[1]] - positions[vertices[0]];
+                    const Vector3<T> d2 = positions[vertices[2]] - positions[vertices[0]];
+                    const Vector2<T> t1 = uvs[vertices[1]] - uvs[vertices[0]];
+                    const Vector2<T> t2 = uvs[vertices[2]] - uvs[vertices[0]];
+                    const T signed_area = t1.x * t2.y - t1.y * t2.x;
+                    if (signed_area == 0)
+                    {
+                        return;
+                    }
+                    const T sign = signed_area > 0 ? static_cast<T>(1) : static_cast<T>(-1);
+                    const Vector3<T> tangent = sign * (t2.y * d1 - t1.y * d2);
+
+                    for (uint32_t k = 0; k < 3; ++k)
+                    {
+                        if (((owned >> k) & 1) == 0)
+                        {
+                            continue;
+                        }
+                        const uint32_t v = vertices[k];
+                        const Point3<T>& p = positions[v];
+                        const Point3<T>& next = positions[vertices[(k + 1) % 3]];
+                        const Point3<T>& previous = positions[vertices[(k + 2) % 3]];
+                        const T cos_angle = Math::Clamp(
+                            Dot(project(next - p, normals[v]), project(previous - p, normals[v])),
+                            static_cast<T>(-1), static_cast<T>(1));
+                        const T angle = std::acos(cos_angle);
+                        const Vector3<T> weighted = angle * project(tangent, normals[v]);
+                        out_tangents[v] += Vector4<T>(weighted.x, weighted.y, weighted.z,
+                                                      sign * angle);
+                    }
+                });
+
+            for (size_t v = begin; v < end; ++v)
+            {
+                // Project again, the sum of the projections cancels out and loses orthogonality.
+                const Vector4<T>& sum = out_tangents[v];
+                Vector3<T> tangent = project(Vector3<T>(sum.x, sum.y, sum.z), normals[v]);
+                if (tangent == Vector3<T>(0))
+                {
+                    tangent = Internal::OrthogonalVector(
+                        Vector3<T>(normals[v].x, normals[v].y, normals[v].z));
+                }
+                out_tangents[v] = Vector4<T>(tangent.x, tangent.y, tangent.z,
+                                             sum.w >= 0 ? static_cast<T>(1) : static_cast<T>(-1));
+            }
+        });
+}
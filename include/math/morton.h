@@ -0,0 +1,446 @@
+#pragma once
+
+#include <array>
+#include <concepts>
+#include <type_traits>
+#include <utility>
+
+#include "math/base.h"
+#include "math/bounds2.h"
+#include "math/bounds3.h"
+#include "math/point2.h"
+#include "math/point3.h"
+#include "math/simd.h"
+
+namespace Math
+{
+
+/**
+ * Integer types used for the codes of the space filling curves. 3D codes use 10 bits per axis in
+ * 32-bit codes and 21 bits per axis in 64-bit codes. 2D codes use 16 and 32 bits per axis.
+ */
+template <typename T>
+concept CurveCode = std::same_as<T, uint32_t> || std::same_as<T, uint64_t>;
+
+/**
+ * Number of bits per axis of a 3D code.
+ */
+template <CurveCode Code>
+inline constexpr uint32_t k_curve_bits_3d = sizeof(Code) == 4 ? 10 : 21;
+
+/**
+ * Number of bits per axis of a 2D code.
+ */
+template <CurveCode Code>
+inline constexpr uint32_t k_curve_bits_2d = sizeof(Code) == 4 ? 16 : 32;
+
+/**
+ * Interleave the bits of the coordinates into a Morton (Z-order) code. Bit 0 of the code is bit 0
+ * of x, bit 1 is bit 0 of y and bit 2 is bit 0 of z.
+ * @tparam Code Type of the code, a 30-bit code for uint32_t or a 63-bit code for uint64_t.
+ * @param p Integer coordinates. Only the lowest k_curve_bits_3d bits of every axis are used.
+ * @return The Morton code.
+ */
+template <CurveCode Code>
+[[nodiscard]] constexpr Code EncodeMorton(const Point3<uint32_t>& p);
+
+/**
+ * Interleave the bits of the coordinates into a Morton (Z-order) code. Bit 0 of the code is bit 0
+ * of x and bit 1 is bit 0 of y.
+ * @tparam Code Type of the code, a 32-bit or a 64-bit code.
+ * @param p Integer coordinates. Only the lowest k_curve_bits_2d bits of every axis are used.
+ * @return The Morton code.
+ */
+template <CurveCode Code>
+[[nodiscard]] constexpr Code EncodeMorton(const Point2<uint32_t>& p);
+
+/**
+ * Quantize the point to a grid over the bounds and compute the Morton code of the grid cell.
+ * @tparam Code Type of the code.
+ * @param bounds The bounds that the grid covers. Points outside of it are clamped to it.
+ * @param p The point.
+ * @return The Morton code.
+ */
+template <CurveCode Code, FloatingPoint T>
+[[nodiscard]] constexpr Code EncodeMorton(const Bounds3<T>& bounds, const Point3<T>& p);
+
+/**
+ * Quantize the point to a grid over the bounds and compute the Morton code of the grid cell.
+ * @tparam Code Type of the code.
+ * @param bounds The bounds that the grid covers. Points outside of it are clamped to it.
+ * @param p The point.
+ * @return The Morton code.
+ */
+template <CurveCode Code, FloatingPoint T>
+[[nodiscard]] constexpr Code EncodeMorton(const Bounds2<T>& bounds, const Point2<T>& p);
+
+/**
+ * Get the coordinates from a 3D Morton code.
+ * @param code The Morton code.
+ * @return The integer coordinates.
+ */
+template <CurveCode Code>
+[[nodiscard]] constexpr Point3<uint32_t> DecodeMorton3(Code code);
+
+/**
+ * Get the coordinates from a 2D Morton code.
+ * @param code The Morton code.
+ * @return The integer coordinates.
+ */
+template <CurveCode Code>
+[[nodiscard]] constexpr Point2<uint32_t> DecodeMorton2(Code code);
+
+/**
+ * Compute the index of the cell along the Hilbert curve. Unlike the Morton curve, consecutive cells
+ * on the Hilbert curve are always neighbours, which gives better locality at a higher cost.
+ * @tparam Code Type of the code.
+ * @param p Integer coordinates. Only the lowest k_curve_bits_3d bits of every axis are used.
+ * @return The Hilbert code.
+ */
+template <CurveCode Code>
+[[nodiscard]] constexpr Code EncodeHilbert(const Point3<uint32_t>& p);
+
+/**
+ * Compute the index of the cell along the Hilbert curve.
+ * @tparam Code Type of the code.
+ * @param p Integer coordinates. Only the lowest k_curve_bits_2d bits of every axis are used.
+ * @return The Hilbert code.
+ */
+template <CurveCode Code>
+[[nodiscard]] constexpr Code EncodeHilbert(const Point2<uint32_t>& p);
+
+/**
+ * Quantize the point to a grid over the bounds and compute the Hilbert code of the grid cell.
+ * @tparam Code Type of the code.
+ * @param bounds The bounds that the grid covers. Points outside of it are clamped to it.
+ * @param p The point.
+ * @return The Hilbert code.
+ */
+template <CurveCode Code, FloatingPoint T>
+[[nodiscard]] constexpr Code EncodeHilbert(const Bounds3<T>& bounds, const Point3<T>& p);
+
+/**
+ * Quantize the point to a grid over the bounds and compute the Hilbert code of the grid cell.
+ * @tparam Code Type of the code.
+ * @param bounds The bounds that the grid covers. Points outside of it are clamped to it.
+ * @param p The point.
+ * @return The Hilbert code.
+ */
+template <CurveCode Code, FloatingPoint T>
+[[nodiscard]] constexpr Code EncodeHilbert(const Bounds2<T>& bounds, const Point2<T>& p);
+
+}  // namespace Math
+
+// Implementation //////////////////////////////////////////////////////////////////////////////////
+
+namespace Math::Internal
+{
+
+// Masks with the bits of one axis of a Morton code, also used by pdep and pext.
+inline constexpr uint32_t k_morton3_mask32 = 0x09249249u;
+inline constexpr uint64_t k_morton3_mask64 = 0x1249249249249249ull;
+inline constexpr uint32_t k_morton2_mask32 = 0x55555555u;
+inline constexpr uint64_t k_morton2_mask64 = 0x5555555555555555ull;
+
+// Spreads the bits so that there are two zero bits after every bit.
+constexpr uint32_t SpreadBits3(uint32_t v)
+{
+    v &= 0x000003ffu;
+    v = (v | (v << 16)) & 0xff0000ffu;
+    v = (v | (v << 8)) & 0x0300f00fu;
+    v = (v | (v << 4)) & 0x030c30c3u;
+    v = (v | (v << 2)) & 0x09249249u;
+    return v;
+}
+
+constexpr uint64_t SpreadBits3(uint64_t v)
+{
+    v &= 0x00000000001fffffull;
+    v = (v | (v << 32)) & 0x001f00000000ffffull;
+    v = (v | (v << 16)) & 0x001f0000ff0000ffull;
+    v = (v | (v << 8)) & 0x100f00f00f00f00full;
+    v = (v | (v << 4)) & 0x10c30c30c30c30c3ull;
+    v = (v | (v << 2)) & 0x1249249249249249ull;
+    return v;
+}
+
+// Inverse of SpreadBits3.
+constexpr uint32_t CompactBits3(uint32_t v)
+{
+    v &= 0x09249249u;
+    v = (v ^ (v >> 2)) & 0x030c30c3u;
+    v = (v ^ (v >> 4)) & 0x0300f00fu;
+    v = (v ^ (v >> 8)) & 0xff0000ffu;
+    v = (v ^ (v >> 16)) & 0x000003ffu;
+    return v;
+}
+
+constexpr uint64_t CompactBits3(uint64_t v)
+{
+    v &= 0x1249249249249249ull;
+    v = (v ^ (v >> 2)) & 0x10c30c30c30c30c3ull;
+    v = (v ^ (v >> 4)) & 0x100f00f00f00f00full;
+    v = (v ^ (v >> 8)) & 0x001f0000ff0000ffull;
+    v = (v ^ (v >> 16)) & 0x001f00000000ffffull;
+    v = (v ^ (v >> 32)) & 0x00000000001fffffull;
+    return v;
+}
+
+// Spreads the bits so that there is one zero bit after every bit.
+constexpr uint32_t SpreadBits2(uint32_t v)
+{
+    v &= 0x0000ffffu;
+    v = (v | (v << 8)) & 0x00ff00ffu;
+    v = (v | (v << 4)) & 0x0f0f0f0fu;
+    v = (v | (v << 2)) & 0x33333333u;
+    v = (v | (v << 1)) & 0x55555555u;
+    return v;
+}
+
+constexpr uint64_t SpreadBits2(uint64_t v)
+{
+    v &= 0x00000000ffffffffull;
+    v = (v | (v << 16)) & 0x0000ffff0000ffffull;
+    v = (v | (v << 8)) & 0x00ff00ff00ff00ffull;
+    v = (v | (v << 4)) & 0x0f0f0f0f0f0f0f0full;
+    v = (v | (v << 2)) & 0x3333333333333333ull;
+    v = (v | (v << 1)) & 0x5555555555555555ull;
+    return v;
+}
+
+// Inverse of SpreadBits2.
+constexpr uint32_t CompactBits2(uint32_t v)
+{
+    v &= 0x55555555u;
+    v = (v ^ (v >> 1)) & 0x33333333u;
+    v = (v ^ (v >> 2)) & 0x0f0f0f0fu;
+    v = (v ^ (v >> 4)) & 0x00ff00ffu;
+    v = (v ^ (v >> 8)) & 0x0000ffffu;
+    return v;
+}
+
+constexpr uint64_t CompactBits2(uint64_t v)
+{
+    v &= 0x5555555555555555ull;
+    v = (v ^ (v >> 1)) & 0x3333333333333333ull;
+    v = (v ^ (v >> 2)) & 0x0f0f0f0f0f0f0f0full;
+    v = (v ^ (v >> 4)) & 0x00ff00ff00ff00ffull;
+    v = (v ^ (v >> 8)) & 0x0000ffff0000ffffull;
+    v = (v ^ (v >> 16)) & 0x00000000ffffffffull;
+    return v;
+}
+
+/**
+ * Maps the offset in [0, 1] to a cell of a grid with 2^bits cells, values outside are clamped.
+ */
+template <FloatingPoint T>
+constexpr uint32_t QuantizeToGrid(T offset, uint32_t bits)
+{
+    // Double has enough precision to represent the index of the last cell for every bit count.
+    const double cell_count = static_cast<double>(uint64_t{1} << bits);
+    const double cell = Math::Clamp(static_cast<double>(offset) * cell_count, 0.0, cell_count - 1);
+    return static_cast<uint32_t>(cell);
+}
+
+/**
+ * Transforms the axes into the transposed Hilbert index, the bits of the index are the bits of the
+ * axes interleaved from the most significant bit, starting with axes[0].
+ * Based on: Programming the Hilbert curve, John Skilling, 2004.
+ */
+template <size_t N>
+constexpr std::array<uint32_t, N> HilbertTranspose(std::array<uint32_t, N> axes, uint32_t bits)
+{
+    const uint32_t highest_bit = 1u << (bits - 1);
+    const auto mask = static_cast<uint32_t>((uint64_t{1} << bits) - 1);
+    for (uint32_t& axis : axes)
+    {
+        axis &= mask;
+    }
+
+    // Inverse undo excess work. The bits are random for typical input, so the branches of the
+    // original algorithm are replaced by masks: if the bit is set the low bits of axes[0] are
+    // inverted, otherwise the low bits of axes[0] and axes[i] are exchanged.
+    for (uint32_t q = highest_bit; q > 1; q >>= 1)
+    {
+        const uint32_t p = q - 1;
+        auto exchange = [&](uint32_t& axis)
+        {
+            const uint32_t set = 0u - static_cast<uint32_t>((axis & q) != 0);
+            const uint32_t t = (axes[0] ^ axis) & p & ~set;
+            axes[0] ^= (p & set) | t;
+            axis ^= t;
+        };
+        // Unrolled so that the axes stay in registers.
+        [&]<size_t... I>(std::index_sequence<I...>) { (exchange(axes[I]), ...); }
+        (std::make_index_sequence<N>());
+    }
+
+    // Gray encode.
+    for (size_t i = 1; i < N; ++i)
+    {
+        axes[i] ^= axes[i - 1];
+    }
+    uint32_t t = 0;
+    for (uint32_t q = highest_bit; q > 1; q >>= 1)
+    {
+        t ^= (q - 1) & (0u - static_cast<uint32_t>((axes[N - 1] & q) != 0));
+    }
+    for (uint32_t& axis : axes)
+    {
+        axis ^= t;
+    }
+    return axes;
+}
+
+}  // namespace Math::Internal
+
+template <Math::CurveCode Code>
+constexpr Code Math::EncodeMorton(const Point3<uint32_t>& p)
+{
+#if MATH_SIMD_BMI2
+    if (!std::is_constant_evaluated())
+    {
+        if constexpr (std::is_same_v<Code, uint32_t>)
+        {
+            return _pdep_u32(p.x, Internal::k_morton3_mask32) |
+                   _pdep_u32(p.y, Internal::k_morton3_mask32 << 1) |
+                   _pdep_u32(p.z, Internal::k_morton3_mask32 << 2);
+        }
+        else
+        {
+            return _pdep_u64(p.x, Internal::k_morton3_mask64) |
+                   _pdep_u64(p.y, Internal::k_morton3_mask64 << 1) |
+                   _pdep_u64(p.z, Internal::k_morton3_mask64 << 2);
+        }
+    }
+#endif
+    return Internal::SpreadBits3(static_cast<Code>(p.x)) |
+           (Internal::SpreadBits3(static_cast<Code>(p.y)) << 1) |
+           (Internal::SpreadBits3(static_cast<Code>(p.z)) << 2);
+}
+
+template <Math::CurveCode Code>
+constexpr Code Math::EncodeMorton(const Point2<uint32_t>& p)
+{
+#if MATH_SIMD_BMI2
+    if (!std::is_constant_evaluated())
+    {
+        if constexpr (std::is_same_v<Code, uint32_t>)
+        {
+            return _pdep_u32(p.x, Internal::k_morton2_mask32) |
+                   _pdep_u32(p.y, Internal::k_morton2_mask32 << 1);
+        }
+        else
+        {
+            return _pdep_u64(p.x, Internal::k_morton2_mask64) |
+                   _pdep_u64(p.y, Internal::k_morton2_mask64 << 1);
+        }
+    }
+#endif
+    return Internal::SpreadBits2(static_cast<Code>(p.x)) |
+           (Internal::SpreadBits2(static_cast<Code>(p.y)) << 1);
+}
+
+template <Math::CurveCode Code, Math::FloatingPoint T>
+constexpr Code Math::EncodeMorton(const Bounds3<T>& bounds, const Point3<T>& p)
+{
+    constexpr uint32_t k_bits = k_curve_bits_3d<Code>;
+    const Vector3<T> offset = Offset(bounds, p);
+    return EncodeMorton<Code>(Point3<uint32_t>(Internal::QuantizeToGrid(offset.x, k_bits),
+                                               Internal::QuantizeToGrid(offset.y, k_bits),
+                                               Internal::QuantizeToGrid(offset.z, k_bits)));
+}
+
+template <Math::CurveCode Code, Math::FloatingPoint T>
+constexpr Code Math::EncodeMorton(const Bounds2<T>& bounds, const Point2<T>& p)
+{
+    constexpr uint32_t k_bits = k_curve_bits_2d<Code>;
+    const Vector2<T> offset = Offset(bounds, p);
+    return EncodeMorton<Code>(Point2<uint32_t>(Internal::QuantizeToGrid(offset.x, k_bits),
+                                               Internal::QuantizeToGrid(offset.y, k_bits)));
+}
+
+template <Math::CurveCode Code>
+constexpr Math::Point3<uint32_t> Math::DecodeMorton3(Code code)
+{
+#if MATH_SIMD_BMI2
+    if (!std::is_constant_evaluated())
+    {
+        if constexpr (std::is_same_v<Code, uint32_t>)
+        {
+            return Point3<uint32_t>(_pext_u32(code, Internal::k_morton3_mask32),
+                                    _pext_u32(code, Internal::k_morton3_mask32 << 1),
+                                    _pext_u32(code, Internal::k_morton3_mask32 << 2));
+        }
+        else
+        {
+            return Point3<uint32_t>(
+                static_cast<uint32_t>(_pext_u64(code, Internal::k_morton3_mask64)),
+                static_cast<uint32_t>(_pext_u64(code, Internal::k_morton3_mask64 << 1)),
+                static_cast<uint32_t>(_pext_u64(code, Internal::k_morton3_mask64 << 2)));
+        }
+    }
+#endif
+    return Point3<uint32_t>(static_cast<uint32_t>(Internal::CompactBits3(code)),
+                            static_cast<uint32_t>(Internal::CompactBits3(code >> 1)),
+                            static_cast<uint32_t>(Internal::CompactBits3(code >> 2)));
+}
+
+template <Math::CurveCode Code>
+constexpr Math::Point2<uint32_t> Math::DecodeMorton2(Code code)
+{
+#if MATH_SIMD_BMI2
+    if (!std::is_constant_evaluated())
+    {
+        if constexpr (std::is_same_v<Code, uint32_t>)
+        {
+            return Point2<uint32_t>(_pext_u32(code, Internal::k_morton2_mask32),
+                                    _pext_u32(code, Internal::k_morton2_mask32 << 1));
+        }
+        else
+        {
+            return Point2<uint32_t>(
+                static_cast<uint32_t>(_pext_u64(code, Internal::k_morton2_mask64)),
+                static_cast<uint32_t>(_pext_u64(code, Internal::k_morton2_mask64 << 1)));
+        }
+    }
+#endif
+    return Point2<uint32_t>(static_cast<uint32_t>(Internal::CompactBits2(code)),
+                            static_cast<uint32_t>(Internal::CompactBits2(code >> 1)));
+}
+
+template <Math::CurveCode Code>
+constexpr Code Math::EncodeHilbert(const Point3<uint32_t>& p)
+{
+    const std::array<uint32_t, 3> axes =
+        Internal::HilbertTranspose<3>({p.x, p.y, p.z}, k_curve_bits_3d<Code>);
+    // The first axis holds the most significant bit of every triple, the Morton code puts x lowest.
+    return EncodeMorton<Code>(Point3<uint32_t>(axes[2], axes[1], axes[0]));
+}
+
+template <Math::CurveCode Code>
+constexpr Code Math::EncodeHilbert(const Point2<uint32_t>& p)
+{
+    const std::array<uint32_t, 2> axes =
+        Internal::HilbertTranspose<2>({p.x, p.y}, k_curve_bits_2d<Code>);
+    return EncodeMorton<Code>(Point2<uint32_t>(axes[1], axes[0]));
+}
+
+template <Math::CurveCode Code, Math::FloatingPoint T>
+constexpr Code Math::EncodeHilbert(const Bounds3<T>& bounds, const Point3<T>& p)
+{
+    constexpr uint32_t k_bits = k_curve_bits_3d<Code>;
+    const Vector3<T> offset = Offset(bounds, p);
+    return EncodeHilbert<Code>(Point3<uint32_t>(Internal::QuantizeToGrid(offset.x, k_bits),
+                                                Internal::QuantizeToGrid(offset.y, k_bits),
+                                                Internal::QuantizeToGrid(offset.z, k_bits)));
+}
+
+template <Math::CurveCode Code, Math::FloatingPoint T>
+constexpr Code Math::EncodeHilbert(const Bounds2<T>& bounds, const Point2<T>& p)
+{
+    constexpr uint32_t k_bits = k_curve_bits_2d<Code>;
+    const Vector2<T> offset = Offset(bounds, p);
+    return EncodeHilbert<Code>(Point2<uint32_t>(Internal::QuantizeToGrid(offset.x, k_bits),
+                                                Internal::QuantizeToGrid(offset.y, k_bits)));
+}
@@ -0,0 +1,599 @@
+#pragma once
+
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+#include "math/base.h"
+#include "math/matrix4x4.h"
+#include "math/normal3.h"
+#include "math/quaternion.h"
+#include "math/simd.h"
+#include "math/vector3.h"
+#include "math/vector4.h"
+
+namespace Math
+{
+
+/**
+ * Encode a unit normal with the octahedral mapping in two 16-bit snorm values, x in the low bits.
+ * A third of the size of Normal3<float>, the decoded normal is within 0.005 degrees of the input.
+ * Based on: A Survey of Efficient Representations for Independent Unit Vectors, Cigolle et al.,
+ * 2014.
+ * @param n The normal, of unit length.
+ * @return The encoded normal.
+ */
+template <FloatingPoint T>
+uint32_t EncodeOctahedral32(const Normal3<T>& n);
+
+/**
+ * Decode a normal encoded with EncodeOctahedral32.
+ * @param encoded The encoded normal.
+ * @return The normal, of unit length.
+ */
+template <FloatingPoint T>
+Normal3<T> DecodeOctahedral32(uint32_t encoded);
+
+/**
+ * Encode a unit normal with the octahedral mapping in two 8-bit snorm values, x in the low bits.
+ * A sixth of the size of Normal3<float>, the decoded normal is within 1 degree of the input.
+ * @param n The normal, of unit length.
+ * @return The encoded normal.
+ * @see EncodeOctahedral32
+ */
+template <FloatingPoint T>
+uint16_t EncodeOctahedral16(const Normal3<T>& n);
+
+/**
+ * Decode a normal encoded with EncodeOctahedral16.
+ * @param encoded The encoded normal.
+ * @return The normal, of unit length.
+ */
+template <FloatingPoint T>
+Normal3<T> DecodeOctahedral16(uint16_t encoded);
+
+/**
+ * Encode a unit normal as three 10-bit snorm values, x in the low bits and the top two bits zero.
+ * The layout of the common 10:10:10:2 vertex format, so the GPU can decode it, but less precise
+ * than EncodeOctahedral32: the decoded normal is within 0.1 degrees of the input.
+ * @param n The normal, of unit length.
+ * @return The encoded normal.
+ */
+template <FloatingPoint T>
+uint32_t EncodeSnorm10(const Normal3<T>& n);
+
+/**
+ * Decode a normal encoded with EncodeSnorm10.
+ * @param encoded The encoded normal.
+ * @return The normal, of unit length.
+ */
+template <FloatingPoint T>
+Normal3<T> DecodeSnorm10(uint32_t encoded);
+
+/**
+ * Encode many normals with EncodeOctahedral32, four at a time with SIMD.
+ * @param normals The normals, of unit length.
+ * @param result Where to store the encoded normals. Must have the same size as normals.
+ */
+template <FloatingPoint T>
+void EncodeOctahedral32(std::type_identity_t<std::span<const Normal3<T>>> normals,
+                        std::span<uint32_t> result);
+
+/**
+ * Decode many normals with DecodeOctahedral32, four at a time with SIMD.
+ * @param encoded The encoded normals.
+ * @param result Where to store the normals. Must have the same size as encoded.
+ */
+template <FloatingPoint T>
+void DecodeOctahedral32(std::span<const uint32_t> encoded,
+                        std::type_identity_t<std::span<Normal3<T>>> result);
+
+/**
+ * Encode many normals with EncodeOctahedral16, four at a time with SIMD.
+ * @param normals The normals, of unit length.
+ * @param result Where to store the encoded normals. Must have the same size as normals.
+ */
+template <FloatingPoint T>
+void EncodeOctahedral16(std::type_identity_t<std::span<const Normal3<T>>> normals,
+                        std::span<uint16_t> result);
+
+/**
+ * Decode many normals with DecodeOctahedral16, four at a time with SIMD.
+ * @param encoded The encoded normals.
+ * @param result Where to store the normals. Must have the same size as encoded.
+ */
+template <FloatingPoint T>
+void DecodeOctahedral16(std::span<const uint16_t> encoded,
+                        std::type_identity_t<std::span<Normal3<T>>> result);
+
+/**
+ * Encode many normals with EncodeSnorm10, four at a time with SIMD.
+ * @param normals The normals, of unit length.
+ * @param result Where to store the encoded normals. Must have the same size as normals.
+ */
+template <FloatingPoint T>
+void EncodeSnorm10(std::type_identity_t<std::span<const Normal3<T>>> normals,
+                   std::span<uint32_t> result);
+
+/**
+ * Decode many normals with DecodeSnorm10, four at a time with SIMD.
+ * @param encoded The encoded normals.
+ * @param result Where to store the normals. Must have the same size as encoded.
+ */
+template <FloatingPoint T>
+void DecodeSnorm10(std::span<const uint32_t> encoded,
+                   std::type_identity_t<std::span<Normal3<T>>> result);
+
+/**
+ * Encode a tangent frame as a QTangent, the rotation from the tangent space axes to the frame with
+ * the sign of w holding the handedness. The tangent is made orthogonal to the normal first.
+ * Based on: Spherical Skinning with Dual Quaternions and QTangents, Frey and Herzog, 2011.
+ * @param normal The normal, of unit length.
+ * @param tangent The tangent in xyz and the handedness in w, as computed by ComputeTangents. The
+ * bitangent is w * Cross(normal, tangent).
+ * @return The QTangent, a unit Quaternion with w never zero so that its sign survives quantization
+ * to 16 bits.
+ */
+template <FloatingPoint T>
+Quaternion<T> EncodeQTangent(const Normal3<T>& normal, const Vector4<T>& tangent);
+
+/**
+ * Decode a tangent frame encoded with EncodeQTangent.
+ * @param q The QTangent.
+ * @param out_normal The normal.
+ * @param out_tangent The tangent in xyz and the handedness, 1 or -1, in w.
+ */
+template <FloatingPoint T>
+void DecodeQTangent(const Quaternion<T>& q, Normal3<T>& out_normal, Vector4<T>& out_tangent);
+
+/**
+ * Quantize a QTangent to four 16-bit snorm values, x in the low bits and w in the high bits. The
+ * decoded frame is within 0.01 degrees of the encoded one.
+ * @param q The QTangent.
+ * @return The packed QTangent.
+ */
+template <FloatingPoint T>
+uint64_t PackQTangent(const Quaternion<T>& q);
+
+/**
+ * Unpack a QTangent packed with PackQTangent.
+ * @param packed The packed QTangent.
+ * @return The QTangent, normalized.
+ */
+template <FloatingPoint T>
+Quaternion<T> UnpackQTangent(uint64_t packed);
+
+}  // namespace Math
+
+// Implementation //////////////////////////////////////////////////////////////////////////////////
+
+namespace Math::Internal
+{
+
+template <int32_t Bits>
+inline constexpr int32_t k_snorm_max = (1 << (Bits - 1)) - 1;
+
+template <int32_t Bits>
+inline constexpr uint32_t k_snorm_mask = (1u << Bits) - 1;
+
+/**
+ * Quantize a value in [-1, 1] to a Bits wide two's complement integer, rounding to nearest even.
+ */
+template <int32_t Bits, FloatingPoint T>
+uint32_t EncodeSnorm(T value)
+{
+    const T scaled = Math::Clamp(value, static_cast<T>(-1), static_cast<T>(1)) *
+                     static_cast<T>(k_snorm_max<Bits>);
+    return static_cast<uint32_t>(static_cast<int32_t>(std::nearbyint(scaled))) & k_snorm_mask<Bits>;
+}
+
+/**
+ * Convert the low Bits bits of the value back to [-1, 1].
+ */
+template <int32_t Bits, FloatingPoint T>
+T DecodeSnorm(uint32_t value)
+{
+    const int32_t quantized = static_cast<int32_t>(value << (32 - Bits)) >> (32 - Bits);
+    return Math::Max(static_cast<T>(quantized) / static_cast<T>(k_snorm_max<Bits>),
+                     static_cast<T>(-1));
+}
+
+/**
+ * Project the normal on the octahedron and unfold the lower half over the upper one, then quantize
+ * to Bits per coordinate.
+ */
+template <int32_t Bits, FloatingPoint T>
+uint32_t EncodeOctahedral(const Normal3<T>& n)
+{
+    const T inverse_sum = 1 / (Math::Abs(n.x) + Math::Abs(n.y) + Math::Abs(n.z));
+    T x = n.x * inverse_sum;
+    T y = n.y * inverse_sum;
+    if (n.z < 0)
+    {
+        const T folded_x = (1 - Math::Abs(y)) * std::copysign(static_cast<T>(1), x);
+        y = (1 - Math::Abs(x)) * std::copysign(static_cast<T>(1), y);
+        x = folded_x;
+    }
+    return EncodeSnorm<Bits>(x) | (EncodeSnorm<Bits>(y) << Bits);
+}
+
+template <int32_t Bits, FloatingPoint T>
+Normal3<T> DecodeOctahedral(uint32_t encoded)
+{
+    T x = DecodeSnorm<Bits, T>(encoded);
+    T y = DecodeSnorm<Bits, T>(encoded >> Bits);
+    const T z = 1 - Math::Abs(x) - Math::Abs(y);
+    const T fold = Math::Max(-z, static_cast<T>(0));
+    x -= std::copysign(fold, x);
+    y -= std::copysign(fold, y);
+    const T length = Math::Sqrt(x * x + y * y + z * z);
+    return Normal3<T>(x / length, y / length, z / length);
+}
+
+#if MATH_SIMD_SSE2
+
+/**
+ * Quantize four values in [-1, 1] to Bits wide two's complement integers.
+ */
+template <int32_t Bits>
+__m128i EncodeSnormSSE(__m128 value)
+{
+    const __m128 clamped = _mm_min_ps(_mm_max_ps(value, _mm_set1_ps(-1.0f)), _mm_set1_ps(1.0f));
+    const __m128i quantized =
+        _mm_cvtps_epi32(_mm_mul_ps(clamped, _mm_set1_ps(static_cast<float>(k_snorm_max<Bits>))));
+    return _mm_and_si128(quantized, _mm_set1_epi32(static_cast<int32_t>(k_snorm_mask<Bits>)));
+}
+
+/**
+ * Convert the Bits wide integers starting at bit Shift of every lane back to [-1, 1].
+ */
+template <int32_t Bits, int32_t Shift>
+__m128 DecodeSnormSSE(__m128i value)
+{
+    const __m128i quantized =
+        _mm_srai_epi32(_mm_slli_epi32(value, 32 - Bits - Shift), 32 - Bits);
+    return _mm_max_ps(_mm_div_ps(_mm_cvtepi32_ps(quantized),
+                                 _mm_set1_ps(static_cast<float>(k_snorm_max<Bits>))),
+                      _mm_set1_ps(-1.0f));
+}
+
+inline __m128 CopySignSSE(__m128 magnitude, __m128 sign)
+{
+    const __m128 sign_mask = _mm_set1_ps(-0.0f);
+    return _mm_or_ps(_mm_andnot_ps(sign_mask, magnitude), _mm_and_ps(sign_mask, sign));
+}
+
+inline void NormalizeSSE(__m128& x, __m128& y, __m128& z)
+{
+    const __m128 length =
+        _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z)));
+    x = _mm_div_ps(x, length);
+    y = _mm_div_ps(y, length);
+    z = _mm_div_ps(z, length);
+}
+
+/**
+ * EncodeOctahedral for four normals.
+ */
+template <int32_t Bits>
+__m128i EncodeOctahedralSSE(__m128 x, __m128 y, __m128 z)
+{
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 inverse_sum =
+        _mm_div_ps(one, _mm_add_ps(_mm_add_ps(AbsSSE(x), AbsSSE(y)), AbsSSE(z)));
+    const __m128 px = _mm_mul_ps(x, inverse_sum);
+    const __m128 py = _mm_mul_ps(y, inverse_sum);
+    const __m128 folded_x = CopySignSSE(_mm_sub_ps(one, AbsSSE(py)), px);
+    const __m128 folded_y = CopySignSSE(_mm_sub_ps(one, AbsSSE(px)), py);
+    const __m128 lower = _mm_cmplt_ps(z, _mm_setzero_ps());
+    return _mm_or_si128(EncodeSnormSSE<Bits>(Select(lower, folded_x, px)),
+                        _mm_slli_epi32(EncodeSnormSSE<Bits>(Select(lower, folded_y, py)), Bits));
+}
+
+/**
+ * DecodeOctahedral for four normals.
+ */
+template <int32_t Bits>
+void DecodeOctahedralSSE(__m128i encoded, __m128& x, __m128& y, __m128& z)
+{
+    x = DecodeSnormSSE<Bits, 0>(encoded);
+    y = DecodeSnormSSE<Bits, Bits>(encoded);
+    z = _mm_sub_ps(_mm_sub_ps(_mm_set1_ps(1.0f), AbsSSE(x)), AbsSSE(y));
+    const __m128 fold = _mm_max_ps(_mm_sub_ps(_mm_setzero_ps(), z), _mm_setzero_ps());
+    x = _mm_sub_ps(x, CopySignSSE(fold, x));
+    y = _mm_sub_ps(y, CopySignSSE(fold, y));
+    NormalizeSSE(x, y, z);
+}
+
+#endif
+
+/**
+ * The octahedral encoding with Bits per coordinate, in the interface used by EncodeNormals and
+ * DecodeNormals. The SIMD functions take and return 32-bit lanes, sign extended from the code.
+ */
+template <int32_t Bits, typename CodeType>
+struct OctahedralCodec
+{
+    using Code = CodeType;
+
+    template <FloatingPoint T>
+    static Code Encode(const Normal3<T>& n)
+    {
+        return static_cast<Code>(EncodeOctahedral<Bits>(n));
+    }
+
+    template <FloatingPoint T>
+    static Normal3<T> Decode(Code code)
+    {
+        return DecodeOctahedral<Bits, T>(code);
+    }
+
+#if MATH_SIMD_SSE2
+    static __m128i EncodeSSE(__m128 x, __m128 y, __m128 z)
+    {
+        constexpr int32_t k_extend = 32 - 8 * static_cast<int32_t>(sizeof(Code));
+        return _mm_srai_epi32(_mm_slli_epi32(EncodeOctahedralSSE<Bits>(x, y, z), k_extend),
+                              k_extend);
+    }
+
+    static void DecodeSSE(__m128i codes, __m128& x, __m128& y, __m128& z)
+    {
+        DecodeOctahedralSSE<Bits>(codes, x, y, z);
+    }
+#endif
+};
+
+/**
+ * Three 10-bit snorm coordinates, see OctahedralCodec.
+ */
+struct Snorm10Codec
+{
+    using Code = uint32_t;
+
+    template <FloatingPoint T>
+    static Code Encode(const Normal3<T>& n)
+    {
+        return EncodeSnorm<10>(n.x) | (EncodeSnorm<10>(n.y) << 10) | (EncodeSnorm<10>(n.z) << 20);
+    }
+
+    template <FloatingPoint T>
+    static Normal3<T> Decode(Code code)
+    {
+        const T x = DecodeSnorm<10, T>(code);
+        const T y = DecodeSnorm<10, T>(code >> 10);
+        const T z = DecodeSnorm<10, T>(code >> 20);
+        const T length = Math::Sqrt(x * x + y * y + z * z);
+        return Normal3<T>(x / length, y / length, z / length);
+    }
+
+#if MATH_SIMD_SSE2
+    static __m128i EncodeSSE(__m128 x, __m128 y, __m128 z)
+    {
+        return _mm_or_si128(_mm_or_si128(EncodeSnormSSE<10>(x),
+                                         _mm_slli_epi32(EncodeSnormSSE<10>(y), 10)),
+                            _mm_slli_epi32(EncodeSnormSSE<10>(z), 20));
+    }
+
+    static void DecodeSSE(__m128i codes, __m128& x, __m128& y, __m128& z)
+    {
+        x = DecodeSnormSSE<10, 0>(codes);
+        y = DecodeSnormSSE<10, 10>(codes);
+        z = DecodeSnormSSE<10, 20>(codes);
+        NormalizeSSE(x, y, z);
+    }
+#endif
+};
+
+using Octahedral32Codec = OctahedralCodec<16, uint32_t>;
+using Octahedral16Codec = OctahedralCodec<8, uint16_t>;
+
+template <typename Codec, FloatingPoint T>
+void EncodeNormals(std::span<const Normal3<T>> normals, std::span<typename Codec::Code> result)
+{
+    assert(normals.size() == result.size());
+    size_t i = 0;
+#if MATH_SIMD_SSE2
+    if constexpr (std::is_same_v<T, float>)
+    {
+        static_assert(sizeof(Normal3<float>) == 3 * sizeof(float));
+        for (; i + 4 <= normals.size(); i += 4)
+        {
+            __m128 x, y, z;
+            Load3x4SSE(&normals[i].x, x, y, z);
+            const __m128i codes = Codec::EncodeSSE(x, y, z);
+            if constexpr (sizeof(typename Codec::Code) == 4)
+            {
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(&result[i]), codes);
+            }
+            else
+            {
+                // The codes are sign extended, so the saturating pack keeps them.
+                _mm_storel_epi64(reinterpret_cast<__m128i*>(&result[i]),
+                                 _mm_packs_epi32(codes, codes));
+            }
+        }
+    }
+#endif
+    for (; i < normals.size(); ++i)
+    {
+        result[i] = Codec::Encode(normals[i]);
+    }
+}
+
+template <typename Codec, FloatingPoint T>
+void DecodeNormals(std::span<const typename Codec::Code> encoded, std::span<Normal3<T>> result)
+{
+    assert(encoded.size() == result.size());
+    size_t i = 0;
+#if MATH_SIMD_SSE2
+    if constexpr (std::is_same_v<T, float>)
+    {
+        static_assert(sizeof(Normal3<float>) == 3 * sizeof(float));
+        for (; i + 4 <= encoded.size(); i += 4)
+        {
+            __m128i codes;
+            if constexpr (sizeof(typename Codec::Code) == 4)
+            {
+                codes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&encoded[i]));
+            }
+            else
+            {
+                codes = _mm_unpacklo_epi16(
+                    _mm_loadl_epi64(reinterpret_cast<const __m128i*>(&encoded[i])),
+                    _mm_setzero_si128());
+            }
+            __m128 x, y, z;
+            Codec::DecodeSSE(codes, x, y, z);
+            Store3x4SSE(&result[i].x, x, y, z);
+        }
+    }
+#endif
+    for (; i < encoded.size(); ++i)
+    {
+        result[i] = Codec::template Decode<T>(encoded[i]);
+    }
+}
+
+}  // namespace Math::Internal
+
+template <Math::FloatingPoint T>
+uint32_t Math::EncodeOctahedral32(const Normal3<T>& n)
+{
+    return Internal::Octahedral32Codec::Encode(n);
+}
+
+template <Math::FloatingPoint T>
+Math::Normal3<T> Math::DecodeOctahedral32(uint32_t encoded)
+{
+    return Internal::Octahedral32Codec::Decode<T>(encoded);
+}
+
+template <Math::FloatingPoint T>
+uint16_t Math::EncodeOctahedral16(const Normal3<T>& n)
+{
+    return Internal::Octahedral16Codec::Encode(n);
+}
+
+template <Math::FloatingPoint T>
+Math::Normal3<T> Math::DecodeOctahedral16(uint16_t encoded)
+{
+    return Internal::Octahedral16Codec::Decode<T>(encoded);
+}
+
+template <Math::FloatingPoint T>
+uint32_t Math::EncodeSnorm10(const Normal3<T>& n)
+{
+    return Internal::Snorm10Codec::Encode(n);
+}
+
+template <Math::FloatingPoint T>
+Math::Normal3<T> Math::DecodeSnorm10(uint32_t encoded)
+{
+    return Internal::Snorm10Codec::Decode<T>(encoded);
+}
+
+template <Math::FloatingPoint T>
+void Math::EncodeOctahedral32(std::type_identity_t<std::span<const Normal3<T>>> normals,
+                              std::span<uint32_t> result)
+{
+    Internal::EncodeNormals<Internal::Octahedral32Codec, T>(normals, result);
+}
+
+template <Math::FloatingPoint T>
+void Math::DecodeOctahedral32(std::span<const uint32_t> encoded,
+                              std::type_identity_t<std::span<Normal3<T>>> result)
+{
+    Internal::DecodeNormals<Internal::Octahedral32Codec, T>(encoded, result);
+}
+
+template <Math::FloatingPoint T>
+void Math::EncodeOctahedral16(std::type_identity_t<std::span<const Normal3<T>>> normals,
+                              std::span<uint16_t> result)
+{
+    Internal::EncodeNormals<Internal::Octahedral16Codec, T>(normals, result);
+}
+
+template <Math::FloatingPoint T>
+void Math::DecodeOctahedral16(std::span<const uint16_t> encoded,
+                              std::type_identity_t<std::span<Normal3<T>>> result)
+{
+    Internal::DecodeNormals<Internal::Octahedral16Codec, T>(encoded, result);
+}
+
+template <Math::FloatingPoint T>
+void Math::EncodeSnorm10(std::type_identity_t<std::span<const Normal3<T>>> normals,
+                         std::span<uint32_t> result)
+{
+    Internal::EncodeNormals<Internal::Snorm10Codec, T>(normals, result);
+}
+
+template <Math::FloatingPoint T>
+void Math::DecodeSnorm10(std::span<const uint32_t> encoded,
+                         std::type_identity_t<std::span<Normal3<T>>> result)
+{
+    Internal::DecodeNormals<Internal::Snorm10Codec, T>(encoded, result);
+}
+
+template <Math::FloatingPoint T>
+Math::Quaternion<T> Math::EncodeQTangent(const Normal3<T>& normal, const Vector4<T>& tangent)
+{
+    // The rotation whose columns are the tangent, Cross(normal, tangent) and the normal, which is
+    // right handed whatever the handedness of the frame.
+    const Vector3<T> n(normal.x, normal.y, normal.z);
+    const Vector3<T> t = Normalize(Vector3<T>(tangent.x, tangent.y, tangent.z) -
+                                   Dot(n, Vector3<T>(tangent.x, tangent.y, tangent.z)) * n);
+    const Vector3<T> b = Cross(n, t);
+    Matrix4x4<T> rotation(1);
+    for (int32_t row = 0; row < 3; ++row)
+    {
+        const auto r = static_cast<size_t>(row);
+        rotation.elements[r][0] = t[row];
+        rotation.elements[r][1] = b[row];
+        rotation.elements[r][2] = n[row];
+    }
+    Quaternion<T> q = Normalize(Quaternion<T>(rotation));
+
+    // q and -q are the same rotation, so the sign of w is free to hold the handedness. Keep w away
+    // from zero so that its sign isn't lost when it is quantized.
+    if (q.w < 0)
+    {
+        q = q * static_cast<T>(-1);
+    }
+    constexpr T k_bias = static_cast<T>(1) / static_cast<T>(Internal::k_snorm_max<16>);
+    if (q.w < k_bias)
+    {
+        q.vec = q.vec * Math::Sqrt(1 - k_bias * k_bias);
+        q.w = k_bias;
+    }
+    return tangent.w < 0 ? q * static_cast<T>(-1) : q;
+}
+
+template <Math::FloatingPoint T>
+void Math::DecodeQTangent(const Quaternion<T>& q, Normal3<T>& out_normal, Vector4<T>& out_tangent)
+{
+    const Vector3<T> t = q * Vector3<T>(1, 0, 0);
+    const Vector3<T> n = q * Vector3<T>(0, 0, 1);
+    out_normal = Normal3<T>(n.x, n.y, n.z);
+    out_tangent = Vector4<T>(t.x, t.y, t.z, q.w < 0 ? static_cast<T>(-1) : static_cast<T>(1));
+}
+
+template <Math::FloatingPoint T>
+uint64_t Math::PackQTangent(const Quaternion<T>& q)
+{
+    return uint64_t{Internal::EncodeSnorm<16>(q.vec.x)} |
+           (uint64_t{Internal::EncodeSnorm<16>(q.vec.y)} << 16) |
+           (uint64_t{Internal::EncodeSnorm<16>(q.vec.z)} << 32) |
+           (uint64_t{Internal::EncodeSnorm<16>(q.w)} << 48);
+}
+
+template <Math::FloatingPoint T>
+Math::Quaternion<T> Math::UnpackQTangent(uint64_t packed)
+{
+    const Quaternion<T> q(Internal::DecodeSnorm<16, T>(static_cast<uint32_t>(packed >> 48)),
+                          Internal::DecodeSnorm<16, T>(static_cast<uint32_t>(packed)),
+                          Internal::DecodeSnorm<16, T>(static_cast<uint32_t>(packed >> 16)),
+                          Internal::DecodeSnorm<16, T>(static_cast<uint32_t>(packed >> 32)));
+    return Normalize(q);
+}
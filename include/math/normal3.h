@@ -53,51 +53,51 @@ struct Normal3
      * Returns a normal with all components set to zero.
      * @return A normal with all components set to zero.
      */
-    static Normal3 Zero();
+    static constexpr Normal3 Zero();
 
     /** Operators **/
-    T& operator[](int index);
-    const T& operator[](int index) const;
+    constexpr T& operator[](int index);
+    constexpr const T& operator[](int index) const;
 
-    bool operator==(const Normal3& other) const;
-    bool operator!=(const Normal3& other) const;
+    constexpr bool operator==(const Normal3& other) const;
+    constexpr bool operator!=(const Normal3& other) const;
 
-    Normal3 operator+(const Normal3& other) const;
-    Normal3& operator+=(const Normal3& other);
-    Normal3 operator-(const Normal3& other) const;
-    Normal3& operator-=(const Normal3& other);
+    constexpr Normal3 operator+(const Normal3& other) const;
+    constexpr Normal3& operator+=(const Normal3& other);
+    constexpr Normal3 operator-(const Normal3& other) const;
+    constexpr Normal3& operator-=(const Normal3& other);
 
-    Normal3 operator*(const Normal3& other) const;
-    Normal3& operator*=(const Normal3& other);
+    constexpr Normal3 operator*(const Normal3& other) const;
+    constexpr Normal3& operator*=(const Normal3& other);
 
-    Normal3 operator-() const;
+    constexpr Normal3 operator-() const;
 
     template <typename U>
-    Normal3 operator*(U scalar) const;
+    constexpr Normal3 operator*(U scalar) const;
     template <typename U>
-    Normal3& operator*=(U scalar);
+    constexpr Normal3& operator*=(U scalar);
     template <typename U>
-    Normal3 operator/(U scalar) const;
+    constexpr Normal3 operator/(U scalar) const;
     template <typename U>
-    Normal3& operator/=(U scalar);
+    constexpr Normal3& operator/=(U scalar);
 };
 
 template <typename T, typename U>
-Normal3<T> operator*(U scalar, const Normal3<T>& n);
+constexpr Normal3<T> operator*(U scalar, const Normal3<T>& n);
 
 /**
  * Checks if any of the components are NaN or infinite value.
  * @return True if any of the components are NaN or infinite value, false otherwise.
  */
 template <typename T>
-[[nodiscard]] bool ContainsNonFinite(const Normal3<T>& n);
+[[nodiscard]] constexpr bool ContainsNonFinite(const Normal3<T>& n);
 
 /**
  * Checks if any of the components are NaN.
  * @return True if any of the components are NaN, false otherwise.
  */
 template <typename T>
-[[nodiscard]] bool ContainsNaN(const Normal3<T>& n);
+[[nodiscard]] constexpr bool ContainsNaN(const Normal3<T>& n);
 
 /**
  * Returns a new normal with the absolute value of each component.
@@ -106,7 +106,7 @@ template <typename T>
  * @return A new normal with the absolute value of each component.
  */
 template <typename T>
-[[nodiscard]] Normal3<T> Abs(const Normal3<T>& n);
+[[nodiscard]] constexpr Normal3<T> Abs(const Normal3<T>& n);
 
 /**
  * Returns the dot product of normal with himself.
@@ -115,7 +115,7 @@ template <typename T>
  * @return The dot product of normal with himself.
  */
 template <typename T>
-[[nodiscard]] T LengthSquared(const Normal3<T>& n);
+[[nodiscard]] constexpr T LengthSquared(const Normal3<T>& n);
 
 /**
  * Returns the length of the normal.
@@ -124,7 +124,7 @@ template <typename T>
  * @return The length of the normal.
  */
 template <typename T>
-[[nodiscard]] double Length(const Normal3<T>& n);
+[[nodiscard]] constexpr double Length(const Normal3<T>& n);
 
 /**
  * Checks if the normals are equal within a given epsilon.
@@ -135,7 +135,7 @@ template <typename T>
  * @return True if the normals are equal within a given epsilon, false otherwise.
  */
 template <typename T>
-bool IsEqual(const Normal3<T>& n1, const Normal3<T>& n2, T epsilon);
+constexpr bool IsEqual(const Normal3<T>& n1, const Normal3<T>& n2, T epsilon);
 
 /**
  * Returns the dot product of two normals.
@@ -145,7 +145,7 @@ bool IsEqual(const Normal3<T>& n1, const Normal3<T>& n2, T epsilon);
  * @return The dot product of two normals.
  */
 template <typename T>
-T Dot(const Normal3<T>& n1, const Normal3<T>& n2);
+constexpr T Dot(const Normal3<T>& n1, const Normal3<T>& n2);
 
 /**
  * Returns the dot product of a vector and a normal.
@@ -155,9 +155,9 @@ T Dot(const Normal3<T>& n1, const Normal3<T>& n2);
  * @return The dot product of a normal and a vector.
  */
 template <typename T>
-T Dot(const Normal3<T>& n, const Vector3<T>& vec);
+constexpr T Dot(const Normal3<T>& n, const Vector3<T>& vec);
 template <typename T>
-T Dot(const Vector3<T>& vec, const Normal3<T>& n);
+constexpr T Dot(const Vector3<T>& vec, const Normal3<T>& n);
 
 /**
  * Returns the absolute dot product of two normals.
@@ -167,7 +167,7 @@ T Dot(const Vector3<T>& vec, const Normal3<T>& n);
  * @return The absolute dot product of two normals.
  */
 template <typename T>
-T AbsDot(const Normal3<T>& n1, const Normal3<T>& n2);
+constexpr T AbsDot(const Normal3<T>& n1, const Normal3<T>& n2);
 
 /**
  * Returns the absolute dot product of a normal and a vector.
@@ -177,9 +177,9 @@ T AbsDot(const Normal3<T>& n1, const Normal3<T>& n2);
  * @return The absolute dot product of a normal and a vector.
  */
 template <typename T>
-T AbsDot(const Normal3<T>& n, const Vector3<T>& vec);
+constexpr T AbsDot(const Normal3<T>& n, const Vector3<T>& vec);
 template <typename T>
-T AbsDot(const Vector3<T>& vec, const Normal3<T>& n);
+constexpr T AbsDot(const Vector3<T>& vec, const Normal3<T>& n);
 
 /**
  * Returns the normalized normal.
@@ -188,7 +188,7 @@ T AbsDot(const Vector3<T>& vec, const Normal3<T>& n);
  * @return The normalized normal.
  */
 template <typename T>
-Normal3<T> Normalize(const Normal3<T>& n);
+constexpr Normal3<T> Normalize(const Normal3<T>& n);
 
 /**
  * Returns the new normal with the minimum components of the two normals.
@@ -198,7 +198,7 @@ Normal3<T> Normalize(const Normal3<T>& n);
  * @return The new normal with the minimum components of the two normals.
  */
 template <typename T>
-Normal3<T> Min(const Normal3<T>& n1, const Normal3<T>& n2);
+constexpr Normal3<T> Min(const Normal3<T>& n1, const Normal3<T>& n2);
 
 /**
  * Returns the new normal with the maximum components of the two normals.
@@ -208,7 +208,7 @@ Normal3<T> Min(const Normal3<T>& n1, const Normal3<T>& n2);
  * @return The new normal with the maximum components of the two normals.
  */
 template <typename T>
-Normal3<T> Max(const Normal3<T>& n1, const Normal3<T>& n2);
+constexpr Normal3<T> Max(const Normal3<T>& n1, const Normal3<T>& n2);
 
 /**
  * Return the new normal with permuted components.
@@ -220,7 +220,7 @@ Normal3<T> Max(const Normal3<T>& n1, const Normal3<T>& n2);
  * @return The new normal with permuted components.
  */
 template <typename T>
-Normal3<T> Permute(const Normal3<T>& n, int x, int y, int z);
+constexpr Normal3<T> Permute(const Normal3<T>& n, int x, int y, int z);
 
 /**
  * Returns the value of the smallest component.
@@ -229,7 +229,7 @@ Normal3<T> Permute(const Normal3<T>& n, int x, int y, int z);
  * @return The value of the smallest component.
  */
 template <typename T>
-T MinComponent(const Normal3<T>& n);
+constexpr T MinComponent(const Normal3<T>& n);
 
 /**
  * Returns the value of the largest component.
@@ -238,7 +238,7 @@ T MinComponent(const Normal3<T>& n);
  * @return The value of the largest component.
  */
 template <typename T>
-T MaxComponent(const Normal3<T>& n);
+constexpr T MaxComponent(const Normal3<T>& n);
 
 /**
  * Returns the index of the smallest component.
@@ -247,7 +247,7 @@ T MaxComponent(const Normal3<T>& n);
  * @return The index of the smallest component.
  */
 template <typename T>
-int MinDimension(const Normal3<T>& n);
+constexpr int MinDimension(const Normal3<T>& n);
 
 /**
  * Returns the index of the largest component.
@@ -256,7 +256,7 @@ int MinDimension(const Normal3<T>& n);
  * @return The index of the largest component.
  */
 template <typename T>
-int MaxDimension(const Normal3<T>& n);
+constexpr int MaxDimension(const Normal3<T>& n);
 
 /**
  * Turn normal to look in the same hemisphere as a vector.
@@ -266,7 +266,7 @@ int MaxDimension(const Normal3<T>& n);
  * negated normal.
  */
 template <typename T>
-Normal3<T> FaceForward(const Normal3<T>& n, const Vector3<T>& vec);
+constexpr Normal3<T> FaceForward(const Normal3<T>& n, const Vector3<T>& vec);
 
 }  // namespace Math
 
@@ -294,43 +294,53 @@ constexpr Math::Normal3<T>::Normal3(const Vector3<T>& vec) : x(vec.x), y(vec.y),
 }
 
 template <typename T>
-Math::Normal3<T> Math::Normal3<T>::Zero()
+constexpr Math::Normal3<T> Math::Normal3<T>::Zero()
 {
     return {0, 0, 0};
 }
 
 template <typename T>
-T& Math::Normal3<T>::operator[](int index)
+constexpr T& Math::Normal3<T>::operator[](int index)
 {
+    // Reading the inactive array member of the union is not allowed in constant expressions.
+    if (std::is_constant_evaluated())
+    {
+        return index == 0 ? x : (index == 1 ? y : z);
+    }
     return data[index];
 }
 
 template <typename T>
-const T& Math::Normal3<T>::operator[](int index) const
+constexpr const T& Math::Normal3<T>::operator[](int index) const
 {
+    // Reading the inactive array member of the union is not allowed in constant expressions.
+    if (std::is_constant_evaluated())
+    {
+        return index == 0 ? x : (index == 1 ? y : z);
+    }
     return data[index];
 }
 
 template <typename T>
-bool Math::Normal3<T>::operator==(const Normal3& other) const
+constexpr bool Math::Normal3<T>::operator==(const Normal3& other) const
 {
     return x == other.x && y == other.y && z == other.z;
 }
 
 template <typename T>
-bool Math::Normal3<T>::operator!=(const Normal3& other) const
+constexpr bool Math::Normal3<T>::operator!=(const Normal3& other) const
 {
     return !(*this == other);
 }
 
 template <typename T>
-Math::Normal3<T> Math::Normal3<T>::operator+(const Normal3& other) const
+constexpr Math::Normal3<T> Math::Normal3<T>::operator+(const Normal3& other) const
 {
     return {x + other.x, y + other.y, z + other.z};
 }
 
 template <typename T>
-Math::Normal3<T>& Math::Normal3<T>::operator+=(const Normal3& other)
+constexpr Math::Normal3<T>& Math::Normal3<T>::operator+=(const Normal3& other)
 {
     x += other.x;
     y += other.y;
@@ -339,13 +349,13 @@ Math::Normal3<T>& Math::Normal3<T>::operator+=(const Normal3& other)
 }
 
 template <typename T>
-Math::Normal3<T> Math::Normal3<T>::operator-(const Normal3& other) const
+constexpr Math::Normal3<T> Math::Normal3<T>::operator-(const Normal3& other) const
 {
     return {x - other.x, y - other.y, z - other.z};
 }
 
 template <typename T>
-Math::Normal3<T>& Math::Normal3<T>::operator-=(const Normal3& other)
+constexpr Math::Normal3<T>& Math::Normal3<T>::operator-=(const Normal3& other)
 {
     x -= other.x;
     y -= other.y;
@@ -354,19 +364,19 @@ Math::Normal3<T>& Math::Normal3<T>::operator-=(const Normal3& other)
 }
 
 template <typename T>
-Math::Normal3<T> Math::Normal3<T>::operator*(const Normal3& other) const
+constexpr Math::Normal3<T> Math::Normal3<T>::operator*(const Normal3& other) const
 {
     return {x * other.x, y * other.y, z * other.z};
 }
 
 template <typename T, typename U>
-Math::Normal3<T> Math::operator*(U scalar, const Normal3<T>& n)
+constexpr Math::Normal3<T> Math::operator*(U scalar, const Normal3<T>& n)
 {
     return n * scalar;
 }
 
 template <typename T>
-Math::Normal3<T>& Math::Normal3<T>::operator*=(const Normal3& other)
+constexpr Math::Normal3<T>& Math::Normal3<T>::operator*=(const Normal3& other)
 {
     x *= other.x;
     y *= other.y;
@@ -375,14 +385,14 @@ Math::Normal3<T>& Math::Normal3<T>::operator*=(const Normal3& other)
 }
 
 template <typename T>
-Math::Normal3<T> Math::Normal3<T>::operator-() const
+constexpr Math::Normal3<T> Math::Normal3<T>::operator-() const
 {
     return {-x, -y, -z};
 }
 
 template <typename T>
 template <typename U>
-Math::Normal3<T> Math::Normal3<T>::operator*(U scalar) const
+constexpr Math::Normal3<T> Math::Normal3<T>::operator*(U scalar) const
 {
     T sc = static_cast<T>(scalar);
     return {x * sc, y * sc, z * sc};
@@ -390,7 +400,7 @@ Math::Normal3<T> Math::Normal3<T>::operator*(U scalar) const
 
 template <typename T>
 template <typename U>
-Math::Normal3<T>& Math::Normal3<T>::operator*=(U scalar)
+constexpr Math::Normal3<T>& Math::Normal3<T>::operator*=(U scalar)
 {
     T sc = static_cast<T>(scalar);
     x *= sc;
@@ -401,7 +411,7 @@ Math::Normal3<T>& Math::Normal3<T>::operator*=(U scalar)
 
 template <typename T>
 template <typename U>
-Math::Normal3<T> Math::Normal3<T>::operator/(U scalar) const
+constexpr Math::Normal3<T> Math::Normal3<T>::operator/(U scalar) const
 {
     if constexpr (std::is_integral_v<T>)
     {
@@ -417,7 +427,7 @@ Math::Normal3<T> Math::Normal3<T>::operator/(U scalar) const
 
 template <typename T>
 template <typename U>
-Math::Normal3<T>& Math::Normal3<T>::operator/=(U scalar)
+constexpr Math::Normal3<T>& Math::Normal3<T>::operator/=(U scalar)
 {
     if constexpr (std::is_integral_v<T>)
     {
@@ -438,80 +448,80 @@ Math::Normal3<T>& Math::Normal3<T>::operator/=(U scalar)
 }
 
 template <typename T>
-bool Math::ContainsNonFinite(const Normal3<T>& n)
+constexpr bool Math::ContainsNonFinite(const Normal3<T>& n)
 {
     return !Math::IsFinite(n.x) || !Math::IsFinite(n.y) || !Math::IsFinite(n.z);
 }
 
 template <typename T>
-bool Math::ContainsNaN(const Normal3<T>& n)
+constexpr bool Math::ContainsNaN(const Normal3<T>& n)
 {
     return Math::IsNaN(n.x) || Math::IsNaN(n.y) || Math::IsNaN(n.z);
 }
 
 template <typename T>
-Math::Normal3<T> Math::Abs(const Normal3<T>& n)
+constexpr Math::Normal3<T> Math::Abs(const Normal3<T>& n)
 {
     return {Math::Abs(n.x), Math::Abs(n.y), Math::Abs(n.z)};
 }
 
 template <typename T>
-T Math::LengthSquared(const Normal3<T>& n)
+constexpr T Math::LengthSquared(const Normal3<T>& n)
 {
     return n.x * n.x + n.y * n.y + n.z * n.z;
 }
 
 template <typename T>
-double Math::Length(const Normal3<T>& n)
+constexpr double Math::Length(const Normal3<T>& n)
 {
-    return Math::Sqrt(static_cast<double>(LengthSquared(n)));
+    return Math::Sqrt(Math::SumOfSquares(n.x, n.y, n.z));
 }
 
 template <typename T>
-bool Math::IsEqual(const Normal3<T>& n1, const Normal3<T>& n2, T epsilon)
+constexpr bool Math::IsEqual(const Normal3<T>& n1, const Normal3<T>& n2, T epsilon)
 {
     return Math::Abs(n1.x - n2.x) <= epsilon && Math::Abs(n1.y - n2.y) <= epsilon &&
            Math::Abs(n1.z - n2.z) <= epsilon;
 }
 
 template <typename T>
-T Math::Dot(const Normal3<T>& n1, const Normal3<T>& n2)
+constexpr T Math::Dot(const Normal3<T>& n1, const Normal3<T>& n2)
 {
     return n1.x * n2.x + n1.y * n2.y + n1.z * n2.z;
 }
 
 template <typename T>
-T Math::Dot(const Normal3<T>& n, const Vector3<T>& vec)
+constexpr T Math::Dot(const Normal3<T>& n, const Vector3<T>& vec)
 {
     return n.x * vec.x + n.y * vec.y + n.z * vec.z;
 }
 
 template <typename T>
-T Math::Dot(const Vector3<T>& vec, const Normal3<T>& n)
+constexpr T Math::Dot(const Vector3<T>& vec, const Normal3<T>& n)
 {
     return n.x * vec.x + n.y * vec.y + n.z * vec.z;
 }
 
 template <typename T>
-T Math::AbsDot(const Normal3<T>& n1, const Normal3<T>& n2)
+constexpr T Math::AbsDot(const Normal3<T>& n1, const Normal3<T>& n2)
 {
     return Math::Abs(Dot(n1, n2));
 }
 
 template <typename T>
-T Math::AbsDot(const Normal3<T>& n, const Vector3<T>& vec)
+constexpr T Math::AbsDot(const Normal3<T>& n, const Vector3<T>& vec)
 {
     return Math::Abs(Dot(n, vec));
 }
 
 template <typename T>
-T Math::AbsDot(const Vector3<T>& vec, const Normal3<T>& n)
+constexpr T Math::AbsDot(const Vector3<T>& vec, const Normal3<T>& n)
 {
     return Math::Abs(Dot(vec, n));
 }
 
 template <typename T>
-Math::Normal3<T> Math::Normalize(const Normal3<T>& n)
+constexpr Math::Normal3<T> Math::Normalize(const Normal3<T>& n)
 {
     double length = Length(n);
     assert(length > 0);
@@ -519,49 +529,49 @@ Math::Normal3<T> Math::Normalize(const Normal3<T>& n)
 }
 
 template <typename T>
-Math::Normal3<T> Math::Min(const Normal3<T>& n1, const Normal3<T>& n2)
+constexpr Math::Normal3<T> Math::Min(const Normal3<T>& n1, const Normal3<T>& n2)
 {
     return {Math::Min(n1.x, n2.x), Math::Min(n1.y, n2.y), Math::Min(n1.z, n2.z)};
 }
 
 template <typename T>
-Math::Normal3<T> Math::Max(const Normal3<T>& n1, const Normal3<T>& n2)
+constexpr Math::Normal3<T> Math::Max(const Normal3<T>& n1, const Normal3<T>& n2)
 {
     return {Math::Max(n1.x, n2.x), Math::Max(n1.y, n2.y), Math::Max(n1.z, n2.z)};
 }
 
 template <typename T>
-Math::Normal3<T> Math::Permute(const Normal3<T>& n, int x, int y, int z)
+constexpr Math::Normal3<T> Math::Permute(const Normal3<T>& n, int x, int y, int z)
 {
     return {n[x], n[y], n[z]};
 }
 
 template <typename T>
-T Math::MinComponent(const Normal3<T>& n)
+constexpr T Math::MinComponent(const Normal3<T>& n)
 {
     return Math::Min(Math::Min(n.x, n.y), n.z);
 }
 
 template <typename T>
-T Math::MaxComponent(const Normal3<T>& n)
+constexpr T Math::MaxComponent(const Normal3<T>& n)
 {
     return Math::Max(Math::Max(n.x, n.y), n.z);
 }
 
 template <typename T>
-int Math::MinDimension(const Normal3<T>& n)
+constexpr int Math::MinDimension(const Normal3<T>& n)
 {
     return n.x < n.y ? (n.x < n.z ? 0 : 2) : (n.y < n.z ? 1 : 2);
 }
 
 template <typename T>
-int Math::MaxDimension(const Normal3<T>& n)
+constexpr int Math::MaxDimension(const Normal3<T>& n)
 {
     return n.x > n.y ? (n.x > n.z ? 0 : 2) : (n.y > n.z ? 1 : 2);
 }
 
 template <typename T>
-Math::Normal3<T> Math::FaceForward(const Normal3<T>& n, const Vector3<T>& vec)
+constexpr Math::Normal3<T> Math::FaceForward(const Normal3<T>& n, const Vector3<T>& vec)
 {
     return (Dot(n, vec) < 0) ? -n : n;
 }
@@ -0,0 +1,730 @@
+#pragma once
+
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <span>
+#include <type_traits>
+
+#include "math/base.h"
+#include "math/bounds3-batch.h"
+#include "math/bounds3.h"
+#include "math/frustum.h"
+#include "math/matrix.h"
+#include "math/point-statistics.h"
+#include "math/point3.h"
+#include "math/ray.h"
+#include "math/simd.h"
+#include "math/vector3.h"
+
+namespace Math
+{
+
+/**
+ * Oriented bounding box, a box rotated around its center. Bounds long objects at any angle much
+ * more tightly than Bounds3.
+ */
+template <FloatingPoint T>
+struct OrientedBounds3
+{
+    Point3<T> center;
+    /** Half the size of the box along each of its axes. */
+    Vector3<T> half_extents;
+    /** Rotation from the space of the box to world space, the columns are the axes of the box. */
+    Matrix3x3<T> rotation;
+
+    /**
+     * Constructs a box with uninitialized members.
+     */
+    constexpr OrientedBounds3() = default;
+
+    /**
+     * Constructs a box.
+     * @param box_center The center.
+     * @param box_half_extents Half the size along each axis.
+     * @param box_rotation The rotation, with the axes of the box as orthonormal columns.
+     */
+    constexpr OrientedBounds3(const Point3<T>& box_center,
+                              const Vector3<T>& box_half_extents,
+                              const Matrix3x3<T>& box_rotation);
+
+    /**
+     * Constructs a box with the same extent as the axis aligned box, without rotation.
+     */
+    constexpr explicit OrientedBounds3(const Bounds3<T>& b);
+
+    /**
+     * Fit a box to the points along their principal axes, the eigenvectors of the covariance of
+     * the points. The largest extent is along the first axis.
+     * @param points The points, at least one.
+     * @return The box containing all the points, up to the rounding of the projections.
+     */
+    static OrientedBounds3 FromPoints(std::span<const Point3<T>> points);
+
+    /**
+     * Bound an axis aligned box transformed by an affine transform. The axes follow the columns of
+     * the transform, the box is exact for a rotation and scale and conservative with shear.
+     * @param b The box in the space that the transform transforms from.
+     * @param m The transform. The last row needs to be 0, 0, 0, 1.
+     * @return The box containing the transformed box.
+     */
+    static OrientedBounds3 FromBounds(const Bounds3<T>& b, const Matrix4x4<T>& m);
+
+    /**
+     * @param index 0, 1 or 2.
+     * @return The axis of the box, a column of the rotation.
+     */
+    [[nodiscard]] constexpr Vector3<T> Axis(int index) const;
+};
+
+/**
+ * Checks if two oriented boxes overlap with the separating axis test, which tries the 3 axes of
+ * each box and the 9 cross products of an axis of one with an axis of the other.
+ * Based on: Real-Time Collision Detection, Ericson, 2005, section 4.4.1.
+ * @param b1 First box.
+ * @param b2 Second box.
+ * @return True if the boxes overlap. Boxes that almost touch can be reported as overlapping.
+ */
+template <FloatingPoint T>
+constexpr bool Overlaps(const OrientedBounds3<T>& b1, const OrientedBounds3<T>& b2);
+
+/**
+ * Checks if the oriented box overlaps the frustum. Conservative in the same way as Overlaps with a
+ * Bounds3.
+ * @param f The frustum.
+ * @param b The box.
+ * @return True if the box overlaps the frustum.
+ */
+template <FloatingPoint T>
+[[nodiscard]] constexpr bool Overlaps(const Frustum<T>& f, const OrientedBounds3<T>& b);
+
+/**
+ * Checks if the oriented box is completely inside the frustum.
+ * @param f The frustum.
+ * @param b The box.
+ * @return True if the box is inside the frustum.
+ */
+template <FloatingPoint T>
+[[nodiscard]] constexpr bool Inside(const Frustum<T>& f, const OrientedBounds3<T>& b);
+
+/**
+ * Checks if a point is inside the oriented box or on its boundary.
+ * @param b The box.
+ * @param p The point.
+ * @return True if the point is inside the box.
+ */
+template <FloatingPoint T>
+constexpr bool InsideInclusive(const OrientedBounds3<T>& b, const Point3<T>& p);
+
+/**
+ * Intersect the ray with the oriented box, by rotating the ray into the space of the box and using
+ * the slab test of Intersect with a Bounds3. The rotation of the ray is not included in the bound
+ * on the rounding error.
+ * @param ray The ray.
+ * @param b The box.
+ * @param t_max The end of the ray segment to test.
+ * @param out_t0 The parameter where the ray enters the box, clamped to 0.
+ * @param out_t1 The parameter where the ray exits the box, clamped to t_max.
+ * @return True if the segment from 0 to t_max overlaps the box.
+ */
+template <FloatingPoint T>
+constexpr bool Intersect(const Ray<T>& ray,
+                         const OrientedBounds3<T>& b,
+                         T t_max,
+                         T& out_t0,
+                         T& out_t1);
+
+/**
+ * Test one oriented box against many. Bit i % 64 of mask[i / 64] is set if boxes[i] overlaps the
+ * query, the bits after the last box are cleared.
+ * @param query The box to test against.
+ * @param boxes The boxes to test.
+ * @param mask Where to write the bits. Needs at least (boxes.size() + 63) / 64 elements.
+ * @return The number of overlapping boxes.
+ */
+template <FloatingPoint T>
+size_t Overlaps(const OrientedBounds3<T>& query,
+                std::type_identity_t<std::span<const OrientedBounds3<T>>> boxes,
+                std::span<uint64_t> mask);
+
+/**
+ * Test many oriented boxes against the frustum. Bit i % 64 of mask[i / 64] is set if boxes[i]
+ * overlaps the frustum, the bits after the last box are cleared.
+ * @param f The frustum.
+ * @param boxes The boxes to test.
+ * @param mask Where to write the bits. Needs at least (boxes.size() + 63) / 64 elements.
+ * @return The number of overlapping boxes.
+ */
+template <FloatingPoint T>
+size_t Overlaps(const Frustum<T>& f,
+                std::type_identity_t<std::span<const OrientedBounds3<T>>> boxes,
+                std::span<uint64_t> mask);
+
+/**
+ * Test the ray against many oriented boxes. Bit i % 64 of mask[i / 64] is set if the segment from
+ * 0 to t_max overlaps boxes[i], the bits after the last box are cleared.
+ * @param ray The ray.
+ * @param boxes The boxes to test.
+ * @param t_max The end of the ray segment to test.
+ * @param mask Where to write the bits. Needs at least (boxes.size() + 63) / 64 elements.
+ * @return The number of boxes hit.
+ */
+template <FloatingPoint T>
+size_t Intersect(const Ray<T>& ray,
+                 std::type_identity_t<std::span<const OrientedBounds3<T>>> boxes,
+                 T t_max,
+                 std::span<uint64_t> mask);
+
+}  // namespace Math
+
+// Implementation //////////////////////////////////////////////////////////////////////////////////
+
+namespace Math::Internal
+{
+
+/**
+ * Added to the absolute values of the rotation between two boxes in the separating axis test, so
+ * that the cross products of almost parallel axes, which are almost zero, don't separate boxes that
+ * overlap.
+ */
+template <FloatingPoint T>
+constexpr T k_oriented_bounds_epsilon = 16 * std::numeric_limits<T>::epsilon();
+
+/**
+ * Eigenvectors of a symmetric matrix as the columns of the result, with cyclic Jacobi rotations.
+ * Based on: Numerical Recipes, 3rd edition, section 11.1.
+ */
+inline Matrix3x3<double> SymmetricEigenvectors(Matrix3x3<double> m, Vector3<double>& out_values)
+{
+    Matrix3x3<double> vectors(1.0);
+    auto& a = m.elements;
+    auto& v = vectors.elements;
+    constexpr int k_pairs[3][2] = {{0, 1}, {0, 2}, {1, 2}};
+    for (int sweep = 0; sweep < 50; ++sweep)
+    {
+        const double off = a[0][1] * a[0][1] + a[0][2] * a[0][2] + a[1][2] * a[1][2];
+        const double diagonal = a[0][0] * a[0][0] + a[1][1] * a[1][1] + a[2][2] * a[2][2];
+        if (off <= 1e-30 * diagonal)
+        {
+            break;
+        }
+        for (const auto& [p, q] : k_pairs)
+        {
+            if (a[p][q] == 0)
+            {
+                continue;
+            }
+            // The rotation J that zeroes a[p][q] in transpose(J) * a * J.
+            const double theta = (a[q][q] - a[p][p]) / (2 * a[p][q]);
+            const double t =
+                std::copysign(1.0, theta) / (std::abs(theta) + std::sqrt(theta * theta + 1));
+            const double c = 1 / std::sqrt(t * t + 1);
+            const double s = t * c;
+            for (int k = 0; k < 3; ++k)
+            {
+                const double kp = a[k][p];
+                const double kq = a[k][q];
+                a[k][p] = c * kp - s * kq;
+                a[k][q] = s * kp + c * kq;
+            }
+            for (int k = 0; k < 3; ++k)
+            {
+                const double pk = a[p][k];
+                const double qk = a[q][k];
+                a[p][k] = c * pk - s * qk;
+                a[q][k] = s * pk + c * qk;
+            }
+            for (int k = 0; k < 3; ++k)
+            {
+                const double kp = v[k][p];
+                const double kq = v[k][q];
+                v[k][p] = c * kp - s * kq;
+                v[k][q] = s * kp + c * kq;
+            }
+        }
+    }
+    out_values = Vector3<double>(a[0][0], a[1][1], a[2][2]);
+    return vectors;
+}
+
+/**
+ * A unit vector perpendicular to the unit vector.
+ */
+template <FloatingPoint T>
+constexpr Vector3<T> PerpendicularAxis(const Vector3<T>& axis)
+{
+    return Normalize(Math::Abs(axis.x) < static_cast<T>(0.9) ? Cross(axis, Vector3<T>(1, 0, 0))
+                                                               : Cross(axis, Vector3<T>(0, 1, 0)));
+}
+
+template <FloatingPoint T>
+constexpr Matrix3x3<T> RotationFromAxes(const Vector3<T> (&axes)[3])
+{
+    // clang-format off
+    return Matrix3x3<T>(axes[0].x, axes[1].x, axes[2].x,
+                        axes[0].y, axes[1].y, axes[2].y,
+                        axes[0].z, axes[1].z, axes[2].z);
+    // clang-format on
+}
+
+template <FloatingPoint T>
+constexpr Containment Classify(const Frustum<T>& f, const OrientedBounds3<T>& b)
+{
+    Containment result = Containment::Inside;
+    for (const Vector4<T>& plane : f.planes)
+    {
+        // The distance of the center and the projection of the half extents on the normal.
+        const Vector3<T> normal(plane.x, plane.y, plane.z);
+        const T distance =
+            normal.x * b.center.x + normal.y * b.center.y + normal.z * b.center.z + plane.w;
+        const T radius = b.half_extents.x * AbsDot(normal, b.Axis(0)) +
+                         b.half_extents.y * AbsDot(normal, b.Axis(1)) +
+                         b.half_extents.z * AbsDot(normal, b.Axis(2));
+        if (distance + radius < 0)
+        {
+            return Containment::Outside;
+        }
+        if (distance - radius < 0)
+        {
+            result = Containment::Intersects;
+        }
+    }
+    return result;
+}
+
+#if MATH_SIMD_SSE2
+
+static_assert(sizeof(OrientedBounds3<float>) == 15 * sizeof(float));
+
+/**
+ * Load four consecutive boxes and transpose them to one register per float of a box: the center,
+ * the half extents and the rotation in row-major order.
+ */
+inline void LoadOrientedBounds4SSE(const OrientedBounds3<float>* boxes, __m128 (&lanes)[15])
+{
+    const float* f = &boxes[0].center.x;
+    // The last group starts at 11 instead of 12 so the fourth box is not read past its end.
+    for (const int first : {0, 4, 8, 11})
+    {
+        __m128 r0 = _mm_loadu_ps(f + first);
+        __m128 r1 = _mm_loadu_ps(f + 15 + first);
+        __m128 r2 = _mm_loadu_ps(f + 30 + first);
+        __m128 r3 = _mm_loadu_ps(f + 45 + first);
+        _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+        lanes[first] = r0;
+        lanes[first + 1] = r1;
+        lanes[first + 2] = r2;
+        lanes[first + 3] = r3;
+    }
+}
+
+/**
+ * The separating axis test of Overlaps for four boxes against the query, returns the bits of the
+ * boxes that overlap it.
+ */
+inline int OverlapsSSE(const OrientedBounds3<float>& query, const __m128 (&box)[15])
+{
+    const __m128 offset[3] = {_mm_sub_ps(box[0], _mm_set1_ps(query.center.x)),
+                              _mm_sub_ps(box[1], _mm_set1_ps(query.center.y)),
+                              _mm_sub_ps(box[2], _mm_set1_ps(query.center.z))};
+    const __m128 epsilon = _mm_set1_ps(k_oriented_bounds_epsilon<float>);
+    __m128 t[3];
+    __m128 r[3][3];
+    __m128 abs_r[3][3];
+    for (int i = 0; i < 3; ++i)
+    {
+        const Vector3<float> axis = query.Axis(i);
+        const __m128 x = _mm_set1_ps(axis.x);
+        const __m128 y = _mm_set1_ps(axis.y);
+        const __m128 z = _mm_set1_ps(axis.z);
+        t[i] = MulAdd(offset[2], z, MulAdd(offset[1], y, _mm_mul_ps(offset[0], x)));
+        for (int j = 0; j < 3; ++j)
+        {
+            r[i][j] = MulAdd(box[12 + j], z, MulAdd(box[9 + j], y, _mm_mul_ps(box[6 + j], x)));
+            abs_r[i][j] = _mm_add_ps(AbsSSE(r[i][j]), epsilon);
+        }
+    }
+
+    const __m128 e1[3] = {_mm_set1_ps(query.half_extents.x), _mm_set1_ps(query.half_extents.y),
+                          _mm_set1_ps(query.half_extents.z)};
+    const __m128* e2 = box + 3;
+    __m128 separated = _mm_setzero_ps();
+    auto separate = [&](__m128 distance, __m128 radius)
+    { separated = _mm_or_ps(separated, _mm_cmpgt_ps(AbsSSE(distance), radius)); };
+    for (int i = 0; i < 3; ++i)
+    {
+        separate(t[i], MulAdd(e2[2], abs_r[i][2],
+                              MulAdd(e2[1], abs_r[i][1], MulAdd(e2[0], abs_r[i][0], e1[i]))));
+    }
+    // The sums are in the order of the scalar Overlaps, so boxes touching a separating plane get
+    // the same result from both.
+    for (int j = 0; j < 3; ++j)
+    {
+        separate(MulAdd(t[2], r[2][j], MulAdd(t[1], r[1][j], _mm_mul_ps(t[0], r[0][j]))),
+                 _mm_add_ps(MulAdd(e1[2], abs_r[2][j],
+                                   MulAdd(e1[1], abs_r[1][j], _mm_mul_ps(e1[0], abs_r[0][j]))),
+                            e2[j]));
+    }
+    for (int i = 0; i < 3; ++i)
+    {
+        const int i1 = (i + 1) % 3;
+        const int i2 = (i + 2) % 3;
+        for (int j = 0; j < 3; ++j)
+        {
+            const int j1 = (j + 1) % 3;
+            const int j2 = (j + 2) % 3;
+            const __m128 radius = MulAdd(
+                e2[j2], abs_r[i][j1],
+                MulAdd(e2[j1], abs_r[i][j2],
+                       MulAdd(e1[i1], abs_r[i2][j], _mm_mul_ps(e1[i2], abs_r[i1][j]))));
+            separate(_mm_sub_ps(_mm_mul_ps(t[i2], r[i1][j]), _mm_mul_ps(t[i1], r[i2][j])), radius);
+        }
+    }
+    return ~_mm_movemask_ps(separated) & 0xF;
+}
+
+#endif
+
+}  // namespace Math::Internal
+
+template <Math::FloatingPoint T>
+constexpr Math::OrientedBounds3<T>::OrientedBounds3(const Point3<T>& box_center,
+                                                    const Vector3<T>& box_half_extents,
+                                                    const Matrix3x3<T>& box_rotation)
+    : center(box_center), half_extents(box_half_extents), rotation(box_rotation)
+{
+}
+
+template <Math::FloatingPoint T>
+constexpr Math::OrientedBounds3<T>::OrientedBounds3(const Bounds3<T>& b)
+    : center(b.min + (b.max - b.min) / static_cast<T>(2)),
+      half_extents((b.max - b.min) / static_cast<T>(2)),
+      rotation(1)
+{
+}
+
+template <Math::FloatingPoint T>
+Math::OrientedBounds3<T> Math::OrientedBounds3<T>::FromPoints(std::span<const Point3<T>> points)
+{
+    assert(!points.empty());
+    PointStatistics<T> statistics;
+    statistics.Add(points);
+    Vector3<double> eigenvalues;
+    const Matrix3x3<double> eigenvectors =
+        Internal::SymmetricEigenvectors(statistics.Covariance(), eigenvalues);
+
+    // The axes by decreasing variance. The vectors are orthonormalized again after the rounding to
+    // T, and the third axis is a cross product so the rotation has no reflection.
+    int order[3] = {0, 1, 2};
+    for (int i = 0; i < 2; ++i)
+    {
+        for (int j = i + 1; j < 3; ++j)
+        {
+            if (eigenvalues[order[j]] > eigenvalues[order[i]])
+            {
+                const int swap = order[i];
+                order[i] = order[j];
+                order[j] = swap;
+            }
+        }
+    }
+    auto column = [&](int index)
+    {
+        return Vector3<T>(static_cast<T>(eigenvectors.elements[0][index]),
+                          static_cast<T>(eigenvectors.elements[1][index]),
+                          static_cast<T>(eigenvectors.elements[2][index]));
+    };
+    Vector3<T> axes[3];
+    axes[0] = Normalize(column(order[0]));
+    axes[1] = column(order[1]);
+    axes[1] = Normalize(axes[1] - axes[0] * Dot(axes[1], axes[0]));
+    axes[2] = Cross(axes[0], axes[1]);
+
+    // Project relative to the mean, which keeps the projections small for points far from the
+    // origin.
+    const Point3<double> mean = statistics.Mean();
+    const Point3<T> origin(static_cast<T>(mean.x), static_cast<T>(mean.y), static_cast<T>(mean.z));
+    Vector3<T> low(std::numeric_limits<T>::infinity());
+    Vector3<T> high(-std::numeric_limits<T>::infinity());
+    for (const Point3<T>& p : points)
+    {
+        const Vector3<T> offset = p - origin;
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            const T projection = Dot(offset, axes[axis]);
+            low[axis] = Math::Min(low[axis], projection);
+            high[axis] = Math::Max(high[axis], projection);
+        }
+    }
+    const Vector3<T> middle = (low + high) / static_cast<T>(2);
+    return OrientedBounds3(origin + axes[0] * middle.x + axes[1] * middle.y + axes[2] * middle.z,
+                           (high - low) / static_cast<T>(2), Internal::RotationFromAxes(axes));
+}
+
+template <Math::FloatingPoint T>
+Math::OrientedBounds3<T> Math::OrientedBounds3<T>::FromBounds(const Bounds3<T>& b,
+                                                              const Matrix4x4<T>& m)
+{
+    const Vector3<T> columns[3] = {Vector3<T>(m(0, 0), m(1, 0), m(2, 0)),
+                                   Vector3<T>(m(0, 1), m(1, 1), m(2, 1)),
+                                   Vector3<T>(m(0, 2), m(1, 2), m(2, 2))};
+
+    // Orthonormalize the columns, with any perpendicular direction where a column is zero or
+    // parallel to the first. Every orthonormal frame bounds the box once the transformed half
+    // extents are projected on it, the frame of the columns is the tightest.
+    Vector3<T> axes[3];
+    axes[0] = LengthSquared(columns[0]) > 0 ? Normalize(columns[0]) : Vector3<T>(1, 0, 0);
+    const Vector3<T> second = columns[1] - axes[0] * Dot(columns[1], axes[0]);
+    axes[1] = LengthSquared(second) > 0 ? Normalize(second) : Internal::PerpendicularAxis(axes[0]);
+    axes[2] = Cross(axes[0], axes[1]);
+
+    const Vector3<T> local_half_extents = (b.max - b.min) / static_cast<T>(2);
+    Vector3<T> world_half_extents;
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        world_half_extents[axis] = local_half_extents.x * AbsDot(axes[axis], columns[0]) +
+                                   local_half_extents.y * AbsDot(axes[axis], columns[1]) +
+                                   local_half_extents.z * AbsDot(axes[axis], columns[2]);
+    }
+    return OrientedBounds3(m * (b.min + local_half_extents), world_half_extents,
+                           Internal::RotationFromAxes(axes));
+}
+
+template <Math::FloatingPoint T>
+constexpr Math::Vector3<T> Math::OrientedBounds3<T>::Axis(int index) const
+{
+    return Vector3<T>(rotation.elements[0][index], rotation.elements[1][index],
+                      rotation.elements[2][index]);
+}
+
+template <Math::FloatingPoint T>
+constexpr bool Math::Overlaps(const OrientedBounds3<T>& b1, const OrientedBounds3<T>& b2)
+{
+    // The offset between the centers and the rotation of b2 in the space of b1.
+    const Vector3<T> offset = b2.center - b1.center;
+    T t[3];
+    T r[3][3];
+    T abs_r[3][3];
+    for (int i = 0; i < 3; ++i)
+    {
+        const Vector3<T> axis = b1.Axis(i);
+        t[i] = Dot(offset, axis);
+        for (int j = 0; j < 3; ++j)
+        {
+            r[i][j] = Dot(axis, b2.Axis(j));
+            abs_r[i][j] = Math::Abs(r[i][j]) + Internal::k_oriented_bounds_epsilon<T>;
+        }
+    }
+
+    const Vector3<T>& e1 = b1.half_extents;
+    const Vector3<T>& e2 = b2.half_extents;
+    for (int i = 0; i < 3; ++i)
+    {
+        if (Math::Abs(t[i]) >
+            e1[i] + e2[0] * abs_r[i][0] + e2[1] * abs_r[i][1] + e2[2] * abs_r[i][2])
+        {
+            return false;
+        }
+    }
+    for (int j = 0; j < 3; ++j)
+    {
+        if (Math::Abs(t[0] * r[0][j] + t[1] * r[1][j] + t[2] * r[2][j]) >
+            e1[0] * abs_r[0][j] + e1[1] * abs_r[1][j] + e1[2] * abs_r[2][j] + e2[j])
+        {
+            return false;
+        }
+    }
+    for (int i = 0; i < 3; ++i)
+    {
+        const int i1 = (i + 1) % 3;
+        const int i2 = (i + 2) % 3;
+        for (int j = 0; j < 3; ++j)
+        {
+            const int j1 = (j + 1) % 3;
+            const int j2 = (j + 2) % 3;
+            const T radius = e1[i1] * abs_r[i2][j] + e1[i2] * abs_r[i1][j] +
+                             e2[j1] * abs_r[i][j2] + e2[j2] * abs_r[i][j1];
+            if (Math::Abs(t[i2] * r[i1][j] - t[i1] * r[i2][j]) > radius)
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+template <Math::FloatingPoint T>
+constexpr bool Math::Overlaps(const Frustum<T>& f, const OrientedBounds3<T>& b)
+{
+    return Internal::Classify(f, b) != Internal::Containment::Outside;
+}
+
+template <Math::FloatingPoint T>
+constexpr bool Math::Inside(const Frustum<T>& f, const OrientedBounds3<T>& b)
+{
+    return Internal::Classify(f, b) == Internal::Containment::Inside;
+}
+
+template <Math::FloatingPoint T>
+constexpr bool Math::InsideInclusive(const OrientedBounds3<T>& b, const Point3<T>& p)
+{
+    const Vector3<T> offset = p - b.center;
+    return Math::Abs(Dot(offset, b.Axis(0))) <= b.half_extents.x &&
+           Math::Abs(Dot(offset, b.Axis(1))) <= b.half_extents.y &&
+           Math::Abs(Dot(offset, b.Axis(2))) <= b.half_extents.z;
+}
+
+template <Math::FloatingPoint T>
+constexpr bool Math::Intersect(const Ray<T>& ray,
+                               const OrientedBounds3<T>& b,
+                               T t_max,
+                               T& out_t0,
+                               T& out_t1)
+{
+    // The rotation is orthonormal, so the parameters along the rotated ray are the same.
+    const Vector3<T> offset = ray.origin - b.center;
+    const Ray<T> local(
+        Point3<T>(Dot(offset, b.Axis(0)), Dot(offset, b.Axis(1)), Dot(offset, b.Axis(2))),
+        Vector3<T>(Dot(ray.direction, b.Axis(0)), Dot(ray.direction, b.Axis(1)),
+                   Dot(ray.direction, b.Axis(2))));
+    const Point3<T> corner(b.half_extents.x, b.half_extents.y, b.half_extents.z);
+    return Intersect(local, Bounds3<T>(-corner, corner), t_max, out_t0, out_t1);
+}
+
+template <Math::FloatingPoint T>
+size_t Math::Overlaps(const OrientedBounds3<T>& query,
+                      std::type_identity_t<std::span<const OrientedBounds3<T>>> boxes,
+                      std::span<uint64_t> mask)
+{
+    auto test = [&](size_t i) { return Overlaps(query, boxes[i]); };
+#if MATH_SIMD_SSE2
+    if constexpr (std::is_same_v<T, float>)
+    {
+        auto test_block = [&](size_t i)
+        {
+            __m128 lanes[15];
+            Internal::LoadOrientedBounds4SSE(&boxes[i], lanes);
+            return Internal::OverlapsSSE(query, lanes);
+        };
+        return Internal::FillMask<4>(boxes.size(), mask, test_block, test);
+    }
+    else
+#endif
+    {
+        return Internal::FillMask(boxes.size(), mask, test);
+    }
+}
+
+template <Math::FloatingPoint T>
+size_t Math::Overlaps(const Frustum<T>& f,
+                      std::type_identity_t<std::span<const OrientedBounds3<T>>> boxes,
+                      std::span<uint64_t> mask)
+{
+    auto test = [&](size_t i) { return Overlaps(f, boxes[i]); };
+#if MATH_SIMD_SSE2
+    if constexpr (std::is_same_v<T, float>)
+    {
+        auto test_block = [&](size_t i)
+        {
+            __m128 box[15];
+            Internal::LoadOrientedBounds4SSE(&boxes[i], box);
+            __m128 outside = _mm_setzero_ps();
+            for (const Vector4<float>& plane : f.planes)
+            {
+                const __m128 x = _mm_set1_ps(plane.x);
+                const __m128 y = _mm_set1_ps(plane.y);
+                const __m128 z = _mm_set1_ps(plane.z);
+                // Summed in the order of Internal::Classify, so boxes touching a plane get the
+                // same result as the scalar test.
+                const __m128 distance = _mm_add_ps(
+                    Internal::MulAdd(box[2], z,
+                                     Internal::MulAdd(box[1], y, _mm_mul_ps(box[0], x))),
+                    _mm_set1_ps(plane.w));
+                __m128 radius = _mm_setzero_ps();
+                for (int axis = 0; axis < 3; ++axis)
+                {
+                    const __m128 projection = Internal::MulAdd(
+                        box[12 + axis], z,
+                        Internal::MulAdd(box[9 + axis], y, _mm_mul_ps(box[6 + axis], x)));
+                    const __m128 term = _mm_mul_ps(box[3 + axis], Internal::AbsSSE(projection));
+                    radius = axis == 0 ? term : _mm_add_ps(radius, term);
+                }
+                // The distance of the corner farthest along the normal.
+                const __m128 far_distance = _mm_add_ps(distance, radius);
+                outside = _mm_or_ps(outside, _mm_cmplt_ps(far_distance, _mm_setzero_ps()));
+            }
+            return ~_mm_movemask_ps(outside) & 0xF;
+        };
+        return Internal::FillMask<4>(boxes.size(), mask, test_block, test);
+    }
+    else
+#endif
+    {
+        return Internal::FillMask(boxes.size(), mask, test);
+    }
+}
+
+template <Math::FloatingPoint T>
+size_t Math::Intersect(const Ray<T>& ray,
+                       std::type_identity_t<std::span<const OrientedBounds3<T>>> boxes,
+                       T t_max,
+                       std::span<uint64_t> mask)
+{
+    auto test = [&](size_t i)
+    {
+        T t0;
+        T t1;
+        return Intersect(ray, boxes[i], t_max, t0, t1);
+    };
+#if MATH_SIMD_SSE2
+    if constexpr (std::is_same_v<T, float>)
+    {
+        const __m128 origin[3] = {_mm_set1_ps(ray.origin.x), _mm_set1_ps(ray.origin.y),
+                                  _mm_set1_ps(ray.origin.z)};
+        const __m128 direction[3] = {_mm_set1_ps(ray.direction.x), _mm_set1_ps(ray.direction.y),
+                                     _mm_set1_ps(ray.direction.z)};
+        const __m128 far_scale = _mm_set1_ps(1 + 2 * Gamma<float>(3));
+        auto test_block = [&](size_t i)
+        {
+            __m128 box[15];
+            Internal::LoadOrientedBounds4SSE(&boxes[i], box);
+            const __m128 offset[3] = {_mm_sub_ps(origin[0], box[0]),
+                                      _mm_sub_ps(origin[1], box[1]),
+                                      _mm_sub_ps(origin[2], box[2])};
+            __m128 t0 = _mm_setzero_ps();
+            __m128 t1 = _mm_set1_ps(t_max);
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                auto project = [&](const __m128 (&v)[3])
+                {
+                    return Internal::MulAdd(
+                        v[2], box[12 + axis],
+                        Internal::MulAdd(v[1], box[9 + axis], _mm_mul_ps(v[0], box[6 + axis])));
+                };
+                // The slab test of Intersect with the precomputed reciprocal, where the planes
+                // are picked by the sign of the direction. The max and min keep t0 and t1 when the
+                // distance is NaN, like the comparisons of the scalar test.
+                const __m128 inverse_direction = _mm_div_ps(_mm_set1_ps(1), project(direction));
+                const __m128 local_origin = project(offset);
+                const __m128 half = box[3 + axis];
+                const __m128 low = _mm_sub_ps(_mm_setzero_ps(), half);
+                const __m128 negative = _mm_cmplt_ps(inverse_direction, _mm_setzero_ps());
+                const __m128 near_plane = Internal::Select(negative, half, low);
+                const __m128 far_plane = Internal::Select(negative, low, half);
+                const __m128 t_near =
+                    _mm_mul_ps(_mm_sub_ps(near_plane, local_origin), inverse_direction);
+                const __m128 t_far = _mm_mul_ps(
+                    _mm_mul_ps(_mm_sub_ps(far_plane, local_origin), inverse_direction), far_scale);
+                t0 = _mm_max_ps(t_near, t0);
+                t1 = _mm_min_ps(t_far, t1);
+            }
+            return _mm_movemask_ps(_mm_cmple_ps(t0, t1));
+        };
+        return Internal::FillMask<4>(boxes.size(), mask, test_block, test);
+    }
+    else
+#endif
+    {
+        return Internal::FillMask(boxes.size(), mask, test);
+    }
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+#include "math/export.h"
+
+namespace Math
+{
+
+/**
+ * @brief Get the number of threads used by the parallel algorithms.
+ * @return The number of hardware threads, at least 1.
+ */
+MATH_EXPORT uint32_t ThreadCount();
+
+/**
+ * @brief Override the number of threads used by the parallel algorithms.
+ * @param count The number of threads. Pass 0 to use the number of hardware threads.
+ */
+MATH_EXPORT void SetThreadCount(uint32_t count);
+
+/**
+ * @brief Split the range [0, count) into contiguous batches and call func(begin, end) for every
+ * batch. The batches run concurrently, the calling thread runs one of them. Returns when all the
+ * batches are done. An exception thrown by func on the calling thread is rethrown once the other
+ * batches are done, func must not throw on the other threads.
+ * @param count The size of the range.
+ * @param min_batch_size The minimum number of elements in a batch. Small ranges run on the calling
+ * thread only, so that the threads are not started for little work.
+ * @param func The function to call for every batch.
+ */
+MATH_EXPORT void ParallelFor(size_t count,
+                             size_t min_batch_size,
+                             const std::function<void(size_t, size_t)>& func);
+
+}  // namespace Math
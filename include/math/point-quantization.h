@@ -0,0 +1,421 @@
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+#include "math/base.h"
+#include "math/bounds3.h"
+#include "math/point3.h"
+#include "math/simd.h"
+#include "math/vector3.h"
+
+namespace Math
+{
+
+/**
+ * Quantize a point to 16 bits per axis relative to a bounding box, half the size of Point3<float>.
+ * Every axis of the box is split in 65535 equal steps, the point is rounded to the nearest one.
+ * @param bounds The bounding box, usually the bounds of the chunk of points being stored.
+ * @param p The point. Points outside of the bounds are clamped to them.
+ * @return The quantized point.
+ * @see QuantizationError16
+ */
+template <FloatingPoint T>
+[[nodiscard]] constexpr Point3<uint16_t> QuantizePoint16(const Bounds3<T>& bounds,
+                                                         const Point3<T>& p);
+
+/**
+ * Get back a point quantized with QuantizePoint16.
+ * @param bounds The bounding box that the point was quantized with.
+ * @param q The quantized point.
+ * @return The point, within QuantizationError16(bounds) of the original point on every axis.
+ */
+template <FloatingPoint T>
+[[nodiscard]] constexpr Point3<T> DequantizePoint16(const Bounds3<T>& bounds,
+                                                    const Point3<uint16_t>& q);
+
+/**
+ * Quantize a point to 21 bits per axis relative to a bounding box, packed in 64 bits with x in the
+ * low bits and the top bit zero. Two thirds of the size of Point3<float>, with 32 times smaller
+ * steps than QuantizePoint16.
+ * @param bounds The bounding box.
+ * @param p The point. Points outside of the bounds are clamped to them.
+ * @return The quantized point.
+ * @see QuantizationError21
+ */
+template <FloatingPoint T>
+[[nodiscard]] constexpr uint64_t QuantizePoint21(const Bounds3<T>& bounds, const Point3<T>& p);
+
+/**
+ * Get back a point quantized with QuantizePoint21.
+ * @param bounds The bounding box that the point was quantized with.
+ * @param q The quantized point.
+ * @return The point, within QuantizationError21(bounds) of the original point on every axis.
+ */
+template <FloatingPoint T>
+[[nodiscard]] constexpr Point3<T> DequantizePoint21(const Bounds3<T>& bounds, uint64_t q);
+
+/**
+ * The largest distance on every axis between a point inside the bounds and the point after
+ * QuantizePoint16 and DequantizePoint16: half a step plus the rounding errors of the arithmetic in
+ * T, which matter when the bounds are far from the origin compared to their size.
+ * @param bounds The bounding box.
+ * @return The bound on the error of every axis.
+ */
+template <FloatingPoint T>
+[[nodiscard]] constexpr Vector3<T> QuantizationError16(const Bounds3<T>& bounds);
+
+/**
+ * The largest distance on every axis between a point inside the bounds and the point after
+ * QuantizePoint21 and DequantizePoint21, see QuantizationError16.
+ * @param bounds The bounding box.
+ * @return The bound on the error of every axis.
+ */
+template <FloatingPoint T>
+[[nodiscard]] constexpr Vector3<T> QuantizationError21(const Bounds3<T>& bounds);
+
+/**
+ * Quantize many points with QuantizePoint16, four at a time with SIMD.
+ * @param bounds The bounding box.
+ * @param points The points.
+ * @param result Where to store the quantized points. Must have the same size as points.
+ */
+template <FloatingPoint T>
+void QuantizePoint16(const Bounds3<T>& bounds,
+                     std::type_identity_t<std::span<const Point3<T>>> points,
+                     std::span<Point3<uint16_t>> result);
+
+/**
+ * Get back many points with DequantizePoint16, four at a time with SIMD.
+ * @param bounds The bounding box that the points were quantized with.
+ * @param quantized The quantized points.
+ * @param result Where to store the points. Must have the same size as quantized.
+ */
+template <FloatingPoint T>
+void DequantizePoint16(const Bounds3<T>& bounds,
+                       std::span<const Point3<uint16_t>> quantized,
+                       std::type_identity_t<std::span<Point3<T>>> result);
+
+/**
+ * Quantize many points with QuantizePoint21, four at a time with SIMD.
+ * @param bounds The bounding box.
+ * @param points The points.
+ * @param result Where to store the quantized points. Must have the same size as points.
+ */
+template <FloatingPoint T>
+void QuantizePoint21(const Bounds3<T>& bounds,
+                     std::type_identity_t<std::span<const Point3<T>>> points,
+                     std::span<uint64_t> result);
+
+/**
+ * Get back many points with DequantizePoint21, four at a time with SIMD.
+ * @param bounds The bounding box that the points were quantized with.
+ * @param quantized The quantized points.
+ * @param result Where to store the points. Must have the same size as quantized.
+ */
+template <FloatingPoint T>
+void DequantizePoint21(const Bounds3<T>& bounds,
+                       std::span<const uint64_t> quantized,
+                       std::type_identity_t<std::span<Point3<T>>> result);
+
+}  // namespace Math
+
+// Implementation //////////////////////////////////////////////////////////////////////////////////
+
+namespace Math::Internal
+{
+
+template <int32_t Bits>
+inline constexpr uint32_t k_quantized_max = (1u << Bits) - 1;
+
+/**
+ * Round the offset in [0, 1] to the nearest of 2^Bits equally spaced values, values outside are
+ * clamped.
+ */
+template <int32_t Bits, FloatingPoint T>
+constexpr uint32_t QuantizeOffset(T offset)
+{
+    const T scaled = Math::Clamp(offset, static_cast<T>(0), static_cast<T>(1)) *
+                     static_cast<T>(k_quantized_max<Bits>);
+    return static_cast<uint32_t>(scaled + static_cast<T>(0.5));
+}
+
+template <int32_t Bits, FloatingPoint T>
+constexpr Point3<uint32_t> QuantizePoint(const Bounds3<T>& bounds, const Point3<T>& p)
+{
+    const Vector3<T> offset = Offset(bounds, p);
+    return Point3<uint32_t>(QuantizeOffset<Bits>(offset.x), QuantizeOffset<Bits>(offset.y),
+                            QuantizeOffset<Bits>(offset.z));
+}
+
+template <int32_t Bits, FloatingPoint T>
+constexpr Point3<T> DequantizePoint(const Bounds3<T>& bounds, const Point3<uint32_t>& q)
+{
+    constexpr T k_inverse_max = 1 / static_cast<T>(k_quantized_max<Bits>);
+    return Lerp(bounds, Point3<T>(static_cast<T>(q.x) * k_inverse_max,
+                                  static_cast<T>(q.y) * k_inverse_max,
+                                  static_cast<T>(q.z) * k_inverse_max));
+}
+
+template <int32_t Bits, FloatingPoint T>
+constexpr Vector3<T> QuantizationError(const Bounds3<T>& bounds)
+{
+    // Half a step, plus a few roundings of the offset relative to the extent and of the
+    // interpolation relative to the magnitude of the corners.
+    const Vector3<T> extent = bounds.max - bounds.min;
+    const Vector3<T> magnitude = Abs(Vector3<T>(bounds.min.x, bounds.min.y, bounds.min.z)) +
+                                 Abs(Vector3<T>(bounds.max.x, bounds.max.y, bounds.max.z));
+    return extent * (static_cast<T>(0.5) / static_cast<T>(k_quantized_max<Bits>)) +
+           (extent + magnitude) * Gamma<T>(4);
+}
+
+constexpr uint64_t Pack21(const Point3<uint32_t>& q)
+{
+    return uint64_t{q.x} | (uint64_t{q.y} << 21) | (uint64_t{q.z} << 42);
+}
+
+constexpr Point3<uint32_t> Unpack21(uint64_t q)
+{
+    constexpr uint64_t k_mask = k_quantized_max<21>;
+    return Point3<uint32_t>(static_cast<uint32_t>(q & k_mask),
+                            static_cast<uint32_t>((q >> 21) & k_mask),
+                            static_cast<uint32_t>((q >> 42) & k_mask));
+}
+
+#if MATH_SIMD_SSE2
+
+/**
+ * The bounds in the form used by the SIMD quantization, with the same arithmetic as Offset and Lerp
+ * so that the results match the scalar functions.
+ */
+struct QuantizationBoundsSSE
+{
+    __m128 min[3];
+    __m128 max[3];
+    __m128 extent[3];
+
+    explicit QuantizationBoundsSSE(const Bounds3<float>& bounds)
+    {
+        for (int32_t axis = 0; axis < 3; ++axis)
+        {
+            const float extent_axis = bounds.max[axis] - bounds.min[axis];
+            min[axis] = _mm_set1_ps(bounds.min[axis]);
+            max[axis] = _mm_set1_ps(bounds.max[axis]);
+            // Offset leaves the axes of zero extent undivided, dividing by one does the same.
+            extent[axis] = _mm_set1_ps(bounds.max[axis] > bounds.min[axis] ? extent_axis : 1.0f);
+        }
+    }
+};
+
+template <int32_t Bits>
+__m128i QuantizeSSE(const QuantizationBoundsSSE& bounds, int32_t axis, __m128 p)
+{
+    const __m128 offset = _mm_div_ps(_mm_sub_ps(p, bounds.min[axis]), bounds.extent[axis]);
+    const __m128 clamped = _mm_min_ps(_mm_max_ps(offset, _mm_setzero_ps()), _mm_set1_ps(1.0f));
+    const __m128 scaled =
+        _mm_mul_ps(clamped, _mm_set1_ps(static_cast<float>(k_quantized_max<Bits>)));
+    return _mm_cvttps_epi32(_mm_add_ps(scaled, _mm_set1_ps(0.5f)));
+}
+
+template <int32_t Bits>
+__m128 DequantizeSSE(const QuantizationBoundsSSE& bounds, int32_t axis, __m128i q)
+{
+    constexpr float k_inverse_max = 1 / static_cast<float>(k_quantized_max<Bits>);
+    const __m128 t = _mm_mul_ps(_mm_cvtepi32_ps(q), _mm_set1_ps(k_inverse_max));
+    return _mm_add_ps(_mm_mul_ps(_mm_sub_ps(_mm_set1_ps(1.0f), t), bounds.min[axis]),
+                      _mm_mul_ps(t, bounds.max[axis]));
+}
+
+#endif
+
+}  // namespace Math::Internal
+
+template <Math::FloatingPoint T>
+constexpr Math::Point3<uint16_t> Math::QuantizePoint16(const Bounds3<T>& bounds, const Point3<T>& p)
+{
+    const Point3<uint32_t> q = Internal::QuantizePoint<16>(bounds, p);
+    return Point3<uint16_t>(static_cast<uint16_t>(q.x), static_cast<uint16_t>(q.y),
+                            static_cast<uint16_t>(q.z));
+}
+
+template <Math::FloatingPoint T>
+constexpr Math::Point3<T> Math::DequantizePoint16(const Bounds3<T>& bounds,
+                                                  const Point3<uint16_t>& q)
+{
+    return Internal::DequantizePoint<16>(bounds, Point3<uint32_t>(q.x, q.y, q.z));
+}
+
+template <Math::FloatingPoint T>
+constexpr uint64_t Math::QuantizePoint21(const Bounds3<T>& bounds, const Point3<T>& p)
+{
+    return Internal::Pack21(Internal::QuantizePoint<21>(bounds, p));
+}
+
+template <Math::FloatingPoint T>
+constexpr Math::Point3<T> Math::DequantizePoint21(const Bounds3<T>& bounds, uint64_t q)
+{
+    return Internal::DequantizePoint<21>(bounds, Internal::Unpack21(q));
+}
+
+template <Math::FloatingPoint T>
+constexpr Math::Vector3<T> Math::QuantizationError16(const Bounds3<T>& bounds)
+{
+    return Internal::QuantizationError<16>(bounds);
+}
+
+template <Math::FloatingPoint T>
+constexpr Math::Vector3<T> Math::QuantizationError21(const Bounds3<T>& bounds)
+{
+    return Internal::QuantizationError<21>(bounds);
+}
+
+template <Math::FloatingPoint T>
+void Math::QuantizePoint16(const Bounds3<T>& bounds,
+                           std::type_identity_t<std::span<const Point3<T>>> points,
+                           std::span<Point3<uint16_t>> result)
+{
+    assert(points.size() == result.size());
+    size_t i = 0;
+#if MATH_SIMD_SSE2
+    if constexpr (std::is_same_v<T, float>)
+    {
+        static_assert(sizeof(Point3<float>) == 3 * sizeof(float));
+        const Internal::QuantizationBoundsSSE simd_bounds(bounds);
+        for (; i + 4 <= points.size(); i += 4)
+        {
+            __m128 p[3];
+            Internal::Load3x4SSE(&points[i].x, p[0], p[1], p[2]);
+            // SSE2 has no 16-bit shuffles to interleave the axes, so scatter through memory.
+            alignas(16) uint32_t q[3][4];
+            for (int32_t axis = 0; axis < 3; ++axis)
+            {
+                _mm_store_si128(reinterpret_cast<__m128i*>(q[axis]),
+                                Internal::QuantizeSSE<16>(simd_bounds, axis, p[axis]));
+            }
+            for (size_t k = 0; k < 4; ++k)
+            {
+                result[i + k] = Point3<uint16_t>(static_cast<uint16_t>(q[0][k]),
+                                                 static_cast<uint16_t>(q[1][k]),
+                                                 static_cast<uint16_t>(q[2][k]));
+            }
+        }
+    }
+#endif
+    for (; i < points.size(); ++i)
+    {
+        result[i] = QuantizePoint16(bounds, points[i]);
+    }
+}
+
+template <Math::FloatingPoint T>
+void Math::DequantizePoint16(const Bounds3<T>& bounds,
+                             std::span<const Point3<uint16_t>> quantized,
+                             std::type_identity_t<std::span<Point3<T>>> result)
+{
+    assert(quantized.size() == result.size());
+    size_t i = 0;
+#if MATH_SIMD_SSE2
+    if constexpr (std::is_same_v<T, float>)
+    {
+        const Internal::QuantizationBoundsSSE simd_bounds(bounds);
+        for (; i + 4 <= quantized.size(); i += 4)
+        {
+            const Point3<uint16_t>* q = &quantized[i];
+            __m128 p[3];
+            for (int32_t axis = 0; axis < 3; ++axis)
+            {
+                const __m128i values = _mm_setr_epi32(q[0][axis], q[1][axis], q[2][axis],
+                                                      q[3][axis]);
+                p[axis] = Internal::DequantizeSSE<16>(simd_bounds, axis, values);
+            }
+            Internal::Store3x4SSE(&result[i].x, p[0], p[1], p[2]);
+        }
+    }
+#endif
+    for (; i < quantized.size(); ++i)
+    {
+        result[i] = DequantizePoint16(bounds, quantized[i]);
+    }
+}
+
+template <Math::FloatingPoint T>
+void Math::QuantizePoint21(const Bounds3<T>& bounds,
+                           std::type_identity_t<std::span<const Point3<T>>> points,
+                           std::span<uint64_t> result)
+{
+    assert(points.size() == result.size());
+    size_t i = 0;
+#if MATH_SIMD_SSE2
+    if constexpr (std::is_same_v<T, float>)
+    {
+        const Internal::QuantizationBoundsSSE simd_bounds(bounds);
+        for (; i + 4 <= points.size(); i += 4)
+        {
+            __m128 p[3];
+            Internal::Load3x4SSE(&points[i].x, p[0], p[1], p[2]);
+            const __m128i x = Internal::QuantizeSSE<21>(simd_bounds, 0, p[0]);
+            const __m128i y = Internal::QuantizeSSE<21>(simd_bounds, 1, p[1]);
+            const __m128i z = Internal::QuantizeSSE<21>(simd_bounds, 2, p[2]);
+            // Widen the lanes to 64 bits, two points at a time, and shift the axes in place.
+            const __m128i zero = _mm_setzero_si128();
+            auto pack = [](__m128i x64, __m128i y64, __m128i z64)
+            {
+                return _mm_or_si128(_mm_or_si128(x64, _mm_slli_epi64(y64, 21)),
+                                    _mm_slli_epi64(z64, 42));
+            };
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(&result[i]),
+                             pack(_mm_unpacklo_epi32(x, zero), _mm_unpacklo_epi32(y, zero),
+                                  _mm_unpacklo_epi32(z, zero)));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(&result[i + 2]),
+                             pack(_mm_unpackhi_epi32(x, zero), _mm_unpackhi_epi32(y, zero),
+                                  _mm_unpackhi_epi32(z, zero)));
+        }
+    }
+#endif
+    for (; i < points.size(); ++i)
+    {
+        result[i] = QuantizePoint21(bounds, points[i]);
+    }
+}
+
+template <Math::FloatingPoint T>
+void Math::DequantizePoint21(const Bounds3<T>& bounds,
+                             std::span<const uint64_t> quantized,
+                             std::type_identity_t<std::span<Point3<T>>> result)
+{
+    assert(quantized.size() == result.size());
+    size_t i = 0;
+#if MATH_SIMD_SSE2
+    if constexpr (std::is_same_v<T, float>)
+    {
+        const Internal::QuantizationBoundsSSE simd_bounds(bounds);
+        const __m128i mask = _mm_set1_epi32(static_cast<int32_t>(Internal::k_quantized_max<21>));
+        for (; i + 4 <= quantized.size(); i += 4)
+        {
+            // Shift every axis to the low 32 bits of the 64-bit lanes, then gather the low halves
+            // of the two registers in one.
+            const __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&quantized[i]));
+            const __m128i high =
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(&quantized[i + 2]));
+            auto gather = [&](int32_t shift)
+            {
+                const __m128i count = _mm_cvtsi32_si128(shift);
+                const __m128 a = _mm_castsi128_ps(_mm_srl_epi64(low, count));
+                const __m128 b = _mm_castsi128_ps(_mm_srl_epi64(high, count));
+                const __m128 low_halves = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+                return _mm_and_si128(_mm_castps_si128(low_halves), mask);
+            };
+            Internal::Store3x4SSE(&result[i].x,
+                                  Internal::DequantizeSSE<21>(simd_bounds, 0, gather(0)),
+                                  Internal::DequantizeSSE<21>(simd_bounds, 1, gather(21)),
+                                  Internal::DequantizeSSE<21>(simd_bounds, 2, gather(42)));
+        }
+    }
+#endif
+    for (; i < quantized.size(); ++i)
+    {
+        result[i] = DequantizePoint21(bounds, quantized[i]);
+    }
+}
@@ -0,0 +1,361 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "math/bounds3-batch.h"
+#include "math/bounds3.h"
+#include "math/matrix.h"
+#include "math/parallel.h"
+#include "math/point3.h"
+#include "math/simd.h"
+#include "math/vector3.h"
+
+namespace Math
+{
+
+/**
+ * Bounds, count, mean and covariance of a point set, accumulated in one streaming pass over chunks
+ * of points. Accumulators of different parts of the set, for example one per thread, are merged
+ * into the statistics of the whole set. The moments are kept in double with the method of Chan et
+ * al., which merges means and sums of squared deviations instead of raw sums, so the result stays
+ * accurate for 10^9 points far from the origin.
+ * Based on: Updating Formulae and a Pairwise Algorithm for Computing Sample Variances, Chan, Golub
+ * and LeVeque, 1979.
+ * @tparam T Type of the points.
+ */
+template <FloatingPoint T>
+class PointStatistics
+{
+public:
+    /**
+     * Constructs the statistics of the empty set.
+     */
+    PointStatistics();
+
+    /**
+     * Add one point.
+     * @param p The point.
+     */
+    void Add(const Point3<T>& p);
+
+    /**
+     * Add points, in chunks that are reduced with SIMD and then merged.
+     * @param points The points.
+     */
+    void Add(std::span<const Point3<T>> points);
+
+    /**
+     * Add the points of another accumulator.
+     * @param other The statistics of the other points.
+     */
+    void Merge(const PointStatistics& other);
+
+    /**
+     * @return The number of points.
+     */
+    [[nodiscard]] uint64_t Count() const;
+
+    /**
+     * @return The bounds of the points, the inverted box from +infinity to -infinity without
+     * points.
+     */
+    [[nodiscard]] const Bounds3<T>& Bounds() const;
+
+    /**
+     * @return The mean of the points, the origin without points.
+     */
+    [[nodiscard]] Point3<double> Mean() const;
+
+    /**
+     * @return The population covariance of the points, the sum of the outer products of the
+     * deviations from the mean divided by the count. Zero without points.
+     */
+    [[nodiscard]] Matrix3x3<double> Covariance() const;
+
+private:
+    void AddChunk(std::span<const Point3<T>> points);
+
+    Bounds3<T> m_bounds;
+    uint64_t m_count;
+    Vector3<double> m_mean;
+    /** Sums of the products of the deviations from the mean, xx, xy, xz, yy, yz and zz. */
+    std::array<double, 6> m_deviations;
+};
+
+/**
+ * Compute the statistics of the points in parallel on ThreadCount() threads. The points are split
+ * into fixed batches that are merged in order, so the result is the same for any thread count.
+ * @param points The points.
+ * @return The statistics.
+ */
+template <FloatingPoint T>
+[[nodiscard]] PointStatistics<T> ComputePointStatistics(
+    std::type_identity_t<std::span<const Point3<T>>> points);
+
+}  // namespace Math
+
+// Implementation //////////////////////////////////////////////////////////////////////////////////
+
+namespace Math::Internal
+{
+
+// Small enough for the chunk to stay in the first level cache between the passes.
+inline constexpr size_t k_point_statistics_chunk_size = 1024;
+inline constexpr size_t k_point_statistics_batch_size = 64 * 1024;
+
+#if MATH_SIMD_SSE2
+
+inline double HorizontalSumSSE(__m128d v)
+{
+    return _mm_cvtsd_f64(_mm_add_sd(v, _mm_unpackhi_pd(v, v)));
+}
+
+#endif
+
+}  // namespace Math::Internal
+
+template <Math::FloatingPoint T>
+Math::PointStatistics<T>::PointStatistics()
+    : m_bounds(Internal::InvertedBounds<T>()), m_count(0), m_mean(0, 0, 0), m_deviations{}
+{
+}
+
+template <Math::FloatingPoint T>
+void Math::PointStatistics<T>::Add(const Point3<T>& p)
+{
+    // Welford's update, the deviation from the old mean times the deviation from the new one.
+    m_bounds = Union(m_bounds, p);
+    ++m_count;
+    const Vector3<double> delta(static_cast<double>(p.x) - m_mean.x,
+                                static_cast<double>(p.y) - m_mean.y,
+                                static_cast<double>(p.z) - m_mean.z);
+    m_mean += delta / static_cast<double>(m_count);
+    const Vector3<double> delta_new(static_cast<double>(p.x) - m_mean.x,
+                                    static_cast<double>(p.y) - m_mean.y,
+                                    static_cast<double>(p.z) - m_mean.z);
+    m_deviations[0] += delta.x * delta_new.x;
+    m_deviations[1] += delta.x * delta_new.y;
+    m_deviations[2] += delta.x * delta_new.z;
+    m_deviations[3] += delta.y * delta_new.y;
+    m_deviations[4] += delta.y * delta_new.z;
+    m_deviations[5] += delta.z * delta_new.z;
+}
+
+template <Math::FloatingPoint T>
+void Math::PointStatistics<T>::Add(std::span<const Point3<T>> points)
+{
+    for (size_t i = 0; i < points.size(); i += Internal::k_point_statistics_chunk_size)
+    {
+        AddChunk(points.subspan(i, Math::Min(Internal::k_point_statistics_chunk_size,
+                                             points.size() - i)));
+    }
+}
+
+template <Math::FloatingPoint T>
+void Math::PointStatistics<T>::AddChunk(std::span<const Point3<T>> points)
+{
+    // Two passes over the chunk, the mean and then the deviations from it, give the statistics of
+    // the chunk, which are merged.
+    PointStatistics chunk;
+    chunk.m_count = points.size();
+    std::array<double, 3> sum = {0, 0, 0};
+    size_t i = 0;
+#if MATH_SIMD_SSE2
+    if constexpr (std::is_same_v<T, float>)
+    {
+        __m128 min_x = _mm_set1_ps(chunk.m_bounds.min.x);
+        __m128 min_y = min_x;
+        __m128 min_z = min_x;
+        __m128 max_x = _mm_set1_ps(chunk.m_bounds.max.x);
+        __m128 max_y = max_x;
+        __m128 max_z = max_x;
+        __m128d sum_x = _mm_setzero_pd();
+        __m128d sum_y = sum_x;
+        __m128d sum_z = sum_x;
+        for (; i + 4 <= points.size(); i += 4)
+        {
+            __m128 x, y, z;
+            Internal::Load3x4SSE(&points[i].x, x, y, z);
+            min_x = _mm_min_ps(min_x, x);
+            min_y = _mm_min_ps(min_y, y);
+            min_z = _mm_min_ps(min_z, z);
+            max_x = _mm_max_ps(max_x, x);
+            max_y = _mm_max_ps(max_y, y);
+            max_z = _mm_max_ps(max_z, z);
+            sum_x = _mm_add_pd(sum_x, _mm_cvtps_pd(x));
+            sum_x = _mm_add_pd(sum_x, _mm_cvtps_pd(_mm_movehl_ps(x, x)));
+            sum_y = _mm_add_pd(sum_y, _mm_cvtps_pd(y));
+            sum_y = _mm_add_pd(sum_y, _mm_cvtps_pd(_mm_movehl_ps(y, y)));
+            sum_z = _mm_add_pd(sum_z, _mm_cvtps_pd(z));
+            sum_z = _mm_add_pd(sum_z, _mm_cvtps_pd(_mm_movehl_ps(z, z)));
+        }
+        alignas(16) float lanes[6][4];
+        _mm_store_ps(lanes[0], min_x);
+        _mm_store_ps(lanes[1], min_y);
+        _mm_store_ps(lanes[2], min_z);
+        _mm_store_ps(lanes[3], max_x);
+        _mm_store_ps(lanes[4], max_y);
+        _mm_store_ps(lanes[5], max_z);
+        // Without a full group of four the lanes are still infinite.
+        for (int lane = 0; lane < (i > 0 ? 4 : 0); ++lane)
+        {
+            chunk.m_bounds = Union(chunk.m_bounds, Point3<T>(lanes[0][lane], lanes[1][lane],
+                                                             lanes[2][lane]));
+            chunk.m_bounds = Union(chunk.m_bounds, Point3<T>(lanes[3][lane], lanes[4][lane],
+                                                             lanes[5][lane]));
+        }
+        sum = {Internal::HorizontalSumSSE(sum_x), Internal::HorizontalSumSSE(sum_y),
+               Internal::HorizontalSumSSE(sum_z)};
+    }
+#endif
+    for (size_t j = i; j < points.size(); ++j)
+    {
+        chunk.m_bounds = Union(chunk.m_bounds, points[j]);
+        sum[0] += static_cast<double>(points[j].x);
+        sum[1] += static_cast<double>(points[j].y);
+        sum[2] += static_cast<double>(points[j].z);
+    }
+    const double inverse_count = 1.0 / static_cast<double>(points.size());
+    chunk.m_mean = Vector3<double>(sum[0] * inverse_count, sum[1] * inverse_count,
+                                   sum[2] * inverse_count);
+
+    std::array<double, 6>& d = chunk.m_deviations;
+    i = 0;
+#if MATH_SIMD_SSE2
+    if constexpr (std::is_same_v<T, float>)
+    {
+        const __m128d mean_x = _mm_set1_pd(chunk.m_mean.x);
+        const __m128d mean_y = _mm_set1_pd(chunk.m_mean.y);
+        const __m128d mean_z = _mm_set1_pd(chunk.m_mean.z);
+        __m128d products[6];
+        for (__m128d& product : products)
+        {
+            product = _mm_setzero_pd();
+        }
+        auto accumulate = [&](__m128d x, __m128d y, __m128d z)
+        {
+            x = _mm_sub_pd(x, mean_x);
+            y = _mm_sub_pd(y, mean_y);
+            z = _mm_sub_pd(z, mean_z);
+            products[0] = _mm_add_pd(products[0], _mm_mul_pd(x, x));
+            products[1] = _mm_add_pd(products[1], _mm_mul_pd(x, y));
+            products[2] = _mm_add_pd(products[2], _mm_mul_pd(x, z));
+            products[3] = _mm_add_pd(products[3], _mm_mul_pd(y, y));
+            products[4] = _mm_add_pd(products[4], _mm_mul_pd(y, z));
+            products[5] = _mm_add_pd(products[5], _mm_mul_pd(z, z));
+        };
+        for (; i + 4 <= points.size(); i += 4)
+        {
+            __m128 x, y, z;
+            Internal::Load3x4SSE(&points[i].x, x, y, z);
+            accumulate(_mm_cvtps_pd(x), _mm_cvtps_pd(y), _mm_cvtps_pd(z));
+            accumulate(_mm_cvtps_pd(_mm_movehl_ps(x, x)), _mm_cvtps_pd(_mm_movehl_ps(y, y)),
+                       _mm_cvtps_pd(_mm_movehl_ps(z, z)));
+        }
+        for (size_t k = 0; k < 6; ++k)
+        {
+            d[k] = Internal::HorizontalSumSSE(products[k]);
+        }
+    }
+#endif
+    for (; i < points.size(); ++i)
+    {
+        const double x = static_cast<double>(points[i].x) - chunk.m_mean.x;
+        const double y = static_cast<double>(points[i].y) - chunk.m_mean.y;
+        const double z = static_cast<double>(points[i].z) - chunk.m_mean.z;
+        d[0] += x * x;
+        d[1] += x * y;
+        d[2] += x * z;
+        d[3] += y * y;
+        d[4] += y * z;
+        d[5] += z * z;
+    }
+    Merge(chunk);
+}
+
+template <Math::FloatingPoint T>
+void Math::PointStatistics<T>::Merge(const PointStatistics& other)
+{
+    if (other.m_count == 0)
+    {
+        return;
+    }
+    m_bounds = Union(m_bounds, other.m_bounds);
+    const auto count = static_cast<double>(m_count);
+    const auto other_count = static_cast<double>(other.m_count);
+    const double total = count + other_count;
+    const Vector3<double> delta = other.m_mean - m_mean;
+    // The deviations of both sets grow by the spread between their means.
+    const double weight = count * other_count / total;
+    m_deviations[0] += other.m_deviations[0] + delta.x * delta.x * weight;
+    m_deviations[1] += other.m_deviations[1] + delta.x * delta.y * weight;
+    m_deviations[2] += other.m_deviations[2] + delta.x * delta.z * weight;
+    m_deviations[3] += other.m_deviations[3] + delta.y * delta.y * weight;
+    m_deviations[4] += other.m_deviations[4] + delta.y * delta.z * weight;
+    m_deviations[5] += other.m_deviations[5] + delta.z * delta.z * weight;
+    m_mean += delta * (other_count / total);
+    m_count += other.m_count;
+}
+
+template <Math::FloatingPoint T>
+uint64_t Math::PointStatistics<T>::Count() const
+{
+    return m_count;
+}
+
+template <Math::FloatingPoint T>
+const Math::Bounds3<T>& Math::PointStatistics<T>::Bounds() const
+{
+    return m_bounds;
+}
+
+template <Math::FloatingPoint T>
+Math::Point3<double> Math::PointStatistics<T>::Mean() const
+{
+    return Point3<double>(m_mean.x, m_mean.y, m_mean.z);
+}
+
+template <Math::FloatingPoint T>
+Math::Matrix3x3<double> Math::PointStatistics<T>::Covariance() const
+{
+    if (m_count == 0)
+    {
+        return Matrix3x3<double>(0);
+    }
+    const double inverse_count = 1.0 / static_cast<double>(m_count);
+    const std::array<double, 6>& d = m_deviations;
+    // clang-format off
+    return Matrix3x3<double>(d[0], d[1], d[2],
+                             d[1], d[3], d[4],
+                             d[2], d[4], d[5]) * inverse_count;
+    // clang-format on
+}
+
+template <Math::FloatingPoint T>
+Math::PointStatistics<T> Math::ComputePointStatistics(
+    std::type_identity_t<std::span<const Point3<T>>> points)
+{
+    constexpr size_t batch_size = Internal::k_point_statistics_batch_size;
+    std::vector<PointStatistics<T>> batches((points.size() + batch_size - 1) / batch_size);
+    ParallelFor(batches.size(), 1,
+                [&](size_t begin, size_t end)
+                {
+                    for (size_t b = begin; b < end; ++b)
+                    {
+                        const size_t first = b * batch_size;
+                        batches[b].Add(
+                            points.subspan(first, Math::Min(batch_size, points.size() - first)));
+                    }
+                });
+
+    PointStatistics<T> result;
+    for (const PointStatistics<T>& batch : batches)
+    {
+        result.Merge(batch);
+    }
+    return result;
+}
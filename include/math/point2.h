@@ -47,50 +47,50 @@ struct Point2
      * Returns a point with all components set to zero.
      * @return A point with all components set to zero.
      */
-    static Point2 Zero();
+    static constexpr Point2 Zero();
 
     /** Operators **/
-    T& operator[](int index);
-    const T& operator[](int index) const;
+    constexpr T& operator[](int index);
+    constexpr const T& operator[](int index) const;
 
-    bool operator==(const Point2& other) const;
-    bool operator!=(const Point2& other) const;
+    constexpr bool operator==(const Point2& other) const;
+    constexpr bool operator!=(const Point2& other) const;
 
-    Point2 operator+(const Vector2<T>& vec) const;
-    Point2& operator+=(const Vector2<T>& vec);
+    constexpr Point2 operator+(const Vector2<T>& vec) const;
+    constexpr Point2& operator+=(const Vector2<T>& vec);
 
-    Point2 operator-(const Vector2<T>& vec) const;
-    Vector2<T> operator-(const Point2& vec) const;
-    Point2& operator-=(const Vector2<T>& vec);
+    constexpr Point2 operator-(const Vector2<T>& vec) const;
+    constexpr Vector2<T> operator-(const Point2& vec) const;
+    constexpr Point2& operator-=(const Vector2<T>& vec);
 
-    Point2 operator-() const;
+    constexpr Point2 operator-() const;
 
     template <typename U>
-    Point2 operator*(U scalar) const;
+    constexpr Point2 operator*(U scalar) const;
     template <typename U>
-    Point2& operator*=(U scalar);
+    constexpr Point2& operator*=(U scalar);
     template <typename U>
-    Point2 operator/(U scalar) const;
+    constexpr Point2 operator/(U scalar) const;
     template <typename U>
-    Point2& operator/=(U scalar);
+    constexpr Point2& operator/=(U scalar);
 };
 
 template <typename T, typename U>
-Point2<T> operator*(U scalar, const Point2<T>& p);
+constexpr Point2<T> operator*(U scalar, const Point2<T>& p);
 
 /**
  * Checks if any of the components are NaN or infinite value.
  * @return True if any of the components are NaN or infinite value, false otherwise.
  */
 template <typename T>
-[[nodiscard]] bool ContainsNonFinite(const Point2<T>& p);
+[[nodiscard]] constexpr bool ContainsNonFinite(const Point2<T>& p);
 
 /**
  * Checks if any of the components are NaN.
  * @return True if any of the components are NaN, false otherwise.
  */
 template <typename T>
-[[nodiscard]] bool ContainsNaN(const Point2<T>& p);
+[[nodiscard]] constexpr bool ContainsNaN(const Point2<T>& p);
 
 /**
  * Returns a new point with the absolute value of each component.
@@ -99,7 +99,7 @@ template <typename T>
  * @return A new point with the absolute value of each component.
  */
 template <typename T>
-[[nodiscard]] Point2<T> Abs(const Point2<T>& p);
+[[nodiscard]] constexpr Point2<T> Abs(const Point2<T>& p);
 
 /**
  * Converts the point to euclidean space by dividing each component by the w component.
@@ -108,7 +108,7 @@ template <typename T>
  * @return The point in euclidean space.
  */
 template <typename T>
-[[nodiscard]] Point2<T> ToEuclidean(const Point2<T>& p);
+[[nodiscard]] constexpr Point2<T> ToEuclidean(const Point2<T>& p);
 
 /**
  * Checks if the points are equal within a given epsilon.
@@ -119,7 +119,7 @@ template <typename T>
  * @return True if the points are equal within a given epsilon, false otherwise.
  */
 template <typename T>
-bool IsEqual(const Point2<T>& p1, const Point2<T>& p2, T epsilon);
+constexpr bool IsEqual(const Point2<T>& p1, const Point2<T>& p2, T epsilon);
 
 /**
  * Calculates the distance between two points.
@@ -129,7 +129,7 @@ bool IsEqual(const Point2<T>& p1, const Point2<T>& p2, T epsilon);
  * @return The distance between the two points.
  */
 template <typename T>
-double Distance(const Point2<T>& p1, const Point2<T>& p2);
+constexpr double Distance(const Point2<T>& p1, const Point2<T>& p2);
 
 /**
  * Calculates the squared distance between two points.
@@ -139,7 +139,7 @@ double Distance(const Point2<T>& p1, const Point2<T>& p2);
  * @return The squared distance between the two points.
  */
 template <typename T>
-T DistanceSquared(const Point2<T>& p1, const Point2<T>& p2);
+constexpr T DistanceSquared(const Point2<T>& p1, const Point2<T>& p2);
 
 /**
  * Calculates the linear interpolation between two points.
@@ -150,7 +150,7 @@ T DistanceSquared(const Point2<T>& p1, const Point2<T>& p2);
  * @return The interpolated point.
  */
 template <typename T>
-Point2<T> Lerp(T t, const Point2<T>& p1, const Point2<T>& p2);
+constexpr Point2<T> Lerp(T t, const Point2<T>& p1, const Point2<T>& p2);
 
 /**
  * Returns the new point with the minimum components of the two points.
@@ -160,7 +160,7 @@ Point2<T> Lerp(T t, const Point2<T>& p1, const Point2<T>& p2);
  * @return The new point with the minimum components of the two points.
  */
 template <typename T>
-Point2<T> Min(const Point2<T>& p1, const Point2<T>& p2);
+constexpr Point2<T> Min(const Point2<T>& p1, const Point2<T>& p2);
 
 /**
  * Returns the new point with the maximum components of the two points.
@@ -170,7 +170,7 @@ Point2<T> Min(const Point2<T>& p1, const Point2<T>& p2);
  * @return The new point with the maximum components of the two points.
  */
 template <typename T>
-Point2<T> Max(const Point2<T>& p1, const Point2<T>& p2);
+constexpr Point2<T> Max(const Point2<T>& p1, const Point2<T>& p2);
 
 /**
  * Return the new point with permuted components.
@@ -181,7 +181,7 @@ Point2<T> Max(const Point2<T>& p1, const Point2<T>& p2);
  * @return The new point with permuted components.
  */
 template <typename T>
-Point2<T> Permute(const Point2<T>& p, int x, int y);
+constexpr Point2<T> Permute(const Point2<T>& p, int x, int y);
 
 /**
  * Returns the new point with each component floored.
@@ -190,7 +190,7 @@ Point2<T> Permute(const Point2<T>& p, int x, int y);
  * @return The new point with each component floored.
  */
 template <typename T>
-Point2<T> Floor(const Point2<T>& p);
+constexpr Point2<T> Floor(const Point2<T>& p);
 
 /**
  * Returns the new point with each component ceilinged.
@@ -199,7 +199,7 @@ Point2<T> Floor(const Point2<T>& p);
  * @return The new point with each component ceilinged.
  */
 template <typename T>
-Point2<T> Ceil(const Point2<T>& p);
+constexpr Point2<T> Ceil(const Point2<T>& p);
 
 /**
  * Returns the new point with each component rounded.
@@ -208,7 +208,7 @@ Point2<T> Ceil(const Point2<T>& p);
  * @return The new point with each component rounded.
  */
 template <typename T>
-Point2<T> Round(const Point2<T>& p);
+constexpr Point2<T> Round(const Point2<T>& p);
 
 }  // namespace Math
 
@@ -231,43 +231,53 @@ constexpr Math::Point2<T>::Point2(T xx, T yy) : x(xx), y(yy)
 }
 
 template <typename T>
-Math::Point2<T> Math::Point2<T>::Zero()
+constexpr Math::Point2<T> Math::Point2<T>::Zero()
 {
     return {0, 0};
 }
 
 template <typename T>
-T& Math::Point2<T>::operator[](int index)
+constexpr T& Math::Point2<T>::operator[](int index)
 {
+    // Reading the inactive array member of the union is not allowed in constant expressions.
+    if (std::is_constant_evaluated())
+    {
+        return index == 0 ? x : y;
+    }
     return data[index];
 }
 
 template <typename T>
-const T& Math::Point2<T>::operator[](int index) const
+constexpr const T& Math::Point2<T>::operator[](int index) const
 {
+    // Reading the inactive array member of the union is not allowed in constant expressions.
+    if (std::is_constant_evaluated())
+    {
+        return index == 0 ? x : y;
+    }
     return data[index];
 }
 
 template <typename T>
-bool Math::Point2<T>::operator==(const Point2& other) const
+constexpr bool Math::Point2<T>::operator==(const Point2& other) const
 {
     return x == other.x && y == other.y;
 }
 
 template <typename T>
-bool Math::Point2<T>::operator!=(const Point2& other) const
+constexpr bool Math::Point2<T>::operator!=(const Point2& other) const
 {
     return !(*this == other);
 }
 
 template <typename T>
-Math::Point2<T> Math::Point2<T>::operator+(const Vector2<T>& vec) const
+constexpr Math::Point2<T> Math::Point2<T>::operator+(const Vector2<T>& vec) const
 {
     return {x + vec.x, y + vec.y};
 }
 
 template <typename T>
-Math::Point2<T>& Math::Point2<T>::operator+=(const Vector2<T>& vec)
+constexpr Math::Point2<T>& Math::Point2<T>::operator+=(const Vector2<T>& vec)
 {
     x += vec.x;
     y += vec.y;
@@ -275,19 +285,19 @@ Math::Point2<T>& Math::Point2<T>::operator+=(const Vector2<T>& vec)
 }
 
 template <typename T>
-Math::Point2<T> Math::Point2<T>::operator-(const Vector2<T>& vec) const
+constexpr Math::Point2<T> Math::Point2<T>::operator-(const Vector2<T>& vec) const
 {
     return {x - vec.x, y - vec.y};
 }
 
 template <typename T>
-Math::Vector2<T> Math::Point2<T>::operator-(const Point2& vec) const
+constexpr Math::Vector2<T> Math::Point2<T>::operator-(const Point2& vec) const
 {
     return {x - vec.x, y - vec.y};
 }
 
 template <typename T>
-Math::Point2<T>& Math::Point2<T>::operator-=(const Vector2<T>& vec)
+constexpr Math::Point2<T>& Math::Point2<T>::operator-=(const Vector2<T>& vec)
 {
     x -= vec.x;
     y -= vec.y;
@@ -295,20 +305,20 @@ Math::Point2<T>& Math::Point2<T>::operator-=(const Vector2<T>& vec)
 }
 
 template <typename T>
-Math::Point2<T> Math::Point2<T>::operator-() const
+constexpr Math::Point2<T> Math::Point2<T>::operator-() const
 {
     return {-x, -y};
 }
 
 template <typename T, typename U>
-Math::Point2<T> Math::operator*(U scalar, const Point2<T>& p)
+constexpr Math::Point2<T> Math::operator*(U scalar, const Point2<T>& p)
 {
     return p * scalar;
 }
 
 template <typename T>
 template <typename U>
-Math::Point2<T> Math::Point2<T>::operator*(U scalar) const
+constexpr Math::Point2<T> Math::Point2<T>::operator*(U scalar) const
 {
     T sc = static_cast<T>(scalar);
     return {x * sc, y * sc};
@@ -316,7 +326,7 @@ Math::Point2<T> Math::Point2<T>::operator*(U scalar) const
 
 template <typename T>
 template <typename U>
-Math::Point2<T>& Math::Point2<T>::operator*=(U scalar)
+constexpr Math::Point2<T>& Math::Point2<T>::operator*=(U scalar)
 {
     T sc = static_cast<T>(scalar);
     x *= sc;
@@ -326,7 +336,7 @@ Math::Point2<T>& Math::Point2<T>::operator*=(U scalar)
 
 template <typename T>
 template <typename U>
-Math::Point2<T> Math::Point2<T>::operator/(U scalar) const
+constexpr Math::Point2<T> Math::Point2<T>::operator/(U scalar) const
 {
     if constexpr (std::is_integral_v<T>)
     {
@@ -342,7 +352,7 @@ Math::Point2<T> Math::Point2<T>::operator/(U scalar) const
 
 template <typename T>
 template <typename U>
-Math::Point2<T>& Math::Point2<T>::operator/=(U scalar)
+constexpr Math::Point2<T>& Math::Point2<T>::operator/=(U scalar)
 {
     if constexpr (std::is_integral_v<T>)
     {
@@ -361,99 +371,99 @@ Math::Point2<T>& Math::Point2<T>::operator/=(U scalar)
 }
 
 template <typename T>
-bool Math::ContainsNonFinite(const Point2<T>& p)
+constexpr bool Math::ContainsNonFinite(const Point2<T>& p)
 {
     return !Math::IsFinite(p.x) || !Math::IsFinite(p.y);
 }
 
 template <typename T>
-bool Math::ContainsNaN(const Point2<T>& p)
+constexpr bool Math::ContainsNaN(const Point2<T>& p)
 {
     return Math::IsNaN(p.x) || Math::IsNaN(p.y);
 }
 
 template <typename T>
-Math::Point2<T> Math::Abs(const Point2<T>& p)
+constexpr Math::Point2<T> Math::Abs(const Point2<T>& p)
 {
     return {Math::Abs(p.x), Math::Abs(p.y)};
 }
 
 template <typename T>
-bool Math::IsEqual(const Point2<T>& p1, const Point2<T>& p2, T epsilon)
+constexpr bool Math::IsEqual(const Point2<T>& p1, const Point2<T>& p2, T epsilon)
 {
     return Math::Abs(p1.x - p2.x) <= epsilon && Math::Abs(p1.y - p2.y) <= epsilon;
 }
 
 template <typename T>
-double Math::Distance(const Point2<T>& p1, const Point2<T>& p2)
+constexpr double Math::Distance(const Point2<T>& p1, const Point2<T>& p2)
 {
     return Length(p1 - p2);
 }
 
 template <typename T>
-T Math::DistanceSquared(const Point2<T>& p1, const Point2<T>& p2)
+constexpr T Math::DistanceSquared(const Point2<T>& p1, const Point2<T>& p2)
 {
     return LengthSquared(p1 - p2);
 }
 
 template <typename T>
-Math::Point2<T> Math::Lerp(T t, const Point2<T>& p1, const Point2<T>& p2)
+constexpr Math::Point2<T> Math::Lerp(T t, const Point2<T>& p1, const Point2<T>& p2)
 {
     return p1 + t * (p2 - p1);
 }
 
 template <typename T>
-Math::Point2<T> Math::Min(const Point2<T>& p1, const Point2<T>& p2)
+constexpr Math::Point2<T> Math::Min(const Point2<T>& p1, const Point2<T>& p2)
 {
     return {Math::Min(p1.x, p2.x), Math::Min(p1.y, p2.y)};
 }
 
 template <typename T>
-Math::Point2<T> Math::Max(const Point2<T>& p1, const Point2<T>& p2)
+constexpr Math::Point2<T> Math::Max(const Point2<T>& p1, const Point2<T>& p2)
 {
     return {Math::Max(p1.x, p2.x), Math::Max(p1.y, p2.y)};
 }
 
 template <typename T>
-Math::Point2<T> Math::Permute(const Point2<T>& p, int x, int y)
+constexpr Math::Point2<T> Math::Permute(const Point2<T>& p, int x, int y)
 {
     return {p[x], p[y]};
 }
 
 template <typename T>
-Math::Point2<T> Math::Floor(const Point2<T>& p)
+constexpr Math::Point2<T> Math::Floor(const Point2<T>& p)
 {
     if constexpr (std::is_integral_v<T>)
     {
         return p;
     }
-    if constexpr (std::is_floating_point_v<T>)
+    if constexpr (FloatingPoint<T>)
     {
         return {Math::Floor(p.x), Math::Floor(p.y)};
     }
 }
 
 template <typename T>
-Math::Point2<T> Math::Ceil(const Point2<T>& p)
+constexpr Math::Point2<T> Math::Ceil(const Point2<T>& p)
 {
     if constexpr (std::is_integral_v<T>)
     {
         return p;
     }
-    if constexpr (std::is_floating_point_v<T>)
+    if constexpr (FloatingPoint<T>)
     {
         return {Math::Ceil(p.x), Math::Ceil(p.y)};
     }
 }
 
 template <typename T>
-Math::Point2<T> Math::Round(const Point2<T>& p)
+constexpr Math::Point2<T> Math::Round(const Point2<T>& p)
 {
     if constexpr (std::is_integral_v<T>)
     {
         return p;
     }
-    if constexpr (std::is_floating_point_v<T>)
+    if constexpr (FloatingPoint<T>)
     {
         return {Math::Round(p.x), Math::Round(p.y)};
     }
@@ -48,50 +48,50 @@ struct Point3
      * Returns a point with all components set to zero.
      * @return A point with all components set to zero.
      */
-    static Point3 Zero();
+    static constexpr Point3 Zero();
 
     /** Operators **/
-    T& operator[](int index);
-    const T& operator[](int index) const;
+    constexpr T& operator[](int index);
+    constexpr const T& operator[](int index) const;
 
-    bool operator==(const Point3& other) const;
-    bool operator!=(const Point3& other) const;
+    constexpr bool operator==(const Point3& other) const;
+    constexpr bool operator!=(const Point3& other) const;
 
-    Point3 operator+(const Vector3<T>& vec) const;
-    Point3& operator+=(const Vector3<T>& vec);
+    constexpr Point3 operator+(const Vector3<T>& vec) const;
+    constexpr Point3& operator+=(const Vector3<T>& vec);
 
-    Point3 operator-(const Vector3<T>& vec) const;
-    Vector3<T> operator-(const Point3& other) const;
-    Point3& operator-=(const Vector3<T>& vec);
+    constexpr Point3 operator-(const Vector3<T>& vec) const;
+    constexpr Vector3<T> operator-(const Point3& other) const;
+    constexpr Point3& operator-=(const Vector3<T>& vec);
 
-    Point3 operator-() const;
+    constexpr Point3 operator-() const;
 
     template <typename U>
-    Point3 operator*(U scalar) const;
+    constexpr Point3 operator*(U scalar) const;
     template <typename U>
-    Point3& operator*=(U scalar);
+    constexpr Point3& operator*=(U scalar);
     template <typename U>
-    Point3 operator/(U scalar) const;
+    constexpr Point3 operator/(U scalar) const;
     template <typename U>
-    Point3& operator/=(U scalar);
+    constexpr Point3& operator/=(U scalar);
 };
 
 template <typename T, typename U>
-Point3<T> operator*(U scalar, const Point3<T>& p);
+constexpr Point3<T> operator*(U scalar, const Point3<T>& p);
 
 /**
  * Checks if any of the components are NaN or infinite value.
  * @return True if any of the components are NaN or infinite value, false otherwise.
  */
 template <typename T>
-[[nodiscard]] bool ContainsNonFinite(const Point3<T>& p);
+[[nodiscard]] constexpr bool ContainsNonFinite(const Point3<T>& p);
 
 /**
  * Checks if any of the components are NaN.
  * @return True if any of the components are NaN, false otherwise.
  */
 template <typename T>
-[[nodiscard]] bool ContainsNaN(const Point3<T>& p);
+[[nodiscard]] constexpr bool ContainsNaN(const Point3<T>& p);
 
 /**
  * Returns a new point with the absolute value of each component.
@@ -100,7 +100,7 @@ template <typename T>
  * @return A new point with the absolute value of each component.
  */
 template <typename T>
-[[nodiscard]] Point3<T> Abs(const Point3<T>& p);
+[[nodiscard]] constexpr Point3<T> Abs(const Point3<T>& p);
 
 /**
  * Converts the point to euclidean space by dividing each component by the w component.
@@ -109,7 +109,7 @@ template <typename T>
  * @return The point in euclidean space.
  */
 template <typename T>
-[[nodiscard]] Point3<T> ToEuclidean(const Point3<T>& p);
+[[nodiscard]] constexpr Point3<T> ToEuclidean(const Point3<T>& p);
 
 /**
  * Checks if the points are equal within a given epsilon.
@@ -120,7 +120,7 @@ template <typename T>
  * @return True if the points are equal within a given epsilon, false otherwise.
  */
 template <typename T>
-bool IsEqual(const Point3<T>& p1, const Point3<T>& p2, T epsilon);
+constexpr bool IsEqual(const Point3<T>& p1, const Point3<T>& p2, T epsilon);
 
 /**
  * Calculates the distance between two points.
@@ -130,7 +130,7 @@ bool IsEqual(const Point3<T>& p1, const Point3<T>& p2, T epsilon);
  * @return The distance between the two points.
  */
 template <typename T>
-double Distance(const Point3<T>& p1, const Point3<T>& p2);
+constexpr double Distance(const Point3<T>& p1, const Point3<T>& p2);
 
 /**
  * Calculates the squared distance between two points.
@@ -140,7 +140,7 @@ double Distance(const Point3<T>& p1, const Point3<T>& p2);
  * @return The squared distance between the two points.
  */
 template <typename T>
-T DistanceSquared(const Point3<T>& p1, const Point3<T>& p2);
+constexpr T DistanceSquared(const Point3<T>& p1, const Point3<T>& p2);
 
 /**
  * Calculates the linear interpolation between two points.
@@ -151,7 +151,7 @@ T DistanceSquared(const Point3<T>& p1, const Point3<T>& p2);
  * @return The interpolated point.
  */
 template <typename T>
-Point3<T> Lerp(T t, const Point3<T>& p1, const Point3<T>& p2);
+constexpr Point3<T> Lerp(T t, const Point3<T>& p1, const Point3<T>& p2);
 
 /**
  * Returns the new point with the minimum components of the two points.
@@ -161,7 +161,7 @@ Point3<T> Lerp(T t, const Point3<T>& p1, const Point3<T>& p2);
  * @return The new point with the minimum components of the two points.
  */
 template <typename T>
-Point3<T> Min(const Point3<T>& p1, const Point3<T>& p2);
+constexpr Point3<T> Min(const Point3<T>& p1, const Point3<T>& p2);
 
 /**
  * Returns the new point with the maximum components of the two points.
@@ -171,7 +171,7 @@ Point3<T> Min(const Point3<T>& p1, const Point3<T>& p2);
  * @return The new point with the maximum components of the two points.
  */
 template <typename T>
-Point3<T> Max(const Point3<T>& p1, const Point3<T>& p2);
+constexpr Point3<T> Max(const Point3<T>& p1, const Point3<T>& p2);
 
 /**
  * Return the new point with permuted components.
@@ -183,7 +183,7 @@ Point3<T> Max(const Point3<T>& p1, const Point3<T>& p2);
  * @return The new point with permuted components.
  */
 template <typename T>
-Point3<T> Permute(const Point3<T>& p, int x, int y, int z);
+constexpr Point3<T> Permute(const Point3<T>& p, int x, int y, int z);
 
 /**
  * Returns the new point with each component floored.
@@ -192,7 +192,7 @@ Point3<T> Permute(const Point3<T>& p, int x, int y, int z);
  * @return The new point with each component floored.
  */
 template <typename T>
-Point3<T> Floor(const Point3<T>& p);
+constexpr Point3<T> Floor(const Point3<T>& p);
 
 /**
  * Returns the new point with each component ceilinged.
@@ -201,7 +201,7 @@ Point3<T> Floor(const Point3<T>& p);
  * @return The new point with each component ceilinged.
  */
 template <typename T>
-Point3<T> Ceil(const Point3<T>& p);
+constexpr Point3<T> Ceil(const Point3<T>& p);
 
 /**
  * Returns the new point with each component rounded.
@@ -210,7 +210,7 @@ Point3<T> Ceil(const Point3<T>& p);
  * @return The new point with each component rounded.
  */
 template <typename T>
-Point3<T> Round(const Point3<T>& p);
+constexpr Point3<T> Round(const Point3<T>& p);
 
 }  // namespace Math
 
@@ -233,43 +233,53 @@ constexpr Math::Point3<T>::Point3(T xx, T yy, T zz) : x(xx), y(yy), z(zz)
 }
 
 template <typename T>
-Math::Point3<T> Math::Point3<T>::Zero()
+constexpr Math::Point3<T> Math::Point3<T>::Zero()
 {
     return {0, 0, 0};
 }
 
 template <typename T>
-T& Math::Point3<T>::operator[](int index)
+constexpr T& Math::Point3<T>::operator[](int index)
 {
+    // Reading the inactive array member of the union is not allowed in constant expressions.
+    if (std::is_constant_evaluated())
+    {
+        return index == 0 ? x : (index == 1 ? y : z);
+    }
     return data[index];
 }
 
 template <typename T>
-const T& Math::Point3<T>::operator[](int index) const
+constexpr const T& Math::Point3<T>::operator[](int index) const
 {
+    // Reading the inactive array member of the union is not allowed in constant expressions.
+    if (std::is_constant_evaluated())
+    {
+        return index == 0 ? x : (index == 1 ? y : z);
+    }
     return data[index];
 }
 
 template <typename T>
-bool Math::Point3<T>::operator==(const Point3& other) const
+constexpr bool Math::Point3<T>::operator==(const Point3& other) const
 {
     return x == other.x && y == other.y && z == other.z;
 }
 
 template <typename T>
-bool Math::Point3<T>::operator!=(const Point3& other) const
+constexpr bool Math::Point3<T>::operator!=(const Point3& other) const
 {
     return !(*this == other);
 }
 
 template <typename T>
-Math::Point3<T> Math::Point3<T>::operator+(const Vector3<T>& vec) const
+constexpr Math::Point3<T> Math::Point3<T>::operator+(const Vector3<T>& vec) const
 {
     return {x + vec.x, y + vec.y, z + vec.z};
 }
 
 template <typename T>
-Math::Point3<T>& Math::Point3<T>::operator+=(const Vector3<T>& vec)
+constexpr Math::Point3<T>& Math::Point3<T>::operator+=(const Vector3<T>& vec)
 {
     x += vec.x;
     y += vec.y;
@@ -278,19 +288,19 @@ Math::Point3<T>& Math::Point3<T>::operator+=(const Vector3<T>& vec)
 }
 
 template <typename T>
-Math::Point3<T> Math::Point3<T>::operator-(const Vector3<T>& vec) const
+constexpr Math::Point3<T> Math::Point3<T>::operator-(const Vector3<T>& vec) const
 {
     return {x - vec.x, y - vec.y, z - vec.z};
 }
 
 template <typename T>
-Math::Vector3<T> Math::Point3<T>::operator-(const Point3& other) const
+constexpr Math::Vector3<T> Math::Point3<T>::operator-(const Point3& other) const
 {
     return {x - other.x, y - other.y, z - other.z};
 }
 
 template <typename T>
-Math::Point3<T>& Math::Point3<T>::operator-=(const Vector3<T>& vec)
+constexpr Math::Point3<T>& Math::Point3<T>::operator-=(const Vector3<T>& vec)
 {
     x -= vec.x;
     y -= vec.y;
@@ -299,20 +309,20 @@ Math::Point3<T>& Math::Point3<T>::operator-=(const Vector3<T>& vec)
 }
 
 template <typename T>
-Math::Point3<T> Math::Point3<T>::operator-() const
+constexpr Math::Point3<T> Math::Point3<T>::operator-() const
 {
     return {-x, -y, -z};
 }
 
 template <typename T, typename U>
-Math::Point3<T> Math::operator*(U scalar, const Point3<T>& p)
+constexpr Math::Point3<T> Math::operator*(U scalar, const Point3<T>& p)
 {
     return p * scalar;
 }
 
 template <typename T>
 template <typename U>
-Math::Point3<T> Math::Point3<T>::operator*(U scalar) const
+constexpr Math::Point3<T> Math::Point3<T>::operator*(U scalar) const
 {
     T sc = static_cast<T>(scalar);
     return {x * sc, y * sc, z * sc};
@@ -320,7 +330,7 @@ Math::Point3<T> Math::Point3<T>::operator*(U scalar) const
 
 template <typename T>
 template <typename U>
-Math::Point3<T>& Math::Point3<T>::operator*=(U scalar)
+constexpr Math::Point3<T>& Math::Point3<T>::operator*=(U scalar)
 {
     T sc = static_cast<T>(scalar);
     x *= sc;
@@ -331,7 +341,7 @@ Math::Point3<T>& Math::Point3<T>::operator*=(U scalar)
 
 template <typename T>
 template <typename U>
-Math::Point3<T> Math::Point3<T>::operator/(U scalar) const
+constexpr Math::Point3<T> Math::Point3<T>::operator/(U scalar) const
 {
     if constexpr (std::is_integral_v<T>)
     {
@@ -347,7 +357,7 @@ Math::Point3<T> Math::Point3<T>::operator/(U scalar) const
 
 template <typename T>
 template <typename U>
-Math::Point3<T>& Math::Point3<T>::operator/=(U scalar)
+constexpr Math::Point3<T>& Math::Point3<T>::operator/=(U scalar)
 {
     if constexpr (std::is_integral_v<T>)
     {
@@ -368,100 +378,100 @@ Math::Point3<T>& Math::Point3<T>::operator/=(U scalar)
 }
 
 template <typename T>
-bool Math::ContainsNonFinite(const Point3<T>& p)
+constexpr bool Math::ContainsNonFinite(const Point3<T>& p)
 {
     return !Math::IsFinite(p.x) || !Math::IsFinite(p.y) || !Math::IsFinite(p.z);
 }
 
 template <typename T>
-bool Math::ContainsNaN(const Point3<T>& p)
+constexpr bool Math::ContainsNaN(const Point3<T>& p)
 {
     return Math::IsNaN(p.x) || Math::IsNaN(p.y) || Math::IsNaN(p.z);
 }
 
 template <typename T>
-Math::Point3<T> Math::Abs(const Point3<T>& p)
+constexpr Math::Point3<T> Math::Abs(const Point3<T>& p)
 {
     return {Math::Abs(p.x), Math::Abs(p.y), Math::Abs(p.z)};
 }
 
 template <typename T>
-bool Math::IsEqual(const Point3<T>& p1, const Point3<T>& p2, T epsilon)
+constexpr bool Math::IsEqual(const Point3<T>& p1, const Point3<T>& p2, T epsilon)
 {
     return Math::Abs(p1.x - p2.x) <= epsilon && Math::Abs(p1.y - p2.y) <= epsilon &&
            Math::Abs(p1.z - p2.z) <= epsilon;
 }
 
 template <typename T>
-double Math::Distance(const Point3<T>& p1, const Point3<T>& p2)
+constexpr double Math::Distance(const Point3<T>& p1, const Point3<T>& p2)
 {
     return Length(p1 - p2);
 }
 
 template <typename T>
-T Math::DistanceSquared(const Point3<T>& p1, const Point3<T>& p2)
+constexpr T Math::DistanceSquared(const Point3<T>& p1, const Point3<T>& p2)
 {
     return LengthSquared(p1 - p2);
 }
 
 template <typename T>
-Math::Point3<T> Math::Lerp(T t, const Point3<T>& p1, const Point3<T>& p2)
+constexpr Math::Point3<T> Math::Lerp(T t, const Point3<T>& p1, const Point3<T>& p2)
 {
     return p1 + t * (p2 - p1);
 }
 
 template <typename T>
-Math::Point3<T> Math::Min(const Point3<T>& p1, const Point3<T>& p2)
+constexpr Math::Point3<T> Math::Min(const Point3<T>& p1, const Point3<T>& p2)
 {
     return {Math::Min(p1.x, p2.x), Math::Min(p1.y, p2.y), Math::Min(p1.z, p2.z)};
 }
 
 template <typename T>
-Math::Point3<T> Math::Max(const Point3<T>& p1, const Point3<T>& p2)
+constexpr Math::Point3<T> Math::Max(const Point3<T>& p1, const Point3<T>& p2)
 {
     return {Math::Max(p1.x, p2.x), Math::Max(p1.y, p2.y), Math::Max(p1.z, p2.z)};
 }
 
 template <typename T>
-Math::Point3<T> Math::Permute(const Point3<T>& p, int x, int y, int z)
+constexpr Math::Point3<T> Math::Permute(const Point3<T>& p, int x, int y, int z)
 {
     return {p[x], p[y], p[z]};
 }
 
 template <typename T>
-Math::Point3<T> Math::Floor(const Point3<T>& p)
+constexpr Math::Point3<T> Math::Floor(const Point3<T>& p)
 {
     if constexpr (std::is_integral_v<T>)
     {
         return p;
     }
-    if constexpr (std::is_floating_point_v<T>)
+    if constexpr (FloatingPoint<T>)
     {
         return {Math::Floor(p.x), Math::Floor(p.y), Math::Floor(p.z)};
     }
 }
 
 template <typename T>
-Math::Point3<T> Math::Ceil(const Point3<T>& p)
+constexpr Math::Point3<T> Math::Ceil(const Point3<T>& p)
 {
     if constexpr (std::is_integral_v<T>)
     {
         return p;
     }
-    if constexpr (std::is_floating_point_v<T>)
+    if constexpr (FloatingPoint<T>)
     {
         return {Math::Ceil(p.x), Math::Ceil(p.y), Math::Ceil(p.z)};
     }
 }
 
 template <typename T>
-Math::Point3<T> Math::Round(const Point3<T>& p)
+constexpr Math::Point3<T> Math::Round(const Point3<T>& p)
 {
     if constexpr (std::is_integral_v<T>)
     {
         return p;
     }
-    if constexpr (std::is_floating_point_v<T>)
+    if constexpr (FloatingPoint<T>)
     {
         return {Math::Round(p.x), Math::Round(p.y), Math::Round(p.z)};
     }
@@ -49,50 +49,50 @@ struct Point4
      * Returns a point with all components set to zero.
      * @return A point with all components set to zero.
      */
-    static Point4 Zero();
+    static constexpr Point4 Zero();
 
     /** Operators **/
-    T& operator[](int index);
-    const T& operator[](int index) const;
+    constexpr T& operator[](int index);
+    constexpr const T& operator[](int index) const;
 
-    bool operator==(const Point4& other) const;
-    bool operator!=(const Point4& other) const;
+    constexpr bool operator==(const Point4& other) const;
+    constexpr bool operator!=(const Point4& other) const;
 
-    Point4 operator+(const Vector4<T>& vec) const;
-    Point4& operator+=(const Vector4<T>& vec);
+    constexpr Point4 operator+(const Vector4<T>& vec) const;
+    constexpr Point4& operator+=(const Vector4<T>& vec);
 
-    Point4 operator-(const Vector4<T>& vec) const;
-    Vector4<T> operator-(const Point4& other) const;
-    Point4& operator-=(const Vector4<T>& vec);
+    constexpr Point4 operator-(const Vector4<T>& vec) const;
+    constexpr Vector4<T> operator-(const Point4& other) const;
+    constexpr Point4& operator-=(const Vector4<T>& vec);
 
-    Point4 operator-() const;
+    constexpr Point4 operator-() const;
 
     template <typename U>
-    Point4 operator*(U scalar) const;
+    constexpr Point4 operator*(U scalar) const;
     template <typename U>
-    Point4& operator*=(U scalar);
+    constexpr Point4& operator*=(U scalar);
     template <typename U>
-    Point4 operator/(U scalar) const;
+    constexpr Point4 operator/(U scalar) const;
     template <typename U>
-    Point4& operator/=(U scalar);
+    constexpr Point4& operator/=(U scalar);
 };
 
 template <typename T, typename U>
-Point4<T> operator*(U scalar, const Point4<T>& p);
+constexpr Point4<T> operator*(U scalar, const Point4<T>& p);
 
 /**
  * Checks if any of the components are NaN or infinite value.
  * @return True if any of the components are NaN or infinite value, false otherwise.
  */
 template <typename T>
-[[nodiscard]] bool ContainsNonFinite(const Point4<T>& p);
+[[nodiscard]] constexpr bool ContainsNonFinite(const Point4<T>& p);
 
 /**
  * Checks if any of the components are NaN.
  * @return True if any of the components are NaN, false otherwise.
  */
 template <typename T>
-[[nodiscard]] bool ContainsNaN(const Point4<T>& p);
+[[nodiscard]] constexpr bool ContainsNaN(const Point4<T>& p);
 
 /**
  * Returns a new point with the absolute value of each component.
@@ -101,7 +101,7 @@ template <typename T>
  * @return A new point with the absolute value of each component.
  */
 template <typename T>
-[[nodiscard]] Point4<T> Abs(const Point4<T>& p);
+[[nodiscard]] constexpr Point4<T> Abs(const Point4<T>& p);
 
 /**
  * Converts the point to euclidean space by dividing each component by the w component.
@@ -110,7 +110,7 @@ template <typename T>
  * @return The point in euclidean space.
  */
 template <typename T>
-[[nodiscard]] Point4<T> ToEuclidean(const Point4<T>& p);
+[[nodiscard]] constexpr Point4<T> ToEuclidean(const Point4<T>& p);
 
 /**
  * Checks if the points are equal within a given epsilon.
@@ -121,7 +121,7 @@ template <typename T>
  * @return True if the points are equal within a given epsilon, false otherwise.
  */
 template <typename T>
-bool IsEqual(const Point4<T>& p1, const Point4<T>& p2, T epsilon);
+constexpr bool IsEqual(const Point4<T>& p1, const Point4<T>& p2, T epsilon);
 
 /**
  * Calculates the distance between two points.
@@ -131,7 +131,7 @@ bool IsEqual(const Point4<T>& p1, const Point4<T>& p2, T epsilon);
  * @return The distance between the two points.
  */
 template <typename T>
-double Distance(const Point4<T>& p1, const Point4<T>& p2);
+constexpr double Distance(const Point4<T>& p1, const Point4<T>& p2);
 
 /**
  * Calculates the squared distance between two points.
@@ -141,7 +141,7 @@ double Distance(const Point4<T>& p1, const Point4<T>& p2);
  * @return The squared distance between the two points.
  */
 template <typename T>
-T DistanceSquared(const Point4<T>& p1, const Point4<T>& p2);
+constexpr T DistanceSquared(const Point4<T>& p1, const Point4<T>& p2);
 
 /**
  * Calculates the linear interpolation between two points.
@@ -152,7 +152,7 @@ T DistanceSquared(const Point4<T>& p1, const Point4<T>& p2);
  * @return The interpolated point.
  */
 template <typename T>
-Point4<T> Lerp(T t, const Point4<T>& p1, const Point4<T>& p2);
+constexpr Point4<T> Lerp(T t, const Point4<T>& p1, const Point4<T>& p2);
 
 /**
  * Returns the new point with the minimum components of the two points.
@@ -162,7 +162,7 @@ Point4<T> Lerp(T t, const Point4<T>& p1, const Point4<T>& p2);
  * @return The new point with the minimum components of the two points.
  */
 template <typename T>
-Point4<T> Min(const Point4<T>& p1, const Point4<T>& p2);
+constexpr Point4<T> Min(const Point4<T>& p1, const Point4<T>& p2);
 
 /**
  * Returns the new point with the maximum components of the two points.
@@ -172,7 +172,7 @@ Point4<T> Min(const Point4<T>& p1, const Point4<T>& p2);
  * @return The new point with the maximum components of the two points.
  */
 template <typename T>
-Point4<T> Max(const Point4<T>& p1, const Point4<T>& p2);
+constexpr Point4<T> Max(const Point4<T>& p1, const Point4<T>& p2);
 
 /**
  * Return the new point with permuted components.
@@ -185,7 +185,7 @@ Point4<T> Max(const Point4<T>& p1, const Point4<T>& p2);
  * @return The new point with permuted components.
  */
 template <typename T>
-Point4<T> Permute(const Point4<T>& p, int x, int y, int z, int w);
+constexpr Point4<T> Permute(const Point4<T>& p, int x, int y, int z, int w);
 
 /**
  * Returns the new point with each component floored.
@@ -194,7 +194,7 @@ Point4<T> Permute(const Point4<T>& p, int x, int y, int z, int w);
  * @return The new point with each component floored.
  */
 template <typename T>
-Point4<T> Floor(const Point4<T>& p);
+constexpr Point4<T> Floor(const Point4<T>& p);
 
 /**
  * Returns the new point with each component ceilinged.
@@ -203,7 +203,7 @@ Point4<T> Floor(const Point4<T>& p);
  * @return The new point with each component ceilinged.
  */
 template <typename T>
-Point4<T> Ceil(const Point4<T>& p);
+constexpr Point4<T> Ceil(const Point4<T>& p);
 
 /**
  * Returns the new point with each component rounded.
@@ -212,7 +212,7 @@ Point4<T> Ceil(const Point4<T>& p);
  * @return The new point with each component rounded.
  */
 template <typename T>
-Point4<T> Round(const Point4<T>& p);
+constexpr Point4<T> Round(const Point4<T>& p);
 
 }  // namespace Math
 
@@ -235,43 +235,53 @@ constexpr Math::Point4<T>::Point4(T xx, T yy, T zz, T ww) : x(xx), y(yy), z(zz),
 }
 
 template <typename T>
-Math::Point4<T> Math::Point4<T>::Zero()
+constexpr Math::Point4<T> Math::Point4<T>::Zero()
 {
     return {0, 0, 0, 0};
 }
 
 template <typename T>
-T& Math::Point4<T>::operator[](int index)
+constexpr T& Math::Point4<T>::operator[](int index)
 {
+    // Reading the inactive array member of the union is not allowed in constant expressions.
+    if (std::is_constant_evaluated())
+    {
+        return index == 0 ? x : (index == 1 ? y : (index == 2 ? z : w));
+    }
     return data[index];
 }
 
 template <typename T>
-const T& Math::Point4<T>::operator[](int index) const
+constexpr const T& Math::Point4<T>::operator[](int index) const
 {
+    // Reading the inactive array member of the union is not allowed in constant expressions.
+    if (std::is_constant_evaluated())
+    {
+        return index == 0 ? x : (index == 1 ? y : (index == 2 ? z : w));
+    }
     return data[index];
 }
 
 template <typename T>
-bool Math::Point4<T>::operator==(const Point4& other) const
+constexpr bool Math::Point4<T>::operator==(const Point4& other) const
 {
     return x == other.x && y == other.y && z == other.z && w == other.w;
 }
 
 template <typename T>
-bool Math::Point4<T>::operator!=(const Point4& other) const
+constexpr bool Math::Point4<T>::operator!=(const Point4& other) const
 {
     return !(*this == other);
 }
 
 template <typename T>
-Math::Point4<T> Math::Point4<T>::operator+(const Vector4<T>& vec) const
+constexpr Math::Point4<T> Math::Point4<T>::operator+(const Vector4<T>& vec) const
 {
     return {x + vec.x, y + vec.y, z + vec.z, w + vec.w};
 }
 
 template <typename T>
-Math::Point4<T>& Math::Point4<T>::operator+=(const Vector4<T>& vec)
+constexpr Math::Point4<T>& Math::Point4<T>::operator+=(const Vector4<T>& vec)
 {
     x += vec.x;
     y += vec.y;
@@ -281,19 +291,19 @@ Math::Point4<T>& Math::Point4<T>::operator+=(const Vector4<T>& vec)
 }
 
 template <typename T>
-Math::Point4<T> Math::Point4<T>::operator-(const Vector4<T>& vec) const
+constexpr Math::Point4<T> Math::Point4<T>::operator-(const Vector4<T>& vec) const
 {
     return {x - vec.x, y - vec.y, z - vec.z, w - vec.w};
 }
 
 template <typename T>
-Math::Vector4<T> Math::Point4<T>::operator-(const Point4& other) const
+constexpr Math::Vector4<T> Math::Point4<T>::operator-(const Point4& other) const
 {
     return {x - other.x, y - other.y, z - other.z, w - other.w};
 }
 
 template <typename T>
-Math::Point4<T>& Math::Point4<T>::operator-=(const Vector4<T>& vec)
+constexpr Math::Point4<T>& Math::Point4<T>::operator-=(const Vector4<T>& vec)
 {
     x -= vec.x;
     y -= vec.y;
@@ -303,20 +313,20 @@ Math::Point4<T>& Math::Point4<T>::operator-=(const Vector4<T>& vec)
 }
 
 template <typename T>
-Math::Point4<T> Math::Point4<T>::operator-() const
+constexpr Math::Point4<T> Math::Point4<T>::operator-() const
 {
     return {-x, -y, -z, -w};
 }
 
 template <typename T, typename U>
-Math::Point4<T> Math::operator*(U scalar, const Point4<T>& p)
+constexpr Math::Point4<T> Math::operator*(U scalar, const Point4<T>& p)
 {
     return p * scalar;
 }
 
 template <typename T>
 template <typename U>
-Math::Point4<T> Math::Point4<T>::operator*(U scalar) const
+constexpr Math::Point4<T> Math::Point4<T>::operator*(U scalar) const
 {
     T sc = static_cast<T>(scalar);
     return {x * sc, y * sc, z * sc, w * sc};
@@ -324,7 +334,7 @@ Math::Point4<T> Math::Point4<T>::operator*(U scalar) const
 
 template <typename T>
 template <typename U>
-Math::Point4<T>& Math::Point4<T>::operator*=(U scalar)
+constexpr Math::Point4<T>& Math::Point4<T>::operator*=(U scalar)
 {
     T sc = static_cast<T>(scalar);
     x *= sc;
@@ -336,7 +346,7 @@ Math::Point4<T>& Math::Point4<T>::operator*=(U scalar)
 
 template <typename T>
 template <typename U>
-Math::Point4<T> Math::Point4<T>::operator/(U scalar) const
+constexpr Math::Point4<T> Math::Point4<T>::operator/(U scalar) const
 {
     if constexpr (std::is_integral_v<T>)
     {
@@ -352,7 +362,7 @@ Math::Point4<T> Math::Point4<T>::operator/(U scalar) const
 
 template <typename T>
 template <typename U>
-Math::Point4<T>& Math::Point4<T>::operator/=(U scalar)
+constexpr Math::Point4<T>& Math::Point4<T>::operator/=(U scalar)
 {
     if constexpr (std::is_integral_v<T>)
     {
@@ -375,28 +385,28 @@ Math::Point4<T>& Math::Point4<T>::operator/=(U scalar)
 }
 
 template <typename T>
-bool Math::ContainsNonFinite(const Point4<T>& p)
+constexpr bool Math::ContainsNonFinite(const Point4<T>& p)
 {
     return !Math::IsFinite(p.x) || !Math::IsFinite(p.y) || !Math::IsFinite(p.z) ||
            !Math::IsFinite(p.w);
 }
 
 template <typename T>
-bool Math::ContainsNaN(const Point4<T>& p)
+constexpr bool Math::ContainsNaN(const Point4<T>& p)
 {
     return Math::IsNaN(p.x) || Math::IsNaN(p.y) || Math::IsNaN(p.z) || Math::IsNaN(p.w);
 }
 
 template <typename T>
-Math::Point4<T> Math::Abs(const Point4<T>& p)
+constexpr Math::Point4<T> Math::Abs(const Point4<T>& p)
 {
     return {Math::Abs(p.x), Math::Abs(p.y), Math::Abs(p.z), Math::Abs(p.w)};
 }
 
 template <typename T>
-Math::Point4<T> Math::ToEuclidean(const Point4<T>& p)
+constexpr Math::Point4<T> Math::ToEuclidean(const Point4<T>& p)
 {
-    if constexpr (std::is_floating_point_v<T>)
+    if constexpr (FloatingPoint<T>)
     {
         const T div = 1 / p.w;
         return {p.x * div, p.y * div, p.z * div, 1};
@@ -408,84 +418,84 @@ Math::Point4<T> Math::ToEuclidean(const Point4<T>& p)
 }
 
 template <typename T>
-bool Math::IsEqual(const Point4<T>& p1, const Point4<T>& p2, T epsilon)
+constexpr bool Math::IsEqual(const Point4<T>& p1, const Point4<T>& p2, T epsilon)
 {
     return Math::Abs(p1.x - p2.x) <= epsilon && Math::Abs(p1.y - p2.y) <= epsilon &&
            Math::Abs(p1.z - p2.z) <= epsilon && Math::Abs(p1.w - p2.w) <= epsilon;
 }
 
 template <typename T>
-double Math::Distance(const Point4<T>& p1, const Point4<T>& p2)
+constexpr double Math::Distance(const Point4<T>& p1, const Point4<T>& p2)
 {
     return Length(p1 - p2);
 }
 
 template <typename T>
-T Math::DistanceSquared(const Point4<T>& p1, const Point4<T>& p2)
+constexpr T Math::DistanceSquared(const Point4<T>& p1, const Point4<T>& p2)
 {
     return LengthSquared(p1 - p2);
 }
 
 template <typename T>
-Math::Point4<T> Math::Lerp(T t, const Point4<T>& p1, const Point4<T>& p2)
+constexpr Math::Point4<T> Math::Lerp(T t, const Point4<T>& p1, const Point4<T>& p2)
 {
     return p1 + t * (p2 - p1);
 }
 
 template <typename T>
-Math::Point4<T> Math::Min(const Point4<T>& p1, const Point4<T>& p2)
+constexpr Math::Point4<T> Math::Min(const Point4<T>& p1, const Point4<T>& p2)
 {
     return {Math::Min(p1.x, p2.x), Math::Min(p1.y, p2.y), Math::Min(p1.z, p2.z),
             Math::Min(p1.w, p2.w)};
 }
 
 template <typename T>
-Math::Point4<T> Math::Max(const Point4<T>& p1, const Point4<T>& p2)
+constexpr Math::Point4<T> Math::Max(const Point4<T>& p1, const Point4<T>& p2)
 {
     return {Math::Max(p1.x, p2.x), Math::Max(p1.y, p2.y), Math::Max(p1.z, p2.z),
             Math::Max(p1.w, p2.w)};
 }
 
 template <typename T>
-Math::Point4<T> Math::Permute(const Point4<T>& p, int x, int y, int z, int w)
+constexpr Math::Point4<T> Math::Permute(const Point4<T>& p, int x, int y, int z, int w)
 {
     return {p[x], p[y], p[z], p[w]};
 }
 
 template <typename T>
-Math::Point4<T> Math::Floor(const Point4<T>& p)
+constexpr Math::Point4<T> Math::Floor(const Point4<T>& p)
 {
     if constexpr (std::is_integral_v<T>)
     {
         return p;
     }
-    if constexpr (std::is_floating_point_v<T>)
+    if constexpr (FloatingPoint<T>)
     {
         return {Math::Floor(p.x), Math::Floor(p.y), Math::Floor(p.z), Math::Floor(p.w)};
     }
 }
 
 template <typename T>
-Math::Point4<T> Math::Ceil(const Point4<T>& p)
+constexpr Math::Point4<T> Math::Ceil(const Point4<T>& p)
 {
     if constexpr (std::is_integral_v<T>)
     {
         return p;
     }
-    if constexpr (std::is_floating_point_v<T>)
+    if constexpr (FloatingPoint<T>)
     {
         return {Math::Ceil(p.x), Math::Ceil(p.y), Math::Ceil(p.z), Math::Ceil(p.w)};
     }
 }
 
 template <typename T>
-Math::Point4<T> Math::Round(const Point4<T>& p)
+constexpr Math::Point4<T> Math::Round(const Point4<T>& p)
 {
     if constexpr (std::is_integral_v<T>)
     {
         return p;
     }
-    if constexpr (std::is_floating_point_v<T>)
+    if constexpr (FloatingPoint<T>)
     {
         return {Math::Round(p.x), Math::Round(p.y), Math::Round(p.z), Math::Round(p.w)};
     }
@@ -13,7 +13,7 @@ namespace Math
  * @param far Distance from a viewer to the far clipping plane. Always positive or zero.
  */
 template <Math::FloatingPoint T>
-Matrix4x4<T> Orthographic_LH_N0(T left, T right, T bottom, T top, T near, T far);
+constexpr Matrix4x4<T> Orthographic_LH_N0(T left, T right, T bottom, T top, T near, T far);
 
 /**
  * Create an orthographic projection matrix for left-handed coordinate system where Z maps between
@@ -23,7 +23,7 @@ Matrix4x4<T> Orthographic_LH_N0(T left, T right, T bottom, T top, T near, T far)
  * @param far Distance from a viewer to the far clipping plane. Always positive or zero.
  */
 template <Math::FloatingPoint T>
-Matrix4x4<T> Orthographic_LH_N1(T left, T right, T bottom, T top, T near, T far);
+constexpr Matrix4x4<T> Orthographic_LH_N1(T left, T right, T bottom, T top, T near, T far);
 
 /**
  * Create an orthographic projection matrix for right-handed coordinate system where Z maps between
@@ -33,7 +33,7 @@ Matrix4x4<T> Orthographic_LH_N1(T left, T right, T bottom, T top, T near, T far)
  * @param far Distance from a viewer to the far clipping plane. Always positive or zero.
  */
 template <Math::FloatingPoint T>
-Matrix4x4<T> Orthographic_RH_N0(T left, T right, T bottom, T top, T near, T far);
+constexpr Matrix4x4<T> Orthographic_RH_N0(T left, T right, T bottom, T top, T near, T far);
 
 /**
  * Create an orthographic projection matrix for right-handed coordinate system where Z maps between
@@ -43,7 +43,7 @@ Matrix4x4<T> Orthographic_RH_N0(T left, T right, T bottom, T top, T near, T far)
  * @param far Distance from a viewer to the far clipping plane. Always positive or zero.
  */
 template <Math::FloatingPoint T>
-Matrix4x4<T> Orthographic_RH_N1(T left, T right, T bottom, T top, T near, T far);
+constexpr Matrix4x4<T> Orthographic_RH_N1(T left, T right, T bottom, T top, T near, T far);
 
 /**
  * Create a perspective projection matrix for left-handed coordinate system where Z maps between 0
@@ -56,7 +56,7 @@ Matrix4x4<T> Orthographic_RH_N1(T left, T right, T bottom, T top, T near, T far)
  * @param far Distance from a viewer to the far clipping plane. Always positive.
  */
 template <Math::FloatingPoint T>
-Matrix4x4<T> Perspective_LH_N0(T vertical_fov, T aspect_ratio, T near, T far);
+constexpr Matrix4x4<T> Perspective_LH_N0(T vertical_fov, T aspect_ratio, T near, T far);
 
 /**
  * Create a perspective projection matrix for left-handed coordinate system where Z maps between -1
@@ -69,7 +69,7 @@ Matrix4x4<T> Perspective_LH_N0(T vertical_fov, T aspect_ratio, T near, T far);
  * @param far Distance from a viewer to the far clipping plane. Always positive.
  */
 template <Math::FloatingPoint T>
-Matrix4x4<T> Perspective_LH_N1(T vertical_fov, T aspect_ratio, T near, T far);
+constexpr Matrix4x4<T> Perspective_LH_N1(T vertical_fov, T aspect_ratio, T near, T far);
 
 /**
  * Create a perspective projection matrix for right-handed coordinate system where Z maps between 0
@@ -82,7 +82,7 @@ Matrix4x4<T> Perspective_LH_N1(T vertical_fov, T aspect_ratio, T near, T far);
  * @param far Distance from a viewer to the far clipping plane. Always positive.
  */
 template <Math::FloatingPoint T>
-Matrix4x4<T> Perspective_RH_N0(T vertical_fov, T aspect_ratio, T near, T far);
+constexpr Matrix4x4<T> Perspective_RH_N0(T vertical_fov, T aspect_ratio, T near, T far);
 
 /**
  * Create a perspective projection matrix for right-handed coordinate system where Z maps between -1
@@ -95,14 +95,19 @@ Matrix4x4<T> Perspective_RH_N0(T vertical_fov, T aspect_ratio, T near, T far);
  * @param far Distance from a viewer to the far clipping plane. Always positive.
  */
 template <Math::FloatingPoint T>
-Matrix4x4<T> Perspective_RH_N1(T vertical_fov, T aspect_ratio, T near, T far);
+constexpr Matrix4x4<T> Perspective_RH_N1(T vertical_fov, T aspect_ratio, T near, T far);
 
 }  // namespace Math
 
 // Implementation //////////////////////////////////////////////////////////////////////////////////
 
 template <Math::FloatingPoint T>
-Math::Matrix4x4<T> Math::Orthographic_LH_N0(T left, T right, T bottom, T top, T near, T far)
+constexpr Math::Matrix4x4<T> Math::Orthographic_LH_N0(T left,
+                                                      T right,
+                                                      T bottom,
+                                                      T top,
+                                                      T near,
+                                                      T far)
 {
     Matrix4x4<T> mat(1);
     mat.elements[0][0] = 2 / (right - left);
@@ -115,7 +120,12 @@ Math::Matrix4x4<T> Math::Orthographic_LH_N0(T left, T right, T bottom, T top, T
 }
 
 template <Math::FloatingPoint T>
-Math::Matrix4x4<T> Math::Orthographic_LH_N1(T left, T right, T bottom, T top, T near, T far)
+constexpr Math::Matrix4x4<T> Math::Orthographic_LH_N1(T left,
+                                                      T right,
+                                                      T bottom,
+                                                      T top,
+                                                      T near,
+                                                      T far)
 {
     Matrix4x4<T> mat(1);
     mat.elements[0][0] = 2 / (right - left);
@@ -128,7 +138,12 @@ Math::Matrix4x4<T> Math::Orthographic_LH_N1(T left, T right, T bottom, T top, T
 }
 
 template <Math::FloatingPoint T>
-Math::Matrix4x4<T> Math::Orthographic_RH_N0(T left, T right, T bottom, T top, T near, T far)
+constexpr Math::Matrix4x4<T> Math::Orthographic_RH_N0(T left,
+                                                      T right,
+                                                      T bottom,
+                                                      T top,
+                                                      T near,
+                                                      T far)
 {
     Matrix4x4<T> mat(1);
     mat.elements[0][0] = 2 / (right - left);
@@ -141,7 +156,12 @@ Math::Matrix4x4<T> Math::Orthographic_RH_N0(T left, T right, T bottom, T top, T
 }
 
 template <Math::FloatingPoint T>
-Math::Matrix4x4<T> Math::Orthographic_RH_N1(T left, T right, T bottom, T top, T near, T far)
+constexpr Math::Matrix4x4<T> Math::Orthographic_RH_N1(T left,
+                                                      T right,
+                                                      T bottom,
+                                                      T top,
+                                                      T near,
+                                                      T far)
 {
     Matrix4x4<T> mat(1);
     mat.elements[0][0] = 2 / (right - left);
@@ -154,7 +174,7 @@ Math::Matrix4x4<T> Math::Orthographic_RH_N1(T left, T right, T bottom, T top, T
 }
 
 template <Math::FloatingPoint T>
-Math::Matrix4x4<T> Math::Perspective_LH_N0(T vertical_fov, T aspect_ratio, T near, T far)
+constexpr Math::Matrix4x4<T> Math::Perspective_LH_N0(T vertical_fov, T aspect_ratio, T near, T far)
 {
     assert(aspect_ratio != 0);
 
@@ -172,7 +192,7 @@ Math::Matrix4x4<T> Math::Perspective_LH_N0(T vertical_fov, T aspect_ratio, T nea
 }
 
 template <Math::FloatingPoint T>
-Math::Matrix4x4<T> Math::Perspective_LH_N1(T vertical_fov, T aspect_ratio, T near, T far)
+constexpr Math::Matrix4x4<T> Math::Perspective_LH_N1(T vertical_fov, T aspect_ratio, T near, T far)
 {
     assert(aspect_ratio != 0);
 
@@ -190,7 +210,7 @@ Math::Matrix4x4<T> Math::Perspective_LH_N1(T vertical_fov, T aspect_ratio, T nea
 }
 
 template <Math::FloatingPoint T>
-Math::Matrix4x4<T> Math::Perspective_RH_N0(T vertical_fov, T aspect_ratio, T near, T far)
+constexpr Math::Matrix4x4<T> Math::Perspective_RH_N0(T vertical_fov, T aspect_ratio, T near, T far)
 {
     assert(aspect_ratio != 0);
 
@@ -212,7 +232,7 @@ Math::Matrix4x4<T> Math::Perspective_RH_N0(T vertical_fov, T aspect_ratio, T nea
 }
 
 template <Math::FloatingPoint T>
-Math::Matrix4x4<T> Math::Perspective_RH_N1(T vertical_fov, T aspect_ratio, T near, T far)
+constexpr Math::Matrix4x4<T> Math::Perspective_RH_N1(T vertical_fov, T aspect_ratio, T near, T far)
 {
     assert(aspect_ratio != 0);
 
@@ -0,0 +1,633 @@
+#pragma once
+
+#include <span>
+#include <type_traits>
+
+#include "math/quaternion.h"
+#include "math/simd.h"
+
+namespace Math
+{
+
+/**
+ * Non-owning view of Quaternions stored as a structure of arrays, one contiguous array per
+ * component. This is the layout used by the batch functions since it lets them process several
+ * Quaternions with one SIMD instruction. All the arrays need to have the same size.
+ * @tparam T Type of the components. Use a const type for a read-only view.
+ */
+template <typename T>
+struct QuaternionSoA
+{
+    std::span<T> x;
+    std::span<T> y;
+    std::span<T> z;
+    std::span<T> w;
+
+    /**
+     * Constructs an empty view.
+     */
+    constexpr QuaternionSoA() = default;
+
+    /**
+     * Constructs a view of the component arrays.
+     * @param x_values The i parts of the Quaternions.
+     * @param y_values The j parts of the Quaternions.
+     * @param z_values The k parts of the Quaternions.
+     * @param w_values The real parts of the Quaternions.
+     */
+    constexpr QuaternionSoA(std::span<T> x_values,
+                            std::span<T> y_values,
+                            std::span<T> z_values,
+                            std::span<T> w_values);
+
+    /**
+     * Constructs a read-only view from a mutable view.
+     */
+    template <typename U>
+        requires std::is_same_v<T, const U>
+    constexpr QuaternionSoA(const QuaternionSoA<U>& other);
+
+    /**
+     * @return The number of Quaternions in the view.
+     */
+    [[nodiscard]] constexpr size_t Size() const;
+
+    /**
+     * Gather the components of one Quaternion.
+     * @param index The index of the Quaternion.
+     * @return The Quaternion at the index.
+     */
+    [[nodiscard]] constexpr Quaternion<std::remove_const_t<T>> Get(size_t index) const;
+
+    /**
+     * Scatter the components of one Quaternion.
+     * @param index The index of the Quaternion.
+     * @param q The Quaternion to store at the index.
+     */
+    constexpr void Set(size_t index, const Quaternion<std::remove_const_t<T>>& q) const
+        requires(!std::is_const_v<T>);
+};
+
+/**
+ * Perform spherical linear interpolation for every pair of Quaternions. The result at index i is
+ * the interpolation between q1[i] and q2[i] with parameter params[i].
+ * @tparam T Type of the Quaternions.
+ * @param params Parameters to interpolate with. Should be between 0 and 1.
+ * @param q1 First Quaternions. Need to have unit length.
+ * @param q2 Second Quaternions. Need to have unit length.
+ * @param result Where to write the interpolated Quaternions. May be the same arrays as q1 or q2.
+ * @note Unlike the scalar Slerp this always interpolates along the shortest path, q2[i] is negated
+ * when it is in the opposite hemisphere from q1[i]. The acos and sin are replaced by polynomial
+ * approximations and the result is renormalized, the components differ from the exact Slerp by less
+ * than 1e-6.
+ * @see Slerp
+ */
+template <Math::FloatingPoint T>
+void Slerp(std::type_identity_t<std::span<const T>> params,
+           std::type_identity_t<QuaternionSoA<const T>> q1,
+           std::type_identity_t<QuaternionSoA<const T>> q2,
+           const QuaternionSoA<T>& result);
+
+/**
+ * Perform normalized linear interpolation for every pair of Quaternions. The result at index i is
+ * the interpolation between q1[i] and q2[i] with parameter params[i].
+ * @tparam T Type of the Quaternions.
+ * @param params Parameters to interpolate with. Should be between 0 and 1.
+ * @param q1 First Quaternions.
+ * @param q2 Second Quaternions.
+ * @param result Where to write the interpolated Quaternions. May be the same arrays as q1 or q2.
+ * @note This is the batch version of Lerp, but it always interpolates along the shortest path,
+ * q2[i] is negated when it is in the opposite hemisphere from q1[i].
+ * @see Lerp
+ */
+template <Math::FloatingPoint T>
+void Nlerp(std::type_identity_t<std::span<const T>> params,
+           std::type_identity_t<QuaternionSoA<const T>> q1,
+           std::type_identity_t<QuaternionSoA<const T>> q2,
+           const QuaternionSoA<T>& result);
+
+/**
+ * Compose every pair of Quaternions, result[i] = q1[i] * q2[i].
+ * @tparam T Type of the Quaternions.
+ * @param q1 First Quaternions.
+ * @param q2 Second Quaternions.
+ * @param result Where to write the products. May be the same span as q1 or q2.
+ */
+template <Math::FloatingPoint T>
+void Multiply(std::span<const Quaternion<T>> q1,
+              std::span<const Quaternion<T>> q2,
+              std::span<Quaternion<T>> result);
+
+/**
+ * Compose every pair of Quaternions, result[i] = q1[i] * q2[i].
+ * @tparam T Type of the Quaternions.
+ * @param q1 First Quaternions.
+ * @param q2 Second Quaternions.
+ * @param result Where to write the products. May be the same arrays as q1 or q2.
+ */
+template <Math::FloatingPoint T>
+void Multiply(std::type_identity_t<QuaternionSoA<const T>> q1,
+              std::type_identity_t<QuaternionSoA<const T>> q2,
+              const QuaternionSoA<T>& result);
+
+/**
+ * Natural logarithm of every Quaternion.
+ * @tparam T Type of the Quaternions.
+ * @param q The Quaternions. Can't have a magnitude of 0.
+ * @param result Where to write the logarithms. May be the same arrays as q.
+ * @see Log
+ */
+template <Math::FloatingPoint T>
+void Log(std::type_identity_t<QuaternionSoA<const T>> q, const QuaternionSoA<T>& result);
+
+/**
+ * Exponential of every Quaternion.
+ * @tparam T Type of the Quaternions.
+ * @param q The Quaternions.
+ * @param result Where to write the exponentials. May be the same arrays as q.
+ * @see Exp
+ */
+template <Math::FloatingPoint T>
+void Exp(std::type_identity_t<QuaternionSoA<const T>> q, const QuaternionSoA<T>& result);
+
+/**
+ * Raise every Quaternion to a power.
+ * @tparam T Type of the Quaternions.
+ * @param q The Quaternions. Can't have a magnitude of 0.
+ * @param exponents The exponent for every Quaternion.
+ * @param result Where to write the powers. May be the same arrays as q.
+ * @see Pow
+ */
+template <Math::FloatingPoint T>
+void Pow(std::type_identity_t<QuaternionSoA<const T>> q,
+         std::type_identity_t<std::span<const T>> exponents,
+         const QuaternionSoA<T>& result);
+
+/**
+ * Angle between every pair of Quaternions.
+ * @tparam T Type of the Quaternions.
+ * @param q1 First Quaternions.
+ * @param q2 Second Quaternions.
+ * @param result Where to write the angles in radians.
+ * @see AngleBetween
+ */
+template <Math::FloatingPoint T>
+void AngleBetween(std::type_identity_t<QuaternionSoA<const T>> q1,
+                  std::type_identity_t<QuaternionSoA<const T>> q2,
+                  std::span<T> result);
+
+/**
+ * Split every rotation into a swing and a twist around the same axis, q[i] = swing[i] * twist[i].
+ * @tparam T Type of the Quaternions.
+ * @param q The rotations. Need to have unit length.
+ * @param axis The twist axis. It doesn't have to be normalized.
+ * @param swing Where to write the swings.
+ * @param twist Where to write the twists.
+ * @see SwingTwist
+ */
+template <Math::FloatingPoint T>
+void SwingTwist(std::type_identity_t<QuaternionSoA<const T>> q,
+                const Vector3<T>& axis,
+                const QuaternionSoA<T>& swing,
+                const QuaternionSoA<T>& twist);
+
+/**
+ * Spherical cubic interpolation for every segment, result[i] is the interpolation between q1[i]
+ * and q2[i] with the control points a1[i] and a2[i] and parameter params[i].
+ * @tparam T Type of the Quaternions.
+ * @param params Parameters to interpolate with. Should be between 0 and 1.
+ * @param q1 First keys.
+ * @param a1 Control points of the first keys.
+ * @param a2 Control points of the second keys.
+ * @param q2 Second keys.
+ * @param result Where to write the interpolated Quaternions.
+ * @see Squad
+ */
+template <Math::FloatingPoint T>
+void Squad(std::type_identity_t<std::span<const T>> params,
+           std::type_identity_t<QuaternionSoA<const T>> q1,
+           std::type_identity_t<QuaternionSoA<const T>> a1,
+           std::type_identity_t<QuaternionSoA<const T>> a2,
+           std::type_identity_t<QuaternionSoA<const T>> q2,
+           const QuaternionSoA<T>& result);
+
+}  // namespace Math
+
+// Implementation //////////////////////////////////////////////////////////////////////////////////
+
+namespace Math::Internal
+{
+
+// Interpolation falls back to Nlerp when the angle is smaller than this, same as the scalar Slerp.
+inline constexpr double k_slerp_lerp_threshold = 0.0001;
+
+// Abramowitz and Stegun 4.4.46, acos(x) = sqrt(1 - x) * P(x) on [0, 1] with the absolute error
+// below 2e-8. Coefficients are ordered from the highest degree for Horner's method.
+inline constexpr double k_acos_coefficients[] = {-0.0012624911, 0.0066700901, -0.0170881256,
+                                                 0.0308918810,  -0.0501743046, 0.0889789874,
+                                                 -0.2145988016, 1.5707963050};
+
+// Taylor series of sin(x) / x in x^2 up to x^10, the absolute error on [-pi/2, pi/2] is below 6e-8.
+inline constexpr double k_sin_coefficients[] = {-1.0 / 39916800.0, 1.0 / 362880.0, -1.0 / 5040.0,
+                                                1.0 / 120.0,       -1.0 / 6.0,      1.0};
+
+template <Math::FloatingPoint T>
+constexpr T AcosApprox(T x)
+{
+    T p = static_cast<T>(k_acos_coefficients[0]);
+    for (size_t i = 1; i < std::size(k_acos_coefficients); ++i)
+    {
+        p = p * x + static_cast<T>(k_acos_coefficients[i]);
+    }
+    return Math::Sqrt(1 - x) * p;
+}
+
+template <Math::FloatingPoint T>
+constexpr T SinApprox(T x)
+{
+    const T x2 = x * x;
+    T p = static_cast<T>(k_sin_coefficients[0]);
+    for (size_t i = 1; i < std::size(k_sin_coefficients); ++i)
+    {
+        p = p * x2 + static_cast<T>(k_sin_coefficients[i]);
+    }
+    return x * p;
+}
+
+template <Math::FloatingPoint T>
+constexpr Math::Quaternion<T> SlerpApprox(T param, const Quaternion<T>& q1, Quaternion<T> q2)
+{
+    T cos_theta = Dot(q1, q2);
+    if (cos_theta < 0)
+    {
+        q2 *= static_cast<T>(-1);
+        cos_theta = -cos_theta;
+    }
+    cos_theta = Math::Min(cos_theta, static_cast<T>(1));
+
+    T weight1 = 1 - param;
+    T weight2 = param;
+    if (cos_theta < 1 - static_cast<T>(k_slerp_lerp_threshold))
+    {
+        const T theta = AcosApprox(cos_theta);
+        const T inv_sin_theta = 1 / SinApprox(theta);
+        weight1 = SinApprox(weight1 * theta) * inv_sin_theta;
+        weight2 = SinApprox(weight2 * theta) * inv_sin_theta;
+    }
+    return Normalize(q1 * weight1 + q2 * weight2);
+}
+
+template <Math::FloatingPoint T>
+constexpr Math::Quaternion<T> NlerpShortestPath(T param,
+                                                const Quaternion<T>& q1,
+                                                const Quaternion<T>& q2)
+{
+    const T weight2 = Dot(q1, q2) < 0 ? -param : param;
+    return Normalize(q1 * (1 - param) + q2 * weight2);
+}
+
+#if MATH_SIMD_SSE2
+
+inline __m128 AcosApprox(__m128 x)
+{
+    __m128 p = _mm_set1_ps(static_cast<float>(k_acos_coefficients[0]));
+    for (size_t i = 1; i < std::size(k_acos_coefficients); ++i)
+    {
+        p = MulAdd(p, x, _mm_set1_ps(static_cast<float>(k_acos_coefficients[i])));
+    }
+    return _mm_mul_ps(_mm_sqrt_ps(_mm_sub_ps(_mm_set1_ps(1.0f), x)), p);
+}
+
+inline __m128 SinApprox(__m128 x)
+{
+    const __m128 x2 = _mm_mul_ps(x, x);
+    __m128 p = _mm_set1_ps(static_cast<float>(k_sin_coefficients[0]));
+    for (size_t i = 1; i < std::size(k_sin_coefficients); ++i)
+    {
+        p = MulAdd(p, x2, _mm_set1_ps(static_cast<float>(k_sin_coefficients[i])));
+    }
+    return _mm_mul_ps(x, p);
+}
+
+/**
+ * Interpolates four Quaternions at the offset. Same math as SlerpApprox, or NlerpShortestPath when
+ * nlerp is true.
+ */
+inline void InterpolateSSE(bool nlerp,
+                           size_t offset,
+                           std::span<const float> params,
+                           const QuaternionSoA<const float>& q1,
+                           const QuaternionSoA<const float>& q2,
+                           const QuaternionSoA<float>& result)
+{
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 t = _mm_loadu_ps(params.data() + offset);
+    const __m128 x1 = _mm_loadu_ps(q1.x.data() + offset);
+    const __m128 y1 = _mm_loadu_ps(q1.y.data() + offset);
+    const __m128 z1 = _mm_loadu_ps(q1.z.data() + offset);
+    const __m128 w1 = _mm_loadu_ps(q1.w.data() + offset);
+    const __m128 x2 = _mm_loadu_ps(q2.x.data() + offset);
+    const __m128 y2 = _mm_loadu_ps(q2.y.data() + offset);
+    const __m128 z2 = _mm_loadu_ps(q2.z.data() + offset);
+    const __m128 w2 = _mm_loadu_ps(q2.w.data() + offset);
+
+    __m128 cos_theta = _mm_mul_ps(x1, x2);
+    cos_theta = MulAdd(y1, y2, cos_theta);
+    cos_theta = MulAdd(z1, z2, cos_theta);
+    cos_theta = MulAdd(w1, w2, cos_theta);
+
+    // Take the shortest path by flipping the sign of the second weight, which is the same as
+    // negating q2.
+    const __m128 sign = _mm_and_ps(cos_theta, _mm_set1_ps(-0.0f));
+    cos_theta = _mm_min_ps(_mm_xor_ps(cos_theta, sign), one);
+
+    __m128 weight1 = _mm_sub_ps(one, t);
+    __m128 weight2 = t;
+    if (!nlerp)
+    {
+        // Lanes below the threshold can divide by zero, they are discarded by the select.
+        const __m128 theta = AcosApprox(cos_theta);
+        const __m128 inv_sin_theta = _mm_div_ps(one, SinApprox(theta));
+        const __m128 use_slerp = _mm_cmplt_ps(
+            cos_theta, _mm_set1_ps(1.0f - static_cast<float>(k_slerp_lerp_threshold)));
+        weight1 =
+            Select(use_slerp, _mm_mul_ps(SinApprox(_mm_mul_ps(weight1, theta)), inv_sin_theta),
+                   weight1);
+        weight2 =
+            Select(use_slerp, _mm_mul_ps(SinApprox(_mm_mul_ps(weight2, theta)), inv_sin_theta),
+                   weight2);
+    }
+    weight2 = _mm_xor_ps(weight2, sign);
+
+    const __m128 x = MulAdd(x1, weight1, _mm_mul_ps(x2, weight2));
+    const __m128 y = MulAdd(y1, weight1, _mm_mul_ps(y2, weight2));
+    const __m128 z = MulAdd(z1, weight1, _mm_mul_ps(z2, weight2));
+    const __m128 w = MulAdd(w1, weight1, _mm_mul_ps(w2, weight2));
+
+    __m128 length_squared = _mm_mul_ps(x, x);
+    length_squared = MulAdd(y, y, length_squared);
+    length_squared = MulAdd(z, z, length_squared);
+    length_squared = MulAdd(w, w, length_squared);
+    const __m128 inv_length = _mm_div_ps(one, _mm_sqrt_ps(length_squared));
+
+    _mm_storeu_ps(result.x.data() + offset, _mm_mul_ps(x, inv_length));
+    _mm_storeu_ps(result.y.data() + offset, _mm_mul_ps(y, inv_length));
+    _mm_storeu_ps(result.z.data() + offset, _mm_mul_ps(z, inv_length));
+    _mm_storeu_ps(result.w.data() + offset, _mm_mul_ps(w, inv_length));
+}
+
+/**
+ * Multiplies four Quaternions at the offset, one Quaternion per lane.
+ */
+inline void MultiplyBatchSSE(size_t offset,
+                             const QuaternionSoA<const float>& q1,
+                             const QuaternionSoA<const float>& q2,
+                             const QuaternionSoA<float>& result)
+{
+    const __m128 x1 = _mm_loadu_ps(q1.x.data() + offset);
+    const __m128 y1 = _mm_loadu_ps(q1.y.data() + offset);
+    const __m128 z1 = _mm_loadu_ps(q1.z.data() + offset);
+    const __m128 w1 = _mm_loadu_ps(q1.w.data() + offset);
+    const __m128 x2 = _mm_loadu_ps(q2.x.data() + offset);
+    const __m128 y2 = _mm_loadu_ps(q2.y.data() + offset);
+    const __m128 z2 = _mm_loadu_ps(q2.z.data() + offset);
+    const __m128 w2 = _mm_loadu_ps(q2.w.data() + offset);
+
+    // Same order of operations as the scalar product.
+    __m128 x = _mm_add_ps(_mm_mul_ps(w1, x2), _mm_mul_ps(x1, w2));
+    x = _mm_sub_ps(MulAdd(y1, z2, x), _mm_mul_ps(z1, y2));
+    __m128 y = _mm_sub_ps(_mm_mul_ps(w1, y2), _mm_mul_ps(x1, z2));
+    y = MulAdd(z1, x2, MulAdd(y1, w2, y));
+    __m128 z = _mm_add_ps(_mm_mul_ps(w1, z2), _mm_mul_ps(x1, y2));
+    z = MulAdd(z1, w2, _mm_sub_ps(z, _mm_mul_ps(y1, x2)));
+    __m128 w = _mm_sub_ps(_mm_mul_ps(w1, w2), _mm_mul_ps(x1, x2));
+    w = _mm_sub_ps(_mm_sub_ps(w, _mm_mul_ps(y1, y2)), _mm_mul_ps(z1, z2));
+
+    _mm_storeu_ps(result.x.data() + offset, x);
+    _mm_storeu_ps(result.y.data() + offset, y);
+    _mm_storeu_ps(result.z.data() + offset, z);
+    _mm_storeu_ps(result.w.data() + offset, w);
+}
+
+#endif
+
+template <Math::FloatingPoint T>
+void Interpolate(bool nlerp,
+                 std::span<const T> params,
+                 const QuaternionSoA<const T>& q1,
+                 const QuaternionSoA<const T>& q2,
+                 const QuaternionSoA<T>& result)
+{
+    const size_t count = params.size();
+    assert(q1.Size() == count);
+    assert(q2.Size() == count);
+    assert(result.Size() == count);
+
+    size_t i = 0;
+#if MATH_SIMD_SSE2
+    if constexpr (std::is_same_v<T, float>)
+    {
+        for (; i + 4 <= count; i += 4)
+        {
+            InterpolateSSE(nlerp, i, params, q1, q2, result);
+        }
+    }
+#endif
+    for (; i < count; ++i)
+    {
+        const Quaternion<T> q = nlerp ? NlerpShortestPath(params[i], q1.Get(i), q2.Get(i))
+                                      : SlerpApprox(params[i], q1.Get(i), q2.Get(i));
+        result.Set(i, q);
+    }
+}
+
+}  // namespace Math::Internal
+
+template <typename T>
+constexpr Math::QuaternionSoA<T>::QuaternionSoA(std::span<T> x_values,
+                                                std::span<T> y_values,
+                                                std::span<T> z_values,
+                                                std::span<T> w_values)
+    : x(x_values), y(y_values), z(z_values), w(w_values)
+{
+    assert(x.size() == y.size() && x.size() == z.size() && x.size() == w.size());
+}
+
+template <typename T>
+template <typename U>
+    requires std::is_same_v<T, const U>
+constexpr Math::QuaternionSoA<T>::QuaternionSoA(const QuaternionSoA<U>& other)
+    : x(other.x), y(other.y), z(other.z), w(other.w)
+{
+}
+
+template <typename T>
+constexpr size_t Math::QuaternionSoA<T>::Size() const
+{
+    return x.size();
+}
+
+template <typename T>
+constexpr Math::Quaternion<std::remove_const_t<T>> Math::QuaternionSoA<T>::Get(size_t index) const
+{
+    return Quaternion<std::remove_const_t<T>>(w[index], x[index], y[index], z[index]);
+}
+
+template <typename T>
+constexpr void Math::QuaternionSoA<T>::Set(size_t index,
+                                           const Quaternion<std::remove_const_t<T>>& q) const
+    requires(!std::is_const_v<T>)
+{
+    x[index] = q.vec.x;
+    y[index] = q.vec.y;
+    z[index] = q.vec.z;
+    w[index] = q.w;
+}
+
+template <Math::FloatingPoint T>
+void Math::Slerp(std::type_identity_t<std::span<const T>> params,
+                 std::type_identity_t<QuaternionSoA<const T>> q1,
+                 std::type_identity_t<QuaternionSoA<const T>> q2,
+                 const QuaternionSoA<T>& result)
+{
+    Internal::Interpolate(false, params, q1, q2, result);
+}
+
+template <Math::FloatingPoint T>
+void Math::Nlerp(std::type_identity_t<std::span<const T>> params,
+                 std::type_identity_t<QuaternionSoA<const T>> q1,
+                 std::type_identity_t<QuaternionSoA<const T>> q2,
+                 const QuaternionSoA<T>& result)
+{
+    Internal::Interpolate(true, params, q1, q2, result);
+}
+
+template <Math::FloatingPoint T>
+void Math::Multiply(std::span<const Quaternion<T>> q1,
+                    std::span<const Quaternion<T>> q2,
+                    std::span<Quaternion<T>> result)
+{
+    assert(q1.size() == result.size());
+    assert(q2.size() == result.size());
+    for (size_t i = 0; i < result.size(); ++i)
+    {
+#if MATH_SIMD_SSE2
+        if constexpr (std::is_same_v<T, float>)
+        {
+            const __m128 q =
+                Internal::MultiplySSE(Internal::LoadSSE(q1[i]), Internal::LoadSSE(q2[i]));
+            result[i] = Internal::StoreSSE(q);
+        }
+        else
+#endif
+        {
+            result[i] = q1[i] * q2[i];
+        }
+    }
+}
+
+template <Math::FloatingPoint T>
+void Math::Multiply(std::type_identity_t<QuaternionSoA<const T>> q1,
+                    std::type_identity_t<QuaternionSoA<const T>> q2,
+                    const QuaternionSoA<T>& result)
+{
+    const size_t count = result.Size();
+    assert(q1.Size() == count);
+    assert(q2.Size() == count);
+
+    size_t i = 0;
+#if MATH_SIMD_SSE2
+    if constexpr (std::is_same_v<T, float>)
+    {
+        for (; i + 4 <= count; i += 4)
+        {
+            Internal::MultiplyBatchSSE(i, q1, q2, result);
+        }
+    }
+#endif
+    for (; i < count; ++i)
+    {
+        result.Set(i, q1.Get(i) * q2.Get(i));
+    }
+}
+
+template <Math::FloatingPoint T>
+void Math::Log(std::type_identity_t<QuaternionSoA<const T>> q, const QuaternionSoA<T>& result)
+{
+    assert(q.Size() == result.Size());
+    for (size_t i = 0; i < result.Size(); ++i)
+    {
+        result.Set(i, Log(q.Get(i)));
+    }
+}
+
+template <Math::FloatingPoint T>
+void Math::Exp(std::type_identity_t<QuaternionSoA<const T>> q, const QuaternionSoA<T>& result)
+{
+    assert(q.Size() == result.Size());
+    for (size_t i = 0; i < result.Size(); ++i)
+    {
+        result.Set(i, Exp(q.Get(i)));
+    }
+}
+
+template <Math::FloatingPoint T>
+void Math::Pow(std::type_identity_t<QuaternionSoA<const T>> q,
+               std::type_identity_t<std::span<const T>> exponents,
+               const QuaternionSoA<T>& result)
+{
+    assert(q.Size() == result.Size());
+    assert(exponents.size() == result.Size());
+    for (size_t i = 0; i < result.Size(); ++i)
+    {
+        result.Set(i, Pow(q.Get(i), exponents[i]));
+    }
+}
+
+template <Math::FloatingPoint T>
+void Math::AngleBetween(std::type_identity_t<QuaternionSoA<const T>> q1,
+                        std::type_identity_t<QuaternionSoA<const T>> q2,
+                        std::span<T> result)
+{
+    assert(q1.Size() == result.size());
+    assert(q2.Size() == result.size());
+    for (size_t i = 0; i < result.size(); ++i)
+    {
+        result[i] = AngleBetween(q1.Get(i), q2.Get(i));
+    }
+}
+
+template <Math::FloatingPoint T>
+void Math::SwingTwist(std::type_identity_t<QuaternionSoA<const T>> q,
+                      const Vector3<T>& axis,
+                      const QuaternionSoA<T>& swing,
+                      const QuaternionSoA<T>& twist)
+{
+    assert(q.Size() == swing.Size());
+    assert(q.Size() == twist.Size());
+    for (size_t i = 0; i < q.Size(); ++i)
+    {
+        const SwingTwistDecomposition<T> decomposition = SwingTwist(q.Get(i), axis);
+        swing.Set(i, decomposition.swing);
+        twist.Set(i, decomposition.twist);
+    }
+}
+
+template <Math::FloatingPoint T>
+void Math::Squad(std::type_identity_t<std::span<const T>> params,
+                 std::type_identity_t<QuaternionSoA<const T>> q1,
+                 std::type_identity_t<QuaternionSoA<const T>> a1,
+                 std::type_identity_t<QuaternionSoA<const T>> a2,
+                 std::type_identity_t<QuaternionSoA<const T>> q2,
+                 const QuaternionSoA<T>& result)
+{
+    assert(params.size() == result.Size());
+    assert(q1.Size() == result.Size());
+    assert(a1.Size() == result.Size());
+    assert(a2.Size() == result.Size());
+    assert(q2.Size() == result.Size());
+    for (size_t i = 0; i < result.Size(); ++i)
+    {
+        result.Set(i, Squad(params[i], q1.Get(i), a1.Get(i), a2.Get(i), q2.Get(i)));
+    }
+}
@@ -1,12 +1,29 @@
 #pragma once
 
+#include <type_traits>
+
 #include "math/matrix4x4.h"
 #include "math/point3.h"
+#include "math/simd.h"
 #include "math/vector3.h"
 
 namespace Math
 {
 
+template <Math::FloatingPoint T>
+class Quaternion;
+
+/**
+ * Result of splitting a rotation into a swing and a twist.
+ * @see SwingTwist
+ */
+template <Math::FloatingPoint T>
+struct SwingTwistDecomposition
+{
+    Quaternion<T> swing;
+    Quaternion<T> twist;
+};
+
 template <Math::FloatingPoint T>
 class Quaternion
 {
@@ -17,7 +34,7 @@ public:
     /**
      * Default constructor. No initialization is done.
      */
-    Quaternion();
+    constexpr Quaternion();
 
     /**
      * @brief Construct a Quaternion using four T values.
@@ -26,17 +43,17 @@ public:
      * @param y - The j part of the Quaternion.
      * @param z - The k part of the Quaternion.
      */
-    Quaternion(T w, T x, T y, T z);
+    constexpr Quaternion(T w, T x, T y, T z);
 
     /**
      * @brief Construct a Quaternion from a matrix. This uses only the upper left 3x3 part of the
      * matrix.
      * @param transform - The transform to construct the Quaternion from.
      */
-    explicit Quaternion(const Matrix4x4<T>& transform);
+    constexpr explicit Quaternion(const Matrix4x4<T>& transform);
 
     template <Math::FloatingPoint U>
-    Quaternion(const Quaternion<U>& other);
+    constexpr Quaternion(const Quaternion<U>& other);
 
     /**
      * @brief Construct a Quaternion from an axis and an angle.
@@ -44,7 +61,7 @@ public:
      * @param angle_degrees - The angle to rotate by in degrees.
      * @return The Quaternion representing the rotation.
      */
-    static Quaternion FromAxisAngleDegrees(const Vector3<T>& axis, T angle_degrees);
+    static constexpr Quaternion FromAxisAngleDegrees(const Vector3<T>& axis, T angle_degrees);
 
     /**
      * @brief Construct a Quaternion from an axis and an angle.
@@ -52,42 +69,51 @@ public:
      * @param angle_radians - The angle to rotate by in radians.
      * @return The Quaternion representing the rotation.
      */
-    static Quaternion FromAxisAngleRadians(const Vector3<T>& axis, T angle_radians);
+    static constexpr Quaternion FromAxisAngleRadians(const Vector3<T>& axis, T angle_radians);
 
     /**
      * @brief Construct an identity Quaternion. This is a Quaternion with all components set to zero
      * except for the real component which is set to one. It represents no rotation.
      */
-    static Quaternion Identity();
+    static constexpr Quaternion Identity();
 
     /**
      * Quaternion with all components set to zero.
      */
-    static Quaternion Zero();
+    static constexpr Quaternion Zero();
 
     /** Operator overloads. */
 
-    bool operator==(const Quaternion& other) const;
-    bool operator!=(const Quaternion& other) const;
+    constexpr bool operator==(const Quaternion& other) const;
+    constexpr bool operator!=(const Quaternion& other) const;
 
-    Quaternion& operator+=(const Quaternion& other);
-    Quaternion& operator-=(const Quaternion& other);
-    Quaternion& operator*=(const Quaternion& other);
-    Quaternion& operator*=(T scalar);
-    Quaternion& operator/=(T scalar);
+    constexpr Quaternion& operator+=(const Quaternion& other);
+    constexpr Quaternion& operator-=(const Quaternion& other);
+    constexpr Quaternion& operator*=(const Quaternion& other);
+    constexpr Quaternion& operator*=(T scalar);
+    constexpr Quaternion& operator/=(T scalar);
 
-    Quaternion operator*(T scalar) const;
-    Quaternion operator/(T scalar) const;
+    constexpr Quaternion operator*(T scalar) const;
+    constexpr Quaternion operator/(T scalar) const;
 };
 
 template <Math::FloatingPoint T>
-Quaternion<T> operator+(const Quaternion<T>& q1, const Quaternion<T>& q2);
+constexpr Quaternion<T> operator+(const Quaternion<T>& q1, const Quaternion<T>& q2);
 template <Math::FloatingPoint T>
-Quaternion<T> operator-(const Quaternion<T>& q1, const Quaternion<T>& q2);
+constexpr Quaternion<T> operator-(const Quaternion<T>& q1, const Quaternion<T>& q2);
+
+/**
+ * Compose two rotations using the Hamilton product.
+ * @tparam T Type of the Quaternions.
+ * @param q1 First Quaternion.
+ * @param q2 Second Quaternion.
+ * @return Returns the product. Rotating by it is the same as rotating by q2 and then by q1.
+ */
 template <Math::FloatingPoint T>
-Quaternion<T> operator*(const Quaternion<T>& q1, const Quaternion<T>& q2);
+constexpr Quaternion<T> operator*(const Quaternion<T>& q1, const Quaternion<T>& q2);
+
 template <Math::FloatingPoint T>
-Quaternion<T> operator*(T scalar, const Quaternion<T>& q);
+constexpr Quaternion<T> operator*(T scalar, const Quaternion<T>& q);
 
 /**
  * Rotate vector by this Quaternion.
@@ -97,7 +123,7 @@ Quaternion<T> operator*(T scalar, const Quaternion<T>& q);
  * @return Returns a new Quaternion.
  */
 template <Math::FloatingPoint T>
-Vector3<T> operator*(const Quaternion<T>& q, const Vector3<T>& vec);
+constexpr Vector3<T> operator*(const Quaternion<T>& q, const Vector3<T>& vec);
 
 /**
  * Rotate point by this Quaternion.
@@ -107,7 +133,7 @@ Vector3<T> operator*(const Quaternion<T>& q, const Vector3<T>& vec);
  * @return Returns a new Quaternion.
  */
 template <Math::FloatingPoint T>
-Point3<T> operator*(const Quaternion<T>& q, const Point3<T>& p);
+constexpr Point3<T> operator*(const Quaternion<T>& q, const Point3<T>& p);
 
 /**
  * Checks if any of the components are NaN or infinite value.
@@ -115,7 +141,7 @@ Point3<T> operator*(const Quaternion<T>& q, const Point3<T>& p);
  * @return True if any of the components are NaN or infinite value, false otherwise.
  */
 template <Math::FloatingPoint T>
-[[nodiscard]] bool ContainsNonFinite(const Quaternion<T>& q);
+[[nodiscard]] constexpr bool ContainsNonFinite(const Quaternion<T>& q);
 
 /**
  * Checks if any of the components are NaN.
@@ -123,7 +149,18 @@ template <Math::FloatingPoint T>
  * @return True if any of the components are NaN, false otherwise.
  */
 template <Math::FloatingPoint T>
-[[nodiscard]] bool ContainsNaN(const Quaternion<T>& q);
+[[nodiscard]] constexpr bool ContainsNaN(const Quaternion<T>& q);
+
+/**
+ * Checks if the Quaternions are equal within a given epsilon.
+ * @tparam T Type of the Quaternions.
+ * @param q1 The first Quaternion.
+ * @param q2 The second Quaternion.
+ * @param epsilon The epsilon to use.
+ * @return True if all the components are equal within a given epsilon, false otherwise.
+ */
+template <Math::FloatingPoint T>
+constexpr bool IsEqual(const Quaternion<T>& q1, const Quaternion<T>& q2, T epsilon);
 
 /**
  * Calculate the length squared of a Quaternion.
@@ -132,7 +169,7 @@ template <Math::FloatingPoint T>
  * @return Returns the length squared of the Quaternion.
  */
 template <Math::FloatingPoint T>
-[[nodiscard]] T LengthSquared(const Quaternion<T>& q);
+[[nodiscard]] constexpr T LengthSquared(const Quaternion<T>& q);
 
 /**
  * Calculate the length of a Quaternion.
@@ -141,7 +178,7 @@ template <Math::FloatingPoint T>
  * @return Returns the length of the Quaternion.
  */
 template <Math::FloatingPoint T>
-[[nodiscard]] T Length(const Quaternion<T>& q);
+[[nodiscard]] constexpr T Length(const Quaternion<T>& q);
 
 /**
  * Calculate the dot product of two Quaternions.
@@ -151,7 +188,7 @@ template <Math::FloatingPoint T>
  * @return Returns the dot product of the two Quaternions.
  */
 template <Math::FloatingPoint T>
-T Dot(const Quaternion<T>& q1, const Quaternion<T>& q2);
+constexpr T Dot(const Quaternion<T>& q1, const Quaternion<T>& q2);
 
 /**
  * Normalize a Quaternion.
@@ -160,7 +197,7 @@ T Dot(const Quaternion<T>& q1, const Quaternion<T>& q2);
  * @return Returns the normalized Quaternion in a new object.
  */
 template <Math::FloatingPoint T>
-Quaternion<T> Normalize(const Quaternion<T>& q);
+constexpr Quaternion<T> Normalize(const Quaternion<T>& q);
 
 /**
  * Perform linear interpolation between two Quaternions.
@@ -174,7 +211,7 @@ Quaternion<T> Normalize(const Quaternion<T>& q);
  * @see Slerp
  */
 template <Math::FloatingPoint T>
-Quaternion<T> Lerp(T param, const Quaternion<T>& q1, const Quaternion<T>& q2);
+constexpr Quaternion<T> Lerp(T param, const Quaternion<T>& q1, const Quaternion<T>& q2);
 
 /**
  * Perform spherical linear interpolation between two Quaternions.
@@ -198,7 +235,7 @@ Quaternion<T> Slerp(T param, const Quaternion<T>& q1, const Quaternion<T>& q2);
  * @return The conjugate of the Quaternion.
  */
 template <Math::FloatingPoint T>
-Quaternion<T> Conjugate(const Quaternion<T>& q);
+constexpr Quaternion<T> Conjugate(const Quaternion<T>& q);
 
 /**
  * @brief Get the inverse of a Quaternion.
@@ -207,32 +244,162 @@ Quaternion<T> Conjugate(const Quaternion<T>& q);
  * @return The inverse of the Quaternion.
  */
 template <Math::FloatingPoint T>
-Quaternion<T> Inverse(const Quaternion<T>& q);
+constexpr Quaternion<T> Inverse(const Quaternion<T>& q);
+
+/**
+ * @brief Get the natural logarithm of a Quaternion.
+ * @tparam T Type of the Quaternion.
+ * @param q The Quaternion. Can't have a magnitude of 0.
+ * @return The logarithm. For a unit Quaternion rotating by angle around axis this is a pure
+ * Quaternion with vector part axis * angle / 2. A negative real Quaternion gets the vector part
+ * (pi, 0, 0).
+ */
+template <Math::FloatingPoint T>
+Quaternion<T> Log(const Quaternion<T>& q);
+
+/**
+ * @brief Get the exponential of a Quaternion. This is the inverse of Log.
+ * @tparam T Type of the Quaternion.
+ * @param q The Quaternion.
+ * @return The exponential of the Quaternion.
+ */
+template <Math::FloatingPoint T>
+Quaternion<T> Exp(const Quaternion<T>& q);
+
+/**
+ * @brief Raise a Quaternion to a power. For a unit Quaternion this scales the angle of the rotation
+ * by the exponent.
+ * @tparam T Type of the Quaternion.
+ * @param q The Quaternion. Can't have a magnitude of 0.
+ * @param exponent The exponent.
+ * @return The Quaternion raised to the power.
+ */
+template <Math::FloatingPoint T>
+Quaternion<T> Pow(const Quaternion<T>& q, T exponent);
+
+/**
+ * @brief Get the angle of the rotation that takes one Quaternion to the other.
+ * @tparam T Type of the Quaternions.
+ * @param q1 First Quaternion.
+ * @param q2 Second Quaternion.
+ * @return The angle in radians, in range [0, pi]. Quaternions with opposite signs represent the
+ * same rotation, so the angle between them is 0.
+ */
+template <Math::FloatingPoint T>
+T AngleBetween(const Quaternion<T>& q1, const Quaternion<T>& q2);
+
+/**
+ * @brief Split a rotation into a twist around the axis and a swing around an axis perpendicular to
+ * it, so that q = swing * twist.
+ * @tparam T Type of the Quaternion.
+ * @param q The rotation to split. Needs to have unit length.
+ * @param axis The twist axis. It doesn't have to be normalized.
+ * @return The swing and the twist. When q swings by 180 degrees the twist is not defined and the
+ * identity is returned for it.
+ */
+template <Math::FloatingPoint T>
+SwingTwistDecomposition<T> SwingTwist(const Quaternion<T>& q, const Vector3<T>& axis);
+
+/**
+ * @brief Perform spherical cubic interpolation between q1 and q2.
+ * @tparam T Type of the Quaternions.
+ * @param param Parameter to interpolate with. Should be between 0 and 1.
+ * @param q1 First key.
+ * @param a1 Control point of the first key.
+ * @param a2 Control point of the second key.
+ * @param q2 Second key.
+ * @return Returns the interpolated Quaternion.
+ * @see SquadControlPoint
+ */
+template <Math::FloatingPoint T>
+Quaternion<T> Squad(T param,
+                    const Quaternion<T>& q1,
+                    const Quaternion<T>& a1,
+                    const Quaternion<T>& a2,
+                    const Quaternion<T>& q2);
+
+/**
+ * @brief Compute the Squad control point of a key so that the curve through the keys has a
+ * continuous first derivative.
+ * @tparam T Type of the Quaternions.
+ * @param q_prev The previous key.
+ * @param q The key to compute the control point for.
+ * @param q_next The next key.
+ * @return The control point. The keys need to have unit length and should be in the same
+ * hemisphere, negate the keys where the dot product with the previous key is negative.
+ */
+template <Math::FloatingPoint T>
+Quaternion<T> SquadControlPoint(const Quaternion<T>& q_prev,
+                                const Quaternion<T>& q,
+                                const Quaternion<T>& q_next);
 
 }  // namespace Math
 
 // Implementation //////////////////////////////////////////////////////////////////////////////////
 
+#if MATH_SIMD_SSE2
+
+namespace Math::Internal
+{
+
+inline __m128 LoadSSE(const Quaternion<float>& q)
+{
+    return _mm_setr_ps(q.vec.x, q.vec.y, q.vec.z, q.w);
+}
+
+inline Math::Quaternion<float> StoreSSE(__m128 v)
+{
+    alignas(16) float values[4];
+    _mm_store_ps(values, v);
+    return Quaternion<float>(values[3], values[0], values[1], values[2]);
+}
+
+/**
+ * Hamilton product of two Quaternions in the x, y, z, w lanes. The lanes are summed in the same
+ * order as in the scalar product so both give the same results.
+ */
+inline __m128 MultiplySSE(__m128 q1, __m128 q2)
+{
+    __m128 result = _mm_mul_ps(_mm_shuffle_ps(q1, q1, _MM_SHUFFLE(3, 3, 3, 3)), q2);
+    result = MulAdd(_mm_shuffle_ps(q1, q1, _MM_SHUFFLE(0, 0, 0, 0)),
+                    _mm_xor_ps(_mm_shuffle_ps(q2, q2, _MM_SHUFFLE(0, 1, 2, 3)),
+                               _mm_setr_ps(0.0f, -0.0f, 0.0f, -0.0f)),
+                    result);
+    result = MulAdd(_mm_shuffle_ps(q1, q1, _MM_SHUFFLE(1, 1, 1, 1)),
+                    _mm_xor_ps(_mm_shuffle_ps(q2, q2, _MM_SHUFFLE(1, 0, 3, 2)),
+                               _mm_setr_ps(0.0f, 0.0f, -0.0f, -0.0f)),
+                    result);
+    result = MulAdd(_mm_shuffle_ps(q1, q1, _MM_SHUFFLE(2, 2, 2, 2)),
+                    _mm_xor_ps(_mm_shuffle_ps(q2, q2, _MM_SHUFFLE(2, 3, 0, 1)),
+                               _mm_setr_ps(-0.0f, 0.0f, 0.0f, -0.0f)),
+                    result);
+    return result;
+}
+
+}  // namespace Math::Internal
+
+#endif
+
 template <Math::FloatingPoint T>
-Math::Quaternion<T>::Quaternion()
+constexpr Math::Quaternion<T>::Quaternion()
 {
     // Do nothing.
 }
 
 template <Math::FloatingPoint T>
-Math::Quaternion<T>::Quaternion(T w, T x, T y, T z) : w(w), vec(x, y, z)
+constexpr Math::Quaternion<T>::Quaternion(T w, T x, T y, T z) : vec(x, y, z), w(w)
 {
 }
 
 template <Math::FloatingPoint T>
-Math::Quaternion<T>::Quaternion(const Matrix4x4<T>& transform)
+constexpr Math::Quaternion<T>::Quaternion(const Matrix4x4<T>& transform)
 {
-    const T trace = transform.elements[0][0] + transform.elements[1][1] + transform.elements[2][2] +
-                    transform.elements[3][3];
+    // The trace is cancelled out when w is small, the other branch is accurate then.
+    const T trace = transform.elements[0][0] + transform.elements[1][1] + transform.elements[2][2];
 
     if (trace > static_cast<T>(0.0))
     {
-        w = Math::Sqrt(trace) / 2;
+        w = Math::Sqrt(trace + transform.elements[3][3]) / 2;
         const T scalar = 1 / (4 * w);
         vec.x = (transform.elements[2][1] - transform.elements[1][2]) * scalar;
         vec.y = (transform.elements[0][2] - transform.elements[2][0]) * scalar;
@@ -274,22 +441,22 @@ Math::Quaternion<T>::Quaternion(const Matrix4x4<T>& transform)
 
 template <Math::FloatingPoint T>
 template <Math::FloatingPoint U>
-Math::Quaternion<T>::Quaternion(const Quaternion<U>& other)
-    : w(static_cast<T>(other.w)),
-      vec(static_cast<T>(other.vec.x), static_cast<T>(other.vec.y), static_cast<T>(other.vec.z))
+constexpr Math::Quaternion<T>::Quaternion(const Quaternion<U>& other)
+    : vec(static_cast<T>(other.vec.x), static_cast<T>(other.vec.y), static_cast<T>(other.vec.z)),
+      w(static_cast<T>(other.w))
 {
 }
 
 template <Math::FloatingPoint T>
-Math::Quaternion<T> Math::Quaternion<T>::FromAxisAngleDegrees(const Vector3<T>& axis,
-                                                              T angle_degrees)
+constexpr Math::Quaternion<T> Math::Quaternion<T>::FromAxisAngleDegrees(const Vector3<T>& axis,
+                                                                        T angle_degrees)
 {
     return FromAxisAngleRadians(axis, Radians(angle_degrees));
 }
 
 template <Math::FloatingPoint T>
-Math::Quaternion<T> Math::Quaternion<T>::FromAxisAngleRadians(const Vector3<T>& axis,
-                                                              T angle_radians)
+constexpr Math::Quaternion<T> Math::Quaternion<T>::FromAxisAngleRadians(const Vector3<T>& axis,
+                                                                        T angle_radians)
 {
     const T s = Sin(angle_radians / 2);
     const T c = Cos(angle_radians / 2);
@@ -298,31 +465,31 @@ Math::Quaternion<T> Math::Quaternion<T>::FromAxisAngleRadians(const Vector3<T>&
 }
 
 template <Math::FloatingPoint T>
-Math::Quaternion<T> Math::Quaternion<T>::Identity()
+constexpr Math::Quaternion<T> Math::Quaternion<T>::Identity()
 {
     return {1, 0, 0, 0};
 }
 
 template <Math::FloatingPoint T>
-Math::Quaternion<T> Math::Quaternion<T>::Zero()
+constexpr Math::Quaternion<T> Math::Quaternion<T>::Zero()
 {
     return {0, 0, 0, 0};
 }
 
 template <Math::FloatingPoint T>
-bool Math::Quaternion<T>::operator==(const Quaternion& other) const
+constexpr bool Math::Quaternion<T>::operator==(const Quaternion& other) const
 {
     return vec == other.vec && w == other.w;
 }
 
 template <Math::FloatingPoint T>
-bool Math::Quaternion<T>::operator!=(const Quaternion& other) const
+constexpr bool Math::Quaternion<T>::operator!=(const Quaternion& other) const
 {
     return !(*this == other);
 }
 
 template <Math::FloatingPoint T>
-Math::Quaternion<T>& Math::Quaternion<T>::operator+=(const Quaternion& other)
+constexpr Math::Quaternion<T>& Math::Quaternion<T>::operator+=(const Quaternion& other)
 {
     vec += other.vec;
     w += other.w;
@@ -330,7 +497,7 @@ Math::Quaternion<T>& Math::Quaternion<T>::operator+=(const Quaternion& other)
 }
 
 template <Math::FloatingPoint T>
-Math::Quaternion<T>& Math::Quaternion<T>::operator-=(const Quaternion& other)
+constexpr Math::Quaternion<T>& Math::Quaternion<T>::operator-=(const Quaternion& other)
 {
     vec -= other.vec;
     w -= other.w;
@@ -338,19 +505,27 @@ Math::Quaternion<T>& Math::Quaternion<T>::operator-=(const Quaternion& other)
 }
 
 template <Math::FloatingPoint T>
-Math::Quaternion<T>& Math::Quaternion<T>::operator*=(const Quaternion& other)
+constexpr Math::Quaternion<T>& Math::Quaternion<T>::operator*=(const Quaternion& other)
 {
-    Quaternion q;
-    q.vec.x = w * other.vec.x + vec.x * other.w + vec.y * other.vec.z - vec.z * other.vec.y;
-    q.vec.y = w * other.vec.y + vec.y * other.w + vec.z * other.vec.x - vec.x * other.vec.z;
-    q.vec.z = w * other.vec.z + vec.z * other.w + vec.x * other.vec.y - vec.y * other.vec.x;
-    q.w = w * other.w - Dot(vec, other.vec);
-    *this = q;
+#if MATH_SIMD_SSE2
+    // The shuffle based product has a shorter dependency chain, which helps when accumulating
+    // rotations. operator* stays scalar since compilers can vectorize loops over it.
+    if constexpr (std::is_same_v<T, float>)
+    {
+        if (!std::is_constant_evaluated())
+        {
+            *this = Internal::StoreSSE(
+                Internal::MultiplySSE(Internal::LoadSSE(*this), Internal::LoadSSE(other)));
+            return *this;
+        }
+    }
+#endif
+    *this = *this * other;
     return *this;
 }
 
 template <Math::FloatingPoint T>
-Math::Quaternion<T>& Math::Quaternion<T>::operator*=(T scalar)
+constexpr Math::Quaternion<T>& Math::Quaternion<T>::operator*=(T scalar)
 {
     vec *= scalar;
     w *= scalar;
@@ -358,7 +533,7 @@ Math::Quaternion<T>& Math::Quaternion<T>::operator*=(T scalar)
 }
 
 template <Math::FloatingPoint T>
-Math::Quaternion<T>& Math::Quaternion<T>::operator/=(T scalar)
+constexpr Math::Quaternion<T>& Math::Quaternion<T>::operator/=(T scalar)
 {
     vec /= scalar;
     w /= scalar;
@@ -366,7 +541,7 @@ Math::Quaternion<T>& Math::Quaternion<T>::operator/=(T scalar)
 }
 
 template <Math::FloatingPoint T>
-Math::Quaternion<T> Math::Quaternion<T>::operator*(T scalar) const
+constexpr Math::Quaternion<T> Math::Quaternion<T>::operator*(T scalar) const
 {
     Quaternion q = *this;
     q *= scalar;
@@ -374,7 +549,7 @@ Math::Quaternion<T> Math::Quaternion<T>::operator*(T scalar) const
 }
 
 template <Math::FloatingPoint T>
-Math::Quaternion<T> Math::Quaternion<T>::operator/(T scalar) const
+constexpr Math::Quaternion<T> Math::Quaternion<T>::operator/(T scalar) const
 {
     Quaternion q = *this;
     q /= scalar;
@@ -382,7 +557,7 @@ Math::Quaternion<T> Math::Quaternion<T>::operator/(T scalar) const
 }
 
 template <Math::FloatingPoint T>
-Math::Quaternion<T> Math::operator+(const Quaternion<T>& q1, const Quaternion<T>& q2)
+constexpr Math::Quaternion<T> Math::operator+(const Quaternion<T>& q1, const Quaternion<T>& q2)
 {
     Quaternion<T> q = q1;
     q += q2;
@@ -390,7 +565,7 @@ Math::Quaternion<T> Math::operator+(const Quaternion<T>& q1, const Quaternion<T>
 }
 
 template <Math::FloatingPoint T>
-Math::Quaternion<T> Math::operator-(const Quaternion<T>& q1, const Quaternion<T>& q2)
+constexpr Math::Quaternion<T> Math::operator-(const Quaternion<T>& q1, const Quaternion<T>& q2)
 {
     Quaternion<T> q = q1;
     q -= q2;
@@ -398,15 +573,17 @@ Math::Quaternion<T> Math::operator-(const Quaternion<T>& q1, const Quaternion<T>
 }
 
 template <Math::FloatingPoint T>
-Math::Quaternion<T> Math::operator*(const Quaternion<T>& q1, const Quaternion<T>& q2)
+constexpr Math::Quaternion<T> Math::operator*(const Quaternion<T>& q1, const Quaternion<T>& q2)
 {
-    Quaternion<T> q = q1;
-    q *= q2;
-    return q;
+    const T x = q1.w * q2.vec.x + q1.vec.x * q2.w + q1.vec.y * q2.vec.z - q1.vec.z * q2.vec.y;
+    const T y = q1.w * q2.vec.y - q1.vec.x * q2.vec.z + q1.vec.y * q2.w + q1.vec.z * q2.vec.x;
+    const T z = q1.w * q2.vec.z + q1.vec.x * q2.vec.y - q1.vec.y * q2.vec.x + q1.vec.z * q2.w;
+    const T w = q1.w * q2.w - q1.vec.x * q2.vec.x - q1.vec.y * q2.vec.y - q1.vec.z * q2.vec.z;
+    return Quaternion<T>(w, x, y, z);
 }
 
 template <Math::FloatingPoint T>
-Math::Quaternion<T> Math::operator*(T scalar, const Quaternion<T>& q)
+constexpr Math::Quaternion<T> Math::operator*(T scalar, const Quaternion<T>& q)
 {
     Quaternion<T> result = q;
     result *= scalar;
@@ -414,7 +591,7 @@ Math::Quaternion<T> Math::operator*(T scalar, const Quaternion<T>& q)
 }
 
 template <Math::FloatingPoint T>
-Math::Vector3<T> Math::operator*(const Quaternion<T>& q, const Vector3<T>& vec)
+constexpr Math::Vector3<T> Math::operator*(const Quaternion<T>& q, const Vector3<T>& vec)
 {
     const Quaternion<T> qp(0, vec.x, vec.y, vec.z);
     const Quaternion<T> result = q * qp * Inverse(q);
@@ -422,7 +599,7 @@ Math::Vector3<T> Math::operator*(const Quaternion<T>& q, const Vector3<T>& vec)
 }
 
 template <Math::FloatingPoint T>
-Math::Point3<T> Math::operator*(const Quaternion<T>& q, const Point3<T>& p)
+constexpr Math::Point3<T> Math::operator*(const Quaternion<T>& q, const Point3<T>& p)
 {
     const Quaternion<T> qp(0, p.x, p.y, p.z);
     const Quaternion<T> result = q * qp * Inverse(q);
@@ -430,38 +607,44 @@ Math::Point3<T> Math::operator*(const Quaternion<T>& q, const Point3<T>& p)
 }
 
 template <Math::FloatingPoint T>
-bool Math::ContainsNonFinite(const Quaternion<T>& q)
+constexpr bool Math::ContainsNonFinite(const Quaternion<T>& q)
 {
-    return !std::isfinite(q.vec.x) || !std::isfinite(q.vec.y) || !std::isfinite(q.vec.z) ||
-           !std::isfinite(q.w);
+    return !Math::IsFinite(q.vec.x) || !Math::IsFinite(q.vec.y) || !Math::IsFinite(q.vec.z) ||
+           !Math::IsFinite(q.w);
 }
 
 template <Math::FloatingPoint T>
-bool Math::ContainsNaN(const Quaternion<T>& q)
+constexpr bool Math::ContainsNaN(const Quaternion<T>& q)
 {
-    return std::isnan(q.vec.x) || std::isnan(q.vec.y) || std::isnan(q.vec.z) || std::isnan(q.w);
+    return Math::IsNaN(q.vec.x) || Math::IsNaN(q.vec.y) || Math::IsNaN(q.vec.z) || Math::IsNaN(q.w);
 }
 
 template <Math::FloatingPoint T>
-T Math::LengthSquared(const Quaternion<T>& q)
+constexpr bool Math::IsEqual(const Quaternion<T>& q1, const Quaternion<T>& q2, T epsilon)
+{
+    return Math::IsEqual(q1.vec, q2.vec, epsilon) && Math::IsEqual(q1.w, q2.w, epsilon);
+}
+
+template <Math::FloatingPoint T>
+constexpr T Math::LengthSquared(const Quaternion<T>& q)
 {
     return q.vec.x * q.vec.x + q.vec.y * q.vec.y + q.vec.z * q.vec.z + q.w * q.w;
 }
 
 template <Math::FloatingPoint T>
-T Math::Length(const Quaternion<T>& q)
+constexpr T Math::Length(const Quaternion<T>& q)
 {
     return Math::Sqrt(LengthSquared(q));
 }
 
 template <Math::FloatingPoint T>
-T Math::Dot(const Quaternion<T>& q1, const Quaternion<T>& q2)
+constexpr T Math::Dot(const Quaternion<T>& q1, const Quaternion<T>& q2)
 {
     return q1.vec.x * q2.vec.x + q1.vec.y * q2.vec.y + q1.vec.z * q2.vec.z + q1.w * q2.w;
 }
 
 template <Math::FloatingPoint T>
-Math::Quaternion<T> Math::Normalize(const Quaternion<T>& q)
+constexpr Math::Quaternion<T> Math::Normalize(const Quaternion<T>& q)
 {
     const T length = Length(q);
     if (length == 0)
@@ -472,7 +655,7 @@ Math::Quaternion<T> Math::Normalize(const Quaternion<T>& q)
 }
 
 template <Math::FloatingPoint T>
-Math::Quaternion<T> Math::Lerp(T param, const Quaternion<T>& q1, const Quaternion<T>& q2)
+constexpr Math::Quaternion<T> Math::Lerp(T param, const Quaternion<T>& q1, const Quaternion<T>& q2)
 {
 #if _DEBUG
     constexpr T k_epsilon = static_cast<T>(0.0001);
@@ -500,7 +683,7 @@ Math::Quaternion<T> Math::Slerp(T param, const Quaternion<T>& q1, const Quaterni
         return Lerp(param, q1, q2);
     }
 
-    const T theta0 = std::acos(cos_theta0);
+    const T theta0 = Math::ArcCos(cos_theta0);
     const T theta = theta0 * param;
 
     Quaternion q3 = q2 - q1 * cos_theta0;
@@ -510,7 +693,7 @@ Math::Quaternion<T> Math::Slerp(T param, const Quaternion<T>& q1, const Quaterni
 }
 
 template <Math::FloatingPoint T>
-Math::Quaternion<T> Math::Conjugate(const Quaternion<T>& q)
+constexpr Math::Quaternion<T> Math::Conjugate(const Quaternion<T>& q)
 {
     Quaternion<T> ret = q;
     ret.vec = -ret.vec;
@@ -518,9 +701,92 @@ Math::Quaternion<T> Math::Conjugate(const Quaternion<T>& q)
 }
 
 template <Math::FloatingPoint T>
-Math::Quaternion<T> Math::Inverse(const Quaternion<T>& q)
+constexpr Math::Quaternion<T> Math::Inverse(const Quaternion<T>& q)
 {
     const T length_squared = LengthSquared(q);
     assert(length_squared != 0);
     return Conjugate(q) / length_squared;
 }
+
+template <Math::FloatingPoint T>
+Math::Quaternion<T> Math::Log(const Quaternion<T>& q)
+{
+    const T length = Length(q);
+    assert(length != 0);
+    const T vec_length = Math::Sqrt(LengthSquared(q.vec));
+    if (vec_length == 0)
+    {
+        // A negative real number is a half turn around any axis, take the x axis so that Exp gives
+        // the number back.
+        const T angle = q.w < 0 ? static_cast<T>(k_pi_double) : T(0);
+        return Quaternion<T>(Math::LogNatural(length), angle, 0, 0);
+    }
+
+    // atan2 is accurate for both small and large angles, unlike acos(w / length).
+    const T scale = Math::ArcTan2(vec_length, q.w) / vec_length;
+    return Quaternion<T>(Math::LogNatural(length), q.vec.x * scale, q.vec.y * scale,
+                         q.vec.z * scale);
+}
+
+template <Math::FloatingPoint T>
+Math::Quaternion<T> Math::Exp(const Quaternion<T>& q)
+{
+    const T angle = Math::Sqrt(LengthSquared(q.vec));
+    const T exp_w = Math::Exp(q.w);
+    const T scale = angle == 0 ? exp_w : exp_w * Math::Sin(angle) / angle;
+    return Quaternion<T>(exp_w * Math::Cos(angle), q.vec.x * scale, q.vec.y * scale,
+                         q.vec.z * scale);
+}
+
+template <Math::FloatingPoint T>
+Math::Quaternion<T> Math::Pow(const Quaternion<T>& q, T exponent)
+{
+    return Exp(Log(q) * exponent);
+}
+
+template <Math::FloatingPoint T>
+T Math::AngleBetween(const Quaternion<T>& q1, const Quaternion<T>& q2)
+{
+    const Quaternion<T> difference = Conjugate(q1) * q2;
+    const T vec_length = Math::Sqrt(LengthSquared(difference.vec));
+    return 2 * Math::ArcTan2(vec_length, Math::Abs(difference.w));
+}
+
+template <Math::FloatingPoint T>
+Math::SwingTwistDecomposition<T> Math::SwingTwist(const Quaternion<T>& q, const Vector3<T>& axis)
+{
+    const Vector3<T> norm_axis = Normalize(axis);
+    const Vector3<T> projection = norm_axis * Dot(q.vec, norm_axis);
+    Quaternion<T> twist(q.w, projection.x, projection.y, projection.z);
+    const T twist_length = Length(twist);
+
+    constexpr T k_epsilon = static_cast<T>(0.000001);
+    if (twist_length < k_epsilon)
+    {
+        return {q, Quaternion<T>::Identity()};
+    }
+    twist /= twist_length;
+    return {q * Conjugate(twist), twist};
+}
+
+template <Math::FloatingPoint T>
+Math::Quaternion<T> Math::Squad(T param,
+                                const Quaternion<T>& q1,
+                                const Quaternion<T>& a1,
+                                const Quaternion<T>& a2,
+                                const Quaternion<T>& q2)
+{
+    const Quaternion<T> keys = Slerp(param, q1, q2);
+    const Quaternion<T> controls = Slerp(param, a1, a2);
+    return Slerp(2 * param * (1 - param), keys, controls);
+}
+
+template <Math::FloatingPoint T>
+Math::Quaternion<T> Math::SquadControlPoint(const Quaternion<T>& q_prev,
+                                            const Quaternion<T>& q,
+                                            const Quaternion<T>& q_next)
+{
+    const Quaternion<T> q_inv = Conjugate(q);
+    const Quaternion<T> tangent = Log(q_inv * q_next) + Log(q_inv * q_prev);
+    return q * Exp(tangent * static_cast<T>(-0.25));
+}
@@ -0,0 +1,168 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <span>
+#include <vector>
+
+#include "math/parallel.h"
+
+namespace Math
+{
+
+/**
+ * Sort the keys in ascending order and reorder the values the same way, using a parallel least
+ * significant digit radix sort. The sort is stable.
+ * @tparam Key Type of the keys, for example Morton codes.
+ * @tparam Value Type of the values, usually indices of the sorted objects.
+ * @param keys The keys to sort.
+ * @param values The values that belong to the keys. Must have the same size as keys.
+ * @note Only the digits that are set in some key are sorted, so 30-bit keys take four passes.
+ */
+template <std::unsigned_integral Key, typename Value>
+void RadixSort(std::span<Key> keys, std::span<Value> values);
+
+}  // namespace Math
+
+// Implementation //////////////////////////////////////////////////////////////////////////////////
+
+namespace Math::Internal
+{
+
+inline constexpr uint32_t k_radix_bits = 8;
+inline constexpr size_t k_radix_size = size_t{1} << k_radix_bits;
+// Below this many keys per thread starting the threads costs more than it saves.
+inline constexpr size_t k_radix_sort_min_batch_size = 32 * 1024;
+
+}  // namespace Math::Internal
+
+template <std::unsigned_integral Key, typename Value>
+void Math::RadixSort(std::span<Key> keys, std::span<Value> values)
+{
+    using Histogram = std::array<size_t, Internal::k_radix_size>;
+    constexpr Key k_digit_mask = static_cast<Key>(Internal::k_radix_size - 1);
+
+    assert(keys.size() == values.size());
+    const size_t count = keys.size();
+    if (count < 2)
+    {
+        return;
+    }
+
+    // The batches are fixed for all the passes, a batch scatters the keys it counted.
+    const size_t batch_count =
+        std::clamp<size_t>(count / Internal::k_radix_sort_min_batch_size, 1, ThreadCount());
+    auto batch_begin = [&](size_t batch) { return batch * count / batch_count; };
+
+    std::vector<Key> used_bits(batch_count, 0);
+    ParallelFor(batch_count, 1,
+                [&](size_t first, size_t last)
+                {
+                    for (size_t batch = first; batch < last; ++batch)
+                    {
+                        const size_t begin = batch_begin(batch);
+                        const size_t end = batch_begin(batch + 1);
+                        Key bits = 0;
+                        for (size_t i = begin; i < end; ++i)
+                        {
+                            bits |= keys[i];
+                        }
+                        used_bits[batch] = bits;
+                    }
+                });
+    Key all_used_bits = 0;
+    for (const Key bits : used_bits)
+    {
+        all_used_bits |= bits;
+    }
+
+    std::vector<Key> key_buffer(count);
+    std::vector<Value> value_buffer(count);
+    std::span<Key> src_keys = keys;
+    std::span<Value> src_values = values;
+    std::span<Key> dst_keys = key_buffer;
+    std::span<Value> dst_values = value_buffer;
+    std::vector<Histogram> histograms(batch_count);
+
+    for (uint32_t shift = 0; shift < sizeof(Key) * 8 && (all_used_bits >> shift) != 0;
+         shift += Internal::k_radix_bits)
+    {
+        ParallelFor(batch_count, 1,
+                    [&, shift](size_t first, size_t last)
+                    {
+                        for (size_t batch = first; batch < last; ++batch)
+                        {
+                            const size_t begin = batch_begin(batch);
+                            const size_t end = batch_begin(batch + 1);
+                            const Key* in_keys = src_keys.data();
+                            Histogram& histogram = histograms[batch];
+                            histogram.fill(0);
+                            for (size_t i = begin; i < end; ++i)
+                            {
+                                ++histogram[(in_keys[i] >> shift) & k_digit_mask];
+                            }
+                        }
+                    });
+
+        // Skip the pass when all the keys have the same digit, it wouldn't change the order.
+        bool single_digit = false;
+        for (size_t digit = 0; digit < Internal::k_radix_size && !single_digit; ++digit)
+        {
+            size_t digit_count = 0;
+            for (const Histogram& histogram : histograms)
+            {
+                digit_count += histogram[digit];
+            }
+            single_digit = digit_count == count;
+        }
+        if (single_digit)
+        {
+            continue;
+        }
+
+        // Turn the counts into the first output position of every digit in every batch.
+        size_t offset = 0;
+        for (size_t digit = 0; digit < Internal::k_radix_size; ++digit)
+        {
+            for (Histogram& histogram : histograms)
+            {
+                const size_t digit_count = histogram[digit];
+                histogram[digit] = offset;
+                offset += digit_count;
+            }
+        }
+
+        ParallelFor(batch_count, 1,
+                    [&, shift](size_t first, size_t last)
+                    {
+                        for (size_t batch = first; batch < last; ++batch)
+                        {
+                            const size_t begin = batch_begin(batch);
+                            const size_t end = batch_begin(batch + 1);
+                            // Raw pointers, the stores could alias the members of the spans.
+                            const Key* in_keys = src_keys.data();
+                            const Value* in_values = src_values.data();
+                            Key* out_keys = dst_keys.data();
+                            Value* out_values = dst_values.data();
+                            Histogram& positions = histograms[batch];
+                            for (size_t i = begin; i < end; ++i)
+                            {
+                                const size_t position =
+                                    positions[(in_keys[i] >> shift) & k_digit_mask]++;
+                                out_keys[position] = in_keys[i];
+                                out_values[position] = in_values[i];
+                            }
+                        }
+                    });
+        std::swap(src_keys, dst_keys);
+        std::swap(src_values, dst_values);
+    }
+
+    if (src_keys.data() != keys.data())
+    {
+        std::copy(src_keys.begin(), src_keys.end(), keys.begin());
+        std::copy(src_values.begin(), src_values.end(), values.begin());
+    }
+}
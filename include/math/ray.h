@@ -0,0 +1,661 @@
+#pragma once
+
+#include <bit>
+#include <cassert>
+#include <span>
+#include <type_traits>
+
+#include "math/base.h"
+#include "math/bounds3.h"
+#include "math/point3.h"
+#include "math/simd.h"
+#include "math/vector3.h"
+
+namespace Math
+{
+
+/**
+ * Half-line starting at the origin and extending along the direction. The points on the ray are
+ * origin + t * direction for t >= 0, the direction doesn't have to be normalized.
+ */
+template <FloatingPoint T>
+struct Ray
+{
+    Point3<T> origin;
+    Vector3<T> direction;
+
+    /**
+     * Constructs a ray with uninitialized origin and direction.
+     */
+    constexpr Ray() = default;
+
+    /**
+     * Constructs a ray.
+     * @param ray_origin The origin.
+     * @param ray_direction The direction.
+     */
+    constexpr Ray(const Point3<T>& ray_origin, const Vector3<T>& ray_direction);
+
+    /**
+     * @param t The parameter along the ray.
+     * @return The point at the parameter.
+     */
+    constexpr Point3<T> operator()(T t) const;
+};
+
+/**
+ * Intersect the ray with the bounding box using the slab test. The far distance of every slab is
+ * enlarged by the bound on its rounding error, so a ray that touches the box is never reported as
+ * missing it, even at grazing angles or when it passes exactly through an edge.
+ * Based on: Physically Based Rendering, 3rd edition, section 3.9.2.
+ * @param ray The ray.
+ * @param b The bounding box.
+ * @param t_max The end of the ray segment to test.
+ * @param out_t0 The parameter where the ray enters the box, clamped to 0.
+ * @param out_t1 The parameter where the ray exits the box, clamped to t_max.
+ * @return True if the segment from 0 to t_max overlaps the box.
+ */
+template <FloatingPoint T>
+constexpr bool Intersect(const Ray<T>& ray, const Bounds3<T>& b, T t_max, T& out_t0, T& out_t1);
+
+/**
+ * Check if the ray intersects the bounding box, with the reciprocal of the direction computed once
+ * for testing one ray against many boxes. Conservative in the same way as the Intersect above.
+ * @param ray The ray.
+ * @param inverse_direction The reciprocal of every coordinate of the direction of the ray.
+ * @param b The bounding box.
+ * @param t_max The end of the ray segment to test.
+ * @return True if the segment from 0 to t_max overlaps the box.
+ */
+template <FloatingPoint T>
+constexpr bool Intersect(const Ray<T>& ray,
+                         const Vector3<T>& inverse_direction,
+                         const Bounds3<T>& b,
+                         T t_max);
+
+/**
+ * Where a ray hits a triangle.
+ */
+template <FloatingPoint T>
+struct TriangleIntersection
+{
+    /** The parameter along the ray. */
+    T t;
+    /** Barycentric coordinates of the hit, the point is b0 * p0 + b1 * p1 + b2 * p2. */
+    T b0;
+    T b1;
+    T b2;
+};
+
+/**
+ * Non-owning view of triangles stored as a structure of arrays, one contiguous array per coordinate
+ * of every vertex. All the arrays need to have the same size.
+ * @tparam T Type of the coordinates. Use a const type for a read-only view.
+ */
+template <typename T>
+struct TriangleSoA
+{
+    std::span<T> p0_x;
+    std::span<T> p0_y;
+    std::span<T> p0_z;
+    std::span<T> p1_x;
+    std::span<T> p1_y;
+    std::span<T> p1_z;
+    std::span<T> p2_x;
+    std::span<T> p2_y;
+    std::span<T> p2_z;
+
+    /**
+     * Constructs an empty view.
+     */
+    constexpr TriangleSoA() = default;
+
+    /**
+     * Constructs a view of the coordinate arrays.
+     */
+    constexpr TriangleSoA(std::span<T> p0_x_values,
+                          std::span<T> p0_y_values,
+                          std::span<T> p0_z_values,
+                          std::span<T> p1_x_values,
+                          std::span<T> p1_y_values,
+                          std::span<T> p1_z_values,
+                          std::span<T> p2_x_values,
+                          std::span<T> p2_y_values,
+                          std::span<T> p2_z_values);
+
+    /**
+     * Constructs a read-only view from a mutable view.
+     */
+    template <typename U>
+        requires std::is_same_v<T, const U>
+    constexpr TriangleSoA(const TriangleSoA<U>& other);
+
+    /**
+     * @return The number of triangles in the view.
+     */
+    [[nodiscard]] constexpr size_t Size() const;
+
+    /**
+     * Gather one vertex of a triangle.
+     * @param index The index of the triangle.
+     * @param vertex The vertex, 0, 1 or 2.
+     * @return The vertex.
+     */
+    [[nodiscard]] constexpr Point3<std::remove_const_t<T>> Get(size_t index, int32_t vertex) const;
+};
+
+/**
+ * Intersect the ray with the triangle. The test is watertight, a ray through an edge or a vertex
+ * shared by triangles hits at least one of them, and hits behind the origin within the rounding
+ * error are rejected. Both sides of the triangle are hit.
+ * Based on: Watertight Ray/Triangle Intersection, Woop, Benthin and Wald, 2013, and Physically
+ * Based Rendering, 3rd edition, section 3.9.6.
+ * @param ray The ray.
+ * @param p0 The first vertex.
+ * @param p1 The second vertex.
+ * @param p2 The third vertex.
+ * @param t_max The end of the ray segment to test.
+ * @param out_hit Where the ray hits the triangle, only written when there is a hit.
+ * @return True if the ray hits the triangle with t in (0, t_max].
+ */
+template <FloatingPoint T>
+constexpr bool Intersect(const Ray<T>& ray,
+                         const Point3<T>& p0,
+                         const Point3<T>& p1,
+                         const Point3<T>& p2,
+                         T t_max,
+                         TriangleIntersection<T>& out_hit);
+
+/**
+ * Find the closest triangle hit by the ray. Several triangles are tested at once with SIMD, the
+ * result is the same as testing the triangles one by one with Intersect.
+ * @param ray The ray.
+ * @param triangles The triangles.
+ * @param t_max The end of the ray segment to test.
+ * @param out_hit Where the ray hits the closest triangle, only written when there is a hit.
+ * @param out_index The index of the closest triangle, only written when there is a hit.
+ * @return True if the ray hits any triangle with t in (0, t_max].
+ */
+template <FloatingPoint T>
+bool IntersectNearest(const Ray<T>& ray,
+                      std::type_identity_t<TriangleSoA<const T>> triangles,
+                      T t_max,
+                      TriangleIntersection<T>& out_hit,
+                      size_t& out_index);
+
+}  // namespace Math
+
+// Implementation //////////////////////////////////////////////////////////////////////////////////
+
+namespace Math::Internal
+{
+
+/**
+ * Transform that moves the ray origin to zero and shears the ray direction to +z, with the
+ * coordinates permuted so that z is the largest dimension of the direction.
+ */
+template <FloatingPoint T>
+struct RayShear
+{
+    int32_t kx;
+    int32_t ky;
+    int32_t kz;
+    T sx;
+    T sy;
+    T sz;
+};
+
+template <FloatingPoint T>
+constexpr RayShear<T> ComputeRayShear(const Vector3<T>& direction)
+{
+    RayShear<T> shear;
+    shear.kz = MaxDimension(Abs(direction));
+    shear.kx = (shear.kz + 1) % 3;
+    shear.ky = (shear.kx + 1) % 3;
+    const Vector3<T> d = Permute(direction, shear.kx, shear.ky, shear.kz);
+    shear.sx = -d.x / d.z;
+    shear.sy = -d.y / d.z;
+    shear.sz = 1 / d.z;
+    return shear;
+}
+
+/**
+ * Bound on the rounding error of the parameter of a hit, for rejecting hits that may be behind the
+ * origin. Computed from the largest transformed coordinates and edge functions.
+ */
+template <FloatingPoint T>
+constexpr T TriangleHitError(T max_x, T max_y, T max_z, T max_e, T inverse_det)
+{
+    const T delta_z = Gamma<T>(3) * max_z;
+    const T delta_x = Gamma<T>(5) * (max_x + max_z);
+    const T delta_y = Gamma<T>(5) * (max_y + max_z);
+    const T delta_e = 2 * (Gamma<T>(2) * max_x * max_y + delta_y * max_x + delta_x * max_y);
+    return 3 * (Gamma<T>(3) * max_e * max_z + delta_e * max_z + delta_z * max_e) *
+           Math::Abs(inverse_det);
+}
+
+template <FloatingPoint T>
+constexpr bool IntersectTriangle(const RayShear<T>& shear,
+                                 const Point3<T>& origin,
+                                 const Point3<T>& p0,
+                                 const Point3<T>& p1,
+                                 const Point3<T>& p2,
+                                 T t_max,
+                                 TriangleIntersection<T>& out_hit)
+{
+    Vector3<T> p0t = Permute(p0 - origin, shear.kx, shear.ky, shear.kz);
+    Vector3<T> p1t = Permute(p1 - origin, shear.kx, shear.ky, shear.kz);
+    Vector3<T> p2t = Permute(p2 - origin, shear.kx, shear.ky, shear.kz);
+    p0t.x += shear.sx * p0t.z;
+    p0t.y += shear.sy * p0t.z;
+    p1t.x += shear.sx * p1t.z;
+    p1t.y += shear.sy * p1t.z;
+    p2t.x += shear.sx * p2t.z;
+    p2t.y += shear.sy * p2t.z;
+
+    // Edge functions, the ray passes through the triangle if they all have the same sign.
+    T e0 = p1t.x * p2t.y - p1t.y * p2t.x;
+    T e1 = p2t.x * p0t.y - p2t.y * p0t.x;
+    T e2 = p0t.x * p1t.y - p0t.y * p1t.x;
+    if constexpr (std::is_same_v<T, float>)
+    {
+        // The ray is on an edge as far as float can tell, the products are exact in double.
+        if (e0 == 0 || e1 == 0 || e2 == 0)
+        {
+            auto edge = [](const Vector3<T>& a, const Vector3<T>& b)
+            {
+                return static_cast<float>(static_cast<double>(a.x) * static_cast<double>(b.y) -
+                                          static_cast<double>(a.y) * static_cast<double>(b.x));
+            };
+            e0 = edge(p1t, p2t);
+            e1 = edge(p2t, p0t);
+            e2 = edge(p0t, p1t);
+        }
+    }
+    if ((e0 < 0 || e1 < 0 || e2 < 0) && (e0 > 0 || e1 > 0 || e2 > 0))
+    {
+        return false;
+    }
+    const T det = e0 + e1 + e2;
+    if (det == 0)
+    {
+        return false;
+    }
+
+    // The parameter is t_scaled / det, compared without dividing.
+    p0t.z *= shear.sz;
+    p1t.z *= shear.sz;
+    p2t.z *= shear.sz;
+    const T t_scaled = e0 * p0t.z + e1 * p1t.z + e2 * p2t.z;
+    if (det < 0 && (t_scaled >= 0 || t_scaled < t_max * det))
+    {
+        return false;
+    }
+    if (det > 0 && (t_scaled <= 0 || t_scaled > t_max * det))
+    {
+        return false;
+    }
+
+    const T inverse_det = 1 / det;
+    const T t = t_scaled * inverse_det;
+    const T max_x = MaxComponent(Vector3<T>(Math::Abs(p0t.x), Math::Abs(p1t.x), Math::Abs(p2t.x)));
+    const T max_y = MaxComponent(Vector3<T>(Math::Abs(p0t.y), Math::Abs(p1t.y), Math::Abs(p2t.y)));
+    const T max_z = MaxComponent(Vector3<T>(Math::Abs(p0t.z), Math::Abs(p1t.z), Math::Abs(p2t.z)));
+    const T max_e = MaxComponent(Vector3<T>(Math::Abs(e0), Math::Abs(e1), Math::Abs(e2)));
+    if (t <= TriangleHitError(max_x, max_y, max_z, max_e, inverse_det))
+    {
+        return false;
+    }
+
+    out_hit.t = t;
+    out_hit.b0 = e0 * inverse_det;
+    out_hit.b1 = e1 * inverse_det;
+    out_hit.b2 = e2 * inverse_det;
+    return true;
+}
+
+#if MATH_SIMD_SSE2
+
+/**
+ * The steps of IntersectTriangle for Lanes::k_width triangles at once, starting at index first.
+ * Lanes where an edge function is zero are finished by IntersectTriangle, since they need the
+ * double precision fallback. Updates the closest hit and returns true if it changed.
+ */
+template <typename Lanes>
+bool IntersectTriangleLanes(const RayShear<float>& shear,
+                            const Point3<float>& origin,
+                            const TriangleSoA<const float>& triangles,
+                            const float* const (&coordinates)[3][3],
+                            size_t first,
+                            float& t_max,
+                            TriangleIntersection<float>& out_hit,
+                            size_t& out_index)
+{
+    using Vec = typename Lanes::Vec;
+    const Vec zero = Lanes::Set(0);
+    Vec x[3];
+    Vec y[3];
+    Vec z[3];
+    for (size_t v = 0; v < 3; ++v)
+    {
+        z[v] = Lanes::Sub(Lanes::Load(coordinates[v][2] + first), Lanes::Set(origin[shear.kz]));
+        x[v] = Lanes::Sub(Lanes::Load(coordinates[v][0] + first), Lanes::Set(origin[shear.kx]));
+        y[v] = Lanes::Sub(Lanes::Load(coordinates[v][1] + first), Lanes::Set(origin[shear.ky]));
+        x[v] = Lanes::Add(x[v], Lanes::Mul(Lanes::Set(shear.sx), z[v]));
+        y[v] = Lanes::Add(y[v], Lanes::Mul(Lanes::Set(shear.sy), z[v]));
+    }
+
+    const Vec e0 = Lanes::Sub(Lanes::Mul(x[1], y[2]), Lanes::Mul(y[1], x[2]));
+    const Vec e1 = Lanes::Sub(Lanes::Mul(x[2], y[0]), Lanes::Mul(y[2], x[0]));
+    const Vec e2 = Lanes::Sub(Lanes::Mul(x[0], y[1]), Lanes::Mul(y[0], x[1]));
+    const uint32_t on_edge = Lanes::Mask(Lanes::Or(
+        Lanes::Or(Lanes::Equal(e0, zero), Lanes::Equal(e1, zero)), Lanes::Equal(e2, zero)));
+    const Vec negative = Lanes::Or(Lanes::Or(Lanes::Less(e0, zero), Lanes::Less(e1, zero)),
+                                   Lanes::Less(e2, zero));
+    const Vec positive = Lanes::Or(Lanes::Or(Lanes::Greater(e0, zero), Lanes::Greater(e1, zero)),
+                                   Lanes::Greater(e2, zero));
+
+    const Vec det = Lanes::Add(Lanes::Add(e0, e1), e2);
+    const Vec sz = Lanes::Set(shear.sz);
+    for (size_t v = 0; v < 3; ++v)
+    {
+        z[v] = Lanes::Mul(z[v], sz);
+    }
+    const Vec t_scaled = Lanes::Add(Lanes::Add(Lanes::Mul(e0, z[0]), Lanes::Mul(e1, z[1])),
+                                    Lanes::Mul(e2, z[2]));
+    const Vec inverse_det = Lanes::Div(Lanes::Set(1), det);
+    const Vec t = Lanes::Mul(t_scaled, inverse_det);
+
+    // Same error bound as TriangleHitError, with the products in the same order.
+    auto max3 = [](Vec a, Vec b, Vec c)
+    { return Lanes::Max(Lanes::Max(Lanes::Abs(a), Lanes::Abs(b)), Lanes::Abs(c)); };
+    const Vec max_x = max3(x[0], x[1], x[2]);
+    const Vec max_y = max3(y[0], y[1], y[2]);
+    const Vec max_z = max3(z[0], z[1], z[2]);
+    const Vec max_e = max3(e0, e1, e2);
+    const Vec delta_z = Lanes::Mul(Lanes::Set(Gamma<float>(3)), max_z);
+    const Vec delta_x = Lanes::Mul(Lanes::Set(Gamma<float>(5)), Lanes::Add(max_x, max_z));
+    const Vec delta_y = Lanes::Mul(Lanes::Set(Gamma<float>(5)), Lanes::Add(max_y, max_z));
+    const Vec delta_e = Lanes::Mul(
+        Lanes::Set(2),
+        Lanes::Add(Lanes::Add(Lanes::Mul(Lanes::Mul(Lanes::Set(Gamma<float>(2)), max_x), max_y),
+                              Lanes::Mul(delta_y, max_x)),
+                   Lanes::Mul(delta_x, max_y)));
+    const Vec delta_t = Lanes::Mul(
+        Lanes::Mul(Lanes::Set(3),
+                   Lanes::Add(Lanes::Add(Lanes::Mul(Lanes::Mul(Lanes::Set(Gamma<float>(3)), max_e),
+                                                    max_z),
+                                         Lanes::Mul(delta_e, max_z)),
+                              Lanes::Mul(delta_z, max_e))),
+        Lanes::Abs(inverse_det));
+
+    // The range of t is tested as t_scaled against t_max * det, without dividing, like
+    // IntersectTriangle.
+    const Vec t_max_scaled = Lanes::Mul(Lanes::Set(t_max), det);
+    const Vec in_front = Lanes::Or(
+        Lanes::And(Lanes::Greater(det, zero),
+                   Lanes::And(Lanes::Greater(t_scaled, zero),
+                              Lanes::LessEqual(t_scaled, t_max_scaled))),
+        Lanes::And(Lanes::Less(det, zero),
+                   Lanes::And(Lanes::Less(t_scaled, zero),
+                              Lanes::LessEqual(t_max_scaled, t_scaled))));
+    const Vec rejected = Lanes::Or(Lanes::And(negative, positive), Lanes::Equal(det, zero));
+    const Vec hit = Lanes::AndNot(rejected, Lanes::And(Lanes::Greater(t, delta_t), in_front));
+    const uint32_t hits = Lanes::Mask(hit) & ~on_edge;
+    if (hits == 0 && on_edge == 0)
+    {
+        return false;
+    }
+
+    alignas(32) float t_values[Lanes::k_width];
+    alignas(32) float t_scaled_values[Lanes::k_width];
+    alignas(32) float det_values[Lanes::k_width];
+    alignas(32) float e_values[3][Lanes::k_width];
+    alignas(32) float inverse_det_values[Lanes::k_width];
+    Lanes::Store(t_values, t);
+    Lanes::Store(t_scaled_values, t_scaled);
+    Lanes::Store(det_values, det);
+    Lanes::Store(e_values[0], e0);
+    Lanes::Store(e_values[1], e1);
+    Lanes::Store(e_values[2], e2);
+    Lanes::Store(inverse_det_values, inverse_det);
+    bool found = false;
+    // The lanes are merged in index order, with the ones on an edge tested by IntersectTriangle,
+    // so ties in t resolve like testing the triangles one by one.
+    for (uint32_t lanes = hits | on_edge; lanes != 0; lanes &= lanes - 1)
+    {
+        const auto lane = static_cast<size_t>(std::countr_zero(lanes));
+        if ((on_edge >> lane) & 1u)
+        {
+            if (IntersectTriangle(shear, origin, triangles.Get(first + lane, 0),
+                                  triangles.Get(first + lane, 1), triangles.Get(first + lane, 2),
+                                  t_max, out_hit))
+            {
+                t_max = out_hit.t;
+                out_index = first + lane;
+                found = true;
+            }
+            continue;
+        }
+        // The closest hit so far can have lowered t_max since the lanes were tested.
+        const float t_max_scaled_lane = t_max * det_values[lane];
+        if (det_values[lane] > 0 ? t_scaled_values[lane] <= t_max_scaled_lane
+                                 : t_scaled_values[lane] >= t_max_scaled_lane)
+        {
+            t_max = t_values[lane];
+            out_hit.t = t_values[lane];
+            out_hit.b0 = e_values[0][lane] * inverse_det_values[lane];
+            out_hit.b1 = e_values[1][lane] * inverse_det_values[lane];
+            out_hit.b2 = e_values[2][lane] * inverse_det_values[lane];
+            out_index = first + lane;
+            found = true;
+        }
+    }
+    return found;
+}
+
+#endif
+
+}  // namespace Math::Internal
+
+template <Math::FloatingPoint T>
+constexpr Math::Ray<T>::Ray(const Point3<T>& ray_origin, const Vector3<T>& ray_direction)
+    : origin(ray_origin), direction(ray_direction)
+{
+}
+
+template <Math::FloatingPoint T>
+constexpr Math::Point3<T> Math::Ray<T>::operator()(T t) const
+{
+    return origin + direction * t;
+}
+
+template <Math::FloatingPoint T>
+constexpr bool Math::Intersect(const Ray<T>& ray,
+                               const Bounds3<T>& b,
+                               T t_max,
+                               T& out_t0,
+                               T& out_t1)
+{
+    T t0 = 0;
+    T t1 = t_max;
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        // A zero direction gives infinite distances, or NaN when the origin is on the slab plane.
+        // The comparisons below are written to ignore NaN.
+        const T inverse_direction = 1 / ray.direction[axis];
+        T t_near = (b.min[axis] - ray.origin[axis]) * inverse_direction;
+        T t_far = (b.max[axis] - ray.origin[axis]) * inverse_direction;
+        if (t_near > t_far)
+        {
+            const T swap = t_near;
+            t_near = t_far;
+            t_far = swap;
+        }
+        // The subtraction and the multiplication each round once, so the distances are within
+        // a factor of 1 + Gamma(3) of the exact distances.
+        t_far *= 1 + 2 * Gamma<T>(3);
+        t0 = t_near > t0 ? t_near : t0;
+        t1 = t_far < t1 ? t_far : t1;
+        if (t0 > t1)
+        {
+            return false;
+        }
+    }
+    out_t0 = t0;
+    out_t1 = t1;
+    return true;
+}
+
+template <Math::FloatingPoint T>
+constexpr bool Math::Intersect(const Ray<T>& ray,
+                               const Vector3<T>& inverse_direction,
+                               const Bounds3<T>& b,
+                               T t_max)
+{
+    T t0 = 0;
+    T t1 = t_max;
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        const bool negative = inverse_direction[axis] < 0;
+        const T t_near = ((negative ? b.max[axis] : b.min[axis]) - ray.origin[axis]) *
+                         inverse_direction[axis];
+        const T t_far = ((negative ? b.min[axis] : b.max[axis]) - ray.origin[axis]) *
+                        inverse_direction[axis] * (1 + 2 * Gamma<T>(3));
+        t0 = t_near > t0 ? t_near : t0;
+        t1 = t_far < t1 ? t_far : t1;
+        if (t0 > t1)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename T>
+constexpr Math::TriangleSoA<T>::TriangleSoA(std::span<T> p0_x_values,
+                                            std::span<T> p0_y_values,
+                                            std::span<T> p0_z_values,
+                                            std::span<T> p1_x_values,
+                                            std::span<T> p1_y_values,
+                                            std::span<T> p1_z_values,
+                                            std::span<T> p2_x_values,
+                                            std::span<T> p2_y_values,
+                                            std::span<T> p2_z_values)
+    : p0_x(p0_x_values),
+      p0_y(p0_y_values),
+      p0_z(p0_z_values),
+      p1_x(p1_x_values),
+      p1_y(p1_y_values),
+      p1_z(p1_z_values),
+      p2_x(p2_x_values),
+      p2_y(p2_y_values),
+      p2_z(p2_z_values)
+{
+    assert(p0_x.size() == p0_y.size() && p0_x.size() == p0_z.size() &&
+           p0_x.size() == p1_x.size() && p0_x.size() == p1_y.size() &&
+           p0_x.size() == p1_z.size() && p0_x.size() == p2_x.size() &&
+           p0_x.size() == p2_y.size() && p0_x.size() == p2_z.size());
+}
+
+template <typename T>
+template <typename U>
+    requires std::is_same_v<T, const U>
+constexpr Math::TriangleSoA<T>::TriangleSoA(const TriangleSoA<U>& other)
+    : p0_x(other.p0_x),
+      p0_y(other.p0_y),
+      p0_z(other.p0_z),
+      p1_x(other.p1_x),
+      p1_y(other.p1_y),
+      p1_z(other.p1_z),
+      p2_x(other.p2_x),
+      p2_y(other.p2_y),
+      p2_z(other.p2_z)
+{
+}
+
+template <typename T>
+constexpr size_t Math::TriangleSoA<T>::Size() const
+{
+    return p0_x.size();
+}
+
+template <typename T>
+constexpr Math::Point3<std::remove_const_t<T>> Math::TriangleSoA<T>::Get(size_t index,
+                                                                         int32_t vertex) const
+{
+    assert(vertex >= 0 && vertex <= 2);
+    if (vertex == 0)
+    {
+        return Point3<std::remove_const_t<T>>(p0_x[index], p0_y[index], p0_z[index]);
+    }
+    if (vertex == 1)
+    {
+        return Point3<std::remove_const_t<T>>(p1_x[index], p1_y[index], p1_z[index]);
+    }
+    return Point3<std::remove_const_t<T>>(p2_x[index], p2_y[index], p2_z[index]);
+}
+
+template <Math::FloatingPoint T>
+constexpr bool Math::Intersect(const Ray<T>& ray,
+                               const Point3<T>& p0,
+                               const Point3<T>& p1,
+                               const Point3<T>& p2,
+                               T t_max,
+                               TriangleIntersection<T>& out_hit)
+{
+    const Internal::RayShear<T> shear = Internal::ComputeRayShear(ray.direction);
+    return Internal::IntersectTriangle(shear, ray.origin, p0, p1, p2, t_max, out_hit);
+}
+
+template <Math::FloatingPoint T>
+bool Math::IntersectNearest(const Ray<T>& ray,
+                            std::type_identity_t<TriangleSoA<const T>> triangles,
+                            T t_max,
+                            TriangleIntersection<T>& out_hit,
+                            size_t& out_index)
+{
+    const Internal::RayShear<T> shear = Internal::ComputeRayShear(ray.direction);
+    const size_t count = triangles.Size();
+    bool found = false;
+    size_t i = 0;
+#if MATH_SIMD_SSE2
+    if constexpr (std::is_same_v<T, float>)
+    {
+        // The coordinates in the permuted order of the shear, so the kernel needs no shuffles.
+        const std::span<const float> spans[3][3] = {
+            {triangles.p0_x, triangles.p0_y, triangles.p0_z},
+            {triangles.p1_x, triangles.p1_y, triangles.p1_z},
+            {triangles.p2_x, triangles.p2_y, triangles.p2_z}};
+        const float* coordinates[3][3];
+        for (size_t v = 0; v < 3; ++v)
+        {
+            coordinates[v][0] = spans[v][shear.kx].data();
+            coordinates[v][1] = spans[v][shear.ky].data();
+            coordinates[v][2] = spans[v][shear.kz].data();
+        }
+#if MATH_SIMD_AVX
+        using Lanes = Internal::LanesAVX;
+#else
+        using Lanes = Internal::LanesSSE;
+#endif
+        for (; i + Lanes::k_width <= count; i += Lanes::k_width)
+        {
+            found |= Internal::IntersectTriangleLanes<Lanes>(shear, ray.origin, triangles,
+                                                             coordinates, i, t_max, out_hit,
+                                                             out_index);
+        }
+    }
+#endif
+    for (; i < count; ++i)
+    {
+        if (Internal::IntersectTriangle(shear, ray.origin, triangles.Get(i, 0), triangles.Get(i, 1),
+                                        triangles.Get(i, 2), t_max, out_hit))
+        {
+            t_max = out_hit.t;
+            out_index = i;
+            found = true;
+        }
+    }
+    return found;
+}
@@ -43,24 +43,24 @@ struct Rotator
      * Returns rotator with zero rotation.
      * @return Rotator with zero rotation.
      */
-    static Rotator Zero();
+    static constexpr Rotator Zero();
 
     /** Operator overloads. */
 
-    bool operator==(const Rotator& other) const;
-    bool operator!=(const Rotator& other) const;
+    constexpr bool operator==(const Rotator& other) const;
+    constexpr bool operator!=(const Rotator& other) const;
 
-    Rotator operator+(const Rotator& other) const;
-    Rotator& operator+=(const Rotator& other);
-    Rotator operator-(const Rotator& other) const;
-    Rotator& operator-=(const Rotator& other);
+    constexpr Rotator operator+(const Rotator& other) const;
+    constexpr Rotator& operator+=(const Rotator& other);
+    constexpr Rotator operator-(const Rotator& other) const;
+    constexpr Rotator& operator-=(const Rotator& other);
 
-    Rotator operator*(T val) const;
-    Rotator& operator*=(T val);
+    constexpr Rotator operator*(T val) const;
+    constexpr Rotator& operator*=(T val);
 };
 
 template <Math::FloatingPoint T>
-Rotator<T> operator*(T val, const Rotator<T>& rot);
+constexpr Rotator<T> operator*(T val, const Rotator<T>& rot);
 
 /**
  * Returns a normalized vector defined by the angles in the rotator.
@@ -69,7 +69,7 @@ Rotator<T> operator*(T val, const Rotator<T>& rot);
  * @return Normalized vector.
  */
 template <Math::FloatingPoint T>
-[[nodiscard]] Vector3<T> RotatorToVector(const Rotator<T>& rot);
+[[nodiscard]] constexpr Vector3<T> RotatorToVector(const Rotator<T>& rot);
 
 /**
  * Returns a vector where each component stores the rotation angle in degrees around
@@ -79,7 +79,7 @@ template <Math::FloatingPoint T>
  * @return Vector with rotation angles.
  */
 template <Math::FloatingPoint T>
-[[nodiscard]] Vector3<T> RotatorToEuler(const Rotator<T>& rot);
+[[nodiscard]] constexpr Vector3<T> RotatorToEuler(const Rotator<T>& rot);
 
 }  // namespace Math
 
@@ -98,31 +98,31 @@ constexpr Math::Rotator<T>::Rotator(T pitch, T yaw, T roll)
 }
 
 template <Math::FloatingPoint T>
-Math::Rotator<T> Math::Rotator<T>::Zero()
+constexpr Math::Rotator<T> Math::Rotator<T>::Zero()
 {
     return Rotator<T>{0, 0, 0};
 }
 
 template <Math::FloatingPoint T>
-bool Math::Rotator<T>::operator==(const Rotator& other) const
+constexpr bool Math::Rotator<T>::operator==(const Rotator& other) const
 {
     return pitch == other.pitch && yaw == other.yaw && roll == other.roll;
 }
 
 template <Math::FloatingPoint T>
-bool Math::Rotator<T>::operator!=(const Rotator& other) const
+constexpr bool Math::Rotator<T>::operator!=(const Rotator& other) const
 {
     return !(*this == other);
 }
 
 template <Math::FloatingPoint T>
-Math::Rotator<T> Math::Rotator<T>::operator+(const Rotator& other) const
+constexpr Math::Rotator<T> Math::Rotator<T>::operator+(const Rotator& other) const
 {
     return Rotator<T>{pitch + other.pitch, yaw + other.yaw, roll + other.roll};
 }
 
 template <Math::FloatingPoint T>
-Math::Rotator<T>& Math::Rotator<T>::operator+=(const Rotator& other)
+constexpr Math::Rotator<T>& Math::Rotator<T>::operator+=(const Rotator& other)
 {
     pitch += other.pitch;
     yaw += other.yaw;
@@ -131,13 +131,13 @@ Math::Rotator<T>& Math::Rotator<T>::operator+=(const Rotator& other)
 }
 
 template <Math::FloatingPoint T>
-Math::Rotator<T> Math::Rotator<T>::operator-(const Rotator& other) const
+constexpr Math::Rotator<T> Math::Rotator<T>::operator-(const Rotator& other) const
 {
     return Rotator<T>{pitch - other.pitch, yaw - other.yaw, roll - other.roll};
 }
 
 template <Math::FloatingPoint T>
-Math::Rotator<T>& Math::Rotator<T>::operator-=(const Rotator& other)
+constexpr Math::Rotator<T>& Math::Rotator<T>::operator-=(const Rotator& other)
 {
     pitch -= other.pitch;
     yaw -= other.yaw;
@@ -146,13 +146,13 @@ Math::Rotator<T>& Math::Rotator<T>::operator-=(const Rotator& other)
 }
 
 template <Math::FloatingPoint T>
-Math::Rotator<T> Math::Rotator<T>::operator*(T val) const
+constexpr Math::Rotator<T> Math::Rotator<T>::operator*(T val) const
 {
     return Rotator<T>{pitch * val, yaw * val, roll * val};
 }
 
 template <Math::FloatingPoint T>
-Math::Rotator<T>& Math::Rotator<T>::operator*=(T val)
+constexpr Math::Rotator<T>& Math::Rotator<T>::operator*=(T val)
 {
     pitch *= val;
     yaw *= val;
@@ -161,13 +161,13 @@ Math::Rotator<T>& Math::Rotator<T>::operator*=(T val)
 }
 
 template <Math::FloatingPoint T>
-Math::Rotator<T> Math::operator*(T val, const Rotator<T>& rot)
+constexpr Math::Rotator<T> Math::operator*(T val, const Rotator<T>& rot)
 {
     return rot * val;
 }
 
 template <Math::FloatingPoint T>
-Math::Vector3<T> Math::RotatorToVector(const Rotator<T>& rot)
+constexpr Math::Vector3<T> Math::RotatorToVector(const Rotator<T>& rot)
 {
     const T pitch_no_winding = Mod(rot.pitch, static_cast<T>(360.0));
     const T yaw_no_winding = Mod(rot.yaw, static_cast<T>(360.0));
@@ -180,7 +180,7 @@ Math::Vector3<T> Math::RotatorToVector(const Rotator<T>& rot)
 }
 
 template <Math::FloatingPoint T>
-Math::Vector3<T> Math::RotatorToEuler(const Rotator<T>& rot)
+constexpr Math::Vector3<T> Math::RotatorToEuler(const Rotator<T>& rot)
 {
     return Vector3<T>{rot.roll, rot.yaw, rot.pitch};
 }
@@ -0,0 +1,166 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Detection of the SIMD instruction sets used by the batch functions. Every SIMD code path has a
+// scalar fallback, define MATH_NO_SIMD to force the fallback.
+#if !defined(MATH_NO_SIMD) && \
+    (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define MATH_SIMD_SSE2 1
+#include <emmintrin.h>
+#else
+#define MATH_SIMD_SSE2 0
+#endif
+
+#if !defined(MATH_NO_SIMD) && defined(__AVX__)
+#define MATH_SIMD_AVX 1
+#include <immintrin.h>
+#else
+#define MATH_SIMD_AVX 0
+#endif
+
+// BMI2 has no dedicated MSVC macro, but every CPU with AVX2 supports it.
+#if !defined(MATH_NO_SIMD) && (defined(__BMI2__) || (defined(_MSC_VER) && defined(__AVX2__)))
+#define MATH_SIMD_BMI2 1
+#include <immintrin.h>
+#else
+#define MATH_SIMD_BMI2 0
+#endif
+
+// F16C has no dedicated MSVC macro either, but every CPU with AVX2 supports it.
+#if !defined(MATH_NO_SIMD) && (defined(__F16C__) || (defined(_MSC_VER) && defined(__AVX2__)))
+#define MATH_SIMD_F16C 1
+#include <immintrin.h>
+#else
+#define MATH_SIMD_F16C 0
+#endif
+
+#if MATH_SIMD_SSE2
+
+namespace Math::Internal
+{
+
+/**
+ * Select a where the mask is set and b otherwise.
+ */
+inline __m128 Select(__m128 mask, __m128 a, __m128 b)
+{
+    return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+/**
+ * Multiply add, a * b + c.
+ */
+inline __m128 MulAdd(__m128 a, __m128 b, __m128 c)
+{
+    return _mm_add_ps(_mm_mul_ps(a, b), c);
+}
+
+/**
+ * Absolute value of every lane.
+ */
+inline __m128 AbsSSE(__m128 v)
+{
+    return _mm_andnot_ps(_mm_set1_ps(-0.0f), v);
+}
+
+/**
+ * Load four consecutive xyz triples, such as four Point3<float>, and transpose them to one register
+ * per coordinate.
+ */
+inline void Load3x4SSE(const float* f, __m128& x, __m128& y, __m128& z)
+{
+    const __m128 a = _mm_loadu_ps(f);      // x0 y0 z0 x1
+    const __m128 b = _mm_loadu_ps(f + 4);  // y1 z1 x2 y2
+    const __m128 c = _mm_loadu_ps(f + 8);  // z2 x3 y3 z3
+    x = _mm_shuffle_ps(a, _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 3, 0));
+    y = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)),
+                       _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+    z = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)),
+                       _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+}
+
+/**
+ * Transpose one register per coordinate back to four consecutive xyz triples, the reverse of
+ * Load3x4SSE.
+ */
+inline void Store3x4SSE(float* f, __m128 x, __m128 y, __m128 z)
+{
+    const __m128 xy_low = _mm_unpacklo_ps(x, y);                           // x0 y0 x1 y1
+    const __m128 xy_high = _mm_unpackhi_ps(x, y);                          // x2 y2 x3 y3
+    const __m128 yz_low = _mm_unpacklo_ps(y, z);                           // y0 z0 y1 z1
+    const __m128 yz_high = _mm_unpackhi_ps(y, z);                          // y2 z2 y3 z3
+    const __m128 zx_low = _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0));   // z0 z0 x1 x1
+    const __m128 zx_high = _mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2));  // z2 z2 x3 x3
+    _mm_storeu_ps(f, _mm_shuffle_ps(xy_low, zx_low, _MM_SHUFFLE(2, 0, 1, 0)));
+    _mm_storeu_ps(f + 4, _mm_shuffle_ps(yz_low, xy_high, _MM_SHUFFLE(1, 0, 3, 2)));
+    _mm_storeu_ps(f + 8, _mm_shuffle_ps(zx_high, yz_high, _MM_SHUFFLE(3, 2, 2, 0)));
+}
+
+/**
+ * Four float lanes, for kernels that are written once for several vector widths.
+ */
+struct LanesSSE
+{
+    using Vec = __m128;
+    static constexpr size_t k_width = 4;
+
+    static Vec Load(const float* p) { return _mm_loadu_ps(p); }
+    static void Store(float* p, Vec a) { _mm_storeu_ps(p, a); }
+    static Vec Set(float value) { return _mm_set1_ps(value); }
+    static Vec Add(Vec a, Vec b) { return _mm_add_ps(a, b); }
+    static Vec Sub(Vec a, Vec b) { return _mm_sub_ps(a, b); }
+    static Vec Mul(Vec a, Vec b) { return _mm_mul_ps(a, b); }
+    static Vec Div(Vec a, Vec b) { return _mm_div_ps(a, b); }
+    static Vec Max(Vec a, Vec b) { return _mm_max_ps(a, b); }
+    static Vec Abs(Vec a) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+    static Vec And(Vec a, Vec b) { return _mm_and_ps(a, b); }
+    static Vec AndNot(Vec a, Vec b) { return _mm_andnot_ps(a, b); }
+    static Vec Or(Vec a, Vec b) { return _mm_or_ps(a, b); }
+    static Vec Less(Vec a, Vec b) { return _mm_cmplt_ps(a, b); }
+    static Vec LessEqual(Vec a, Vec b) { return _mm_cmple_ps(a, b); }
+    static Vec Greater(Vec a, Vec b) { return _mm_cmpgt_ps(a, b); }
+    static Vec Equal(Vec a, Vec b) { return _mm_cmpeq_ps(a, b); }
+    static uint32_t Mask(Vec a) { return static_cast<uint32_t>(_mm_movemask_ps(a)); }
+};
+
+}  // namespace Math::Internal
+
+#endif
+
+#if MATH_SIMD_AVX
+
+namespace Math::Internal
+{
+
+/**
+ * Eight float lanes, see LanesSSE.
+ */
+struct LanesAVX
+{
+    using Vec = __m256;
+    static constexpr size_t k_width = 8;
+
+    static Vec Load(const float* p) { return _mm256_loadu_ps(p); }
+    static void Store(float* p, Vec a) { _mm256_storeu_ps(p, a); }
+    static Vec Set(float value) { return _mm256_set1_ps(value); }
+    static Vec Add(Vec a, Vec b) { return _mm256_add_ps(a, b); }
+    static Vec Sub(Vec a, Vec b) { return _mm256_sub_ps(a, b); }
+    static Vec Mul(Vec a, Vec b) { return _mm256_mul_ps(a, b); }
+    static Vec Div(Vec a, Vec b) { return _mm256_div_ps(a, b); }
+    static Vec Max(Vec a, Vec b) { return _mm256_max_ps(a, b); }
+    static Vec Abs(Vec a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+    static Vec And(Vec a, Vec b) { return _mm256_and_ps(a, b); }
+    static Vec AndNot(Vec a, Vec b) { return _mm256_andnot_ps(a, b); }
+    static Vec Or(Vec a, Vec b) { return _mm256_or_ps(a, b); }
+    static Vec Less(Vec a, Vec b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+    static Vec LessEqual(Vec a, Vec b) { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+    static Vec Greater(Vec a, Vec b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+    static Vec Equal(Vec a, Vec b) { return _mm256_cmp_ps(a, b, _CMP_EQ_OQ); }
+    static uint32_t Mask(Vec a) { return static_cast<uint32_t>(_mm256_movemask_ps(a)); }
+};
+
+}  // namespace Math::Internal
+
+#endif
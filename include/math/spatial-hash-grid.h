@@ -0,0 +1,321 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "math/base.h"
+#include "math/parallel.h"
+#include "math/point3.h"
+#include "math/radix-sort.h"
+
+namespace Math
+{
+
+/**
+ * Uniform grid over unbounded space for neighbour queries on points. The cells are hashed into a
+ * table with a bucket per point, the points are stored sorted by bucket in flat arrays so that the
+ * points of a bucket are contiguous in memory.
+ * Based on: Optimized Spatial Hashing for Collision Detection of Deformable Objects, Teschner et
+ * al., 2003.
+ */
+template <FloatingPoint T>
+struct SpatialHashGrid
+{
+    /** Size of the cells, queries are fastest with a radius close to it. */
+    T cell_size;
+    /** The points sorted by bucket. */
+    std::vector<Point3<T>> points;
+    /** Index of the sorted points in the span passed to Build(). */
+    std::vector<uint32_t> indices;
+    /** Index of the first point of every bucket, followed by the number of points. */
+    std::vector<uint32_t> bucket_start;
+
+    /**
+     * Constructs an empty grid.
+     * @param grid_cell_size Size of the cells, must be greater than zero.
+     */
+    explicit SpatialHashGrid(T grid_cell_size);
+};
+
+/**
+ * Sort the points into the grid, the storage of the grid is reused. Runs in parallel on
+ * ThreadCount() threads.
+ * @param points The points.
+ * @param grid The grid to build.
+ */
+template <FloatingPoint T>
+void Build(std::type_identity_t<std::span<const Point3<T>>> points, SpatialHashGrid<T>& grid);
+
+/**
+ * Call func(index, distance_squared) for every point within the radius around the center. The
+ * order of the points is unspecified.
+ * @param grid The grid.
+ * @param center Center of the query.
+ * @param radius Radius of the query, points at exactly this distance are included.
+ * @param func The function to call with the index of the point and its squared distance.
+ */
+template <FloatingPoint T, typename Func>
+void ForEachInRadius(const SpatialHashGrid<T>& grid,
+                     const Point3<T>& center,
+                     T radius,
+                     Func&& func);
+
+/**
+ * Find the nearest points to the center, k is the size of the output spans.
+ * @param grid The grid.
+ * @param center Center of the query.
+ * @param indices Output for the indices of the nearest points, sorted by distance.
+ * @param distances_squared Output for the squared distances. Must have the same size as indices.
+ * @return The number of points found, which is k unless the grid has fewer points.
+ */
+template <FloatingPoint T>
+size_t FindNearest(const SpatialHashGrid<T>& grid,
+                   const Point3<T>& center,
+                   std::span<uint32_t> indices,
+                   std::type_identity_t<std::span<T>> distances_squared);
+
+}  // namespace Math
+
+// Implementation //////////////////////////////////////////////////////////////////////////////////
+
+namespace Math::Internal
+{
+
+inline constexpr size_t k_grid_min_batch_size = 16 * 1024;
+// Number of buckets a query can visit without allocating.
+inline constexpr size_t k_grid_query_buckets = 64;
+// Cell coordinates are clamped to this magnitude, so they fit in int32_t with room to iterate.
+inline constexpr int32_t k_grid_max_cell = 1 << 30;
+
+struct GridCell
+{
+    int32_t x;
+    int32_t y;
+    int32_t z;
+};
+
+template <FloatingPoint T>
+int32_t CellCoordinate(T value, T inv_cell_size)
+{
+    constexpr auto k_max = static_cast<T>(k_grid_max_cell);
+    return static_cast<int32_t>(Math::Clamp(Math::Floor(value * inv_cell_size), -k_max, k_max));
+}
+
+template <FloatingPoint T>
+GridCell CellOf(const Point3<T>& p, T inv_cell_size)
+{
+    return {CellCoordinate(p.x, inv_cell_size), CellCoordinate(p.y, inv_cell_size),
+            CellCoordinate(p.z, inv_cell_size)};
+}
+
+inline uint32_t HashCell(int32_t x, int32_t y, int32_t z, uint32_t mask)
+{
+    uint32_t hash = (static_cast<uint32_t>(x) * 73856093u) ^
+                    (static_cast<uint32_t>(y) * 19349663u) ^ (static_cast<uint32_t>(z) * 83492791u);
+    // The products only move bits up, mix the high bits into the low bits that the mask keeps.
+    hash ^= hash >> 15;
+    hash *= 0x2c1b3c6du;
+    hash ^= hash >> 12;
+    return hash & mask;
+}
+
+/**
+ * Call func(begin, end) with the range of the sorted points of every bucket that the cells in the
+ * range hash to. Every bucket is visited once, even if several cells hash to it.
+ * @return True if the range has more cells than buckets and every point was visited at once.
+ */
+template <FloatingPoint T, typename Func>
+bool ForEachBucket(const SpatialHashGrid<T>& grid,
+                   const GridCell& min_cell,
+                   const GridCell& max_cell,
+                   Func&& func)
+{
+    const auto mask = static_cast<uint32_t>(grid.bucket_start.size() - 2);
+    // Multiplied one axis at a time and stopped past the mask, the full product can overflow.
+    int64_t cell_count = 1;
+    for (const int64_t extent : {int64_t{max_cell.x} - min_cell.x + 1,
+                                 int64_t{max_cell.y} - min_cell.y + 1,
+                                 int64_t{max_cell.z} - min_cell.z + 1})
+    {
+        cell_count *= extent;
+        // A large range covers every bucket, visit them all at once.
+        if (cell_count > static_cast<int64_t>(mask))
+        {
+            func(size_t{0}, grid.points.size());
+            return true;
+        }
+    }
+
+    std::array<uint32_t, k_grid_query_buckets> local_buckets;
+    std::vector<uint32_t> heap_buckets;
+    std::span<uint32_t> buckets = local_buckets;
+    if (cell_count > static_cast<int64_t>(local_buckets.size()))
+    {
+        heap_buckets.resize(static_cast<size_t>(cell_count));
+        buckets = heap_buckets;
+    }
+
+    size_t bucket_count = 0;
+    for (int32_t z = min_cell.z; z <= max_cell.z; ++z)
+    {
+        for (int32_t y = min_cell.y; y <= max_cell.y; ++y)
+        {
+            for (int32_t x = min_cell.x; x <= max_cell.x; ++x)
+            {
+                buckets[bucket_count++] = HashCell(x, y, z, mask);
+            }
+        }
+    }
+    std::sort(buckets.begin(), buckets.begin() + static_cast<ptrdiff_t>(bucket_count));
+    uint32_t previous = UINT32_MAX;
+    for (size_t i = 0; i < bucket_count; ++i)
+    {
+        const uint32_t bucket = buckets[i];
+        if (bucket != previous)
+        {
+            func(size_t{grid.bucket_start[bucket]}, size_t{grid.bucket_start[bucket + 1]});
+            previous = bucket;
+        }
+    }
+    return false;
+}
+
+}  // namespace Math::Internal
+
+template <Math::FloatingPoint T>
+Math::SpatialHashGrid<T>::SpatialHashGrid(T grid_cell_size)
+    : cell_size(grid_cell_size), bucket_start(2, 0)
+{
+    assert(grid_cell_size > 0);
+}
+
+template <Math::FloatingPoint T>
+void Math::Build(std::type_identity_t<std::span<const Point3<T>>> points, SpatialHashGrid<T>& grid)
+{
+    assert(grid.cell_size > 0);
+    assert(points.size() < UINT32_MAX);
+    const auto count = static_cast<uint32_t>(points.size());
+    const uint32_t bucket_count = std::bit_ceil(Math::Max(count, 1u));
+    const uint32_t mask = bucket_count - 1;
+    const T inv_cell_size = 1 / grid.cell_size;
+
+    std::vector<uint32_t> buckets(count);
+    grid.indices.resize(count);
+    ParallelFor(count, Internal::k_grid_min_batch_size,
+                [&](size_t begin, size_t end)
+                {
+                    for (size_t i = begin; i < end; ++i)
+                    {
+                        const Internal::GridCell cell = Internal::CellOf(points[i], inv_cell_size);
+                        buckets[i] = Internal::HashCell(cell.x, cell.y, cell.z, mask);
+                        grid.indices[i] = static_cast<uint32_t>(i);
+                    }
+                });
+
+    // Counting sort on the bucket, digit by digit.
+    RadixSort<uint32_t, uint32_t>(buckets, grid.indices);
+
+    // Every bucket starts after the last point of the previous non empty bucket.
+    grid.points.resize(count);
+    grid.bucket_start.resize(size_t{bucket_count} + 1);
+    ParallelFor(size_t{count} + 1, Internal::k_grid_min_batch_size,
+                [&](size_t begin, size_t end)
+                {
+                    for (size_t i = begin; i < end; ++i)
+                    {
+                        const uint32_t first = i == 0 ? 0 : buckets[i - 1] + 1;
+                        const uint32_t last = i == count ? bucket_count : buckets[i];
+                        for (uint32_t bucket = first; bucket <= last; ++bucket)
+                        {
+                            grid.bucket_start[bucket] = static_cast<uint32_t>(i);
+                        }
+                        if (i < count)
+                        {
+                            grid.points[i] = points[grid.indices[i]];
+                        }
+                    }
+                });
+}
+
+template <Math::FloatingPoint T, typename Func>
+void Math::ForEachInRadius(const SpatialHashGrid<T>& grid,
+                           const Point3<T>& center,
+                           T radius,
+                           Func&& func)
+{
+    const T inv_cell_size = 1 / grid.cell_size;
+    const T radius_squared = radius * radius;
+    const Vector3<T> extent(radius, radius, radius);
+    Internal::ForEachBucket(grid, Internal::CellOf(center - extent, inv_cell_size),
+                            Internal::CellOf(center + extent, inv_cell_size),
+                            [&](size_t begin, size_t end)
+                            {
+                                for (size_t i = begin; i < end; ++i)
+                                {
+                                    const T distance_squared =
+                                        DistanceSquared(grid.points[i], center);
+                                    if (distance_squared <= radius_squared)
+                                    {
+                                        func(grid.indices[i], distance_squared);
+                                    }
+                                }
+                            });
+}
+
+template <Math::FloatingPoint T>
+size_t Math::FindNearest(const SpatialHashGrid<T>& grid,
+                         const Point3<T>& center,
+                         std::span<uint32_t> indices,
+                         std::type_identity_t<std::span<T>> distances_squared)
+{
+    assert(indices.size() == distances_squared.size());
+    const size_t k = Math::Min(indices.size(), grid.points.size());
+    if (k == 0)
+    {
+        return 0;
+    }
+
+    // Search in growing cubes until the k-th nearest point is closer than the cube's half size,
+    // then no point outside of the cube can be closer. The cube stops growing once it covers more
+    // cells than there are buckets, then every point has been visited.
+    const T inv_cell_size = 1 / grid.cell_size;
+    for (T radius = grid.cell_size;; radius *= 2)
+    {
+        size_t found = 0;
+        const Vector3<T> extent(radius, radius, radius);
+        const bool all_buckets = Internal::ForEachBucket(
+            grid, Internal::CellOf(center - extent, inv_cell_size),
+            Internal::CellOf(center + extent, inv_cell_size),
+            [&](size_t begin, size_t end)
+            {
+                for (size_t i = begin; i < end; ++i)
+                {
+                    const T distance_squared = DistanceSquared(grid.points[i], center);
+                    if (found == k && distance_squared >= distances_squared[k - 1])
+                    {
+                        continue;
+                    }
+                    // Insertion into the sorted outputs, k is expected to be small.
+                    size_t position = found < k ? found++ : k - 1;
+                    while (position > 0 && distances_squared[position - 1] > distance_squared)
+                    {
+                        distances_squared[position] = distances_squared[position - 1];
+                        indices[position] = indices[position - 1];
+                        --position;
+                    }
+                    distances_squared[position] = distance_squared;
+                    indices[position] = grid.indices[i];
+                }
+            });
+        if (all_buckets || (found == k && distances_squared[k - 1] <= radius * radius))
+        {
+            return found;
+        }
+    }
+}
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <compare>
+#include <cstdint>
+
+#include "math/bounds2.h"
+#include "math/bounds3.h"
+#include "math/point2.h"
+#include "math/point3.h"
+
+namespace Math
+{
+
+/**
+ * Pair of overlapping objects found by a broadphase, with first < second.
+ */
+struct OverlapPair
+{
+    uint32_t first;
+    uint32_t second;
+
+    constexpr auto operator<=>(const OverlapPair& other) const = default;
+};
+
+}  // namespace Math
+
+// Helpers for the spatial structures that are written once for 2D and 3D.
+
+namespace Math::Internal
+{
+
+template <typename T, int N>
+struct SpatialTypes;
+
+template <typename T>
+struct SpatialTypes<T, 2>
+{
+    using Point = Point2<T>;
+    using Bounds = Bounds2<T>;
+};
+
+template <typename T>
+struct SpatialTypes<T, 3>
+{
+    using Point = Point3<T>;
+    using Bounds = Bounds3<T>;
+};
+
+template <typename T>
+constexpr T& Coordinate(Point2<T>& p, int32_t axis)
+{
+    return axis == 0 ? p.x : p.y;
+}
+
+template <typename T>
+constexpr T Coordinate(const Point2<T>& p, int32_t axis)
+{
+    return axis == 0 ? p.x : p.y;
+}
+
+template <typename T>
+constexpr T& Coordinate(Point3<T>& p, int32_t axis)
+{
+    return axis == 0 ? p.x : (axis == 1 ? p.y : p.z);
+}
+
+template <typename T>
+constexpr T Coordinate(const Point3<T>& p, int32_t axis)
+{
+    return axis == 0 ? p.x : (axis == 1 ? p.y : p.z);
+}
+
+/**
+ * Squared distance from the point to the closest point of the bounds, zero inside.
+ */
+template <int N, typename Point, typename Bounds>
+constexpr auto DistanceSquaredToBounds(const Point& p, const Bounds& b)
+{
+    decltype(p.x) distance_squared = 0;
+    for (int32_t axis = 0; axis < N; ++axis)
+    {
+        const auto below = Coordinate(b.min, axis) - Coordinate(p, axis);
+        const auto above = Coordinate(p, axis) - Coordinate(b.max, axis);
+        const auto d = Math::Max(Math::Max(below, above), decltype(below){0});
+        distance_squared += d * d;
+    }
+    return distance_squared;
+}
+
+/**
+ * Check if the inner bounds are completely inside the outer bounds, boundaries included.
+ */
+template <int N, typename Bounds>
+constexpr bool ContainsBounds(const Bounds& outer, const Bounds& inner)
+{
+    for (int32_t axis = 0; axis < N; ++axis)
+    {
+        if (Coordinate(inner.min, axis) < Coordinate(outer.min, axis) ||
+            Coordinate(inner.max, axis) > Coordinate(outer.max, axis))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace Math::Internal
@@ -0,0 +1,583 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "math/base.h"
+#include "math/bounds3-batch.h"
+#include "math/bounds3.h"
+#include "math/frustum.h"
+#include "math/point3.h"
+#include "math/rng.h"
+#include "math/simd.h"
+#include "math/vector3.h"
+
+namespace Math
+{
+
+/**
+ * Bounding sphere. Cheaper to test than a box and independent of the rotation of what it bounds,
+ * which makes it a good first level for culling.
+ */
+template <FloatingPoint T>
+struct Sphere
+{
+    Point3<T> center;
+    T radius;
+
+    /**
+     * Constructs a sphere with uninitialized members.
+     */
+    constexpr Sphere() = default;
+
+    /**
+     * Constructs a sphere.
+     * @param sphere_center The center.
+     * @param sphere_radius The radius, 0 or more.
+     */
+    constexpr Sphere(const Point3<T>& sphere_center, T sphere_radius);
+
+    /**
+     * Constructs the sphere through the corners of the box, same as BoundingSphere.
+     */
+    constexpr explicit Sphere(const Bounds3<T>& b);
+
+    /**
+     * Fit a sphere to the points with Ritter's algorithm: start from the two points farthest apart
+     * of the ones with the smallest and largest x, y or z, then grow the sphere just enough to
+     * include every point outside it. Two passes over the points, the radius is usually within a
+     * few percent of the minimal one.
+     * Based on: An Efficient Bounding Sphere, Ritter, Graphics Gems, 1990, and Real-Time Collision
+     * Detection, Ericson, 2005, section 4.3.2.
+     * @param points The points, at least one.
+     * @return The sphere containing all the points.
+     */
+    static Sphere FromPointsApproximate(std::span<const Point3<T>> points);
+
+    /**
+     * Fit the smallest sphere containing the points with Welzl's algorithm. The points are shuffled
+     * with a fixed seed, which gives the expected linear time, and the points that end up on the
+     * boundary are moved to the front so the next spheres find them first. A point that would make
+     * the support set degenerate is skipped, so a last pass grows the radius to the farthest point.
+     * Based on: Smallest Enclosing Disks (Balls and Ellipsoids), Welzl, 1991, and Smallest
+     * Enclosing Balls of Points - Fast and Robust in C++, Gärtner, 1999.
+     * @param points The points, at least one.
+     * @return The sphere containing all the points.
+     */
+    static Sphere FromPoints(std::span<const Point3<T>> points);
+};
+
+/**
+ * Checks if two spheres overlap.
+ * @param s1 First sphere.
+ * @param s2 Second sphere.
+ * @return True if the spheres overlap or touch.
+ */
+template <FloatingPoint T>
+[[nodiscard]] constexpr bool Overlaps(const Sphere<T>& s1, const Sphere<T>& s2);
+
+/**
+ * Checks if the sphere overlaps the box, by comparing the distance from the center to the closest
+ * point of the box with the radius.
+ * Based on: A Simple Method for Box-Sphere Intersection Testing, Arvo, Graphics Gems, 1990.
+ * @param b The box.
+ * @param s The sphere.
+ * @return True if the sphere overlaps or touches the box.
+ */
+template <FloatingPoint T>
+[[nodiscard]] constexpr bool Overlaps(const Bounds3<T>& b, const Sphere<T>& s);
+
+/**
+ * Checks if the sphere overlaps the frustum. Conservative in the same way as Overlaps with a
+ * Bounds3, a sphere near a corner of the frustum can be reported as overlapping.
+ * @param f The frustum.
+ * @param s The sphere.
+ * @return True if the sphere overlaps the frustum.
+ */
+template <FloatingPoint T>
+[[nodiscard]] constexpr bool Overlaps(const Frustum<T>& f, const Sphere<T>& s);
+
+/**
+ * Checks if the sphere is completely inside the frustum.
+ * @param f The frustum.
+ * @param s The sphere.
+ * @return True if the sphere is inside the frustum.
+ */
+template <FloatingPoint T>
+[[nodiscard]] constexpr bool Inside(const Frustum<T>& f, const Sphere<T>& s);
+
+/**
+ * Checks if a point is inside the sphere or on its boundary.
+ * @param s The sphere.
+ * @param p The point.
+ * @return True if the point is inside the sphere.
+ */
+template <FloatingPoint T>
+constexpr bool InsideInclusive(const Sphere<T>& s, const Point3<T>& p);
+
+/**
+ * Test one sphere against many. Bit i % 64 of mask[i / 64] is set if spheres[i] overlaps the
+ * query, the bits after the last sphere are cleared.
+ * @param query The sphere to test against.
+ * @param spheres The spheres to test.
+ * @param mask Where to write the bits. Needs at least (spheres.size() + 63) / 64 elements.
+ * @return The number of overlapping spheres.
+ */
+template <FloatingPoint T>
+size_t Overlaps(const Sphere<T>& query,
+                std::type_identity_t<std::span<const Sphere<T>>> spheres,
+                std::span<uint64_t> mask);
+
+/**
+ * Test many spheres against one box. Bit i % 64 of mask[i / 64] is set if spheres[i] overlaps the
+ * box, the bits after the last sphere are cleared.
+ * @param query The box to test against.
+ * @param spheres The spheres to test.
+ * @param mask Where to write the bits. Needs at least (spheres.size() + 63) / 64 elements.
+ * @return The number of overlapping spheres.
+ */
+template <FloatingPoint T>
+size_t Overlaps(const Bounds3<T>& query,
+                std::type_identity_t<std::span<const Sphere<T>>> spheres,
+                std::span<uint64_t> mask);
+
+/**
+ * Test many spheres against the frustum. Bit i % 64 of mask[i / 64] is set if spheres[i] overlaps
+ * the frustum, the bits after the last sphere are cleared.
+ * @param f The frustum.
+ * @param spheres The spheres to test.
+ * @param mask Where to write the bits. Needs at least (spheres.size() + 63) / 64 elements.
+ * @return The number of overlapping spheres.
+ */
+template <FloatingPoint T>
+size_t Overlaps(const Frustum<T>& f,
+                std::type_identity_t<std::span<const Sphere<T>>> spheres,
+                std::span<uint64_t> mask);
+
+}  // namespace Math
+
+// Implementation //////////////////////////////////////////////////////////////////////////////////
+
+namespace Math::Internal
+{
+
+/**
+ * The sphere in T containing the sphere in double, so that the points inside the sphere in double
+ * stay inside after the center and the radius are rounded.
+ */
+template <FloatingPoint T>
+Sphere<T> RoundSphereOutward(const Point3<double>& center, double radius)
+{
+    const Point3<T> rounded(static_cast<T>(center.x), static_cast<T>(center.y),
+                            static_cast<T>(center.z));
+    const Point3<double> rounded_center(rounded.x, rounded.y, rounded.z);
+    const double enclosing = (radius + Distance(center, rounded_center)) *
+                             (1 + 4 * std::numeric_limits<double>::epsilon());
+    T result = static_cast<T>(enclosing);
+    if (static_cast<double>(result) < enclosing)
+    {
+        result = std::nextafter(result, std::numeric_limits<T>::infinity());
+    }
+    return Sphere<T>(rounded, result);
+}
+
+/**
+ * The smallest sphere with the support points on its boundary, built one point at a time. Every
+ * new point is made orthogonal to the previous ones relative to the first, and a point that is
+ * almost in the span of the previous ones is rejected, which keeps degenerate support sets from
+ * dividing by zero.
+ * Based on: Smallest Enclosing Balls of Points - Fast and Robust in C++, Gärtner, 1999.
+ */
+class SupportSphere
+{
+public:
+    /** The sphere of the support points, with a negative squared radius when there are none. */
+    Point3<double> center{0, 0, 0};
+    double squared_radius = -1;
+
+    int Size() const { return m_size; }
+
+    /**
+     * @return The squared distance of the point outside the sphere, positive if it is outside.
+     */
+    double Excess(const Point3<double>& p) const
+    {
+        return DistanceSquared(p, center) - squared_radius;
+    }
+
+    bool Push(const Point3<double>& p)
+    {
+        assert(m_size < 4);
+        if (m_size == 0)
+        {
+            m_first = p;
+            m_centers[0] = p;
+            m_squared_radii[0] = 0;
+        }
+        else
+        {
+            Vector3<double>& v = m_v[m_size];
+            v = p - m_first;
+            double a[4];
+            for (int i = 1; i < m_size; ++i)
+            {
+                a[i] = Dot(m_v[i], v) * 2 / m_z[i];
+            }
+            for (int i = 1; i < m_size; ++i)
+            {
+                v -= m_v[i] * a[i];
+            }
+            m_z[m_size] = 2 * LengthSquared(v);
+            if (m_z[m_size] <= 1e-32 * squared_radius)
+            {
+                return false;
+            }
+            const double e = DistanceSquared(p, m_centers[m_size - 1]) -
+                             m_squared_radii[m_size - 1];
+            const double f = e / m_z[m_size];
+            m_centers[m_size] = m_centers[m_size - 1] + v * f;
+            m_squared_radii[m_size] = m_squared_radii[m_size - 1] + e * f / 2;
+        }
+        center = m_centers[m_size];
+        squared_radius = m_squared_radii[m_size];
+        ++m_size;
+        return true;
+    }
+
+    /**
+     * Removes the last support point. The sphere stays the same until the next push.
+     */
+    void Pop() { --m_size; }
+
+private:
+    int m_size = 0;
+    Point3<double> m_first;
+    Vector3<double> m_v[4];
+    double m_z[4] = {};
+    Point3<double> m_centers[4];
+    double m_squared_radii[4] = {};
+};
+
+/**
+ * Grow the sphere to the smallest one containing points[0, end) with its support points on the
+ * boundary. The points outside the sphere become support points, and are moved to the front once
+ * the sphere contains the ones before them.
+ */
+inline void MoveToFrontSphere(std::vector<Point3<double>>& points,
+                              size_t end,
+                              SupportSphere& sphere)
+{
+    if (sphere.Size() == 4)
+    {
+        return;
+    }
+    for (size_t i = 0; i < end; ++i)
+    {
+        if (sphere.Excess(points[i]) > 0 && sphere.Push(points[i]))
+        {
+            MoveToFrontSphere(points, i, sphere);
+            sphere.Pop();
+            std::rotate(points.begin(), points.begin() + static_cast<ptrdiff_t>(i),
+                        points.begin() + static_cast<ptrdiff_t>(i + 1));
+        }
+    }
+}
+
+template <FloatingPoint T>
+constexpr Containment Classify(const Frustum<T>& f, const Sphere<T>& s)
+{
+    Containment result = Containment::Inside;
+    for (const Vector4<T>& plane : f.planes)
+    {
+        // The planes are not normalized, so the radius is scaled by the length of the normal.
+        const Vector3<T> normal(plane.x, plane.y, plane.z);
+        const T distance =
+            normal.x * s.center.x + normal.y * s.center.y + normal.z * s.center.z + plane.w;
+        const T radius = s.radius * static_cast<T>(Length(normal));
+        if (distance + radius < 0)
+        {
+            return Containment::Outside;
+        }
+        if (distance - radius < 0)
+        {
+            result = Containment::Intersects;
+        }
+    }
+    return result;
+}
+
+#if MATH_SIMD_SSE2
+
+static_assert(sizeof(Sphere<float>) == 4 * sizeof(float));
+
+/**
+ * Load four consecutive spheres and transpose them to one register per coordinate of the center
+ * and one for the radius.
+ */
+inline void LoadSpheres4SSE(const Sphere<float>* spheres, __m128 (&lanes)[4])
+{
+    const float* f = &spheres[0].center.x;
+    __m128 r0 = _mm_loadu_ps(f);
+    __m128 r1 = _mm_loadu_ps(f + 4);
+    __m128 r2 = _mm_loadu_ps(f + 8);
+    __m128 r3 = _mm_loadu_ps(f + 12);
+    _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+    lanes[0] = r0;
+    lanes[1] = r1;
+    lanes[2] = r2;
+    lanes[3] = r3;
+}
+
+#endif
+
+}  // namespace Math::Internal
+
+template <Math::FloatingPoint T>
+constexpr Math::Sphere<T>::Sphere(const Point3<T>& sphere_center, T sphere_radius)
+    : center(sphere_center), radius(sphere_radius)
+{
+}
+
+template <Math::FloatingPoint T>
+constexpr Math::Sphere<T>::Sphere(const Bounds3<T>& b)
+{
+    BoundingSphere(b, center, radius);
+}
+
+template <Math::FloatingPoint T>
+Math::Sphere<T> Math::Sphere<T>::FromPointsApproximate(std::span<const Point3<T>> points)
+{
+    assert(!points.empty());
+    size_t low[3] = {0, 0, 0};
+    size_t high[3] = {0, 0, 0};
+    for (size_t i = 1; i < points.size(); ++i)
+    {
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            low[axis] = points[i][axis] < points[low[axis]][axis] ? i : low[axis];
+            high[axis] = points[i][axis] > points[high[axis]][axis] ? i : high[axis];
+        }
+    }
+    auto to_double = [](const Point3<T>& p) { return Point3<double>(p.x, p.y, p.z); };
+    int widest = 0;
+    double widest_distance = -1;
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        const double distance =
+            DistanceSquared(to_double(points[low[axis]]), to_double(points[high[axis]]));
+        if (distance > widest_distance)
+        {
+            widest = axis;
+            widest_distance = distance;
+        }
+    }
+
+    // Grow in double, so the rounding of the steps doesn't leave earlier points outside.
+    const Point3<double> first = to_double(points[low[widest]]);
+    Point3<double> center = first + (to_double(points[high[widest]]) - first) / 2.0;
+    double radius = std::sqrt(widest_distance) / 2;
+    for (const Point3<T>& point : points)
+    {
+        const Point3<double> p = to_double(point);
+        const double squared_distance = DistanceSquared(p, center);
+        if (squared_distance > radius * radius)
+        {
+            // Move the center toward the point, keeping the far side of the sphere in place.
+            const double distance = std::sqrt(squared_distance);
+            const double new_radius = (radius + distance) / 2;
+            center = center + (p - center) * ((new_radius - radius) / distance);
+            radius = new_radius;
+        }
+    }
+    return Internal::RoundSphereOutward<T>(center, radius);
+}
+
+template <Math::FloatingPoint T>
+Math::Sphere<T> Math::Sphere<T>::FromPoints(std::span<const Point3<T>> points)
+{
+    assert(!points.empty());
+    std::vector<Point3<double>> shuffled;
+    shuffled.reserve(points.size());
+    for (const Point3<T>& p : points)
+    {
+        shuffled.emplace_back(p.x, p.y, p.z);
+    }
+    RNG rng(points.size());
+    for (size_t i = shuffled.size() - 1; i > 0; --i)
+    {
+        std::swap(shuffled[i], shuffled[rng.UniformUInt32(static_cast<uint32_t>(i + 1))]);
+    }
+
+    Internal::SupportSphere sphere;
+    Internal::MoveToFrontSphere(shuffled, shuffled.size(), sphere);
+    double squared_radius = sphere.squared_radius;
+    for (const Point3<double>& p : shuffled)
+    {
+        squared_radius = Math::Max(squared_radius, DistanceSquared(p, sphere.center));
+    }
+    return Internal::RoundSphereOutward<T>(sphere.center, std::sqrt(squared_radius));
+}
+
+template <Math::FloatingPoint T>
+constexpr bool Math::Overlaps(const Sphere<T>& s1, const Sphere<T>& s2)
+{
+    const T radius = s1.radius + s2.radius;
+    return DistanceSquared(s1.center, s2.center) <= radius * radius;
+}
+
+template <Math::FloatingPoint T>
+constexpr bool Math::Overlaps(const Bounds3<T>& b, const Sphere<T>& s)
+{
+    T squared_distance = 0;
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        // At most one of the two is positive.
+        const T below = Math::Max(b.min[axis] - s.center[axis], static_cast<T>(0));
+        const T above = Math::Max(s.center[axis] - b.max[axis], static_cast<T>(0));
+        const T distance = below + above;
+        squared_distance += distance * distance;
+    }
+    return squared_distance <= s.radius * s.radius;
+}
+
+template <Math::FloatingPoint T>
+constexpr bool Math::Overlaps(const Frustum<T>& f, const Sphere<T>& s)
+{
+    return Internal::Classify(f, s) != Internal::Containment::Outside;
+}
+
+template <Math::FloatingPoint T>
+constexpr bool Math::Inside(const Frustum<T>& f, const Sphere<T>& s)
+{
+    return Internal::Classify(f, s) == Internal::Containment::Inside;
+}
+
+template <Math::FloatingPoint T>
+constexpr bool Math::InsideInclusive(const Sphere<T>& s, const Point3<T>& p)
+{
+    return DistanceSquared(s.center, p) <= s.radius * s.radius;
+}
+
+template <Math::FloatingPoint T>
+size_t Math::Overlaps(const Sphere<T>& query,
+                      std::type_identity_t<std::span<const Sphere<T>>> spheres,
+                      std::span<uint64_t> mask)
+{
+    auto test = [&](size_t i) { return Overlaps(query, spheres[i]); };
+#if MATH_SIMD_SSE2
+    if constexpr (std::is_same_v<T, float>)
+    {
+        const __m128 center[3] = {_mm_set1_ps(query.center.x), _mm_set1_ps(query.center.y),
+                                  _mm_set1_ps(query.center.z)};
+        const __m128 query_radius = _mm_set1_ps(query.radius);
+        auto test_block = [&](size_t i)
+        {
+            __m128 sphere[4];
+            Internal::LoadSpheres4SSE(&spheres[i], sphere);
+            const __m128 x = _mm_sub_ps(center[0], sphere[0]);
+            const __m128 y = _mm_sub_ps(center[1], sphere[1]);
+            const __m128 z = _mm_sub_ps(center[2], sphere[2]);
+            const __m128 squared_distance =
+                Internal::MulAdd(z, z, Internal::MulAdd(y, y, _mm_mul_ps(x, x)));
+            const __m128 radius = _mm_add_ps(query_radius, sphere[3]);
+            return _mm_movemask_ps(_mm_cmple_ps(squared_distance, _mm_mul_ps(radius, radius)));
+        };
+        return Internal::FillMask<4>(spheres.size(), mask, test_block, test);
+    }
+    else
+#endif
+    {
+        return Internal::FillMask(spheres.size(), mask, test);
+    }
+}
+
+template <Math::FloatingPoint T>
+size_t Math::Overlaps(const Bounds3<T>& query,
+                      std::type_identity_t<std::span<const Sphere<T>>> spheres,
+                      std::span<uint64_t> mask)
+{
+    auto test = [&](size_t i) { return Overlaps(query, spheres[i]); };
+#if MATH_SIMD_SSE2
+    if constexpr (std::is_same_v<T, float>)
+    {
+        const __m128 low[3] = {_mm_set1_ps(query.min.x), _mm_set1_ps(query.min.y),
+                               _mm_set1_ps(query.min.z)};
+        const __m128 high[3] = {_mm_set1_ps(query.max.x), _mm_set1_ps(query.max.y),
+                                _mm_set1_ps(query.max.z)};
+        auto test_block = [&](size_t i)
+        {
+            __m128 sphere[4];
+            Internal::LoadSpheres4SSE(&spheres[i], sphere);
+            __m128 squared_distance = _mm_setzero_ps();
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                const __m128 below = _mm_max_ps(_mm_sub_ps(low[axis], sphere[axis]),
+                                                _mm_setzero_ps());
+                const __m128 above = _mm_max_ps(_mm_sub_ps(sphere[axis], high[axis]),
+                                                _mm_setzero_ps());
+                const __m128 distance = _mm_add_ps(below, above);
+                squared_distance = Internal::MulAdd(distance, distance, squared_distance);
+            }
+            return _mm_movemask_ps(
+                _mm_cmple_ps(squared_distance, _mm_mul_ps(sphere[3], sphere[3])));
+        };
+        return Internal::FillMask<4>(spheres.size(), mask, test_block, test);
+    }
+    else
+#endif
+    {
+        return Internal::FillMask(spheres.size(), mask, test);
+    }
+}
+
+template <Math::FloatingPoint T>
+size_t Math::Overlaps(const Frustum<T>& f,
+                      std::type_identity_t<std::span<const Sphere<T>>> spheres,
+                      std::span<uint64_t> mask)
+{
+    auto test = [&](size_t i) { return Overlaps(f, spheres[i]); };
+#if MATH_SIMD_SSE2
+    if constexpr (std::is_same_v<T, float>)
+    {
+        __m128 planes[6][5];
+        for (int i = 0; i < 6; ++i)
+        {
+            const Vector4<float>& plane = f.planes[i];
+            const Vector3<float> normal(plane.x, plane.y, plane.z);
+            planes[i][0] = _mm_set1_ps(plane.x);
+            planes[i][1] = _mm_set1_ps(plane.y);
+            planes[i][2] = _mm_set1_ps(plane.z);
+            planes[i][3] = _mm_set1_ps(plane.w);
+            planes[i][4] = _mm_set1_ps(static_cast<float>(Length(normal)));
+        }
+        auto test_block = [&](size_t i)
+        {
+            __m128 sphere[4];
+            Internal::LoadSpheres4SSE(&spheres[i], sphere);
+            __m128 outside = _mm_setzero_ps();
+            for (const auto& plane : planes)
+            {
+                const __m128 distance = _mm_add_ps(
+                    Internal::MulAdd(sphere[2], plane[2],
+                                     Internal::MulAdd(sphere[1], plane[1],
+                                                      _mm_mul_ps(sphere[0], plane[0]))),
+                    plane[3]);
+                const __m128 far_distance = Internal::MulAdd(sphere[3], plane[4], distance);
+                outside = _mm_or_ps(outside, _mm_cmplt_ps(far_distance, _mm_setzero_ps()));
+            }
+            return ~_mm_movemask_ps(outside) & 0xF;
+        };
+        return Internal::FillMask<4>(spheres.size(), mask, test_block, test);
+    }
+    else
+#endif
+    {
+        return Internal::FillMask(spheres.size(), mask, test);
+    }
+}
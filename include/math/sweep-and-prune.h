@@ -0,0 +1,116 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <numeric>
+#include <span>
+#include <vector>
+
+#include "math/base.h"
+#include "math/bounds3.h"
+#include "math/spatial-types.h"
+
+namespace Math
+{
+
+/**
+ * Broadphase that sorts the bounds along one axis and tests only the bounds whose intervals on that
+ * axis overlap. The order is kept between calls, objects move little from frame to frame so the
+ * order is restored with an insertion sort in close to linear time.
+ * @tparam T Data type of the bounds.
+ */
+template <FloatingPoint T>
+class SweepAndPrune
+{
+public:
+    /**
+     * Find all pairs of overlapping bounds. The sort axis is chosen as the axis with the largest
+     * spread of the centers whenever the number of bounds changes.
+     * @param bounds The bounds of the objects, the indices into it are the ids in the pairs.
+     * @param pairs Preallocated output, filled with the first pairs found.
+     * @return The total number of overlapping pairs, which is larger than the size of the output if
+     * it was too small.
+     */
+    size_t FindOverlapPairs(std::span<const Bounds3<T>> bounds, std::span<OverlapPair> pairs);
+
+private:
+    std::vector<uint32_t> m_order;
+    std::vector<Bounds3<T>> m_sorted;
+    int32_t m_axis = 0;
+};
+
+}  // namespace Math
+
+// Implementation //////////////////////////////////////////////////////////////////////////////////
+
+template <Math::FloatingPoint T>
+size_t Math::SweepAndPrune<T>::FindOverlapPairs(std::span<const Bounds3<T>> bounds,
+                                                std::span<OverlapPair> pairs)
+{
+    assert(bounds.size() <= UINT32_MAX);
+    if (m_order.size() != bounds.size())
+    {
+        m_axis = 0;
+        if (!bounds.empty())
+        {
+            auto center = [](const Bounds3<T>& b)
+            { return b.min + (b.max - b.min) / static_cast<T>(2); };
+            Bounds3<T> centers(center(bounds[0]));
+            for (const Bounds3<T>& b : bounds)
+            {
+                centers = Union(centers, center(b));
+            }
+            m_axis = MaximumExtent(centers);
+        }
+        m_order.resize(bounds.size());
+        std::iota(m_order.begin(), m_order.end(), 0u);
+        std::sort(m_order.begin(), m_order.end(), [&](uint32_t a, uint32_t b)
+                  { return bounds[a].min[m_axis] < bounds[b].min[m_axis]; });
+    }
+    else
+    {
+        for (size_t i = 1; i < m_order.size(); ++i)
+        {
+            const uint32_t index = m_order[i];
+            const T key = bounds[index].min[m_axis];
+            size_t j = i;
+            for (; j > 0 && bounds[m_order[j - 1]].min[m_axis] > key; --j)
+            {
+                m_order[j] = m_order[j - 1];
+            }
+            m_order[j] = index;
+        }
+    }
+
+    // Sweep over a sorted copy so the inner loop reads contiguous memory, with the coordinates
+    // rotated so the sort axis is x.
+    m_sorted.resize(bounds.size());
+    const int32_t axis_y = (m_axis + 1) % 3;
+    const int32_t axis_z = (m_axis + 2) % 3;
+    for (size_t i = 0; i < m_order.size(); ++i)
+    {
+        const Bounds3<T>& b = bounds[m_order[i]];
+        m_sorted[i] = Bounds3<T>(Point3<T>(b.min[m_axis], b.min[axis_y], b.min[axis_z]),
+                                 Point3<T>(b.max[m_axis], b.max[axis_y], b.max[axis_z]));
+    }
+
+    size_t count = 0;
+    for (size_t i = 0; i < m_sorted.size(); ++i)
+    {
+        const Bounds3<T>& a = m_sorted[i];
+        for (size_t j = i + 1; j < m_sorted.size() && m_sorted[j].min.x <= a.max.x; ++j)
+        {
+            if (Overlaps(a, m_sorted[j]))
+            {
+                if (count < pairs.size())
+                {
+                    pairs[count] = {Math::Min(m_order[i], m_order[j]),
+                                    Math::Max(m_order[i], m_order[j])};
+                }
+                ++count;
+            }
+        }
+    }
+    return count;
+}
@@ -14,7 +14,7 @@ namespace Math
  * @return The identity transform.
  */
 template <typename T>
-Matrix4x4<T> Identity();
+constexpr Matrix4x4<T> Identity();
 
 /**
  * Create a translation matrix.
@@ -23,7 +23,7 @@ Matrix4x4<T> Identity();
  * @return The translation matrix.
  */
 template <typename T>
-Matrix4x4<T> Translate(const Point3<T>& delta);
+constexpr Matrix4x4<T> Translate(const Point3<T>& delta);
 
 /**
  * Create a translation matrix.
@@ -32,7 +32,7 @@ Matrix4x4<T> Translate(const Point3<T>& delta);
  * @return The translation matrix.
  */
 template <typename T>
-Matrix4x4<T> Translate(const Vector3<T>& delta);
+constexpr Matrix4x4<T> Translate(const Vector3<T>& delta);
 
 /**
  * Create a scale matrix.
@@ -43,7 +43,7 @@ Matrix4x4<T> Translate(const Vector3<T>& delta);
  * @return The scale matrix.
  */
 template <typename T>
-Matrix4x4<T> Scale(T x, T y, T z);
+constexpr Matrix4x4<T> Scale(T x, T y, T z);
 
 /**
  * Create a scale matrix.
@@ -52,7 +52,7 @@ Matrix4x4<T> Scale(T x, T y, T z);
  * @return The scale matrix.
  */
 template <typename T>
-Matrix4x4<T> Scale(T scalar);
+constexpr Matrix4x4<T> Scale(T scalar);
 
 /**
  * Create a rotation matrix around the x-axis.
@@ -61,7 +61,7 @@ Matrix4x4<T> Scale(T scalar);
  * @return The rotation matrix.
  */
 template <typename T>
-Matrix4x4<T> RotateX(T angle_degrees);
+constexpr Matrix4x4<T> RotateX(T angle_degrees);
 
 /**
  * Create a rotation matrix around the y-axis.
@@ -70,7 +70,7 @@ Matrix4x4<T> RotateX(T angle_degrees);
  * @return The rotation matrix.
  */
 template <typename T>
-Matrix4x4<T> RotateY(T angle_degrees);
+constexpr Matrix4x4<T> RotateY(T angle_degrees);
 
 /**
  * Create a rotation matrix around the z-axis.
@@ -79,7 +79,7 @@ Matrix4x4<T> RotateY(T angle_degrees);
  * @return The rotation matrix.
  */
 template <typename T>
-Matrix4x4<T> RotateZ(T angle_degrees);
+constexpr Matrix4x4<T> RotateZ(T angle_degrees);
 
 /**
  * Create a rotation matrix around an arbitrary axis.
@@ -89,7 +89,7 @@ Matrix4x4<T> RotateZ(T angle_degrees);
  * @return The rotation matrix.
  */
 template <typename T>
-Matrix4x4<T> Rotate(T angle_degrees, const Vector3<T>& axis);
+constexpr Matrix4x4<T> Rotate(T angle_degrees, const Vector3<T>& axis);
 
 /**
  * Create a rotation matrix from a quaternion.
@@ -98,7 +98,7 @@ Matrix4x4<T> Rotate(T angle_degrees, const Vector3<T>& axis);
  * @return The rotation matrix.
  */
 template <typename T>
-Matrix4x4<T> Rotate(const Quaternion<T>& q);
+constexpr Matrix4x4<T> Rotate(const Quaternion<T>& q);
 
 /**
  * Create a rotation matrix from a rotator. This applies angle around x then around y and then
@@ -108,7 +108,7 @@ Matrix4x4<T> Rotate(const Quaternion<T>& q);
  * @return The rotation matrix.
  */
 template <typename T>
-Matrix4x4<T> Rotate(const Rotator<T>& rot);
+constexpr Matrix4x4<T> Rotate(const Rotator<T>& rot);
 
 /**
  * Create a rotation and translation matrix from a rotator and a translation vector.
@@ -118,7 +118,7 @@ Matrix4x4<T> Rotate(const Rotator<T>& rot);
  * @return The rotation and translation matrix.
  */
 template <typename T>
-Matrix4x4<T> RotateAndTranslate(const Rotator<T>& rot, const Point3<T>& t);
+constexpr Matrix4x4<T> RotateAndTranslate(const Rotator<T>& rot, const Point3<T>& t);
 
 /**
  * Create a rotation and translation matrix from a rotator and a translation vector.
@@ -128,7 +128,7 @@ Matrix4x4<T> RotateAndTranslate(const Rotator<T>& rot, const Point3<T>& t);
  * @return The rotation and translation matrix.
  */
 template <typename T>
-Matrix4x4<T> RotateAndTranslate(const Rotator<T>& rot, const Vector3<T>& t);
+constexpr Matrix4x4<T> RotateAndTranslate(const Rotator<T>& rot, const Vector3<T>& t);
 
 /**
  *  Create a world to camera (view) transform for a right-handed coordinate system.
@@ -139,7 +139,9 @@ Matrix4x4<T> RotateAndTranslate(const Rotator<T>& rot, const Vector3<T>& t);
  * @return The view matrix.
  */
 template <typename T>
-Matrix4x4<T> LookAt_RH(const Point3<T>& eye, const Point3<T>& target, const Vector3<T>& up);
+constexpr Matrix4x4<T> LookAt_RH(const Point3<T>& eye,
+                                 const Point3<T>& target,
+                                 const Vector3<T>& up);
 
 /**
  * Create a world to camera (view) transform for a left-handed coordinate system.
@@ -150,14 +152,16 @@ Matrix4x4<T> LookAt_RH(const Point3<T>& eye, const Point3<T>& target, const Vect
  * @return The view matrix.
  */
 template <typename T>
-Matrix4x4<T> LookAt_LH(const Point3<T>& eye, const Point3<T>& target, const Vector3<T>& up);
+constexpr Matrix4x4<T> LookAt_LH(const Point3<T>& eye,
+                                 const Point3<T>& target,
+                                 const Vector3<T>& up);
 
 }  // namespace Math
 
 // Implementation //////////////////////////////////////////////////////////////////////////////////
 
 template <typename T>
-Math::Matrix4x4<T> Math::Identity()
+constexpr Math::Matrix4x4<T> Math::Identity()
 {
     // clang-format off
     return Matrix4x4<T>{
@@ -170,7 +174,7 @@ Math::Matrix4x4<T> Math::Identity()
 }
 
 template <typename T>
-Math::Matrix4x4<T> Math::Translate(const Point3<T>& delta)
+constexpr Math::Matrix4x4<T> Math::Translate(const Point3<T>& delta)
 {
     // clang-format off
     return Matrix4x4<T>{
@@ -183,7 +187,7 @@ Math::Matrix4x4<T> Math::Translate(const Point3<T>& delta)
 }
 
 template <typename T>
-Math::Matrix4x4<T> Math::Translate(const Vector3<T>& delta)
+constexpr Math::Matrix4x4<T> Math::Translate(const Vector3<T>& delta)
 {
     // clang-format off
     return Matrix4x4<T>{
@@ -196,7 +200,7 @@ Math::Matrix4x4<T> Math::Translate(const Vector3<T>& delta)
 }
 
 template <typename T>
-Math::Matrix4x4<T> Math::Scale(T x, T y, T z)
+constexpr Math::Matrix4x4<T> Math::Scale(T x, T y, T z)
 {
     // clang-format off
     return Matrix4x4<T>{
@@ -209,17 +213,17 @@ Math::Matrix4x4<T> Math::Scale(T x, T y, T z)
 }
 
 template <typename T>
-Math::Matrix4x4<T> Math::Scale(T scalar)
+constexpr Math::Matrix4x4<T> Math::Scale(T scalar)
 {
     return Scale(scalar, scalar, scalar);
 }
 
 template <typename T>
-Math::Matrix4x4<T> Math::RotateX(T angle_degrees)
+constexpr Math::Matrix4x4<T> Math::RotateX(T angle_degrees)
 {
     const T angle_radians = Radians(angle_degrees);
-    const T cos = std::cos(angle_radians);
-    const T sin = std::sin(angle_radians);
+    const T cos = Math::Cos(angle_radians);
+    const T sin = Math::Sin(angle_radians);
 
     // clang-format off
     return Matrix4x4<T>{
@@ -232,11 +236,11 @@ Math::Matrix4x4<T> Math::RotateX(T angle_degrees)
 }
 
 template <typename T>
-Math::Matrix4x4<T> Math::RotateY(T angle_degrees)
+constexpr Math::Matrix4x4<T> Math::RotateY(T angle_degrees)
 {
     const T angle_radians = Radians(angle_degrees);
-    const T cos = std::cos(angle_radians);
-    const T sin = std::sin(angle_radians);
+    const T cos = Math::Cos(angle_radians);
+    const T sin = Math::Sin(angle_radians);
 
     // clang-format off
     return Matrix4x4<T>{
@@ -249,11 +253,11 @@ Math::Matrix4x4<T> Math::RotateY(T angle_degrees)
 }
 
 template <typename T>
-Math::Matrix4x4<T> Math::RotateZ(T angle_degrees)
+constexpr Math::Matrix4x4<T> Math::RotateZ(T angle_degrees)
 {
     const T angle_radians = Radians(angle_degrees);
-    const T cos = std::cos(angle_radians);
-    const T sin = std::sin(angle_radians);
+    const T cos = Math::Cos(angle_radians);
+    const T sin = Math::Sin(angle_radians);
 
     // clang-format off
     return Matrix4x4<T>{
@@ -266,11 +270,11 @@ Math::Matrix4x4<T> Math::RotateZ(T angle_degrees)
 }
 
 template <typename T>
-Math::Matrix4x4<T> Math::Rotate(T angle_degrees, const Vector3<T>& axis)
+constexpr Math::Matrix4x4<T> Math::Rotate(T angle_degrees, const Vector3<T>& axis)
 {
     const T angle_radians = Radians(angle_degrees);
-    const T cos = std::cos(angle_radians);
-    const T sin = std::sin(angle_radians);
+    const T cos = Math::Cos(angle_radians);
+    const T sin = Math::Sin(angle_radians);
     const T one_minus_cos = 1 - cos;
 
     const Vector3<T> norm_axis = Normalize(axis);
@@ -289,7 +293,7 @@ Math::Matrix4x4<T> Math::Rotate(T angle_degrees, const Vector3<T>& axis)
 }
 
 template <typename T>
-Math::Matrix4x4<T> Math::Rotate(const Quaternion<T>& q)
+constexpr Math::Matrix4x4<T> Math::Rotate(const Quaternion<T>& q)
 {
     const T x = q.vec.x;
     const T y = q.vec.y;
@@ -307,34 +311,34 @@ Math::Matrix4x4<T> Math::Rotate(const Quaternion<T>& q)
 }
 
 template <typename T>
-Math::Matrix4x4<T> Math::Rotate(const Rotator<T>& rot)
+constexpr Math::Matrix4x4<T> Math::Rotate(const Rotator<T>& rot)
 {
     return RotateZ(rot.pitch) * RotateY(rot.yaw) * RotateX(rot.roll);
 }
 
 template <typename T>
-Math::Matrix4x4<T> Math::RotateAndTranslate(const Rotator<T>& rot, const Point3<T>& t)
+constexpr Math::Matrix4x4<T> Math::RotateAndTranslate(const Rotator<T>& rot, const Point3<T>& t)
 {
     return Translate(t) * Rotate(rot);
 }
 
 template <typename T>
-Math::Matrix4x4<T> Math::RotateAndTranslate(const Rotator<T>& rot, const Vector3<T>& t)
+constexpr Math::Matrix4x4<T> Math::RotateAndTranslate(const Rotator<T>& rot, const Vector3<T>& t)
 {
     return Translate(t) * Rotate(rot);
 }
 
 template <typename T>
-Math::Matrix4x4<T> Math::LookAt_RH(const Point3<T>& eye,
-                                   const Point3<T>& target,
-                                   const Vector3<T>& up)
+constexpr Math::Matrix4x4<T> Math::LookAt_RH(const Point3<T>& eye,
+                                             const Point3<T>& target,
+                                             const Vector3<T>& up)
 {
     const Vector3<T> forward = Normalize(eye - target);
     const Vector3<T> right = Normalize(Cross(up, forward));
     const Vector3<T> new_up = Cross(forward, right);
     const Vector3<T> eye_vector = eye - Point3<T>::Zero();
 
-    Matrix4x4 result(1.0f);
+    Matrix4x4<T> result(1);
     result(0, 0) = right.x;
     result(0, 1) = right.y;
     result(0, 2) = right.z;
@@ -352,16 +356,16 @@ Math::Matrix4x4<T> Math::LookAt_RH(const Point3<T>& eye,
 }
 
 template <typename T>
-Math::Matrix4x4<T> Math::LookAt_LH(const Point3<T>& eye,
-                                   const Point3<T>& target,
-                                   const Vector3<T>& up)
+constexpr Math::Matrix4x4<T> Math::LookAt_LH(const Point3<T>& eye,
+                                             const Point3<T>& target,
+                                             const Vector3<T>& up)
 {
     const Vector3<T> forward = Normalize(target - eye);
     const Vector3<T> right = Normalize(Cross(up, forward));
     const Vector3<T> new_up = Cross(forward, right);
     const Vector3<T> eye_vector = eye - Point3<T>::Zero();
 
-    Matrix4x4 result(1.0f);
+    Matrix4x4<T> result(1);
     result(0, 0) = right.x;
     result(0, 1) = right.y;
     result(0, 2) = right.z;
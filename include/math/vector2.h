@@ -47,51 +47,51 @@ struct Vector2
      * Returns a vector with all components set to zero.
      * @return A vector with all components set to zero.
      */
-    static Vector2 Zero();
+    static constexpr Vector2 Zero();
 
     /** Operators **/
-    T& operator[](int index);
-    const T& operator[](int index) const;
+    constexpr T& operator[](int index);
+    constexpr const T& operator[](int index) const;
 
-    bool operator==(const Vector2& other) const;
-    bool operator!=(const Vector2& other) const;
+    constexpr bool operator==(const Vector2& other) const;
+    constexpr bool operator!=(const Vector2& other) const;
 
-    Vector2 operator+(const Vector2& other) const;
-    Vector2& operator+=(const Vector2& other);
-    Vector2 operator-(const Vector2& other) const;
-    Vector2& operator-=(const Vector2& other);
+    constexpr Vector2 operator+(const Vector2& other) const;
+    constexpr Vector2& operator+=(const Vector2& other);
+    constexpr Vector2 operator-(const Vector2& other) const;
+    constexpr Vector2& operator-=(const Vector2& other);
 
-    Vector2 operator*(const Vector2& other) const;
-    Vector2& operator*=(const Vector2& other);
+    constexpr Vector2 operator*(const Vector2& other) const;
+    constexpr Vector2& operator*=(const Vector2& other);
 
-    Vector2 operator-() const;
+    constexpr Vector2 operator-() const;
 
     template <typename U>
-    Vector2 operator*(U scalar) const;
+    constexpr Vector2 operator*(U scalar) const;
     template <typename U>
-    Vector2& operator*=(U scalar);
+    constexpr Vector2& operator*=(U scalar);
     template <typename U>
-    Vector2 operator/(U scalar) const;
+    constexpr Vector2 operator/(U scalar) const;
     template <typename U>
-    Vector2& operator/=(U scalar);
+    constexpr Vector2& operator/=(U scalar);
 };
 
 template <typename T, typename U>
-Vector2<T> operator*(U scalar, const Vector2<T>& vec);
+constexpr Vector2<T> operator*(U scalar, const Vector2<T>& vec);
 
 /**
  * Checks if any of the components are NaN or infinite value.
  * @return True if any of the components are NaN or infinite value, false otherwise.
  */
 template <typename T>
-[[nodiscard]] bool ContainsNonFinite(const Vector2<T>& vec);
+[[nodiscard]] constexpr bool ContainsNonFinite(const Vector2<T>& vec);
 
 /**
  * Checks if any of the components are NaN.
  * @return True if any of the components are NaN, false otherwise.
  */
 template <typename T>
-[[nodiscard]] bool ContainsNaN(const Vector2<T>& vec);
+[[nodiscard]] constexpr bool ContainsNaN(const Vector2<T>& vec);
 
 /**
  * Returns a new vector with the absolute value of each component.
@@ -100,7 +100,7 @@ template <typename T>
  * @return A new vector with the absolute value of each component.
  */
 template <typename T>
-[[nodiscard]] Vector2<T> Abs(const Vector2<T>& vec);
+[[nodiscard]] constexpr Vector2<T> Abs(const Vector2<T>& vec);
 
 /**
  * Returns the dot product of vector with himself.
@@ -109,7 +109,7 @@ template <typename T>
  * @return The dot product of vector with himself.
  */
 template <typename T>
-[[nodiscard]] T LengthSquared(const Vector2<T>& vec);
+[[nodiscard]] constexpr T LengthSquared(const Vector2<T>& vec);
 
 /**
  * Returns the length of the vector.
@@ -118,7 +118,7 @@ template <typename T>
  * @return The length of the vector.
  */
 template <typename T>
-[[nodiscard]] double Length(const Vector2<T>& vec);
+[[nodiscard]] constexpr double Length(const Vector2<T>& vec);
 
 /**
  * Checks if the vectors are equal within a given epsilon.
@@ -129,7 +129,7 @@ template <typename T>
  * @return True if the vectors are equal within a given epsilon, false otherwise.
  */
 template <typename T>
-bool IsEqual(const Vector2<T>& vec1, const Vector2<T>& vec2, T epsilon);
+constexpr bool IsEqual(const Vector2<T>& vec1, const Vector2<T>& vec2, T epsilon);
 
 /**
  * Returns the linear interpolation between two vectors.
@@ -140,7 +140,7 @@ bool IsEqual(const Vector2<T>& vec1, const Vector2<T>& vec2, T epsilon);
  * @return The linear interpolation between two vectors.
  */
 template <typename T>
-Vector2<T> Lerp(T t, const Vector2<T>& vec1, const Vector2<T>& vec2);
+constexpr Vector2<T> Lerp(T t, const Vector2<T>& vec1, const Vector2<T>& vec2);
 
 /**
  * Returns the dot product of two vectors.
@@ -150,7 +150,7 @@ Vector2<T> Lerp(T t, const Vector2<T>& vec1, const Vector2<T>& vec2);
  * @return The dot product of two vectors.
  */
 template <typename T>
-T Dot(const Vector2<T>& vec1, const Vector2<T>& vec2);
+constexpr T Dot(const Vector2<T>& vec1, const Vector2<T>& vec2);
 
 /**
  * Returns the absolute dot product of two vectors.
@@ -160,7 +160,7 @@ T Dot(const Vector2<T>& vec1, const Vector2<T>& vec2);
  * @return The absolute dot product of two vectors.
  */
 template <typename T>
-T AbsDot(const Vector2<T>& vec1, const Vector2<T>& vec2);
+constexpr T AbsDot(const Vector2<T>& vec1, const Vector2<T>& vec2);
 
 /**
  * Returns the cross product of two vectors.
@@ -170,7 +170,7 @@ T AbsDot(const Vector2<T>& vec1, const Vector2<T>& vec2);
  * @return The cross product of two vectors.
  */
 template <typename T>
-T Cross(const Vector2<T>& vec1, const Vector2<T>& vec2);
+constexpr T Cross(const Vector2<T>& vec1, const Vector2<T>& vec2);
 
 /**
  * Returns the normalized vector.
@@ -179,7 +179,7 @@ T Cross(const Vector2<T>& vec1, const Vector2<T>& vec2);
  * @return The normalized vector.
  */
 template <typename T>
-Vector2<T> Normalize(const Vector2<T>& vec);
+constexpr Vector2<T> Normalize(const Vector2<T>& vec);
 
 /**
  * Returns the new vector with the minimum components of the two vectors.
@@ -189,7 +189,7 @@ Vector2<T> Normalize(const Vector2<T>& vec);
  * @return The new vector with the minimum components of the two vectors.
  */
 template <typename T>
-Vector2<T> Min(const Vector2<T>& vec1, const Vector2<T>& vec2);
+constexpr Vector2<T> Min(const Vector2<T>& vec1, const Vector2<T>& vec2);
 
 /**
  * Returns the new vector with the maximum components of the two vectors.
@@ -199,7 +199,7 @@ Vector2<T> Min(const Vector2<T>& vec1, const Vector2<T>& vec2);
  * @return The new vector with the maximum components of the two vectors.
  */
 template <typename T>
-Vector2<T> Max(const Vector2<T>& vec1, const Vector2<T>& vec2);
+constexpr Vector2<T> Max(const Vector2<T>& vec1, const Vector2<T>& vec2);
 
 /**
  * Return the new vector with permuted components.
@@ -210,7 +210,7 @@ Vector2<T> Max(const Vector2<T>& vec1, const Vector2<T>& vec2);
  * @return The new vector with permuted components.
  */
 template <typename T>
-Vector2<T> Permute(const Vector2<T>& vec, int x, int y);
+constexpr Vector2<T> Permute(const Vector2<T>& vec, int x, int y);
 
 /**
  * Returns the new vector with all the components clamped.
@@ -221,7 +221,7 @@ Vector2<T> Permute(const Vector2<T>& vec, int x, int y);
  * @return The new vector with all the components clamped.
  */
 template <typename T>
-Vector2<T> Clamp(const Vector2<T>& vec, T low, T high);
+constexpr Vector2<T> Clamp(const Vector2<T>& vec, T low, T high);
 
 /**
  * Reflect the incidence vector around the normal.
@@ -230,7 +230,7 @@ Vector2<T> Clamp(const Vector2<T>& vec, T low, T high);
  * @return The reflected vector.
  */
 template <typename T>
-Vector2<T> Reflect(const Vector2<T>& incidence, const Vector2<T>& normal);
+constexpr Vector2<T> Reflect(const Vector2<T>& incidence, const Vector2<T>& normal);
 
 /**
  * Returns the value of the smallest component.
@@ -239,7 +239,7 @@ Vector2<T> Reflect(const Vector2<T>& incidence, const Vector2<T>& normal);
  * @return The value of the smallest component.
  */
 template <typename T>
-T MinComponent(const Vector2<T>& vec);
+constexpr T MinComponent(const Vector2<T>& vec);
 
 /**
  * Returns the value of the largest component.
@@ -248,7 +248,7 @@ T MinComponent(const Vector2<T>& vec);
  * @return The value of the largest component.
  */
 template <typename T>
-T MaxComponent(const Vector2<T>& vec);
+constexpr T MaxComponent(const Vector2<T>& vec);
 
 /**
  * Returns the index of the smallest component.
@@ -257,7 +257,7 @@ T MaxComponent(const Vector2<T>& vec);
  * @return The index of the smallest component.
  */
 template <typename T>
-int MinDimension(const Vector2<T>& vec);
+constexpr int MinDimension(const Vector2<T>& vec);
 
 /**
  * Returns the index of the largest component.
@@ -266,7 +266,7 @@ int MinDimension(const Vector2<T>& vec);
  * @return The index of the largest component.
  */
 template <typename T>
-int MaxDimension(const Vector2<T>& vec);
+constexpr int MaxDimension(const Vector2<T>& vec);
 
 }  // namespace Math
 
@@ -289,43 +289,53 @@ constexpr Math::Vector2<T>::Vector2(T xx, T yy) : x(xx), y(yy)
 }
 
 template <typename T>
-Math::Vector2<T> Math::Vector2<T>::Zero()
+constexpr Math::Vector2<T> Math::Vector2<T>::Zero()
 {
     return {0, 0};
 }
 
 template <typename T>
-T& Math::Vector2<T>::operator[](int index)
+constexpr T& Math::Vector2<T>::operator[](int index)
 {
+    // Reading the inactive array member of the union is not allowed in constant expressions.
+    if (std::is_constant_evaluated())
+    {
+        return index == 0 ? x : y;
+    }
     return data[index];
 }
 
 template <typename T>
-const T& Math::Vector2<T>::operator[](int index) const
+constexpr const T& Math::Vector2<T>::operator[](int index) const
 {
+    // Reading the inactive array member of the union is not allowed in constant expressions.
+    if (std::is_constant_evaluated())
+    {
+        return index == 0 ? x : y;
+    }
     return data[index];
 }
 
 template <typename T>
-bool Math::Vector2<T>::operator==(const Vector2& other) const
+constexpr bool Math::Vector2<T>::operator==(const Vector2& other) const
 {
     return x == other.x && y == other.y;
 }
 
 template <typename T>
-bool Math::Vector2<T>::operator!=(const Vector2& other) const
+constexpr bool Math::Vector2<T>::operator!=(const Vector2& other) const
 {
     return !(*this == other);
 }
 
 template <typename T>
-Math::Vector2<T> Math::Vector2<T>::operator+(const Vector2& other) const
+constexpr Math::Vector2<T> Math::Vector2<T>::operator+(const Vector2& other) const
 {
     return {x + other.x, y + other.y};
 }
 
 template <typename T>
-Math::Vector2<T>& Math::Vector2<T>::operator+=(const Vector2& other)
+constexpr Math::Vector2<T>& Math::Vector2<T>::operator+=(const Vector2& other)
 {
     x += other.x;
     y += other.y;
@@ -333,13 +343,13 @@ Math::Vector2<T>& Math::Vector2<T>::operator+=(const Vector2& other)
 }
 
 template <typename T>
-Math::Vector2<T> Math::Vector2<T>::operator-(const Vector2& other) const
+constexpr Math::Vector2<T> Math::Vector2<T>::operator-(const Vector2& other) const
 {
     return {x - other.x, y - other.y};
 }
 
 template <typename T>
-Math::Vector2<T>& Math::Vector2<T>::operator-=(const Vector2& other)
+constexpr Math::Vector2<T>& Math::Vector2<T>::operator-=(const Vector2& other)
 {
     x -= other.x;
     y -= other.y;
@@ -347,19 +357,19 @@ Math::Vector2<T>& Math::Vector2<T>::operator-=(const Vector2& other)
 }
 
 template <typename T>
-Math::Vector2<T> Math::Vector2<T>::operator*(const Vector2& other) const
+constexpr Math::Vector2<T> Math::Vector2<T>::operator*(const Vector2& other) const
 {
     return {x * other.x, y * other.y};
 }
 
 template <typename T, typename U>
-Math::Vector2<T> Math::operator*(U scalar, const Vector2<T>& vec)
+constexpr Math::Vector2<T> Math::operator*(U scalar, const Vector2<T>& vec)
 {
     return vec * scalar;
 }
 
 template <typename T>
-Math::Vector2<T>& Math::Vector2<T>::operator*=(const Vector2& other)
+constexpr Math::Vector2<T>& Math::Vector2<T>::operator*=(const Vector2& other)
 {
     x *= other.x;
     y *= other.y;
@@ -367,14 +377,14 @@ Math::Vector2<T>& Math::Vector2<T>::operator*=(const Vector2& other)
 }
 
 template <typename T>
-Math::Vector2<T> Math::Vector2<T>::operator-() const
+constexpr Math::Vector2<T> Math::Vector2<T>::operator-() const
 {
     return {-x, -y};
 }
 
 template <typename T>
 template <typename U>
-Math::Vector2<T> Math::Vector2<T>::operator*(U scalar) const
+constexpr Math::Vector2<T> Math::Vector2<T>::operator*(U scalar) const
 {
     T sc = static_cast<T>(scalar);
     return {x * sc, y * sc};
@@ -382,7 +392,7 @@ Math::Vector2<T> Math::Vector2<T>::operator*(U scalar) const
 
 template <typename T>
 template <typename U>
-Math::Vector2<T>& Math::Vector2<T>::operator*=(U scalar)
+constexpr Math::Vector2<T>& Math::Vector2<T>::operator*=(U scalar)
 {
     T sc = static_cast<T>(scalar);
     x *= sc;
@@ -392,7 +402,7 @@ Math::Vector2<T>& Math::Vector2<T>::operator*=(U scalar)
 
 template <typename T>
 template <typename U>
-Math::Vector2<T> Math::Vector2<T>::operator/(U scalar) const
+constexpr Math::Vector2<T> Math::Vector2<T>::operator/(U scalar) const
 {
     if constexpr (std::is_integral_v<T>)
     {
@@ -408,7 +418,7 @@ Math::Vector2<T> Math::Vector2<T>::operator/(U scalar) const
 
 template <typename T>
 template <typename U>
-Math::Vector2<T>& Math::Vector2<T>::operator/=(U scalar)
+constexpr Math::Vector2<T>& Math::Vector2<T>::operator/=(U scalar)
 {
     if constexpr (std::is_integral_v<T>)
     {
@@ -427,67 +437,67 @@ Math::Vector2<T>& Math::Vector2<T>::operator/=(U scalar)
 }
 
 template <typename T>
-bool Math::ContainsNonFinite(const Vector2<T>& vec)
+constexpr bool Math::ContainsNonFinite(const Vector2<T>& vec)
 {
     return !Math::IsFinite(vec.x) || !Math::IsFinite(vec.y);
 }
 
 template <typename T>
-bool Math::ContainsNaN(const Vector2<T>& vec)
+constexpr bool Math::ContainsNaN(const Vector2<T>& vec)
 {
     return Math::IsNaN(vec.x) || Math::IsNaN(vec.y);
 }
 
 template <typename T>
-Math::Vector2<T> Math::Abs(const Vector2<T>& vec)
+constexpr Math::Vector2<T> Math::Abs(const Vector2<T>& vec)
 {
     return {Math::Abs(vec.x), Math::Abs(vec.y)};
 }
 
 template <typename T>
-T Math::LengthSquared(const Vector2<T>& vec)
+constexpr T Math::LengthSquared(const Vector2<T>& vec)
 {
     return vec.x * vec.x + vec.y * vec.y;
 }
 
 template <typename T>
-double Math::Length(const Vector2<T>& vec)
+constexpr double Math::Length(const Vector2<T>& vec)
 {
-    return Math::Sqrt(static_cast<double>(LengthSquared(vec)));
+    return Math::Sqrt(Math::SumOfSquares(vec.x, vec.y));
 }
 
 template <typename T>
-bool Math::IsEqual(const Vector2<T>& vec1, const Vector2<T>& vec2, T epsilon)
+constexpr bool Math::IsEqual(const Vector2<T>& vec1, const Vector2<T>& vec2, T epsilon)
 {
     return Math::Abs(vec1.x - vec2.x) <= epsilon && Math::Abs(vec1.y - vec2.y) <= epsilon;
 }
 
 template <typename T>
-Math::Vector2<T> Math::Lerp(T t, const Vector2<T>& vec1, const Vector2<T>& vec2)
+constexpr Math::Vector2<T> Math::Lerp(T t, const Vector2<T>& vec1, const Vector2<T>& vec2)
 {
     return (1 - t) * vec1 + t * vec2;
 }
 
 template <typename T>
-T Math::Dot(const Vector2<T>& vec1, const Vector2<T>& vec2)
+constexpr T Math::Dot(const Vector2<T>& vec1, const Vector2<T>& vec2)
 {
     return vec1.x * vec2.x + vec1.y * vec2.y;
 }
 
 template <typename T>
-T Math::AbsDot(const Vector2<T>& vec1, const Vector2<T>& vec2)
+constexpr T Math::AbsDot(const Vector2<T>& vec1, const Vector2<T>& vec2)
 {
     return Math::Abs(Dot(vec1, vec2));
 }
 
 template <typename T>
-T Math::Cross(const Vector2<T>& vec1, const Vector2<T>& vec2)
+constexpr T Math::Cross(const Vector2<T>& vec1, const Vector2<T>& vec2)
 {
     return vec1.x * vec2.y - vec1.y * vec2.x;
 }
 
 template <typename T>
-Math::Vector2<T> Math::Normalize(const Vector2<T>& vec)
+constexpr Math::Vector2<T> Math::Normalize(const Vector2<T>& vec)
 {
     double length = Length(vec);
     assert(length > 0);
@@ -495,55 +505,55 @@ Math::Vector2<T> Math::Normalize(const Vector2<T>& vec)
 }
 
 template <typename T>
-Math::Vector2<T> Math::Min(const Vector2<T>& vec1, const Vector2<T>& vec2)
+constexpr Math::Vector2<T> Math::Min(const Vector2<T>& vec1, const Vector2<T>& vec2)
 {
     return {Math::Min(vec1.x, vec2.x), Math::Min(vec1.y, vec2.y)};
 }
 
 template <typename T>
-Math::Vector2<T> Math::Max(const Vector2<T>& vec1, const Vector2<T>& vec2)
+constexpr Math::Vector2<T> Math::Max(const Vector2<T>& vec1, const Vector2<T>& vec2)
 {
     return {Math::Max(vec1.x, vec2.x), Math::Max(vec1.y, vec2.y)};
 }
 
 template <typename T>
-Math::Vector2<T> Math::Permute(const Vector2<T>& vec, int x, int y)
+constexpr Math::Vector2<T> Math::Permute(const Vector2<T>& vec, int x, int y)
 {
     return {vec[x], vec[y]};
 }
 
 template <typename T>
-Math::Vector2<T> Math::Clamp(const Vector2<T>& vec, T low, T high)
+constexpr Math::Vector2<T> Math::Clamp(const Vector2<T>& vec, T low, T high)
 {
     return {Math::Clamp(vec.x, low, high), Math::Clamp(vec.y, low, high)};
 }
 
 template <typename T>
-T Math::MinComponent(const Vector2<T>& vec)
+constexpr T Math::MinComponent(const Vector2<T>& vec)
 {
     return Math::Min(vec.x, vec.y);
 }
 
 template <typename T>
-T Math::MaxComponent(const Vector2<T>& vec)
+constexpr T Math::MaxComponent(const Vector2<T>& vec)
 {
     return Math::Max(vec.x, vec.y);
 }
 
 template <typename T>
-int Math::MinDimension(const Vector2<T>& vec)
+constexpr int Math::MinDimension(const Vector2<T>& vec)
 {
     return vec.x < vec.y ? 0 : 1;
 }
 
 template <typename T>
-int Math::MaxDimension(const Vector2<T>& vec)
+constexpr int Math::MaxDimension(const Vector2<T>& vec)
 {
     return vec.x > vec.y ? 0 : 1;
 }
 
 template <typename T>
-Math::Vector2<T> Math::Reflect(const Vector2<T>& incidence, const Vector2<T>& normal)
+constexpr Math::Vector2<T> Math::Reflect(const Vector2<T>& incidence, const Vector2<T>& normal)
 {
     assert(Dot(incidence, normal) >= 0);
     return 2 * Dot(incidence, normal) * normal - incidence;
@@ -48,37 +48,37 @@ struct Vector3
      * Returns a vector with all components set to zero.
      * @return A vector with all components set to zero.
      */
-    static Vector3 Zero();
+    static constexpr Vector3 Zero();
 
     /** Operators **/
-    T& operator[](int index);
-    const T& operator[](int index) const;
+    constexpr T& operator[](int index);
+    constexpr const T& operator[](int index) const;
 
-    bool operator==(const Vector3& other) const;
-    bool operator!=(const Vector3& other) const;
+    constexpr bool operator==(const Vector3& other) const;
+    constexpr bool operator!=(const Vector3& other) const;
 
-    Vector3 operator+(const Vector3& other) const;
-    Vector3& operator+=(const Vector3& other);
-    Vector3 operator-(const Vector3& other) const;
-    Vector3& operator-=(const Vector3& other);
+    constexpr Vector3 operator+(const Vector3& other) const;
+    constexpr Vector3& operator+=(const Vector3& other);
+    constexpr Vector3 operator-(const Vector3& other) const;
+    constexpr Vector3& operator-=(const Vector3& other);
 
-    Vector3 operator*(const Vector3& other) const;
-    Vector3& operator*=(const Vector3& other);
+    constexpr Vector3 operator*(const Vector3& other) const;
+    constexpr Vector3& operator*=(const Vector3& other);
 
-    Vector3 operator-() const;
+    constexpr Vector3 operator-() const;
 
     template <typename U>
-    Vector3 operator*(U scalar) const;
+    constexpr Vector3 operator*(U scalar) const;
     template <typename U>
-    Vector3& operator*=(U scalar);
+    constexpr Vector3& operator*=(U scalar);
     template <typename U>
-    Vector3 operator/(U scalar) const;
+    constexpr Vector3 operator/(U scalar) const;
     template <typename U>
-    Vector3& operator/=(U scalar);
+    constexpr Vector3& operator/=(U scalar);
 };
 
 template <typename T, typename U>
-Vector3<T> operator*(U scalar, const Vector3<T>& vec);
+constexpr Vector3<T> operator*(U scalar, const Vector3<T>& vec);
 
 /**
  * Checks if any of the components are NaN or infinite value.
@@ -87,7 +87,7 @@ Vector3<T> operator*(U scalar, const Vector3<T>& vec);
  * @return True if any of the components are NaN or infinite value, false otherwise.
  */
 template <typename T>
-[[nodiscard]] bool ContainsNonFinite(const Vector3<T>& vec);
+[[nodiscard]] constexpr bool ContainsNonFinite(const Vector3<T>& vec);
 
 /**
  * Checks if any of the components are NaN.
@@ -96,7 +96,7 @@ template <typename T>
  * @return True if any of the components are NaN, false otherwise.
  */
 template <typename T>
-[[nodiscard]] bool ContainsNaN(const Vector3<T>& vec);
+[[nodiscard]] constexpr bool ContainsNaN(const Vector3<T>& vec);
 
 /**
  * Returns a new vector with the absolute value of each component.
@@ -105,7 +105,7 @@ template <typename T>
  * @return A new vector with the absolute value of each component.
  */
 template <typename T>
-[[nodiscard]] Vector3<T> Abs(const Vector3<T>& vec);
+[[nodiscard]] constexpr Vector3<T> Abs(const Vector3<T>& vec);
 
 /**
  * Returns the dot product of vector with himself.
@@ -114,7 +114,7 @@ template <typename T>
  * @return The dot product of vector with himself.
  */
 template <typename T>
-[[nodiscard]] T LengthSquared(const Vector3<T>& vec);
+[[nodiscard]] constexpr T LengthSquared(const Vector3<T>& vec);
 
 /**
  * Returns the length of the vector.
@@ -123,7 +123,7 @@ template <typename T>
  * @return The length of the vector.
  */
 template <typename T>
-[[nodiscard]] double Length(const Vector3<T>& vec);
+[[nodiscard]] constexpr double Length(const Vector3<T>& vec);
 
 /**
  * Checks if the vectors are equal within a given epsilon.
@@ -134,7 +134,7 @@ template <typename T>
  * @return True if the vectors are equal within a given epsilon, false otherwise.
  */
 template <typename T>
-bool IsEqual(const Vector3<T>& vec1, const Vector3<T>& vec2, T epsilon);
+constexpr bool IsEqual(const Vector3<T>& vec1, const Vector3<T>& vec2, T epsilon);
 
 /**
  * Returns the linear interpolation between two vectors.
@@ -145,7 +145,7 @@ bool IsEqual(const Vector3<T>& vec1, const Vector3<T>& vec2, T epsilon);
  * @return The linear interpolation between two vectors.
  */
 template <typename T>
-Vector3<T> Lerp(T t, const Vector3<T>& vec1, const Vector3<T>& vec2);
+constexpr Vector3<T> Lerp(T t, const Vector3<T>& vec1, const Vector3<T>& vec2);
 
 /**
  * Returns the dot product of two vectors.
@@ -155,7 +155,7 @@ Vector3<T> Lerp(T t, const Vector3<T>& vec1, const Vector3<T>& vec2);
  * @return The dot product of two vectors.
  */
 template <typename T>
-T Dot(const Vector3<T>& vec1, const Vector3<T>& vec2);
+constexpr T Dot(const Vector3<T>& vec1, const Vector3<T>& vec2);
 
 /**
  * Returns the absolute dot product of two vectors.
@@ -165,7 +165,7 @@ T Dot(const Vector3<T>& vec1, const Vector3<T>& vec2);
  * @return The absolute dot product of two vectors.
  */
 template <typename T>
-T AbsDot(const Vector3<T>& vec1, const Vector3<T>& vec2);
+constexpr T AbsDot(const Vector3<T>& vec1, const Vector3<T>& vec2);
 
 /**
  * Returns the cross product of two vectors.
@@ -175,7 +175,7 @@ T AbsDot(const Vector3<T>& vec1, const Vector3<T>& vec2);
  * @return The cross product of two vectors.
  */
 template <typename T>
-Vector3<T> Cross(const Vector3<T>& vec1, const Vector3<T>& vec2);
+constexpr Vector3<T> Cross(const Vector3<T>& vec1, const Vector3<T>& vec2);
 
 /**
  * Returns the cross product of two vectors in 2D. Ignores z component.
@@ -185,7 +185,7 @@ Vector3<T> Cross(const Vector3<T>& vec1, const Vector3<T>& vec2);
  * @return The cross product of two vectors in 2D.
  */
 template <typename T>
-T Cross2D(const Vector3<T>& vec1, const Vector3<T>& vec2);
+constexpr T Cross2D(const Vector3<T>& vec1, const Vector3<T>& vec2);
 
 /**
  * Returns the normalized vector.
@@ -194,7 +194,7 @@ T Cross2D(const Vector3<T>& vec1, const Vector3<T>& vec2);
  * @return The normalized vector.
  */
 template <typename T>
-Vector3<T> Normalize(const Vector3<T>& vec);
+constexpr Vector3<T> Normalize(const Vector3<T>& vec);
 
 /**
  * Returns the new vector with the minimum components of the two vectors.
@@ -204,7 +204,7 @@ Vector3<T> Normalize(const Vector3<T>& vec);
  * @return The new vector with the minimum components of the two vectors.
  */
 template <typename T>
-Vector3<T> Min(const Vector3<T>& vec1, const Vector3<T>& vec2);
+constexpr Vector3<T> Min(const Vector3<T>& vec1, const Vector3<T>& vec2);
 
 /**
  * Returns the new vector with the maximum components of the two vectors.
@@ -214,7 +214,7 @@ Vector3<T> Min(const Vector3<T>& vec1, const Vector3<T>& vec2);
  * @return The new vector with the maximum components of the two vectors.
  */
 template <typename T>
-Vector3<T> Max(const Vector3<T>& vec1, const Vector3<T>& vec2);
+constexpr Vector3<T> Max(const Vector3<T>& vec1, const Vector3<T>& vec2);
 
 /**
  * Return the new vector with permuted components.
@@ -226,7 +226,7 @@ Vector3<T> Max(const Vector3<T>& vec1, const Vector3<T>& vec2);
  * @return The new vector with permuted components.
  */
 template <typename T>
-Vector3<T> Permute(const Vector3<T>& vec, int x, int y, int z);
+constexpr Vector3<T> Permute(const Vector3<T>& vec, int x, int y, int z);
 
 /**
  * Returns the new vector with all the components clamped.
@@ -237,7 +237,7 @@ Vector3<T> Permute(const Vector3<T>& vec, int x, int y, int z);
  * @return The new vector with all the components clamped.
  */
 template <typename T>
-Vector3<T> Clamp(const Vector3<T>& vec, T low, T high);
+constexpr Vector3<T> Clamp(const Vector3<T>& vec, T low, T high);
 
 /**
  * Reflect the incidence vector around the normal.
@@ -246,7 +246,7 @@ Vector3<T> Clamp(const Vector3<T>& vec, T low, T high);
  * @return The reflected vector.
  */
 template <typename T>
-Vector3<T> Reflect(const Vector3<T>& incidence, const Vector3<T>& normal);
+constexpr Vector3<T> Reflect(const Vector3<T>& incidence, const Vector3<T>& normal);
 
 /**
  * Returns the value of the smallest component.
@@ -255,7 +255,7 @@ Vector3<T> Reflect(const Vector3<T>& incidence, const Vector3<T>& normal);
  * @return The value of the smallest component.
  */
 template <typename T>
-T MinComponent(const Vector3<T>& vec);
+constexpr T MinComponent(const Vector3<T>& vec);
 
 /**
  * Returns the value of the largest component.
@@ -264,7 +264,7 @@ T MinComponent(const Vector3<T>& vec);
  * @return The value of the largest component.
  */
 template <typename T>
-T MaxComponent(const Vector3<T>& vec);
+constexpr T MaxComponent(const Vector3<T>& vec);
 
 /**
  * Returns the index of the smallest component.
@@ -273,7 +273,7 @@ T MaxComponent(const Vector3<T>& vec);
  * @return The index of the smallest component.
  */
 template <typename T>
-int MinDimension(const Vector3<T>& vec);
+constexpr int MinDimension(const Vector3<T>& vec);
 
 /**
  * Returns the index of the largest component.
@@ -282,7 +282,7 @@ int MinDimension(const Vector3<T>& vec);
  * @return The index of the largest component.
  */
 template <typename T>
-int MaxDimension(const Vector3<T>& vec);
+constexpr int MaxDimension(const Vector3<T>& vec);
 
 }  // namespace Math
 
@@ -305,43 +305,53 @@ constexpr Math::Vector3<T>::Vector3(T xx, T yy, T zz) : x(xx), y(yy), z(zz)
 }
 
 template <typename T>
-Math::Vector3<T> Math::Vector3<T>::Zero()
+constexpr Math::Vector3<T> Math::Vector3<T>::Zero()
 {
     return Vector3<T>{0, 0, 0};
 }
 
 template <typename T>
-T& Math::Vector3<T>::operator[](int index)
+constexpr T& Math::Vector3<T>::operator[](int index)
 {
+    // Reading the inactive array member of the union is not allowed in constant expressions.
+    if (std::is_constant_evaluated())
+    {
+        return index == 0 ? x : (index == 1 ? y : z);
+    }
     return data[index];
 }
 
 template <typename T>
-const T& Math::Vector3<T>::operator[](int index) const
+constexpr const T& Math::Vector3<T>::operator[](int index) const
 {
+    // Reading the inactive array member of the union is not allowed in constant expressions.
+    if (std::is_constant_evaluated())
+    {
+        return index == 0 ? x : (index == 1 ? y : z);
+    }
     return data[index];
 }
 
 template <typename T>
-bool Math::Vector3<T>::operator==(const Vector3& other) const
+constexpr bool Math::Vector3<T>::operator==(const Vector3& other) const
 {
     return x == other.x && y == other.y && z == other.z;
 }
 
 template <typename T>
-bool Math::Vector3<T>::operator!=(const Vector3& other) const
+constexpr bool Math::Vector3<T>::operator!=(const Vector3& other) const
 {
     return !(*this == other);
 }
 
 template <typename T>
-Math::Vector3<T> Math::Vector3<T>::operator+(const Vector3& other) const
+constexpr Math::Vector3<T> Math::Vector3<T>::operator+(const Vector3& other) const
 {
     return {x + other.x, y + other.y, z + other.z};
 }
 
 template <typename T>
-Math::Vector3<T>& Math::Vector3<T>::operator+=(const Vector3& other)
+constexpr Math::Vector3<T>& Math::Vector3<T>::operator+=(const Vector3& other)
 {
     x += other.x;
     y += other.y;
@@ -350,13 +360,13 @@ Math::Vector3<T>& Math::Vector3<T>::operator+=(const Vector3& other)
 }
 
 template <typename T>
-Math::Vector3<T> Math::Vector3<T>::operator-(const Vector3& other) const
+constexpr Math::Vector3<T> Math::Vector3<T>::operator-(const Vector3& other) const
 {
     return {x - other.x, y - other.y, z - other.z};
 }
 
 template <typename T>
-Math::Vector3<T>& Math::Vector3<T>::operator-=(const Vector3& other)
+constexpr Math::Vector3<T>& Math::Vector3<T>::operator-=(const Vector3& other)
 {
     x -= other.x;
     y -= other.y;
@@ -365,19 +375,19 @@ Math::Vector3<T>& Math::Vector3<T>::operator-=(const Vector3& other)
 }
 
 template <typename T>
-Math::Vector3<T> Math::Vector3<T>::operator*(const Vector3& other) const
+constexpr Math::Vector3<T> Math::Vector3<T>::operator*(const Vector3& other) const
 {
     return {x * other.x, y * other.y, z * other.z};
 }
 
 template <typename T, typename U>
-Math::Vector3<T> Math::operator*(U scalar, const Vector3<T>& vec)
+constexpr Math::Vector3<T> Math::operator*(U scalar, const Vector3<T>& vec)
 {
     return vec * scalar;
 }
 
 template <typename T>
-Math::Vector3<T>& Math::Vector3<T>::operator*=(const Vector3& other)
+constexpr Math::Vector3<T>& Math::Vector3<T>::operator*=(const Vector3& other)
 {
     x *= other.x;
     y *= other.y;
@@ -386,14 +396,14 @@ Math::Vector3<T>& Math::Vector3<T>::operator*=(const Vector3& other)
 }
 
 template <typename T>
-Math::Vector3<T> Math::Vector3<T>::operator-() const
+constexpr Math::Vector3<T> Math::Vector3<T>::operator-() const
 {
     return {-x, -y, -z};
 }
 
 template <typename T>
 template <typename U>
-Math::Vector3<T> Math::Vector3<T>::operator*(U scalar) const
+constexpr Math::Vector3<T> Math::Vector3<T>::operator*(U scalar) const
 {
     T sc = static_cast<T>(scalar);
     return {x * sc, y * sc, z * sc};
@@ -401,7 +411,7 @@ Math::Vector3<T> Math::Vector3<T>::operator*(U scalar) const
 
 template <typename T>
 template <typename U>
-Math::Vector3<T>& Math::Vector3<T>::operator*=(U scalar)
+constexpr Math::Vector3<T>& Math::Vector3<T>::operator*=(U scalar)
 {
     T sc = static_cast<T>(scalar);
     x *= sc;
@@ -412,7 +422,7 @@ Math::Vector3<T>& Math::Vector3<T>::operator*=(U scalar)
 
 template <typename T>
 template <typename U>
-Math::Vector3<T> Math::Vector3<T>::operator/(U scalar) const
+constexpr Math::Vector3<T> Math::Vector3<T>::operator/(U scalar) const
 {
     if constexpr (std::is_integral_v<T>)
     {
@@ -428,7 +438,7 @@ Math::Vector3<T> Math::Vector3<T>::operator/(U scalar) const
 
 template <typename T>
 template <typename U>
-Math::Vector3<T>& Math::Vector3<T>::operator/=(U scalar)
+constexpr Math::Vector3<T>& Math::Vector3<T>::operator/=(U scalar)
 {
     if constexpr (std::is_integral_v<T>)
     {
@@ -449,75 +459,75 @@ Math::Vector3<T>& Math::Vector3<T>::operator/=(U scalar)
 }
 
 template <typename T>
-bool Math::ContainsNonFinite(const Vector3<T>& vec)
+constexpr bool Math::ContainsNonFinite(const Vector3<T>& vec)
 {
     return !Math::IsFinite(vec.x) || !Math::IsFinite(vec.y) || !Math::IsFinite(vec.z);
 }
 
 template <typename T>
-bool Math::ContainsNaN(const Vector3<T>& vec)
+constexpr bool Math::ContainsNaN(const Vector3<T>& vec)
 {
     return Math::IsNaN(vec.x) || Math::IsNaN(vec.y) || Math::IsNaN(vec.z);
 }
 
 template <typename T>
-Math::Vector3<T> Math::Abs(const Vector3<T>& vec)
+constexpr Math::Vector3<T> Math::Abs(const Vector3<T>& vec)
 {
     return {Math::Abs(vec.x), Math::Abs(vec.y), Math::Abs(vec.z)};
 }
 
 template <typename T>
-T Math::LengthSquared(const Vector3<T>& vec)
+constexpr T Math::LengthSquared(const Vector3<T>& vec)
 {
     return vec.x * vec.x + vec.y * vec.y + vec.z * vec.z;
 }
 
 template <typename T>
-double Math::Length(const Vector3<T>& vec)
+constexpr double Math::Length(const Vector3<T>& vec)
 {
-    return Math::Sqrt(static_cast<double>(LengthSquared(vec)));
+    return Math::Sqrt(Math::SumOfSquares(vec.x, vec.y, vec.z));
 }
 
 template <typename T>
-bool Math::IsEqual(const Vector3<T>& vec1, const Vector3<T>& vec2, T epsilon)
+constexpr bool Math::IsEqual(const Vector3<T>& vec1, const Vector3<T>& vec2, T epsilon)
 {
     return Math::Abs(vec1.x - vec2.x) <= epsilon && Math::Abs(vec1.y - vec2.y) <= epsilon &&
            Math::Abs(vec1.z - vec2.z) <= epsilon;
 }
 
 template <typename T>
-Math::Vector3<T> Math::Lerp(T t, const Vector3<T>& vec1, const Vector3<T>& vec2)
+constexpr Math::Vector3<T> Math::Lerp(T t, const Vector3<T>& vec1, const Vector3<T>& vec2)
 {
     return (1 - t) * vec1 + t * vec2;
 }
 
 template <typename T>
-T Math::Dot(const Vector3<T>& vec1, const Vector3<T>& vec2)
+constexpr T Math::Dot(const Vector3<T>& vec1, const Vector3<T>& vec2)
 {
     return vec1.x * vec2.x + vec1.y * vec2.y + vec1.z * vec2.z;
 }
 
 template <typename T>
-T Math::AbsDot(const Vector3<T>& vec1, const Vector3<T>& vec2)
+constexpr T Math::AbsDot(const Vector3<T>& vec1, const Vector3<T>& vec2)
 {
     return Math::Abs(Dot(vec1, vec2));
 }
 
 template <typename T>
-Math::Vector3<T> Math::Cross(const Vector3<T>& vec1, const Vector3<T>& vec2)
+constexpr Math::Vector3<T> Math::Cross(const Vector3<T>& vec1, const Vector3<T>& vec2)
 {
     return {vec1.y * vec2.z - vec1.z * vec2.y, vec1.z * vec2.x - vec1.x * vec2.z,
             vec1.x * vec2.y - vec1.y * vec2.x};
 }
 
 template <typename T>
-T Math::Cross2D(const Vector3<T>& vec1, const Vector3<T>& vec2)
+constexpr T Math::Cross2D(const Vector3<T>& vec1, const Vector3<T>& vec2)
 {
     return vec1.x * vec2.y - vec1.y * vec2.x;
 }
 
 template <typename T>
-Math::Vector3<T> Math::Normalize(const Vector3<T>& vec)
+constexpr Math::Vector3<T> Math::Normalize(const Vector3<T>& vec)
 {
     double length = Length(vec);
     assert(length > 0);
@@ -525,56 +535,56 @@ Math::Vector3<T> Math::Normalize(const Vector3<T>& vec)
 }
 
 template <typename T>
-Math::Vector3<T> Math::Min(const Vector3<T>& vec1, const Vector3<T>& vec2)
+constexpr Math::Vector3<T> Math::Min(const Vector3<T>& vec1, const Vector3<T>& vec2)
 {
     return {Math::Min(vec1.x, vec2.x), Math::Min(vec1.y, vec2.y), Math::Min(vec1.z, vec2.z)};
 }
 
 template <typename T>
-Math::Vector3<T> Math::Max(const Vector3<T>& vec1, const Vector3<T>& vec2)
+constexpr Math::Vector3<T> Math::Max(const Vector3<T>& vec1, const Vector3<T>& vec2)
 {
     return {Math::Max(vec1.x, vec2.x), Math::Max(vec1.y, vec2.y), Math::Max(vec1.z, vec2.z)};
 }
 
 template <typename T>
-Math::Vector3<T> Math::Permute(const Vector3<T>& vec, int x, int y, int z)
+constexpr Math::Vector3<T> Math::Permute(const Vector3<T>& vec, int x, int y, int z)
 {
     return {vec[x], vec[y], vec[z]};
 }
 
 template <typename T>
-Math::Vector3<T> Math::Clamp(const Vector3<T>& vec, T low, T high)
+constexpr Math::Vector3<T> Math::Clamp(const Vector3<T>& vec, T low, T high)
 {
     return {Math::Clamp(vec.x, low, high), Math::Clamp(vec.y, low, high),
             Math::Clamp(vec.z, low, high)};
 }
 
 template <typename T>
-T Math::MinComponent(const Vector3<T>& vec)
+constexpr T Math::MinComponent(const Vector3<T>& vec)
 {
     return Math::Min(Math::Min(vec.x, vec.y), vec.z);
 }
 
 template <typename T>
-T Math::MaxComponent(const Vector3<T>& vec)
+constexpr T Math::MaxComponent(const Vector3<T>& vec)
 {
     return Math::Max(Math::Max(vec.x, vec.y), vec.z);
 }
 
 template <typename T>
-int Math::MinDimension(const Vector3<T>& vec)
+constexpr int Math::MinDimension(const Vector3<T>& vec)
 {
     return vec.x < vec.y ? (vec.x < vec.z ? 0 : 2) : (vec.y < vec.z ? 1 : 2);
 }
 
 template <typename T>
-int Math::MaxDimension(const Vector3<T>& vec)
+constexpr int Math::MaxDimension(const Vector3<T>& vec)
 {
     return vec.x > vec.y ? (vec.x > vec.z ? 0 : 2) : (vec.y > vec.z ? 1 : 2);
 }
 
 template <typename T>
-Math::Vector3<T> Math::Reflect(const Vector3<T>& incidence, const Vector3<T>& normal)
+constexpr Math::Vector3<T> Math::Reflect(const Vector3<T>& incidence, const Vector3<T>& normal)
 {
     assert(Dot(incidence, normal) >= 0);
     return 2 * Dot(incidence, normal) * normal - incidence;
@@ -49,51 +49,51 @@ struct Vector4
      * Returns vector with all components set to zero.
      * @return Vector with all components set to zero.
      */
-    static Vector4 Zero();
+    static constexpr Vector4 Zero();
 
     /** Operators **/
-    T& operator[](int index);
-    const T& operator[](int index) const;
+    constexpr T& operator[](int index);
+    constexpr const T& operator[](int index) const;
 
-    bool operator==(const Vector4& other) const;
-    bool operator!=(const Vector4& other) const;
+    constexpr bool operator==(const Vector4& other) const;
+    constexpr bool operator!=(const Vector4& other) const;
 
-    Vector4 operator+(const Vector4& other) const;
-    Vector4& operator+=(const Vector4& other);
-    Vector4 operator-(const Vector4& other) const;
-    Vector4& operator-=(const Vector4& other);
+    constexpr Vector4 operator+(const Vector4& other) const;
+    constexpr Vector4& operator+=(const Vector4& other);
+    constexpr Vector4 operator-(const Vector4& other) const;
+    constexpr Vector4& operator-=(const Vector4& other);
 
-    Vector4 operator*(const Vector4& other) const;
-    Vector4& operator*=(const Vector4& other);
+    constexpr Vector4 operator*(const Vector4& other) const;
+    constexpr Vector4& operator*=(const Vector4& other);
 
-    Vector4 operator-() const;
+    constexpr Vector4 operator-() const;
 
     template <typename U>
-    Vector4 operator*(U scalar) const;
+    constexpr Vector4 operator*(U scalar) const;
     template <typename U>
-    Vector4& operator*=(U scalar);
+    constexpr Vector4& operator*=(U scalar);
     template <typename U>
-    Vector4 operator/(U scalar) const;
+    constexpr Vector4 operator/(U scalar) const;
     template <typename U>
-    Vector4& operator/=(U scalar);
+    constexpr Vector4& operator/=(U scalar);
 };
 
 template <typename T, typename U>
-Vector4<T> operator*(U scalar, const Vector4<T>& vec);
+constexpr Vector4<T> operator*(U scalar, const Vector4<T>& vec);
 
 /**
  * Checks if any of the components are NaN or infinite value.
  * @return True if any of the components are NaN or infinite value, false otherwise.
  */
 template <typename T>
-[[nodiscard]] bool ContainsNonFinite(const Vector4<T>& vec);
+[[nodiscard]] constexpr bool ContainsNonFinite(const Vector4<T>& vec);
 
 /**
  * Checks if any of the components are NaN.
  * @return True if any of the components are NaN, false otherwise.
  */
 template <typename T>
-[[nodiscard]] bool ContainsNaN(const Vector4<T>& vec);
+[[nodiscard]] constexpr bool ContainsNaN(const Vector4<T>& vec);
 
 /**
  * Returns a new vector with the absolute value of each component.
@@ -102,7 +102,7 @@ template <typename T>
  * @return A new vector with the absolute value of each component.
  */
 template <typename T>
-[[nodiscard]] Vector4<T> Abs(const Vector4<T>& vec);
+[[nodiscard]] constexpr Vector4<T> Abs(const Vector4<T>& vec);
 
 /**
  * Returns the dot product of vector with himself.
@@ -111,7 +111,7 @@ template <typename T>
  * @return The dot product of vector with himself.
  */
 template <typename T>
-[[nodiscard]] T LengthSquared(const Vector4<T>& vec);
+[[nodiscard]] constexpr T LengthSquared(const Vector4<T>& vec);
 
 /**
  * Returns the length of the vector.
@@ -120,7 +120,7 @@ template <typename T>
  * @return The length of the vector.
  */
 template <typename T>
-[[nodiscard]] double Length(const Vector4<T>& vec);
+[[nodiscard]] constexpr double Length(const Vector4<T>& vec);
 
 /**
  * Checks if the vectors are equal within a given epsilon.
@@ -131,7 +131,7 @@ template <typename T>
  * @return True if the vectors are equal within a given epsilon, false otherwise.
  */
 template <typename T>
-bool IsEqual(const Vector4<T>& vec1, const Vector4<T>& vec2, T epsilon);
+constexpr bool IsEqual(const Vector4<T>& vec1, const Vector4<T>& vec2, T epsilon);
 
 /**
  * Returns the linear interpolation of two vectors.
@@ -142,7 +142,7 @@ bool IsEqual(const Vector4<T>& vec1, const Vector4<T>& vec2, T epsilon);
  * @return The linear interpolation of two vectors.
  */
 template <typename T>
-Vector4<T> Lerp(T t, const Vector4<T>& vec1, const Vector4<T>& vec2);
+constexpr Vector4<T> Lerp(T t, const Vector4<T>& vec1, const Vector4<T>& vec2);
 
 /**
  * Returns the dot product of two vectors.
@@ -152,7 +152,7 @@ Vector4<T> Lerp(T t, const Vector4<T>& vec1, const Vector4<T>& vec2);
  * @return The dot product of two vectors.
  */
 template <typename T>
-T Dot(const Vector4<T>& vec1, const Vector4<T>& vec2);
+constexpr T Dot(const Vector4<T>& vec1, const Vector4<T>& vec2);
 
 /**
  * Returns the absolute dot product of two vectors.
@@ -162,7 +162,7 @@ T Dot(const Vector4<T>& vec1, const Vector4<T>& vec2);
  * @return The absolute dot product of two vectors.
  */
 template <typename T>
-T AbsDot(const Vector4<T>& vec1, const Vector4<T>& vec2);
+constexpr T AbsDot(const Vector4<T>& vec1, const Vector4<T>& vec2);
 
 /**
  * Returns the normalized vector.
@@ -171,7 +171,7 @@ T AbsDot(const Vector4<T>& vec1, const Vector4<T>& vec2);
  * @return The normalized vector.
  */
 template <typename T>
-Vector4<T> Normalize(const Vector4<T>& vec);
+constexpr Vector4<T> Normalize(const Vector4<T>& vec);
 
 /**
  * Returns the new vector with the minimum components of the two vectors.
@@ -181,7 +181,7 @@ Vector4<T> Normalize(const Vector4<T>& vec);
  * @return The new vector with the minimum components of the two vectors.
  */
 template <typename T>
-Vector4<T> Min(const Vector4<T>& vec1, const Vector4<T>& vec2);
+constexpr Vector4<T> Min(const Vector4<T>& vec1, const Vector4<T>& vec2);
 
 /**
  * Returns the new vector with the maximum components of the two vectors.
@@ -191,7 +191,7 @@ Vector4<T> Min(const Vector4<T>& vec1, const Vector4<T>& vec2);
  * @return The new vector with the maximum components of the two vectors.
  */
 template <typename T>
-Vector4<T> Max(const Vector4<T>& vec1, const Vector4<T>& vec2);
+constexpr Vector4<T> Max(const Vector4<T>& vec1, const Vector4<T>& vec2);
 
 /**
  * Return the new vector with permuted components.
@@ -204,7 +204,7 @@ Vector4<T> Max(const Vector4<T>& vec1, const Vector4<T>& vec2);
  * @return The new vector with permuted components.
  */
 template <typename T>
-Vector4<T> Permute(const Vector4<T>& vec, int x, int y, int z, int w);
+constexpr Vector4<T> Permute(const Vector4<T>& vec, int x, int y, int z, int w);
 
 /**
  * Returns the new vector with all the components clamped.
@@ -215,7 +215,7 @@ Vector4<T> Permute(const Vector4<T>& vec, int x, int y, int z, int w);
  * @return The new vector with all the components clamped.
  */
 template <typename T>
-Vector4<T> Clamp(const Vector4<T>& vec, T low, T high);
+constexpr Vector4<T> Clamp(const Vector4<T>& vec, T low, T high);
 
 /**
  * Returns the value of the smallest component.
@@ -224,7 +224,7 @@ Vector4<T> Clamp(const Vector4<T>& vec, T low, T high);
  * @return The value of the smallest component.
  */
 template <typename T>
-T MinComponent(const Vector4<T>& vec);
+constexpr T MinComponent(const Vector4<T>& vec);
 
 /**
  * Returns the value of the largest component.
@@ -233,7 +233,7 @@ T MinComponent(const Vector4<T>& vec);
  * @return The value of the largest component.
  */
 template <typename T>
-T MaxComponent(const Vector4<T>& vec);
+constexpr T MaxComponent(const Vector4<T>& vec);
 
 /**
  * Returns the index of the smallest component.
@@ -242,7 +242,7 @@ T MaxComponent(const Vector4<T>& vec);
  * @return The index of the smallest component.
  */
 template <typename T>
-int MinDimension(const Vector4<T>& vec);
+constexpr int MinDimension(const Vector4<T>& vec);
 
 /**
  * Returns the index of the largest component.
@@ -251,7 +251,7 @@ int MinDimension(const Vector4<T>& vec);
  * @return The index of the largest component.
  */
 template <typename T>
-int MaxDimension(const Vector4<T>& vec);
+constexpr int MaxDimension(const Vector4<T>& vec);
 
 }  // namespace Math
 
@@ -274,43 +274,53 @@ constexpr Math::Vector4<T>::Vector4(T xx, T yy, T zz, T ww) : x(xx), y(yy), z(zz
 }
 
 template <typename T>
-Math::Vector4<T> Math::Vector4<T>::Zero()
+constexpr Math::Vector4<T> Math::Vector4<T>::Zero()
 {
     return {0, 0, 0, 0};
 }
 
 template <typename T>
-T& Math::Vector4<T>::operator[](int index)
+constexpr T& Math::Vector4<T>::operator[](int index)
 {
+    // Reading the inactive array member of the union is not allowed in constant expressions.
+    if (std::is_constant_evaluated())
+    {
+        return index == 0 ? x : (index == 1 ? y : (index == 2 ? z : w));
+    }
     return data[index];
 }
 
 template <typename T>
-const T& Math::Vector4<T>::operator[](int index) const
+constexpr const T& Math::Vector4<T>::operator[](int index) const
 {
+    // Reading the inactive array member of the union is not allowed in constant expressions.
+    if (std::is_constant_evaluated())
+    {
+        return index == 0 ? x : (index == 1 ? y : (index == 2 ? z : w));
+    }
     return data[index];
 }
 
 template <typename T>
-bool Math::Vector4<T>::operator==(const Vector4& other) const
+constexpr bool Math::Vector4<T>::operator==(const Vector4& other) const
 {
     return x == other.x && y == other.y && z == other.z && w == other.w;
 }
 
 template <typename T>
-bool Math::Vector4<T>::operator!=(const Vector4& other) const
+constexpr bool Math::Vector4<T>::operator!=(const Vector4& other) const
 {
     return !(*this == other);
 }
 
 template <typename T>
-Math::Vector4<T> Math::Vector4<T>::operator+(const Vector4& other) const
+constexpr Math::Vector4<T> Math::Vector4<T>::operator+(const Vector4& other) const
 {
     return {x + other.x, y + other.y, z + other.z, w + other.w};
 }
 
 template <typename T>
-Math::Vector4<T>& Math::Vector4<T>::operator+=(const Vector4& other)
+constexpr Math::Vector4<T>& Math::Vector4<T>::operator+=(const Vector4& other)
 {
     x += other.x;
     y += other.y;
@@ -320,13 +330,13 @@ Math::Vector4<T>& Math::Vector4<T>::operator+=(const Vector4& other)
 }
 
 template <typename T>
-Math::Vector4<T> Math::Vector4<T>::operator-(const Vector4& other) const
+constexpr Math::Vector4<T> Math::Vector4<T>::operator-(const Vector4& other) const
 {
     return {x - other.x, y - other.y, z - other.z, w - other.w};
 }
 
 template <typename T>
-Math::Vector4<T>& Math::Vector4<T>::operator-=(const Vector4& other)
+constexpr Math::Vector4<T>& Math::Vector4<T>::operator-=(const Vector4& other)
 {
     x -= other.x;
     y -= other.y;
@@ -336,19 +346,19 @@ Math::Vector4<T>& Math::Vector4<T>::operator-=(const Vector4& other)
 }
 
 template <typename T>
-Math::Vector4<T> Math::Vector4<T>::operator*(const Vector4& other) const
+constexpr Math::Vector4<T> Math::Vector4<T>::operator*(const Vector4& other) const
 {
     return {x * other.x, y * other.y, z * other.z, w * other.w};
 }
 
 template <typename T, typename U>
-Math::Vector4<T> Math::operator*(U scalar, const Vector4<T>& vec)
+constexpr Math::Vector4<T> Math::operator*(U scalar, const Vector4<T>& vec)
 {
     return vec * scalar;
 }
 
 template <typename T>
-Math::Vector4<T>& Math::Vector4<T>::operator*=(const Vector4& other)
+constexpr Math::Vector4<T>& Math::Vector4<T>::operator*=(const Vector4& other)
 {
     x *= other.x;
     y *= other.y;
@@ -358,14 +368,14 @@ Math::Vector4<T>& Math::Vector4<T>::operator*=(const Vector4& other)
 }
 
 template <typename T>
-Math::Vector4<T> Math::Vector4<T>::operator-() const
+constexpr Math::Vector4<T> Math::Vector4<T>::operator-() const
 {
     return {-x, -y, -z, -w};
 }
 
 template <typename T>
 template <typename U>
-Math::Vector4<T> Math::Vector4<T>::operator*(U scalar) const
+constexpr Math::Vector4<T> Math::Vector4<T>::operator*(U scalar) const
 {
     T sc = static_cast<T>(scalar);
     return {x * sc, y * sc, z * sc, w * sc};
@@ -373,7 +383,7 @@ Math::Vector4<T> Math::Vector4<T>::operator*(U scalar) const
 
 template <typename T>
 template <typename U>
-Math::Vector4<T>& Math::Vector4<T>::operator*=(U scalar)
+constexpr Math::Vector4<T>& Math::Vector4<T>::operator*=(U scalar)
 {
     T sc = static_cast<T>(scalar);
     x *= sc;
@@ -385,7 +395,7 @@ Math::Vector4<T>& Math::Vector4<T>::operator*=(U scalar)
 
 template <typename T>
 template <typename U>
-Math::Vector4<T> Math::Vector4<T>::operator/(U scalar) const
+constexpr Math::Vector4<T> Math::Vector4<T>::operator/(U scalar) const
 {
     if constexpr (std::is_integral_v<T>)
     {
@@ -401,7 +411,7 @@ Math::Vector4<T> Math::Vector4<T>::operator/(U scalar) const
 
 template <typename T>
 template <typename U>
-Math::Vector4<T>& Math::Vector4<T>::operator/=(U scalar)
+constexpr Math::Vector4<T>& Math::Vector4<T>::operator/=(U scalar)
 {
     if constexpr (std::is_integral_v<T>)
     {
@@ -424,63 +434,63 @@ Math::Vector4<T>& Math::Vector4<T>::operator/=(U scalar)
 }
 
 template <typename T>
-bool Math::ContainsNonFinite(const Vector4<T>& vec)
+constexpr bool Math::ContainsNonFinite(const Vector4<T>& vec)
 {
     return !Math::IsFinite(vec.x) || !Math::IsFinite(vec.y) || !Math::IsFinite(vec.z) ||
            !Math::IsFinite(vec.w);
 }
 
 template <typename T>
-bool Math::ContainsNaN(const Vector4<T>& vec)
+constexpr bool Math::ContainsNaN(const Vector4<T>& vec)
 {
     return Math::IsNaN(vec.x) || Math::IsNaN(vec.y) || Math::IsNaN(vec.z) || Math::IsNaN(vec.w);
 }
 
 template <typename T>
-Math::Vector4<T> Math::Abs(const Vector4<T>& vec)
+constexpr Math::Vector4<T> Math::Abs(const Vector4<T>& vec)
 {
     return {Math::Abs(vec.x), Math::Abs(vec.y), Math::Abs(vec.z), Math::Abs(vec.w)};
 }
 
 template <typename T>
-T Math::LengthSquared(const Vector4<T>& vec)
+constexpr T Math::LengthSquared(const Vector4<T>& vec)
 {
     return vec.x * vec.x + vec.y * vec.y + vec.z * vec.z + vec.w * vec.w;
 }
 
 template <typename T>
-double Math::Length(const Vector4<T>& vec)
+constexpr double Math::Length(const Vector4<T>& vec)
 {
-    return Math::Sqrt(static_cast<double>(LengthSquared(vec)));
+    return Math::Sqrt(Math::SumOfSquares(vec.x, vec.y, vec.z, vec.w));
 }
 
 template <typename T>
-bool Math::IsEqual(const Vector4<T>& vec1, const Vector4<T>& vec2, T epsilon)
+constexpr bool Math::IsEqual(const Vector4<T>& vec1, const Vector4<T>& vec2, T epsilon)
 {
     return Math::Abs(vec1.x - vec2.x) <= epsilon && Math::Abs(vec1.y - vec2.y) <= epsilon &&
            Math::Abs(vec1.z - vec2.z) <= epsilon && Math::Abs(vec1.w - vec2.w) <= epsilon;
 }
 
 template <typename T>
-Math::Vector4<T> Math::Lerp(T t, const Vector4<T>& vec1, const Vector4<T>& vec2)
+constexpr Math::Vector4<T> Math::Lerp(T t, const Vector4<T>& vec1, const Vector4<T>& vec2)
 {
     return vec1 + (vec2 - vec1) * t;
 }
 
 template <typename T>
-T Math::Dot(const Vector4<T>& vec1, const Vector4<T>& vec2)
+constexpr T Math::Dot(const Vector4<T>& vec1, const Vector4<T>& vec2)
 {
     return vec1.x * vec2.x + vec1.y * vec2.y + vec1.z * vec2.z + vec1.w * vec2.w;
 }
 
 template <typename T>
-T Math::AbsDot(const Vector4<T>& vec1, const Vector4<T>& vec2)
+constexpr T Math::AbsDot(const Vector4<T>& vec1, const Vector4<T>& vec2)
 {
     return Math::Abs(Dot(vec1, vec2));
 }
 
 template <typename T>
-Math::Vector4<T> Math::Normalize(const Vector4<T>& vec)
+constexpr Math::Vector4<T> Math::Normalize(const Vector4<T>& vec)
 {
     double length = Length(vec);
     assert(length > 0);
@@ -488,53 +498,53 @@ Math::Vector4<T> Math::Normalize(const Vector4<T>& vec)
 }
 
 template <typename T>
-Math::Vector4<T> Math::Min(const Vector4<T>& vec1, const Vector4<T>& vec2)
+constexpr Math::Vector4<T> Math::Min(const Vector4<T>& vec1, const Vector4<T>& vec2)
 {
     return {Math::Min(vec1.x, vec2.x), Math::Min(vec1.y, vec2.y), Math::Min(vec1.z, vec2.z),
             Math::Min(vec1.w, vec2.w)};
 }
 
 template <typename T>
-Math::Vector4<T> Math::Max(const Vector4<T>& vec1, const Vector4<T>& vec2)
+constexpr Math::Vector4<T> Math::Max(const Vector4<T>& vec1, const Vector4<T>& vec2)
 {
     return {Math::Max(vec1.x, vec2.x), Math::Max(vec1.y, vec2.y), Math::Max(vec1.z, vec2.z),
             Math::Max(vec1.w, vec2.w)};
 }
 
 template <typename T>
-Math::Vector4<T> Math::Permute(const Vector4<T>& vec, int x, int y, int z, int w)
+constexpr Math::Vector4<T> Math::Permute(const Vector4<T>& vec, int x, int y, int z, int w)
 {
     return {vec[x], vec[y], vec[z], vec[w]};
 }
 
 template <typename T>
-Math::Vector4<T> Math::Clamp(const Vector4<T>& vec, T low, T high)
+constexpr Math::Vector4<T> Math::Clamp(const Vector4<T>& vec, T low, T high)
 {
     return {Math::Clamp(vec.x, low, high), Math::Clamp(vec.y, low, high),
             Math::Clamp(vec.z, low, high), Math::Clamp(vec.w, low, high)};
 }
 
 template <typename T>
-T Math::MinComponent(const Vector4<T>& vec)
+constexpr T Math::MinComponent(const Vector4<T>& vec)
 {
     return Math::Min(Math::Min(vec.x, vec.y), Math::Min(vec.z, vec.w));
 }
 
 template <typename T>
-T Math::MaxComponent(const Vector4<T>& vec)
+constexpr T Math::MaxComponent(const Vector4<T>& vec)
 {
     return Math::Max(Math::Max(vec.x, vec.y), Math::Max(vec.z, vec.w));
 }
 
 template <typename T>
-int Math::MinDimension(const Vector4<T>& vec)
+constexpr int Math::MinDimension(const Vector4<T>& vec)
 {
     return vec.x < vec.y ? (vec.x < vec.z ? (vec.x < vec.w ? 0 : 3) : (vec.z < vec.w ? 2 : 3))
                          : (vec.y < vec.z ? (vec.y < vec.w ? 1 : 3) : (vec.z < vec.w ? 2 : 3));
 }
 
 template <typename T>
-int Math::MaxDimension(const Vector4<T>& vec)
+constexpr int Math::MaxDimension(const Vector4<T>& vec)
 {
     return vec.x > vec.y ? (vec.x > vec.z ? (vec.x > vec.w ? 0 : 3) : (vec.z > vec.w ? 2 : 3))
                          : (vec.y > vec.z ? (vec.y > vec.w ? 1 : 3) : (vec.z > vec.w ? 2 : 3));
@@ -0,0 +1,331 @@
+#include "math/binary-file.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstring>
+#include <fstream>
+#include <utility>
+#include <vector>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+
+constexpr std::array<char, 8> k_magic = {'M', 'A', 'T', 'H', 'B', 'I', 'N', '\0'};
+constexpr uint32_t k_version = 1;
+// Reads as another value on a machine with a different byte order.
+constexpr uint32_t k_endianness = 0x01020304;
+
+struct BinaryFileHeader
+{
+    std::array<char, 8> magic;
+    uint32_t version;
+    uint32_t endianness;
+    uint64_t array_count;
+    uint64_t directory_offset;
+    uint64_t file_size;
+    uint8_t reserved[24];
+};
+static_assert(sizeof(BinaryFileHeader) == 64);
+
+void WritePadding(std::ofstream& file, size_t alignment)
+{
+    static constexpr std::array<char, Math::k_binary_file_alignment> k_zeros = {};
+    const auto position = static_cast<size_t>(file.tellp());
+    file.write(k_zeros.data(),
+               static_cast<std::streamsize>((alignment - position % alignment) % alignment));
+}
+
+const std::byte* MapFile(const std::filesystem::path& path, size_t& size)
+{
+#if defined(_WIN32)
+    const HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                    OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return nullptr;
+    }
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file, &file_size) ||
+        file_size.QuadPart < static_cast<LONGLONG>(sizeof(BinaryFileHeader)))
+    {
+        CloseHandle(file);
+        return nullptr;
+    }
+    // The view keeps the mapping and the file open.
+    const HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (mapping == nullptr)
+    {
+        return nullptr;
+    }
+    const void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    size = static_cast<size_t>(file_size.QuadPart);
+    return static_cast<const std::byte*>(view);
+#else
+    const int file = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (file < 0)
+    {
+        return nullptr;
+    }
+    struct stat status;
+    if (fstat(file, &status) != 0 ||
+        static_cast<size_t>(status.st_size) < sizeof(BinaryFileHeader))
+    {
+        close(file);
+        return nullptr;
+    }
+    // The mapping keeps the file open.
+    size = static_cast<size_t>(status.st_size);
+    void* view = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+    close(file);
+    return view == MAP_FAILED ? nullptr : static_cast<const std::byte*>(view);
+#endif
+}
+
+void UnmapFile(const std::byte* data, [[maybe_unused]] size_t size)
+{
+#if defined(_WIN32)
+    UnmapViewOfFile(data);
+#else
+    munmap(const_cast<std::byte*>(data), size);
+#endif
+}
+
+bool IsValidFile(const std::byte* data, size_t size)
+{
+    const auto* header = reinterpret_cast<const BinaryFileHeader*>(data);
+    if (header->magic != k_magic || header->version != k_version ||
+        header->endianness != k_endianness || header->file_size != size)
+    {
+        return false;
+    }
+    // Compare with divisions, so corrupt counts can't overflow the products.
+    const uint64_t directory_offset = header->directory_offset;
+    if (directory_offset % alignof(Math::BinaryArrayInfo) != 0 || directory_offset > size ||
+        header->array_count > (size - directory_offset) / sizeof(Math::BinaryArrayInfo))
+    {
+        return false;
+    }
+    const auto* arrays = reinterpret_cast<const Math::BinaryArrayInfo*>(data + directory_offset);
+    return std::all_of(arrays, arrays + header->array_count,
+                       [size](const Math::BinaryArrayInfo& info)
+                       {
+                           return info.element_size != 0 &&
+                                  info.offset % Math::k_binary_file_alignment == 0 &&
+                                  info.offset <= size &&
+                                  info.count <= (size - info.offset) / info.element_size &&
+                                  std::memchr(info.name, '\0', sizeof(info.name)) != nullptr;
+                       });
+}
+
+}  // namespace
+
+struct Math::BinaryFileWriter::Impl
+{
+    std::ofstream file;
+    std::vector<BinaryArrayInfo> arrays;
+    BinaryArrayInfo current = {};
+    bool in_array = false;
+};
+
+struct Math::MappedBinaryFile::Impl
+{
+    const std::byte* data = nullptr;
+    size_t size = 0;
+};
+
+Math::BinaryFileWriter::BinaryFileWriter() : m_impl(new Impl) {}
+
+Math::BinaryFileWriter::~BinaryFileWriter()
+{
+    delete m_impl;
+}
+
+Math::BinaryFileWriter::BinaryFileWriter(BinaryFileWriter&& other) noexcept : m_impl(nullptr)
+{
+    std::swap(m_impl, other.m_impl);
+}
+
+Math::BinaryFileWriter& Math::BinaryFileWriter::operator=(BinaryFileWriter&& other) noexcept
+{
+    std::swap(m_impl, other.m_impl);
+    return *this;
+}
+
+bool Math::BinaryFileWriter::Open(const std::filesystem::path& path)
+{
+    m_impl->file = std::ofstream(path, std::ios::binary | std::ios::trunc);
+    m_impl->arrays.clear();
+    m_impl->in_array = false;
+    // Zeros until Close writes the header, an unfinished file doesn't open.
+    const BinaryFileHeader header = {};
+    m_impl->file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    return m_impl->file.good();
+}
+
+bool Math::BinaryFileWriter::BeginArray(BinaryType type,
+                                        uint32_t element_size,
+                                        std::string_view name)
+{
+    assert(m_impl->file.is_open() && !m_impl->in_array);
+    if (name.size() > BinaryArrayInfo::k_max_name_length)
+    {
+        return false;
+    }
+    WritePadding(m_impl->file, k_binary_file_alignment);
+    BinaryArrayInfo& info = m_impl->current;
+    info = {};
+    info.type = type;
+    info.element_size = element_size;
+    info.offset = static_cast<uint64_t>(m_impl->file.tellp());
+    std::memcpy(info.name, name.data(), name.size());
+    m_impl->in_array = true;
+    return m_impl->file.good();
+}
+
+bool Math::BinaryFileWriter::AppendBytes([[maybe_unused]] BinaryType type,
+                                         const void* data,
+                                         size_t size)
+{
+    assert(m_impl->in_array && type == m_impl->current.type);
+    m_impl->file.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+    m_impl->current.count += size / m_impl->current.element_size;
+    return m_impl->file.good();
+}
+
+void Math::BinaryFileWriter::EndArray()
+{
+    assert(m_impl->in_array);
+    m_impl->arrays.push_back(m_impl->current);
+    m_impl->in_array = false;
+}
+
+bool Math::BinaryFileWriter::Close()
+{
+    std::ofstream& file = m_impl->file;
+    if (!file.is_open())
+    {
+        return false;
+    }
+    assert(!m_impl->in_array);
+    WritePadding(file, alignof(BinaryArrayInfo));
+    BinaryFileHeader header = {};
+    header.magic = k_magic;
+    header.version = k_version;
+    header.endianness = k_endianness;
+    header.array_count = m_impl->arrays.size();
+    header.directory_offset = static_cast<uint64_t>(file.tellp());
+    file.write(reinterpret_cast<const char*>(m_impl->arrays.data()),
+               static_cast<std::streamsize>(m_impl->arrays.size() * sizeof(BinaryArrayInfo)));
+    header.file_size = static_cast<uint64_t>(file.tellp());
+    file.seekp(0);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.close();
+    m_impl->arrays.clear();
+    return !file.fail();
+}
+
+Math::MappedBinaryFile::MappedBinaryFile() : m_impl(new Impl) {}
+
+Math::MappedBinaryFile::~MappedBinaryFile()
+{
+    if (m_impl != nullptr)
+    {
+        Close();
+    }
+    delete m_impl;
+}
+
+Math::MappedBinaryFile::MappedBinaryFile(MappedBinaryFile&& other) noexcept : m_impl(nullptr)
+{
+    std::swap(m_impl, other.m_impl);
+}
+
+Math::MappedBinaryFile& Math::MappedBinaryFile::operator=(MappedBinaryFile&& other) noexcept
+{
+    std::swap(m_impl, other.m_impl);
+    return *this;
+}
+
+bool Math::MappedBinaryFile::Open(const std::filesystem::path& path)
+{
+    Close();
+    size_t size = 0;
+    const std::byte* data = MapFile(path, size);
+    if (data == nullptr)
+    {
+        return false;
+    }
+    if (!IsValidFile(data, size))
+    {
+        UnmapFile(data, size);
+        return false;
+    }
+    m_impl->data = data;
+    m_impl->size = size;
+    return true;
+}
+
+void Math::MappedBinaryFile::Close()
+{
+    if (m_impl->data != nullptr)
+    {
+        UnmapFile(m_impl->data, m_impl->size);
+        m_impl->data = nullptr;
+        m_impl->size = 0;
+    }
+}
+
+bool Math::MappedBinaryFile::IsOpen() const
+{
+    return m_impl->data != nullptr;
+}
+
+size_t Math::MappedBinaryFile::ArrayCount() const
+{
+    if (m_impl->data == nullptr)
+    {
+        return 0;
+    }
+    const auto* header = reinterpret_cast<const BinaryFileHeader*>(m_impl->data);
+    return static_cast<size_t>(header->array_count);
+}
+
+const Math::BinaryArrayInfo& Math::MappedBinaryFile::GetArrayInfo(size_t index) const
+{
+    assert(index < ArrayCount());
+    const auto* header = reinterpret_cast<const BinaryFileHeader*>(m_impl->data);
+    const auto* arrays =
+        reinterpret_cast<const BinaryArrayInfo*>(m_impl->data + header->directory_offset);
+    return arrays[index];
+}
+
+size_t Math::MappedBinaryFile::FindArray(std::string_view name) const
+{
+    for (size_t i = 0; i < ArrayCount(); ++i)
+    {
+        if (name == GetArrayInfo(i).name)
+        {
+            return i;
+        }
+    }
+    return k_invalid_array;
+}
+
+const std::byte* Math::MappedBinaryFile::Data() const
+{
+    return m_impl->data;
+}
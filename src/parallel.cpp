@@ -0,0 +1,74 @@
+#include "math/parallel.h"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+static std::atomic<uint32_t> g_thread_count_override = 0;
+
+uint32_t Math::ThreadCount()
+{
+    const uint32_t count_override = g_thread_count_override.load(std::memory_order_relaxed);
+    if (count_override != 0)
+    {
+        return count_override;
+    }
+    return std::max(std::thread::hardware_concurrency(), 1u);
+}
+
+void Math::SetThreadCount(uint32_t count)
+{
+    g_thread_count_override.store(count, std::memory_order_relaxed);
+}
+
+void Math::ParallelFor(size_t count,
+                       size_t min_batch_size,
+                       const std::function<void(size_t, size_t)>& func)
+{
+    if (count == 0)
+    {
+        return;
+    }
+
+    min_batch_size = std::max<size_t>(min_batch_size, 1);
+    const size_t max_batch_count = (count + min_batch_size - 1) / min_batch_size;
+    const size_t batch_count = std::min<size_t>(ThreadCount(), max_batch_count);
+    if (batch_count <= 1)
+    {
+        func(0, count);
+        return;
+    }
+
+    // Spread the remainder over the first batches so the sizes differ by one at most.
+    const size_t batch_size = count / batch_count;
+    const size_t remainder = count % batch_count;
+    auto batch_begin = [&](size_t batch)
+    { return batch * batch_size + std::min(batch, remainder); };
+
+    std::vector<std::thread> threads;
+    threads.reserve(batch_count - 1);
+    auto join = [&]
+    {
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+    };
+    // Destroying a thread that is still joinable terminates, so the threads that started are
+    // joined before an exception from this thread or from starting a thread leaves.
+    try
+    {
+        for (size_t batch = 1; batch < batch_count; ++batch)
+        {
+            threads.emplace_back(std::cref(func), batch_begin(batch), batch_begin(batch + 1));
+        }
+        func(0, batch_begin(1));
+    }
+    catch (...)
+    {
+        join();
+        throw;
+    }
+    join();
+}
@@ -400,3 +400,34 @@ TEST(BaseTests, Power)
     }
 }
 
+
+TEST(BaseTests, NextFloat)
+{
+    {
+        EXPECT_EQ(Math::NextFloatUp(1.0f), std::nextafter(1.0f, 2.0f));
+        EXPECT_EQ(Math::NextFloatDown(1.0f), std::nextafter(1.0f, 0.0f));
+        EXPECT_EQ(Math::NextFloatUp(-1.0f), std::nextafter(-1.0f, 0.0f));
+        EXPECT_EQ(Math::NextFloatDown(-1.0f), std::nextafter(-1.0f, -2.0f));
+        EXPECT_EQ(Math::NextFloatUp(0.0f), std::numeric_limits<float>::denorm_min());
+        EXPECT_EQ(Math::NextFloatUp(-0.0f), std::numeric_limits<float>::denorm_min());
+        EXPECT_EQ(Math::NextFloatDown(0.0f), -std::numeric_limits<float>::denorm_min());
+        EXPECT_EQ(Math::NextFloatUp(std::numeric_limits<float>::max()), Math::k_inf_float);
+        EXPECT_EQ(Math::NextFloatUp(Math::k_inf_float), Math::k_inf_float);
+        EXPECT_EQ(Math::NextFloatDown(Math::k_neg_inf_float), Math::k_neg_inf_float);
+        EXPECT_TRUE(Math::IsNaN(Math::NextFloatUp(NAN)));
+    }
+    {
+        EXPECT_EQ(Math::NextFloatUp(1.0), std::nextafter(1.0, 2.0));
+        EXPECT_EQ(Math::NextFloatDown(-3.5), std::nextafter(-3.5, -4.0));
+        EXPECT_EQ(Math::NextFloatDown(0.0), -std::numeric_limits<double>::denorm_min());
+    }
+    static_assert(Math::NextFloatUp(1.0f) > 1.0f);
+}
+
+TEST(BaseTests, Gamma)
+{
+    EXPECT_EQ(Math::Gamma<float>(0), 0.0f);
+    EXPECT_NEAR(Math::Gamma<float>(3), 3 * std::numeric_limits<float>::epsilon() / 2, 1e-12f);
+    EXPECT_GT(Math::Gamma<double>(5), 5 * std::numeric_limits<double>::epsilon() / 2);
+    EXPECT_LT(Math::Gamma<double>(5), 6 * std::numeric_limits<double>::epsilon() / 2);
+}
@@ -0,0 +1,156 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "math/binary-file.h"
+#include "math/rng.h"
+
+using Bounds3f = Math::Bounds3<float>;
+using Matrix4x4f = Math::Matrix4x4<float>;
+using Point3f = Math::Point3<float>;
+
+namespace
+{
+
+std::filesystem::path TempPath(const char* name)
+{
+    return std::filesystem::temp_directory_path() / name;
+}
+
+std::vector<Point3f> RandomPoints(size_t count, uint64_t seed)
+{
+    Math::RNG rng(seed);
+    std::vector<Point3f> result(count);
+    for (Point3f& p : result)
+    {
+        p = Point3f(rng.UniformFloat(), rng.UniformFloat(), rng.UniformFloat());
+    }
+    return result;
+}
+
+}  // namespace
+
+TEST(BinaryFileTests, RoundTrip)
+{
+    const std::filesystem::path path = TempPath("math-binary-file-round-trip.bin");
+    const std::vector<Point3f> points = RandomPoints(1001, 1);
+    const std::vector<Bounds3f> bounds = {Bounds3f(Point3f(0, 0, 0), Point3f(1, 2, 3)),
+                                          Bounds3f(Point3f(-1, -1, -1), Point3f(0, 0, 0))};
+    const std::vector<Matrix4x4f> matrices = {Matrix4x4f(1), Matrix4x4f(2)};
+
+    Math::BinaryFileWriter writer;
+    ASSERT_TRUE(writer.Open(path));
+    EXPECT_TRUE(writer.WriteArray<Point3f>("points", points));
+    EXPECT_TRUE(writer.WriteArray<Bounds3f>("bounds", bounds));
+    EXPECT_TRUE(writer.WriteArray<uint32_t>("empty", {}));
+    // Streamed in uneven chunks.
+    EXPECT_TRUE(writer.BeginArray<Matrix4x4f>("matrices"));
+    for (int i = 0; i < 3; ++i)
+    {
+        EXPECT_TRUE(writer.AppendChunk<Matrix4x4f>(matrices));
+        EXPECT_TRUE(writer.AppendChunk<Matrix4x4f>(std::span(matrices).first(1)));
+    }
+    writer.EndArray();
+    EXPECT_TRUE(writer.Close());
+
+    Math::MappedBinaryFile file;
+    ASSERT_TRUE(file.Open(path));
+    EXPECT_TRUE(file.IsOpen());
+    ASSERT_EQ(file.ArrayCount(), 4u);
+    EXPECT_EQ(file.FindArray("missing"), Math::MappedBinaryFile::k_invalid_array);
+    EXPECT_EQ(file.GetArrayInfo(1).type, Math::BinaryType::Bounds3f);
+    EXPECT_EQ(file.GetArrayInfo(1).element_size, sizeof(Bounds3f));
+    EXPECT_STREQ(file.GetArrayInfo(3).name, "matrices");
+
+    const size_t points_index = file.FindArray("points");
+    ASSERT_EQ(points_index, 0u);
+    const std::span<const Point3f> mapped_points = file.GetArray<Point3f>(points_index);
+    ASSERT_EQ(mapped_points.size(), points.size());
+    EXPECT_TRUE(std::equal(points.begin(), points.end(), mapped_points.begin()));
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(mapped_points.data()) % Math::k_binary_file_alignment,
+              0u);
+
+    const std::span<const Bounds3f> mapped_bounds = file.GetArray<Bounds3f>(1);
+    ASSERT_EQ(mapped_bounds.size(), 2u);
+    EXPECT_EQ(mapped_bounds[0], bounds[0]);
+    EXPECT_EQ(mapped_bounds[1], bounds[1]);
+    EXPECT_TRUE(file.GetArray<uint32_t>(2).empty());
+    // The wrong type or a missing array give no elements.
+    EXPECT_TRUE(file.GetArray<Bounds3f>(points_index).empty());
+    EXPECT_TRUE(file.GetArray<Point3f>(Math::MappedBinaryFile::k_invalid_array).empty());
+
+    const std::span<const Matrix4x4f> mapped_matrices = file.GetArray<Matrix4x4f>(3);
+    ASSERT_EQ(mapped_matrices.size(), 9u);
+    for (size_t i = 0; i < 9; ++i)
+    {
+        EXPECT_EQ(mapped_matrices[i], matrices[i % 3 == 2 ? 0 : i % 3]);
+    }
+
+    // Moving keeps the mapping.
+    Math::MappedBinaryFile moved = std::move(file);
+    EXPECT_EQ(moved.GetArray<Point3f>(0)[0], points[0]);
+    moved.Close();
+    EXPECT_FALSE(moved.IsOpen());
+    EXPECT_EQ(moved.ArrayCount(), 0u);
+    std::filesystem::remove(path);
+}
+
+TEST(BinaryFileTests, InvalidFiles)
+{
+    const std::filesystem::path path = TempPath("math-binary-file-invalid.bin");
+    Math::MappedBinaryFile file;
+    EXPECT_FALSE(file.Open(TempPath("math-binary-file-missing.bin")));
+
+    // A file that was not closed has no header.
+    {
+        Math::BinaryFileWriter writer;
+        ASSERT_TRUE(writer.Open(path));
+        EXPECT_TRUE(writer.WriteArray<Point3f>("points", RandomPoints(10, 2)));
+    }
+    EXPECT_FALSE(file.Open(path));
+
+    Math::BinaryFileWriter writer;
+    ASSERT_TRUE(writer.Open(path));
+    EXPECT_TRUE(writer.WriteArray<Point3f>("points", RandomPoints(100, 3)));
+    EXPECT_TRUE(writer.Close());
+    EXPECT_TRUE(file.Open(path));
+    file.Close();
+
+    // Truncated.
+    const auto size = std::filesystem::file_size(path);
+    std::filesystem::resize_file(path, size - 1);
+    EXPECT_FALSE(file.Open(path));
+    std::filesystem::resize_file(path, 10);
+    EXPECT_FALSE(file.Open(path));
+
+    // Corrupt count.
+    ASSERT_TRUE(writer.Open(path));
+    EXPECT_TRUE(writer.WriteArray<Point3f>("points", RandomPoints(100, 3)));
+    EXPECT_TRUE(writer.Close());
+    {
+        std::fstream stream(path, std::ios::binary | std::ios::in | std::ios::out);
+        const uint64_t count = UINT64_MAX / 4;
+        stream.seekp(static_cast<std::streamoff>(size - sizeof(Math::BinaryArrayInfo) + 8));
+        stream.write(reinterpret_cast<const char*>(&count), sizeof(count));
+    }
+    EXPECT_FALSE(file.Open(path));
+
+    // Names longer than the directory entry holds are rejected, the array is not started.
+    ASSERT_TRUE(writer.Open(path));
+    const std::string long_name(Math::BinaryArrayInfo::k_max_name_length + 1, 'a');
+    EXPECT_FALSE(writer.BeginArray<Point3f>(long_name));
+    EXPECT_FALSE(writer.WriteArray<Point3f>(long_name, RandomPoints(10, 4)));
+    const std::string max_name(Math::BinaryArrayInfo::k_max_name_length, 'b');
+    EXPECT_TRUE(writer.WriteArray<Point3f>(max_name, RandomPoints(10, 4)));
+    EXPECT_TRUE(writer.Close());
+    ASSERT_TRUE(file.Open(path));
+    ASSERT_EQ(file.ArrayCount(), 1u);
+    EXPECT_EQ(file.FindArray(max_name), 0u);
+    file.Close();
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,167 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "math/bounds3-batch.h"
+#include "math/rng.h"
+
+#include "mask-bits.h"
+
+namespace
+{
+
+template <typename T>
+struct BatchData
+{
+    std::vector<Math::Bounds3<T>> boxes;
+    std::vector<Math::Point3<T>> points;
+    std::vector<T> soa[6];
+
+    explicit BatchData(size_t count)
+    {
+        Math::RNG rng(1);
+        auto random = [&](float low, float high)
+        { return static_cast<T>(rng.UniformFloatInRange(low, high)); };
+        for (size_t i = 0; i < count; ++i)
+        {
+            const Math::Point3<T> p(random(-10, 10), random(-10, 10), random(-10, 10));
+            boxes.emplace_back(p, p + Math::Vector3<T>(random(0, 3), random(0, 3), random(0, 3)));
+            points.push_back(p);
+            // Some points exactly on the boundaries.
+            if (i % 7 == 0)
+            {
+                points.back().x = static_cast<T>(-2);
+            }
+            const Math::Bounds3<T>& b = boxes.back();
+            const T components[] = {b.min.x, b.min.y, b.min.z, b.max.x, b.max.y, b.max.z};
+            for (size_t c = 0; c < 6; ++c)
+            {
+                soa[c].push_back(components[c]);
+            }
+        }
+    }
+
+    Math::Bounds3SoA<const T> BoxesSoA() const
+    {
+        return Math::Bounds3SoA<const T>(soa[0], soa[1], soa[2], soa[3], soa[4], soa[5]);
+    }
+
+    Math::Point3SoA<const T> PointsSoA() const
+    {
+        // The points are the min corners of the boxes.
+        return Math::Point3SoA<const T>(soa[0], soa[1], soa[2]);
+    }
+};
+
+template <typename T>
+void TestBatch(size_t count)
+{
+    const BatchData<T> data(count);
+    const std::span<const Math::Bounds3<T>> boxes = data.boxes;
+
+    Math::Bounds3<T> expected_union = data.boxes[0];
+    for (const Math::Bounds3<T>& b : data.boxes)
+    {
+        expected_union = Math::Union(expected_union, b);
+    }
+    EXPECT_EQ(Math::Union(boxes), expected_union);
+    EXPECT_EQ(Math::Union<T>(data.BoxesSoA()), expected_union);
+
+    const Math::Bounds3<T> query(Math::Point3<T>(-2, -3, -4), Math::Point3<T>(3, 2, 1));
+    std::vector<uint64_t> mask((count + 63) / 64 + 1, ~uint64_t{0});
+    size_t expected_count = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        expected_count += Math::Overlaps(query, data.boxes[i]) ? 1 : 0;
+    }
+
+    EXPECT_EQ(Math::Overlaps(query, boxes, mask), expected_count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        EXPECT_EQ(MaskBit(mask, i), Math::Overlaps(query, data.boxes[i]));
+    }
+    // The padding bits are cleared and the words after the mask are left alone.
+    EXPECT_EQ(mask[(count - 1) / 64] >> (count - 1) % 64, uint64_t{MaskBit(mask, count - 1)});
+    EXPECT_EQ(mask.back(), ~uint64_t{0});
+
+    EXPECT_EQ(Math::Overlaps(query, data.BoxesSoA(), mask), expected_count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        EXPECT_EQ(MaskBit(mask, i), Math::Overlaps(query, data.boxes[i]));
+    }
+
+    expected_count = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        expected_count += Math::Inside(query, data.points[i]) ? 1 : 0;
+    }
+    EXPECT_EQ(Math::Inside(query, data.points, mask), expected_count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        EXPECT_EQ(MaskBit(mask, i), Math::Inside(query, data.points[i]));
+    }
+
+    size_t expected_min_count = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        expected_min_count += Math::Inside(query, data.boxes[i].min) ? 1 : 0;
+    }
+    EXPECT_EQ(Math::Inside(query, data.PointsSoA(), mask), expected_min_count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        EXPECT_EQ(MaskBit(mask, i), Math::Inside(query, data.boxes[i].min));
+    }
+}
+
+template <typename T>
+void TestTransformBounds(size_t count)
+{
+    BatchData<T> data(count);
+    Math::RNG rng(2);
+    std::vector<Math::Matrix4x4<T>> matrices(count, Math::Matrix4x4<T>(1));
+    for (Math::Matrix4x4<T>& m : matrices)
+    {
+        for (size_t row = 0; row < 3; ++row)
+        {
+            for (size_t column = 0; column < 4; ++column)
+            {
+                m.elements[row][column] = static_cast<T>(rng.UniformFloatInRange(-10, 10));
+            }
+        }
+    }
+
+    std::vector<Math::Bounds3<T>> result(count);
+    Math::TransformBounds<T>(matrices, data.boxes, result);
+    for (size_t i = 0; i < count; ++i)
+    {
+        EXPECT_EQ(result[i], Math::TransformBounds(matrices[i], data.boxes[i]));
+    }
+    // In place.
+    Math::TransformBounds<T>(matrices, data.boxes, data.boxes);
+    EXPECT_EQ(data.boxes, result);
+}
+
+}  // namespace
+
+TEST(Bounds3BatchTests, Float)
+{
+    TestBatch<float>(1);
+    TestBatch<float>(203);
+    TestBatch<float>(1024);
+    TestTransformBounds<float>(203);
+}
+
+TEST(Bounds3BatchTests, Double)
+{
+    TestBatch<double>(1);
+    TestBatch<double>(203);
+    TestTransformBounds<double>(203);
+}
+
+TEST(Bounds3BatchTests, Empty)
+{
+    const Math::Bounds3<float> empty = Math::Union(std::span<const Math::Bounds3<float>>());
+    const Math::Bounds3<float> b(Math::Point3<float>(1, 2, 3), Math::Point3<float>(4, 5, 6));
+    EXPECT_EQ(Math::Union(empty, b), b);
+    EXPECT_EQ(Math::Overlaps(b, std::span<const Math::Bounds3<float>>(), {}), 0u);
+}
@@ -0,0 +1,174 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <utility>
+#include <vector>
+
+#include "math/bvh-file.h"
+#include "math/rng.h"
+
+using Bounds3f = Math::Bounds3<float>;
+using Point3f = Math::Point3<float>;
+
+namespace
+{
+
+std::vector<Bounds3f> RandomBoxes(size_t count, uint64_t seed)
+{
+    Math::RNG rng(seed);
+    std::vector<Bounds3f> boxes;
+    for (size_t i = 0; i < count; ++i)
+    {
+        const Point3f p(rng.UniformFloatInRange(-100, 100), rng.UniformFloatInRange(-100, 100),
+                        rng.UniformFloatInRange(-100, 100));
+        boxes.emplace_back(p, p + Math::Vector3<float>(2, 2, 2));
+    }
+    return boxes;
+}
+
+template <typename Tree>
+std::vector<uint32_t> Overlaps(const Tree& bvh, const Bounds3f& query)
+{
+    std::vector<uint32_t> found;
+    Math::ForEachOverlap(bvh, query, [&](uint32_t primitive) { found.push_back(primitive); });
+    std::sort(found.begin(), found.end());
+    return found;
+}
+
+}  // namespace
+
+TEST(BVHFileTests, RoundTrip)
+{
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "math-bvh.bin";
+    const std::vector<Bounds3f> boxes = RandomBoxes(5000, 1);
+    Math::LinearBVH<float> bvh;
+    Math::Build<float>(boxes, bvh);
+    Math::LinearBVH<float> single;
+    Math::Build<float>(std::span(boxes).first(1), single);
+
+    Math::BinaryFileWriter writer;
+    ASSERT_TRUE(writer.Open(path));
+    EXPECT_TRUE(writer.WriteArray<Bounds3f>("boxes", boxes));
+    EXPECT_TRUE(Math::WriteBVH(writer, "scene", bvh));
+    EXPECT_TRUE(Math::WriteBVH(writer, "single", single));
+    EXPECT_TRUE(Math::WriteBVH(writer, "empty", Math::LinearBVH<float>()));
+    EXPECT_TRUE(writer.Close());
+
+    Math::MappedBinaryFile file;
+    ASSERT_TRUE(file.Open(path));
+    Math::BVHView<float> view;
+    ASSERT_TRUE(Math::LoadBVH(file, "scene", view));
+    ASSERT_EQ(view.nodes.size(), bvh.nodes.size());
+    const Math::BVHFileHeader& header =
+        file.GetArray<Math::BVHFileHeader>(file.FindArray("scene"))[0];
+    EXPECT_EQ(header.primitive_count, 5000u);
+    EXPECT_EQ(header.max_leaf_size, 1u);
+    EXPECT_EQ(header.split_method, Math::BVHSplitMethod::Morton);
+
+    Math::RNG rng(2);
+    for (int i = 0; i < 100; ++i)
+    {
+        const Point3f p(rng.UniformFloatInRange(-100, 100), rng.UniformFloatInRange(-100, 100),
+                        rng.UniformFloatInRange(-100, 100));
+        const Bounds3f query(p, p + Math::Vector3<float>(10, 10, 10));
+        EXPECT_EQ(Overlaps(view, query), Overlaps(bvh, query));
+    }
+
+    ASSERT_TRUE(Math::LoadBVH(file, "single", view));
+    EXPECT_EQ(Overlaps(view, boxes[0]), std::vector<uint32_t>{0});
+    ASSERT_TRUE(Math::LoadBVH(file, "empty", view));
+    EXPECT_TRUE(view.nodes.empty());
+    EXPECT_TRUE(Overlaps(view, boxes[0]).empty());
+
+    // Missing names, arrays that are not hierarchies and the wrong precision fail.
+    Math::BVHView<double> view_double;
+    EXPECT_FALSE(Math::LoadBVH(file, "scene", view_double));
+    EXPECT_FALSE(Math::LoadBVH(file, "missing", view));
+    EXPECT_FALSE(Math::LoadBVH(file, "boxes", view));
+    file.Close();
+    std::filesystem::remove(path);
+}
+
+TEST(BVHFileTests, Checksum)
+{
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "math-bvh-sum.bin";
+    const std::vector<Bounds3f> boxes = RandomBoxes(100, 3);
+    Math::LinearBVH<float> bvh;
+    Math::Build<float>(boxes, bvh);
+    Math::BinaryFileWriter writer;
+    ASSERT_TRUE(writer.Open(path));
+    EXPECT_TRUE(Math::WriteBVH(writer, "scene", bvh));
+    EXPECT_TRUE(writer.Close());
+
+    // Flip a bit of the first node, which starts at the second aligned offset.
+    {
+        std::fstream stream(path, std::ios::binary | std::ios::in | std::ios::out);
+        stream.seekg(2 * Math::k_binary_file_alignment);
+        char byte = 0;
+        stream.read(&byte, 1);
+        byte = static_cast<char>(byte ^ 1);
+        stream.seekp(2 * Math::k_binary_file_alignment);
+        stream.write(&byte, 1);
+    }
+    Math::MappedBinaryFile file;
+    ASSERT_TRUE(file.Open(path));
+    Math::BVHView<float> view;
+    EXPECT_FALSE(Math::LoadBVH(file, "scene", view));
+    EXPECT_TRUE(Math::LoadBVH(file, "scene", view, false));
+    EXPECT_EQ(view.nodes.size(), bvh.nodes.size());
+    file.Close();
+    std::filesystem::remove(path);
+}
+
+TEST(BVHFileTests, Indices)
+{
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "math-bvh-idx.bin";
+    const std::vector<Bounds3f> boxes = RandomBoxes(100, 4);
+    Math::LinearBVH<float> bvh;
+    Math::Build<float>(boxes, bvh);
+
+    // Out of range children and primitives, a child that is its own ancestor, and a subtree
+    // reached twice are rejected even without the checksum.
+    const uint32_t leaf = static_cast<uint32_t>(bvh.nodes.size() - 1);
+    const std::vector<std::pair<size_t, Math::BVHNode<float>>> corruptions = {
+        {0, {bvh.nodes[0].bounds, static_cast<uint32_t>(bvh.nodes.size()), bvh.nodes[0].right}},
+        {leaf, {bvh.nodes[leaf].bounds, 100, Math::k_bvh_leaf}},
+        {bvh.nodes[0].left, {bvh.nodes[0].bounds, 0, bvh.nodes[0].right}},
+        {0, {bvh.nodes[0].bounds, bvh.nodes[0].left, bvh.nodes[0].left}},
+    };
+    for (const auto& [index, node] : corruptions)
+    {
+        Math::BinaryFileWriter writer;
+        ASSERT_TRUE(writer.Open(path));
+        EXPECT_TRUE(Math::WriteBVH(writer, "scene", bvh));
+        EXPECT_TRUE(writer.Close());
+        {
+            std::fstream stream(path, std::ios::binary | std::ios::in | std::ios::out);
+            stream.seekp(static_cast<std::streamoff>(2 * Math::k_binary_file_alignment +
+                                                     index * sizeof(node)));
+            stream.write(reinterpret_cast<const char*>(&node), sizeof(node));
+        }
+
+        Math::MappedBinaryFile file;
+        ASSERT_TRUE(file.Open(path));
+        Math::BVHView<float> view;
+        EXPECT_FALSE(Math::LoadBVH(file, "scene", view, false));
+        file.Close();
+    }
+
+    // The untouched file loads without the checksum too.
+    {
+        Math::BinaryFileWriter writer;
+        ASSERT_TRUE(writer.Open(path));
+        EXPECT_TRUE(Math::WriteBVH(writer, "scene", bvh));
+        EXPECT_TRUE(writer.Close());
+    }
+    Math::MappedBinaryFile file;
+    ASSERT_TRUE(file.Open(path));
+    Math::BVHView<float> view;
+    EXPECT_TRUE(Math::LoadBVH(file, "scene", view, false));
+    file.Close();
+    std::filesystem::remove(path);
+}
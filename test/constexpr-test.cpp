@@ -0,0 +1,175 @@
+#include <gtest/gtest.h>
+
+#include "math/math.h"
+
+using Vector2f = Math::Vector2<float>;
+using Vector3f = Math::Vector3<float>;
+using Vector3d = Math::Vector3<double>;
+using Vector3i = Math::Vector3<int>;
+using Vector4f = Math::Vector4<float>;
+using Point2f = Math::Point2<float>;
+using Point3f = Math::Point3<float>;
+using Point3d = Math::Point3<double>;
+using Point4f = Math::Point4<float>;
+using Normal3f = Math::Normal3<float>;
+using Bounds2f = Math::Bounds2<float>;
+using Bounds3f = Math::Bounds3<float>;
+using Matrix4f = Math::Matrix4x4<float>;
+using Matrix4d = Math::Matrix4x4<double>;
+using Quatd = Math::Quaternion<double>;
+using Rotd = Math::Rotator<double>;
+
+TEST(ConstexprTests, Base)
+{
+    static_assert(Math::Abs(-3) == 3);
+    static_assert(Math::Min(2.0f, 3.0f) == 2.0f);
+    static_assert(Math::Max(2.0, 3.0) == 3.0);
+    static_assert(Math::Clamp(5, 0, 3) == 3);
+    static_assert(Math::Lerp(0.5, 2.0, 4.0) == 3.0);
+    static_assert(Math::IsFinite(1.0f));
+    static_assert(!Math::IsFinite(Math::k_inf_double));
+    static_assert(Math::IsNaN(std::numeric_limits<double>::quiet_NaN()));
+
+    static_assert(Math::Sqrt(16.0) == 4.0);
+    static_assert(Math::Sqrt(2.0f) == 1.41421356f);
+    static_assert(Math::Sqrt(0.0) == 0.0);
+    static_assert(Math::IsNaN(Math::Sqrt(-1.0)));
+
+    static_assert(Math::Floor(2.5) == 2.0);
+    static_assert(Math::Floor(-2.5) == -3.0);
+    static_assert(Math::Ceil(2.5f) == 3.0f);
+    static_assert(Math::Ceil(-2.5f) == -2.0f);
+    static_assert(Math::Round(2.5) == 3.0);
+    static_assert(Math::Round(-2.5) == -3.0);
+    static_assert(Math::Round(-2.4) == -2.0);
+
+    static_assert(Math::Sin(0.0) == 0.0);
+    static_assert(Math::Cos(0.0) == 1.0);
+    static_assert(Math::IsEqual(Math::Sin(Math::k_pi_double / 6), 0.5, 1e-15));
+    static_assert(Math::IsEqual(Math::Cos(Math::k_pi_double / 3), 0.5, 1e-15));
+    static_assert(Math::IsEqual(Math::Sin(100.0), -0.50636564110975879, 1e-13));
+    static_assert(Math::IsEqual(Math::Tan(Math::k_pi_float / 4), 1.0f, 1e-6f));
+
+    // Compile time fallbacks need to agree with the runtime implementation.
+    constexpr double k_sin = Math::Sin(1.2345);
+    constexpr double k_sqrt = Math::Sqrt(1.2345);
+    volatile double runtime_value = 1.2345;
+    EXPECT_NEAR(k_sin, Math::Sin(static_cast<double>(runtime_value)), 1e-15);
+    EXPECT_DOUBLE_EQ(k_sqrt, Math::Sqrt(static_cast<double>(runtime_value)));
+}
+
+TEST(ConstexprTests, Vectors)
+{
+    constexpr Vector3f v1(1, 2, 3);
+    constexpr Vector3f v2(4, 5, 6);
+    static_assert(v1 + v2 == Vector3f(5, 7, 9));
+    static_assert(v2 - v1 == Vector3f(3, 3, 3));
+    static_assert(v1 * 2 == Vector3f(2, 4, 6));
+    static_assert(2 * v1 == Vector3f(2, 4, 6));
+    static_assert(v2 / 2.0f == Vector3f(2, 2.5f, 3));
+    static_assert(-v1 == Vector3f(-1, -2, -3));
+    static_assert(v1[2] == 3);
+    static_assert(Math::Dot(v1, v2) == 32);
+    static_assert(Math::Cross(v1, v2) == Vector3f(-3, 6, -3));
+    static_assert(Math::Permute(v1, 2, 0, 1) == Vector3f(3, 1, 2));
+    static_assert(Math::MaxDimension(v1) == 2);
+    static_assert(Math::Length(Vector3d(2, 3, 6)) == 7);
+    static_assert(Math::IsEqual(Math::Normalize(Vector3d(0, 3, 4)), Vector3d(0, 0.6, 0.8), 1e-15));
+    static_assert(Math::Vector3<int>::Zero() == Vector3i(0));
+
+    constexpr Vector3f v3 = []()
+    {
+        Vector3f v(1, 2, 3);
+        v += Vector3f(1, 1, 1);
+        v *= 2;
+        v[0] = 0;
+        return v;
+    }();
+    static_assert(v3 == Vector3f(0, 6, 8));
+
+    static_assert(Math::Dot(Vector2f(1, 2), Vector2f(3, 4)) == 11);
+    static_assert(Math::Dot(Vector4f(1, 2, 3, 4), Vector4f(1, 1, 1, 1)) == 10);
+    static_assert(Vector4f(1, 2, 3, 4)[3] == 4);
+}
+
+TEST(ConstexprTests, PointsAndNormals)
+{
+    constexpr Point3f p1(1, 2, 3);
+    constexpr Point3f p2(4, 6, 3);
+    static_assert(p2 - p1 == Vector3f(3, 4, 0));
+    static_assert(p1 + Vector3f(1, 1, 1) == Point3f(2, 3, 4));
+    static_assert(Math::DistanceSquared(p1, p2) == 25);
+    static_assert(Math::Distance(p1, p2) == 5);
+    static_assert(Math::Floor(Point3d(1.5, -1.5, 2)) == Point3d(1, -2, 2));
+    static_assert(Point2f(1, 2)[1] == 2);
+    static_assert(Math::Lerp(0.5f, Point4f(0), Point4f(2, 4, 6, 8)) == Point4f(1, 2, 3, 4));
+
+    constexpr Normal3f n(0, 0, 2);
+    static_assert(Math::Normalize(n) == Normal3f(0, 0, 1));
+    static_assert(Math::Dot(n, Vector3f(1, 1, 1)) == 2);
+    static_assert(Math::FaceForward(n, Vector3f(0, 0, -1)) == Normal3f(0, 0, -2));
+}
+
+TEST(ConstexprTests, Bounds)
+{
+    constexpr Bounds3f b(Point3f(0, 0, 0), Point3f(1, 2, 3));
+    static_assert(b[1] == Point3f(1, 2, 3));
+    static_assert(Math::Volume(b) == 6);
+    static_assert(Math::SurfaceArea(b) == 22);
+    static_assert(Math::MaximumExtent(b) == 2);
+    static_assert(Math::Union(b, Point3f(-1, 0, 0)).min == Point3f(-1, 0, 0));
+    static_assert(Math::Inside(b, Point3f(0.5f, 0.5f, 0.5f)));
+    static_assert(!Math::Overlaps(b, Bounds3f(Point3f(5), Point3f(6))));
+    static_assert(Math::Offset(b, Point3f(0.5f, 1, 1.5f)) == Vector3f(0.5f, 0.5f, 0.5f));
+    static_assert(Math::Corner(b, 7) == Point3f(1, 2, 3));
+
+    constexpr Bounds2f b2(Point2f(0, 0), Point2f(2, 2));
+    static_assert(Math::Intersect(b2, Bounds2f(Point2f(1, 1), Point2f(3, 3))).min == Point2f(1, 1));
+}
+
+TEST(ConstexprTests, Matrices)
+{
+    constexpr Matrix4f m = Math::Translate(Vector3f(1, 2, 3)) * Math::Scale(2.0f);
+    static_assert(m * Point3f(1, 1, 1) == Point3f(3, 4, 5));
+    static_assert(m * Vector3f(1, 1, 1) == Vector3f(2, 2, 2));
+    static_assert(Math::Transpose(Math::Transpose(m)) == m);
+    static_assert(Math::Identity<float>() * m == m);
+    static_assert(Math::Inverse(m) * m == Math::Identity<float>());
+    static_assert(Matrix4f::Zero() + m - m == Matrix4f::Zero());
+
+    constexpr Matrix4d ortho = Math::Orthographic_RH_N1(-1.0, 1.0, -1.0, 1.0, 0.0, 2.0);
+    static_assert(ortho(2, 2) == -1);
+    static_assert(ortho(2, 3) == -1);
+
+    constexpr Matrix4d rot = Math::RotateZ(90.0);
+    static_assert(Math::IsEqual(rot * Vector3d(1, 0, 0), Vector3d(0, 1, 0), 1e-15));
+
+    constexpr Matrix4d perspective = Math::Perspective_LH_N0(90.0, 1.0, 1.0, 10.0);
+    static_assert(Math::IsEqual(perspective(1, 1), 1.0, 1e-15));
+
+    constexpr Matrix4d view =
+        Math::LookAt_RH(Point3d(0, 0, 5), Point3d(0, 0, 0), Vector3d(0, 1, 0));
+    static_assert(view * Point3d(0, 0, 0) == Point3d(0, 0, -5));
+
+    // The compile time matrices have to match the ones built at runtime.
+    const Matrix4d runtime_rot = Math::RotateZ(90.0);
+    EXPECT_TRUE(Math::IsEqual(rot, runtime_rot, 1e-15));
+}
+
+TEST(ConstexprTests, Quaternions)
+{
+    constexpr Quatd q1(1, 2, 3, 4);
+    constexpr Quatd q2(5, 6, 7, 8);
+    static_assert(q1 * q2 == Quatd(-60, 12, 30, 24));
+    static_assert(q1 + q2 == Quatd(6, 8, 10, 12));
+    static_assert(Math::Dot(q1, q2) == 70);
+    static_assert(Math::Conjugate(q1) == Quatd(1, -2, -3, -4));
+    static_assert(Math::LengthSquared(q1 * Math::Inverse(q1) - Quatd::Identity()) < 1e-30);
+
+    constexpr Quatd q3 = Quatd::FromAxisAngleDegrees(Vector3d(0, 0, 1), 90);
+    static_assert(Math::IsEqual(q3 * Vector3d(1, 0, 0), Vector3d(0, 1, 0), 1e-15));
+    static_assert(Math::IsEqual(Math::Rotate(q3), Math::RotateZ(90.0), 1e-15));
+
+    constexpr Rotd r = Rotd(10, 20, 30) + Rotd(1, 2, 3);
+    static_assert(r == Rotd(11, 22, 33));
+}
@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "math/dynamic-aabb-tree.h"
+#include "math/rng.h"
+
+using Bounds3f = Math::Bounds3<float>;
+using Point3f = Math::Point3<float>;
+
+namespace
+{
+
+Bounds3f RandomBox(Math::RNG& rng)
+{
+    const Point3f p(rng.UniformFloatInRange(-20, 20), rng.UniformFloatInRange(-20, 20),
+                    rng.UniformFloatInRange(-20, 20));
+    const float size = rng.UniformFloatInRange(0.1f, 3);
+    return Bounds3f(p, p + Math::Vector3<float>(size, size, size));
+}
+
+std::vector<Math::OverlapPair> BruteForcePairs(const Math::DynamicAABBTree<float>& tree,
+                                               const std::vector<uint32_t>& ids)
+{
+    std::vector<Math::OverlapPair> pairs;
+    for (size_t i = 0; i < ids.size(); ++i)
+    {
+        for (size_t j = i + 1; j < ids.size(); ++j)
+        {
+            if (Math::Overlaps(tree.GetFatBounds(ids[i]), tree.GetFatBounds(ids[j])))
+            {
+                pairs.push_back({std::min(ids[i], ids[j]), std::max(ids[i], ids[j])});
+            }
+        }
+    }
+    std::sort(pairs.begin(), pairs.end());
+    return pairs;
+}
+
+std::vector<Math::OverlapPair> TreePairs(const Math::DynamicAABBTree<float>& tree)
+{
+    std::vector<Math::OverlapPair> pairs(tree.FindOverlapPairs({}));
+    EXPECT_EQ(tree.FindOverlapPairs(pairs), pairs.size());
+    std::sort(pairs.begin(), pairs.end());
+    return pairs;
+}
+
+}  // namespace
+
+TEST(DynamicAABBTreeTests, InsertRemove)
+{
+    Math::DynamicAABBTree<float> tree(0.5f);
+    EXPECT_EQ(tree.Size(), 0u);
+    EXPECT_EQ(tree.FindOverlapPairs({}), 0u);
+
+    const Bounds3f box(Point3f(0, 0, 0), Point3f(1, 1, 1));
+    const uint32_t a = tree.Insert(box);
+    EXPECT_EQ(tree.GetFatBounds(a), Math::Expand(box, 0.5f));
+    EXPECT_EQ(tree.Height(), 0);
+
+    // Small moves stay inside the expanded bounds.
+    EXPECT_FALSE(tree.Move(a, Bounds3f(Point3f(0.25f, 0, 0), Point3f(1.25f, 1, 1))));
+    const Bounds3f moved(Point3f(2, 0, 0), Point3f(3, 1, 1));
+    EXPECT_TRUE(tree.Move(a, moved));
+    EXPECT_EQ(tree.GetFatBounds(a), Math::Expand(moved, 0.5f));
+
+    const uint32_t b = tree.Insert(Bounds3f(Point3f(3.5f, 0, 0), Point3f(4, 1, 1)));
+    const uint32_t c = tree.Insert(Bounds3f(Point3f(10, 0, 0), Point3f(11, 1, 1)));
+    EXPECT_EQ(tree.Size(), 3u);
+    EXPECT_EQ(TreePairs(tree), (std::vector<Math::OverlapPair>{{std::min(a, b), std::max(a, b)}}));
+
+    std::vector<uint32_t> found;
+    tree.ForEachOverlap(Bounds3f(Point3f(9, 0, 0), Point3f(20, 1, 1)),
+                        [&](uint32_t id) { found.push_back(id); });
+    EXPECT_EQ(found, std::vector<uint32_t>{c});
+
+    tree.Remove(a);
+    EXPECT_EQ(tree.Size(), 2u);
+    EXPECT_TRUE(TreePairs(tree).empty());
+    // The id of the removed object is reused.
+    EXPECT_EQ(tree.Insert(box), a);
+}
+
+TEST(DynamicAABBTreeTests, Pairs)
+{
+    Math::RNG rng(1);
+    Math::DynamicAABBTree<float> tree(0.2f);
+    std::vector<uint32_t> ids;
+    std::vector<Bounds3f> boxes;
+    for (int i = 0; i < 1000; ++i)
+    {
+        boxes.push_back(RandomBox(rng));
+        ids.push_back(tree.Insert(boxes.back()));
+    }
+    EXPECT_EQ(TreePairs(tree), BruteForcePairs(tree, ids));
+
+    // The output is filled up to its size and the total count is returned.
+    const size_t total = tree.FindOverlapPairs({});
+    ASSERT_GT(total, 10u);
+    std::vector<Math::OverlapPair> partial(10);
+    EXPECT_EQ(tree.FindOverlapPairs(partial), total);
+
+    for (int frame = 0; frame < 5; ++frame)
+    {
+        for (size_t i = 0; i < ids.size(); ++i)
+        {
+            if (rng.UniformUInt32(8) == 0)
+            {
+                tree.Remove(ids[i]);
+                boxes[i] = RandomBox(rng);
+                ids[i] = tree.Insert(boxes[i]);
+                continue;
+            }
+            const Math::Vector3<float> offset(rng.UniformFloatInRange(-0.5f, 0.5f),
+                                              rng.UniformFloatInRange(-0.5f, 0.5f),
+                                              rng.UniformFloatInRange(-0.5f, 0.5f));
+            boxes[i] = Bounds3f(boxes[i].min + offset, boxes[i].max + offset);
+            tree.Move(ids[i], boxes[i]);
+            const Bounds3f& fat = tree.GetFatBounds(ids[i]);
+            EXPECT_EQ(Math::Union(fat, boxes[i]), fat);
+        }
+        EXPECT_EQ(TreePairs(tree), BruteForcePairs(tree, ids));
+    }
+}
+
+TEST(DynamicAABBTreeTests, Balance)
+{
+    // Inserting along a line degenerates to a list without rotations.
+    Math::DynamicAABBTree<float> tree(0.0f);
+    for (int i = 0; i < 4096; ++i)
+    {
+        const auto x = static_cast<float>(i);
+        tree.Insert(Bounds3f(Point3f(x, 0, 0), Point3f(x + 0.5f, 1, 1)));
+    }
+    EXPECT_LE(tree.Height(), static_cast<int32_t>(1.44 * std::log2(4096.0)) + 2);
+    EXPECT_EQ(tree.FindOverlapPairs({}), 0u);
+}
@@ -0,0 +1,194 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+#include "math/fixed.h"
+#include "math/matrix4x4.h"
+#include "math/quaternion.h"
+#include "math/vector2.h"
+#include "math/vector3.h"
+#include "math/vector4.h"
+
+using Fixed = Math::Fixed<int32_t, 16>;
+using Fixed16 = Math::Fixed<int16_t, 12>;
+using Vector3x = Math::Vector3<Fixed>;
+
+static_assert(Math::FloatingPoint<Fixed>);
+static_assert(sizeof(Vector3x) == 12);
+static_assert(std::is_trivially_copyable_v<Fixed>);
+
+namespace
+{
+
+constexpr double k_step = 1.0 / 65536;
+
+double ToDouble(Fixed value)
+{
+    return static_cast<double>(value);
+}
+
+}  // namespace
+
+TEST(FixedTests, Arithmetic)
+{
+    EXPECT_EQ(Fixed(1).Raw(), 65536);
+    EXPECT_EQ(Fixed(-3).Raw(), -3 * 65536);
+    EXPECT_EQ(Fixed(0.5).Raw(), 32768);
+    EXPECT_EQ(Fixed(-1.25f).Raw(), -81920);
+    EXPECT_EQ(Fixed(1e10).Raw(), std::numeric_limits<int32_t>::max());
+    EXPECT_EQ(Fixed(32767).Raw(), 32767 * 65536);
+    EXPECT_EQ(Fixed(-32768).Raw(), std::numeric_limits<int32_t>::min());
+    EXPECT_EQ(Fixed(32768).Raw(), std::numeric_limits<int32_t>::max());
+    EXPECT_EQ(Fixed(-32769).Raw(), std::numeric_limits<int32_t>::min());
+    EXPECT_EQ(Fixed(int64_t{1} << 40).Raw(), std::numeric_limits<int32_t>::max());
+    EXPECT_EQ(Fixed(std::numeric_limits<uint32_t>::max()).Raw(),
+              std::numeric_limits<int32_t>::max());
+    EXPECT_EQ(Fixed16(100).Raw(), std::numeric_limits<int16_t>::max());
+    EXPECT_EQ(Fixed16(-8).Raw(), std::numeric_limits<int16_t>::min());
+    EXPECT_EQ(static_cast<int32_t>(Fixed(-2.5)), -3);
+    EXPECT_EQ(static_cast<double>(Fixed::FromRaw(1)), k_step);
+
+    const Fixed a(2.5);
+    const Fixed b(-0.75);
+    EXPECT_EQ(a + b, Fixed(1.75));
+    EXPECT_EQ(a - b, Fixed(3.25));
+    EXPECT_EQ(a * b, Fixed(-1.875));
+    EXPECT_EQ(1 - a, Fixed(-1.5));
+    EXPECT_EQ(-a, Fixed(-2.5));
+    EXPECT_TRUE(b < 0 && a > b && a >= 2);
+
+    // Products and quotients round to nearest.
+    static_assert(std::numeric_limits<Fixed>::round_style == std::round_to_nearest);
+    static_assert(std::numeric_limits<Fixed>::has_denorm == std::denorm_absent);
+    static_assert(std::numeric_limits<Fixed>::digits10 == 9);
+    static_assert(std::numeric_limits<Fixed>::max_exponent == 0);
+    static_assert(!std::numeric_limits<Fixed>::traps);
+    EXPECT_EQ(Fixed::FromRaw(3) * Fixed(0.5), Fixed::FromRaw(2));
+    EXPECT_EQ(Fixed(1) / 3, Fixed::FromRaw(21845));
+    EXPECT_EQ(Fixed(-1) / 3, Fixed::FromRaw(-21845));
+    EXPECT_EQ(Fixed(2) / 3, Fixed::FromRaw(43691));
+    EXPECT_EQ(Fixed(2) / -3, Fixed::FromRaw(-43691));
+    EXPECT_EQ(Fixed(-2) / -3, Fixed::FromRaw(43691));
+
+    // Overflow wraps around.
+    const Fixed max = std::numeric_limits<Fixed>::max();
+    EXPECT_EQ(max + Fixed::FromRaw(1), std::numeric_limits<Fixed>::lowest());
+
+    EXPECT_EQ(Fixed16(1).Raw(), 4096);
+    EXPECT_EQ(Fixed16(3) * Fixed16(-2.5), Fixed16(-7.5));
+    EXPECT_EQ(Fixed16(7) / Fixed16(2), Fixed16(3.5));
+
+    static_assert((Fixed(3) / 4 + 1).Raw() == 114688);
+}
+
+TEST(FixedTests, Functions)
+{
+    EXPECT_EQ(Math::Sqrt(Fixed(16)), Fixed(4));
+    EXPECT_EQ(Math::Sqrt(Fixed(0)), Fixed(0));
+    EXPECT_EQ(Math::Floor(Fixed(-1.5)), Fixed(-2));
+    EXPECT_EQ(Math::Ceil(Fixed(-1.5)), Fixed(-1));
+    EXPECT_EQ(Math::Ceil(Fixed(1.25)), Fixed(2));
+    EXPECT_EQ(Math::Round(Fixed(2.5)), Fixed(3));
+    EXPECT_EQ(Math::Round(Fixed(-2.5)), Fixed(-3));
+    EXPECT_EQ(Math::Round(Fixed(-2.25)), Fixed(-2));
+    EXPECT_EQ(Math::Sin(Fixed(0)), Fixed(0));
+    EXPECT_EQ(Math::Cos(Fixed(0)), Fixed(1));
+    EXPECT_EQ(Math::ArcTan2(Fixed(0), Fixed(0)), Fixed(0));
+
+    // The most fractional bits that leave room for pi.
+    using Fixed29 = Math::Fixed<int32_t, 29>;
+    using Fixed13 = Math::Fixed<int16_t, 13>;
+    EXPECT_NEAR(static_cast<double>(Math::ArcTan2(Fixed29(0), Fixed29(-1))), Math::k_pi_double,
+                1e-6);
+    EXPECT_NEAR(static_cast<double>(Math::ArcTan2(Fixed29(-0.0001), Fixed29(-1))),
+                std::atan2(-0.0001, -1.0), 1e-6);
+    EXPECT_NEAR(static_cast<double>(Math::ArcCos(Fixed29(-1))), Math::k_pi_double, 1e-6);
+    EXPECT_NEAR(static_cast<double>(Math::ArcTan2(Fixed13(0), Fixed13(-1))), Math::k_pi_double,
+                1.0 / 8192);
+    EXPECT_TRUE(Math::IsFinite(std::numeric_limits<Fixed>::max()));
+
+    // Within about one step of the correctly rounded result, over several turns.
+    for (int32_t i = -100000; i <= 100000; ++i)
+    {
+        const Fixed x = Fixed::FromRaw(i * 37);
+        EXPECT_NEAR(ToDouble(Math::Sin(x)), std::sin(ToDouble(x)), 0.6 * k_step);
+        EXPECT_NEAR(ToDouble(Math::Cos(x)), std::cos(ToDouble(x)), 0.6 * k_step);
+    }
+    for (int32_t i = 0; i < 100000; ++i)
+    {
+        const Fixed x = Fixed::FromRaw(i * 21473);
+        EXPECT_NEAR(ToDouble(Math::Sqrt(x)), std::sqrt(ToDouble(x)), 0.5 * k_step);
+    }
+    for (int32_t i = -65536; i <= 65536; i += 7)
+    {
+        const Fixed x = Fixed::FromRaw(i);
+        EXPECT_NEAR(ToDouble(Math::ArcCos(x)), std::acos(ToDouble(x)), 1.0 * k_step);
+    }
+    for (int32_t i = -300; i <= 300; ++i)
+    {
+        for (int32_t j = -300; j <= 300; j += 13)
+        {
+            const Fixed y = Fixed::FromRaw(i * 971);
+            const Fixed x = Fixed::FromRaw(j * 503);
+            EXPECT_NEAR(ToDouble(Math::ArcTan2(y, x)), std::atan2(ToDouble(y), ToDouble(x)),
+                        0.6 * k_step);
+        }
+    }
+
+    EXPECT_NEAR(static_cast<double>(Math::Sin(Fixed16(1))), std::sin(1.0), 1.0 / 4096);
+    EXPECT_NEAR(static_cast<double>(Math::Cos(Fixed16(-7))), std::cos(-7.0), 1.0 / 4096);
+}
+
+TEST(FixedTests, Templates)
+{
+    const Vector3x a(1, 2, 3);
+    const Vector3x b(4, 5, 6);
+    EXPECT_EQ(Math::Cross(a, b), Vector3x(-3, 6, -3));
+    EXPECT_EQ(Math::Dot(a, b), Fixed(32));
+    EXPECT_EQ(a * 2 - b, Vector3x(-2, -1, 0));
+    const Vector3x n = Math::Normalize(Vector3x(3, 0, 4));
+    EXPECT_NEAR(ToDouble(n.x), 0.6, k_step);
+    EXPECT_NEAR(ToDouble(n.z), 0.8, k_step);
+
+    // The squares of components above sqrt(32768) don't fit in Fixed, the length is computed from
+    // the integer representations. Normalize multiplies by the reciprocal rounded to a Fixed.
+    const Vector3x large(200, 0, -150);
+    EXPECT_EQ(Math::Length(large), 250.0);
+    EXPECT_EQ(Math::Length(Math::Vector2<Fixed>(300, 400)), 500.0);
+    EXPECT_EQ(Math::Length(Math::Vector4<Fixed>(200, 200, 200, 200)), 400.0);
+    const Vector3x large_n = Math::Normalize(large);
+    EXPECT_NEAR(ToDouble(large_n.x), 0.8, 1e-3);
+    EXPECT_EQ(large_n.y, 0);
+    EXPECT_NEAR(ToDouble(large_n.z), -0.6, 1e-3);
+
+    const Math::Matrix4x4<Fixed> m(2, 0, 0, 1,
+                                   0, 4, 0, 2,
+                                   0, 0, Fixed(0.5), 3,
+                                   0, 0, 0, 1);
+    EXPECT_EQ(m * Math::Inverse(m), Math::Matrix4x4<Fixed>(1));
+
+    const Fixed half_pi(Math::k_pi_double / 2);
+    const Math::Quaternion<Fixed> q =
+        Math::Quaternion<Fixed>::FromAxisAngleRadians(Vector3x(0, 0, 1), half_pi);
+    const Vector3x rotated = q * Vector3x(1, 0, 0);
+    EXPECT_NEAR(ToDouble(rotated.x), 0.0, 4 * k_step);
+    EXPECT_NEAR(ToDouble(rotated.y), 1.0, 4 * k_step);
+    EXPECT_NEAR(ToDouble(rotated.z), 0.0, 4 * k_step);
+}
+
+TEST(FixedTests, Deterministic)
+{
+    // The integer implementations give the same bits at compile time and at run time.
+    constexpr Fixed k_sin = Math::Sin(Fixed(1234.5678));
+    constexpr Fixed k_atan = Fixed::ArcTan2(Fixed(-3), Fixed(-7));
+    constexpr Fixed k_sqrt = Math::Sqrt(Fixed(2));
+    volatile int32_t raw = Fixed(1234.5678).Raw();
+    EXPECT_EQ(Math::Sin(Fixed::FromRaw(raw)), k_sin);
+    raw = Fixed(-3).Raw();
+    EXPECT_EQ(Math::ArcTan2(Fixed::FromRaw(raw), Fixed(-7)), k_atan);
+    raw = Fixed(2).Raw();
+    EXPECT_EQ(Math::Sqrt(Fixed::FromRaw(raw)), k_sqrt);
+    EXPECT_EQ(k_sqrt.Raw(), 92682);
+}
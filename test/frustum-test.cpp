@@ -0,0 +1,34 @@
+#include <gtest/gtest.h>
+
+#include "math/frustum.h"
+#include "math/projections.h"
+
+using Bounds3f = Math::Bounds3<float>;
+using Point3f = Math::Point3<float>;
+
+TEST(FrustumTests, Overlaps)
+{
+    // Looking down +z with a 90 degree field of view, so the sides are the planes |x| = z, |y| = z.
+    const Math::Frustum<float> frustums[] = {
+        Math::Frustum<float>::FromMatrix_N0(Math::Perspective_LH_N0(90.0f, 1.0f, 1.0f, 100.0f)),
+        Math::Frustum<float>::FromMatrix_N1(Math::Perspective_LH_N1(90.0f, 1.0f, 1.0f, 100.0f))};
+    for (const Math::Frustum<float>& f : frustums)
+    {
+        const Bounds3f inside(Point3f(-1, -1, 10), Point3f(1, 1, 12));
+        EXPECT_TRUE(Math::Overlaps(f, inside));
+        EXPECT_TRUE(Math::Inside(f, inside));
+
+        const Bounds3f crossing_near(Point3f(-0.1f, -0.1f, 0.5f), Point3f(0.1f, 0.1f, 2));
+        EXPECT_TRUE(Math::Overlaps(f, crossing_near));
+        EXPECT_FALSE(Math::Inside(f, crossing_near));
+
+        const Bounds3f crossing_side(Point3f(9, 0, 10), Point3f(11, 1, 11));
+        EXPECT_TRUE(Math::Overlaps(f, crossing_side));
+        EXPECT_FALSE(Math::Inside(f, crossing_side));
+
+        EXPECT_FALSE(Math::Overlaps(f, Bounds3f(Point3f(-1, -1, -5), Point3f(1, 1, -2))));
+        EXPECT_FALSE(Math::Overlaps(f, Bounds3f(Point3f(-1, -1, 101), Point3f(1, 1, 102))));
+        EXPECT_FALSE(Math::Overlaps(f, Bounds3f(Point3f(-30, 0, 10), Point3f(-20, 1, 12))));
+        EXPECT_FALSE(Math::Overlaps(f, Bounds3f(Point3f(0, 20, 10), Point3f(1, 30, 12))));
+    }
+}
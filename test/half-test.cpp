@@ -0,0 +1,210 @@
+#include <gtest/gtest.h>
+
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "math/half.h"
+#include "math/normal3.h"
+#include "math/point3.h"
+#include "math/quaternion.h"
+#include "math/rng.h"
+
+using Math::BFloat16;
+using Math::Half;
+using Vector3f = Math::Vector3<float>;
+using Vector3h = Math::Vector3<Half>;
+
+static_assert(Math::FloatingPoint<Half>);
+static_assert(Math::FloatingPoint<BFloat16>);
+static_assert(sizeof(Vector3h) == 6);
+static_assert(std::is_trivially_copyable_v<Half> && std::is_trivially_copyable_v<BFloat16>);
+
+namespace
+{
+
+// Random bit patterns cover every exponent, subnormals, infinities and not a numbers.
+std::vector<Vector3f> RandomBitPatterns(size_t count, uint64_t seed)
+{
+    Math::RNG rng(seed);
+    std::vector<Vector3f> result(count);
+    for (Vector3f& v : result)
+    {
+        v = Vector3f(std::bit_cast<float>(rng.UniformUInt32()),
+                     std::bit_cast<float>(rng.UniformUInt32()),
+                     std::bit_cast<float>(rng.UniformUInt32()));
+    }
+    return result;
+}
+
+}  // namespace
+
+TEST(HalfTests, Conversion)
+{
+    EXPECT_EQ(Half(1.0f).Bits(), 0x3c00);
+    EXPECT_EQ(Half(-2).Bits(), 0xc000);
+    EXPECT_EQ(Half(0.5).Bits(), 0x3800);
+    EXPECT_EQ(Half(-0.0f).Bits(), 0x8000);
+    EXPECT_EQ(Half(65504.0f).Bits(), 0x7bff);
+    EXPECT_EQ(Half(1e10f).Bits(), 0x7c00);
+    EXPECT_EQ(Half(-std::numeric_limits<float>::infinity()).Bits(), 0xfc00);
+    EXPECT_TRUE(std::isnan(static_cast<float>(Half(std::numeric_limits<float>::quiet_NaN()))));
+
+    // Ties round to even, from 65520 on the values round to infinity.
+    EXPECT_EQ(Half(1.0f + 0x1p-11f).Bits(), 0x3c00);
+    EXPECT_EQ(Half(1.0f + 0x3p-11f).Bits(), 0x3c02);
+    EXPECT_EQ(Half(65519.0f).Bits(), 0x7bff);
+    EXPECT_EQ(Half(65520.0f).Bits(), 0x7c00);
+
+    // Subnormals.
+    EXPECT_EQ(Half(0x1p-24f).Bits(), 0x0001);
+    EXPECT_EQ(Half(0x1p-25f).Bits(), 0x0000);
+    EXPECT_EQ(Half(0x3p-25f).Bits(), 0x0002);
+    EXPECT_EQ(Half(0x1p-14f).Bits(), 0x0400);
+    EXPECT_EQ(static_cast<float>(Half::FromBits(0x0001)), 0x1p-24f);
+    EXPECT_EQ(static_cast<float>(Half::FromBits(0x03ff)), 0x3ffp-24f);
+
+    // Every half converts to float and back unchanged.
+    for (uint32_t bits = 0; bits <= 0xffff; ++bits)
+    {
+        const Half h = Half::FromBits(static_cast<uint16_t>(bits));
+        if (!std::isnan(static_cast<float>(h)))
+        {
+            EXPECT_EQ(Half(static_cast<float>(h)).Bits(), bits);
+        }
+    }
+
+    // Doubles round once, a double just past a tie doesn't become the tie as a float first.
+    EXPECT_EQ(Half(1.0 + 0x1p-11 + 0x1p-40).Bits(), 0x3c01);
+    EXPECT_EQ(Half(-1.0 - 0x1p-11 - 0x1p-40).Bits(), 0xbc01);
+    EXPECT_EQ(Half(1.0 + 0x1p-11 - 0x1p-40).Bits(), 0x3c00);
+    EXPECT_EQ(Half(0x1p-25 + 0x1p-60).Bits(), 0x0001);
+    EXPECT_EQ(Half(65520.0 - 0x1p-30).Bits(), 0x7bff);
+    EXPECT_EQ(Half(1e300).Bits(), 0x7c00);
+    EXPECT_EQ(Half(-std::numeric_limits<double>::infinity()).Bits(), 0xfc00);
+    EXPECT_EQ(Half(1e-300).Bits(), 0x0000);
+    EXPECT_TRUE(std::isnan(static_cast<float>(Half(std::numeric_limits<double>::quiet_NaN()))));
+
+    static_assert(Half(3.0f).Bits() == 0x4200);
+    static_assert(Half(1.0 + 0x1p-11 + 0x1p-40).Bits() == 0x3c01);
+    static_assert(static_cast<float>(Half::FromBits(0xc200)) == -3.0f);
+}
+
+TEST(HalfTests, BFloat16Conversion)
+{
+    EXPECT_EQ(BFloat16(1.0f).Bits(), 0x3f80);
+    EXPECT_EQ(BFloat16(-2).Bits(), 0xc000);
+    EXPECT_EQ(BFloat16(1.0f + 0x1p-8f).Bits(), 0x3f80);
+    EXPECT_EQ(BFloat16(1.0f + 0x3p-8f).Bits(), 0x3f82);
+    EXPECT_EQ(BFloat16(std::numeric_limits<float>::max()).Bits(), 0x7f80);
+    EXPECT_EQ(BFloat16(std::bit_cast<float>(0x7f800001u)).Bits(), 0x7fc0);
+    EXPECT_EQ(static_cast<float>(BFloat16::FromBits(0x4049)), 3.140625f);
+    EXPECT_EQ(BFloat16(1.0 + 0x1p-8 + 0x1p-40).Bits(), 0x3f81);
+    EXPECT_EQ(BFloat16(16842753).Bits(), 0x4b81);
+    EXPECT_EQ(BFloat16(1e300).Bits(), 0x7f80);
+    static_assert(BFloat16(3.0f).Bits() == 0x4040);
+}
+
+TEST(HalfTests, Limits)
+{
+    EXPECT_EQ(static_cast<float>(std::numeric_limits<Half>::max()), 65504.0f);
+    EXPECT_EQ(static_cast<float>(std::numeric_limits<Half>::min()), 0x1p-14f);
+    EXPECT_EQ(static_cast<float>(std::numeric_limits<Half>::epsilon()), 0x1p-10f);
+    EXPECT_EQ(static_cast<float>(std::numeric_limits<Half>::infinity()),
+              std::numeric_limits<float>::infinity());
+    EXPECT_EQ(static_cast<float>(std::numeric_limits<BFloat16>::epsilon()), 0x1p-7f);
+    EXPECT_EQ(static_cast<float>(std::numeric_limits<BFloat16>::min()),
+              std::numeric_limits<float>::min());
+
+    // The properties of binary16, and of float with a shorter mantissa.
+    using HalfLimits = std::numeric_limits<Half>;
+    using BFloat16Limits = std::numeric_limits<BFloat16>;
+    static_assert(HalfLimits::is_iec559 && HalfLimits::radix == 2 && HalfLimits::digits == 11);
+    static_assert(HalfLimits::has_denorm == std::denorm_present && !HalfLimits::traps);
+    static_assert(HalfLimits::min_exponent == -13 && HalfLimits::max_exponent == 16);
+    static_assert(HalfLimits::round_style == std::round_to_nearest);
+    static_assert(BFloat16Limits::has_denorm == std::numeric_limits<float>::has_denorm);
+    static_assert(BFloat16Limits::min_exponent == std::numeric_limits<float>::min_exponent);
+    static_assert(BFloat16Limits::max_exponent == std::numeric_limits<float>::max_exponent);
+    static_assert(BFloat16Limits::max_exponent10 == std::numeric_limits<float>::max_exponent10);
+
+    EXPECT_EQ(Math::NextFloatUp(Half(1)).Bits(), 0x3c01);
+    EXPECT_EQ(Math::NextFloatDown(Half(0)).Bits(), 0x8001);
+    EXPECT_EQ(Math::NextFloatUp(BFloat16(-1)).Bits(), 0xbf7f);
+}
+
+TEST(HalfTests, Templates)
+{
+    // The arithmetic is done in float and rounded when stored.
+    Half h = 1;
+    h += 0.25;
+    h *= 2;
+    EXPECT_EQ(static_cast<float>(h), 2.5f);
+    EXPECT_EQ(static_cast<float>(-h), -2.5f);
+    EXPECT_EQ(static_cast<float>(Math::Sqrt(Half(16))), 4.0f);
+    EXPECT_EQ(static_cast<float>(Math::Abs(Half(-3))), 3.0f);
+    EXPECT_EQ(static_cast<float>(Math::Lerp(Half(0.5f), Half(1), Half(3))), 2.0f);
+
+    const Vector3h a(1, 2, 3);
+    const Vector3h b(4, 5, 6);
+    EXPECT_EQ(a + b, Vector3h(5, 7, 9));
+    EXPECT_EQ(Math::Cross(a, b), Vector3h(-3, 6, -3));
+    EXPECT_EQ(static_cast<float>(Math::Dot(a, b)), 32.0f);
+    EXPECT_EQ(a * 2, Vector3h(2, 4, 6));
+    // Normalize multiplies by the reciprocal of the length rounded to a half.
+    const Vector3h n = Math::Normalize(Vector3h(3, 0, 4));
+    EXPECT_NEAR(n.x, 0.6f, 1e-3f);
+    EXPECT_EQ(static_cast<float>(n.y), 0.0f);
+    EXPECT_NEAR(n.z, 0.8f, 1e-3f);
+
+    const Math::Point3<Half> p(1, 2, 3);
+    EXPECT_EQ(p + a, Math::Point3<Half>(2, 4, 6));
+    EXPECT_EQ(Math::Floor(Math::Point3<Half>(1.5f, -1.5f, 2)), Math::Point3<Half>(1, -2, 2));
+
+    const Math::Normal3<BFloat16> normal(0, 0, 1);
+    EXPECT_EQ(static_cast<float>(Math::Dot(normal, Math::Vector3<BFloat16>(1, 2, 3))), 3.0f);
+
+    const Math::Quaternion<Half> q =
+        Math::Quaternion<Half>::FromAxisAngleDegrees(Vector3h(0, 0, 1), Half(90));
+    const Vector3h rotated = q * Vector3h(1, 0, 0);
+    EXPECT_NEAR(rotated.x, 0.0f, 1e-3f);
+    EXPECT_NEAR(rotated.y, 1.0f, 1e-3f);
+    EXPECT_NEAR(rotated.z, 0.0f, 1e-3f);
+}
+
+TEST(HalfTests, ConvertVectors)
+{
+    // Odd sizes exercise the scalar tail after the SIMD loop.
+    for (const size_t size : {0u, 1u, 3u, 1001u})
+    {
+        const std::vector<Vector3f> vectors = RandomBitPatterns(size, size + 1);
+        std::vector<Vector3h> halves(size);
+        std::vector<Math::Vector3<BFloat16>> bfloats(size);
+        Math::ConvertVectors(vectors, halves);
+        Math::ConvertVectors(vectors, bfloats);
+        for (size_t i = 0; i < size; ++i)
+        {
+            for (int k = 0; k < 3; ++k)
+            {
+                EXPECT_EQ(halves[i][k].Bits(), Half(vectors[i][k]).Bits());
+                EXPECT_EQ(bfloats[i][k].Bits(), BFloat16(vectors[i][k]).Bits());
+            }
+        }
+
+        std::vector<Vector3f> from_halves(size), from_bfloats(size);
+        Math::ConvertVectors(halves, from_halves);
+        Math::ConvertVectors(bfloats, from_bfloats);
+        for (size_t i = 0; i < size; ++i)
+        {
+            for (int k = 0; k < 3; ++k)
+            {
+                EXPECT_EQ(std::bit_cast<uint32_t>(from_halves[i][k]),
+                          std::bit_cast<uint32_t>(static_cast<float>(halves[i][k])));
+                EXPECT_EQ(std::bit_cast<uint32_t>(from_bfloats[i][k]),
+                          std::bit_cast<uint32_t>(static_cast<float>(bfloats[i][k])));
+            }
+        }
+    }
+}
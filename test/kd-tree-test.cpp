@@ -0,0 +1,182 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "math/kd-tree.h"
+#include "math/rng.h"
+
+using Point2f = Math::Point2<float>;
+using Point3f = Math::Point3<float>;
+using Point3d = Math::Point3<double>;
+
+namespace
+{
+
+std::vector<Point3f> RandomPoints3(size_t count, uint64_t seed)
+{
+    Math::RNG rng(seed);
+    std::vector<Point3f> points;
+    for (size_t i = 0; i < count; ++i)
+    {
+        points.emplace_back(rng.UniformFloatInRange(-10, 10), rng.UniformFloatInRange(-5, 5),
+                            rng.UniformFloatInRange(-1, 1));
+    }
+    return points;
+}
+
+template <typename Point>
+std::vector<float> SortedDistances(const std::vector<Point>& points, const Point& center)
+{
+    std::vector<float> distances;
+    for (const Point& p : points)
+    {
+        distances.push_back(Math::DistanceSquared(p, center));
+    }
+    std::sort(distances.begin(), distances.end());
+    return distances;
+}
+
+}  // namespace
+
+TEST(KdTreeTests, Build)
+{
+    Math::KdTree3<float> tree;
+    for (const uint32_t thread_count : {1u, 4u})
+    {
+        Math::SetThreadCount(thread_count);
+        for (const size_t count : {size_t{0}, size_t{1}, size_t{2}, size_t{300000}})
+        {
+            const std::vector<Point3f> points = RandomPoints3(count, count);
+            Math::Build(points, tree);
+            ASSERT_EQ(tree.indices.size(), count);
+            std::vector<uint32_t> indices = tree.indices;
+            std::sort(indices.begin(), indices.end());
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                EXPECT_EQ(indices[i], i);
+            }
+
+            // The point at the root splits the range along the longest axis.
+            if (count > 2)
+            {
+                const uint32_t mid = static_cast<uint32_t>(count / 2);
+                const float split = points[tree.indices[mid]].x;
+                for (uint32_t i = 0; i < count; ++i)
+                {
+                    const float x = points[tree.indices[i]].x;
+                    EXPECT_TRUE(i < mid ? x <= split : x >= split);
+                }
+            }
+        }
+    }
+    Math::SetThreadCount(0);
+}
+
+TEST(KdTreeTests, Nearest)
+{
+    const std::vector<Point3f> points = RandomPoints3(10000, 1);
+    Math::KdTree3<float> tree;
+    Math::Build(points, tree);
+
+    Math::RNG rng(2);
+    for (const size_t k : {size_t{1}, size_t{5}, size_t{40}})
+    {
+        for (int i = 0; i < 20; ++i)
+        {
+            const Point3f center(rng.UniformFloatInRange(-15, 15), rng.UniformFloatInRange(-15, 15),
+                                 rng.UniformFloatInRange(-15, 15));
+            std::vector<uint32_t> indices(k);
+            std::vector<float> distances(k);
+            ASSERT_EQ(Math::FindNearest(tree, center, indices, distances), k);
+            const std::vector<float> expected = SortedDistances(points, center);
+            for (size_t j = 0; j < k; ++j)
+            {
+                EXPECT_EQ(distances[j], expected[j]);
+                EXPECT_EQ(distances[j], Math::DistanceSquared(points[indices[j]], center));
+            }
+        }
+    }
+
+    // Duplicated points and more neighbours than points.
+    const std::vector<Point2f> points2(7, Point2f(1, 2));
+    Math::KdTree2<float> tree2;
+    Math::Build(points2, tree2);
+    std::vector<uint32_t> indices(10);
+    std::vector<float> distances(10);
+    ASSERT_EQ(Math::FindNearest(tree2, Point2f(0, 2), indices, distances), 7u);
+    std::sort(indices.begin(), indices.begin() + 7);
+    for (uint32_t i = 0; i < 7; ++i)
+    {
+        EXPECT_EQ(indices[i], i);
+        EXPECT_EQ(distances[i], 1.0f);
+    }
+}
+
+TEST(KdTreeTests, NearestBatch)
+{
+    Math::RNG rng(3);
+    std::vector<Point3d> points;
+    for (int i = 0; i < 5000; ++i)
+    {
+        points.emplace_back(rng.UniformFloat(), rng.UniformFloat(), rng.UniformFloat());
+    }
+    Math::KdTree3<double> tree;
+    Math::Build(points, tree);
+
+    constexpr size_t k_k = 4;
+    const std::vector<Point3d> centers(points.begin(), points.begin() + 1000);
+    std::vector<uint32_t> indices(centers.size() * k_k);
+    std::vector<double> distances(indices.size());
+    Math::SetThreadCount(4);
+    EXPECT_EQ(Math::FindNearest(tree, centers, k_k, indices, distances), k_k);
+    Math::SetThreadCount(0);
+    for (size_t i = 0; i < centers.size(); ++i)
+    {
+        // Every point is its own nearest neighbour.
+        EXPECT_EQ(indices[i * k_k], i);
+        EXPECT_EQ(distances[i * k_k], 0.0);
+
+        std::vector<uint32_t> single_indices(k_k);
+        std::vector<double> single_distances(k_k);
+        Math::FindNearest(tree, centers[i], single_indices, single_distances);
+        for (size_t j = 0; j < k_k; ++j)
+        {
+            EXPECT_EQ(distances[i * k_k + j], single_distances[j]);
+        }
+    }
+}
+
+TEST(KdTreeTests, Radius)
+{
+    Math::RNG rng(4);
+    std::vector<Point2f> points;
+    for (int i = 0; i < 10000; ++i)
+    {
+        points.emplace_back(rng.UniformFloatInRange(0, 100), rng.UniformFloatInRange(0, 100));
+    }
+    Math::KdTree2<float> tree;
+    Math::Build(points, tree);
+
+    for (const float radius : {0.0f, 1.0f, 10.0f, 500.0f})
+    {
+        for (int i = 0; i < 10; ++i)
+        {
+            const Point2f center = points[rng.UniformUInt32(10000)];
+            std::vector<uint32_t> found;
+            Math::ForEachInRadius(tree, center, radius,
+                                  [&](uint32_t index, float) { found.push_back(index); });
+            std::sort(found.begin(), found.end());
+
+            std::vector<uint32_t> expected;
+            for (uint32_t j = 0; j < points.size(); ++j)
+            {
+                if (Math::DistanceSquared(points[j], center) <= radius * radius)
+                {
+                    expected.push_back(j);
+                }
+            }
+            EXPECT_EQ(found, expected);
+        }
+    }
+}
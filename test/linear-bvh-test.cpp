@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "math/linear-bvh.h"
+#include "math/rng.h"
+
+using Bounds3f = Math::Bounds3<float>;
+using Point3f = Math::Point3<float>;
+
+namespace
+{
+
+std::vector<Bounds3f> RandomBoxes(size_t count, uint64_t seed)
+{
+    Math::RNG rng(seed);
+    std::vector<Bounds3f> boxes;
+    for (size_t i = 0; i < count; ++i)
+    {
+        const Point3f p(rng.UniformFloatInRange(-100, 100), rng.UniformFloatInRange(-100, 100),
+                        rng.UniformFloatInRange(-100, 100));
+        const Math::Vector3<float> size(rng.UniformFloatInRange(0, 5),
+                                        rng.UniformFloatInRange(0, 5),
+                                        rng.UniformFloatInRange(0, 5));
+        boxes.emplace_back(p, p + size);
+    }
+    return boxes;
+}
+
+// Checks the links and the bounds of the hierarchy, returns the leaf count under the node.
+size_t CheckNode(const Math::LinearBVH<float>& bvh,
+                 const std::vector<Bounds3f>& boxes,
+                 uint32_t node,
+                 std::vector<int>& visits)
+{
+    const Math::BVHNode<float>& n = bvh.nodes[node];
+    if (bvh.IsLeaf(node))
+    {
+        EXPECT_EQ(n.bounds, boxes[n.left]);
+        ++visits[n.left];
+        return 1;
+    }
+    EXPECT_EQ(bvh.parents[n.left], node);
+    EXPECT_EQ(bvh.parents[n.right], node);
+    EXPECT_EQ(n.bounds, Math::Union(bvh.nodes[n.left].bounds, bvh.nodes[n.right].bounds));
+    return CheckNode(bvh, boxes, n.left, visits) + CheckNode(bvh, boxes, n.right, visits);
+}
+
+void CheckHierarchy(const Math::LinearBVH<float>& bvh, const std::vector<Bounds3f>& boxes)
+{
+    ASSERT_EQ(bvh.nodes.size(), boxes.empty() ? 0 : 2 * boxes.size() - 1);
+    if (boxes.empty())
+    {
+        return;
+    }
+    EXPECT_EQ(bvh.parents[0], Math::k_bvh_leaf);
+    std::vector<int> visits(boxes.size(), 0);
+    EXPECT_EQ(CheckNode(bvh, boxes, 0, visits), boxes.size());
+    EXPECT_TRUE(std::all_of(visits.begin(), visits.end(), [](int v) { return v == 1; }));
+}
+
+}  // namespace
+
+TEST(LinearBVHTests, Build)
+{
+    Math::LinearBVH<float> bvh;
+    for (const uint32_t thread_count : {1u, 4u})
+    {
+        Math::SetThreadCount(thread_count);
+        for (const size_t count : {size_t{0}, size_t{1}, size_t{2}, size_t{3}, size_t{1000},
+                                   size_t{100000}})
+        {
+            const std::vector<Bounds3f> boxes = RandomBoxes(count, count);
+            Math::Build<float>(boxes, bvh);
+            CheckHierarchy(bvh, boxes);
+        }
+    }
+    Math::SetThreadCount(0);
+
+    // Identical boxes have identical Morton codes, the index breaks the ties.
+    const std::vector<Bounds3f> same(1000, Bounds3f(Point3f(1, 2, 3), Point3f(4, 5, 6)));
+    Math::Build<float>(same, bvh);
+    CheckHierarchy(bvh, same);
+}
+
+TEST(LinearBVHTests, Refit)
+{
+    std::vector<Bounds3f> boxes = RandomBoxes(5000, 1);
+    Math::LinearBVH<float> bvh;
+    Math::Build<float>(boxes, bvh);
+    for (Bounds3f& box : boxes)
+    {
+        box = Bounds3f(box.min * 0.5f, box.max * 0.5f + Math::Vector3<float>(1, 0, 0));
+    }
+    Math::Refit<float>(boxes, bvh);
+    CheckHierarchy(bvh, boxes);
+}
+
+TEST(LinearBVHTests, ForEachOverlap)
+{
+    const std::vector<Bounds3f> boxes = RandomBoxes(20000, 2);
+    Math::LinearBVH<float> bvh;
+    Math::Build<float>(boxes, bvh);
+
+    Math::RNG rng(3);
+    for (int i = 0; i < 50; ++i)
+    {
+        const Point3f p(rng.UniformFloatInRange(-100, 100), rng.UniformFloatInRange(-100, 100),
+                        rng.UniformFloatInRange(-100, 100));
+        const Bounds3f query(p, p + Math::Vector3<float>(10, 10, 10));
+
+        std::vector<uint32_t> found;
+        Math::ForEachOverlap(bvh, query, [&](uint32_t primitive) { found.push_back(primitive); });
+        std::sort(found.begin(), found.end());
+
+        std::vector<uint32_t> expected;
+        for (uint32_t j = 0; j < boxes.size(); ++j)
+        {
+            if (Math::Overlaps(boxes[j], query))
+            {
+                expected.push_back(j);
+            }
+        }
+        EXPECT_EQ(found, expected);
+    }
+}
@@ -0,0 +1,190 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "math/loose-tree.h"
+#include "math/projections.h"
+#include "math/rng.h"
+
+using Bounds2f = Math::Bounds2<float>;
+using Bounds3f = Math::Bounds3<float>;
+using Point2f = Math::Point2<float>;
+using Point3f = Math::Point3<float>;
+using Handle = Math::LooseTreeHandle;
+
+namespace
+{
+
+Bounds3f RandomBox(Math::RNG& rng, float range)
+{
+    const Point3f p(rng.UniformFloatInRange(-range, range), rng.UniformFloatInRange(-range, range),
+                    rng.UniformFloatInRange(-range, range));
+    // Mostly small boxes with a few large ones.
+    const float size = rng.UniformUInt32(10) == 0 ? rng.UniformFloatInRange(10, 60)
+                                                  : rng.UniformFloatInRange(0, 3);
+    return Bounds3f(p, p + Math::Vector3<float>(size, size * 0.5f, size * 2));
+}
+
+template <typename Tree, typename Query, typename Test>
+void ExpectQuery(const Tree& tree,
+                 const std::vector<Handle>& handles,
+                 const std::vector<Bounds3f>& boxes,
+                 Query query,
+                 Test test)
+{
+    std::vector<uint32_t> found;
+    query([&](Handle handle) { found.push_back(handle.index); });
+    std::sort(found.begin(), found.end());
+    EXPECT_TRUE(std::adjacent_find(found.begin(), found.end()) == found.end());
+
+    std::vector<uint32_t> expected;
+    for (size_t i = 0; i < handles.size(); ++i)
+    {
+        if (tree.IsValid(handles[i]) && test(boxes[i]))
+        {
+            expected.push_back(handles[i].index);
+        }
+    }
+    std::sort(expected.begin(), expected.end());
+    EXPECT_EQ(found, expected);
+}
+
+}  // namespace
+
+TEST(LooseTreeTests, InsertRemove)
+{
+    Math::LooseOctree<float> tree(Bounds3f(Point3f(-100, -100, -100), Point3f(100, 100, 100)));
+    EXPECT_EQ(tree.Size(), 0u);
+    EXPECT_EQ(tree.NodeCount(), 1u);
+
+    const Bounds3f box(Point3f(10, 10, 10), Point3f(11, 11, 11));
+    const Handle a = tree.Insert(box);
+    EXPECT_TRUE(tree.IsValid(a));
+    EXPECT_EQ(tree.GetBounds(a), box);
+    EXPECT_EQ(tree.Size(), 1u);
+    EXPECT_GT(tree.NodeCount(), 1u);
+
+    tree.Remove(a);
+    EXPECT_FALSE(tree.IsValid(a));
+    EXPECT_EQ(tree.Size(), 0u);
+    EXPECT_EQ(tree.NodeCount(), 1u);
+
+    // The slot is reused, but the old handle stays invalid.
+    const Handle b = tree.Insert(box);
+    EXPECT_EQ(b.index, a.index);
+    EXPECT_FALSE(tree.IsValid(a));
+    EXPECT_TRUE(tree.IsValid(b));
+
+    // Objects outside of the world are kept in the root.
+    const Handle outside = tree.Insert(Bounds3f(Point3f(500, 0, 0), Point3f(501, 1, 1)));
+    std::vector<Handle> found;
+    tree.ForEachOverlap(Bounds3f(Point3f(400, -10, -10), Point3f(600, 10, 10)),
+                        [&](Handle handle) { found.push_back(handle); });
+    EXPECT_EQ(found, std::vector<Handle>{outside});
+}
+
+TEST(LooseTreeTests, Queries)
+{
+    Math::RNG rng(1);
+    Math::LooseOctree<float> tree(Bounds3f(Point3f(-100, -100, -100), Point3f(100, 100, 100)), 6);
+    std::vector<Handle> handles;
+    std::vector<Bounds3f> boxes;
+    for (int i = 0; i < 3000; ++i)
+    {
+        // Some objects are partially or completely outside of the world bounds.
+        boxes.push_back(RandomBox(rng, 120));
+        handles.push_back(tree.Insert(boxes.back()));
+    }
+
+    const Math::Frustum<float> frustum = Math::Frustum<float>::FromMatrix_N0(
+        Math::Perspective_LH_N0(60.0f, 1.5f, 1.0f, 80.0f));
+    for (int round = 0; round < 4; ++round)
+    {
+        for (int i = 0; i < 10; ++i)
+        {
+            const Point3f p(rng.UniformFloatInRange(-120, 120), rng.UniformFloatInRange(-120, 120),
+                            rng.UniformFloatInRange(-120, 120));
+            const float size = rng.UniformFloatInRange(1, 80);
+            const Bounds3f query(p, p + Math::Vector3<float>(size, size, size));
+            ExpectQuery(
+                tree, handles, boxes,
+                [&](auto func) { tree.ForEachOverlap(query, func); },
+                [&](const Bounds3f& b) { return Math::Overlaps(b, query); });
+            ExpectQuery(
+                tree, handles, boxes,
+                [&](auto func) { tree.ForEachInside(query, func); },
+                [&](const Bounds3f& b) { return Math::Internal::ContainsBounds<3>(query, b); });
+        }
+        ExpectQuery(
+            tree, handles, boxes, [&](auto func) { tree.ForEachInFrustum(frustum, func); },
+            [&](const Bounds3f& b) { return Math::Overlaps(frustum, b); });
+
+        // Move everything, mostly by small amounts, and remove and insert some objects.
+        for (size_t i = 0; i < handles.size(); ++i)
+        {
+            if (!tree.IsValid(handles[i]))
+            {
+                continue;
+            }
+            if (rng.UniformUInt32(10) == 0)
+            {
+                tree.Remove(handles[i]);
+                boxes.push_back(RandomBox(rng, 120));
+                handles.push_back(tree.Insert(boxes.back()));
+                continue;
+            }
+            const float step = rng.UniformUInt32(20) == 0 ? 50.0f : 0.5f;
+            const Math::Vector3<float> offset(rng.UniformFloatInRange(-step, step),
+                                              rng.UniformFloatInRange(-step, step),
+                                              rng.UniformFloatInRange(-step, step));
+            boxes[i] = Bounds3f(boxes[i].min + offset, boxes[i].max + offset);
+            tree.Move(handles[i], boxes[i]);
+            EXPECT_EQ(tree.GetBounds(handles[i]), boxes[i]);
+        }
+        EXPECT_EQ(tree.Size(), 3000u);
+    }
+
+    for (const Handle handle : handles)
+    {
+        if (tree.IsValid(handle))
+        {
+            tree.Remove(handle);
+        }
+    }
+    EXPECT_EQ(tree.Size(), 0u);
+    EXPECT_EQ(tree.NodeCount(), 1u);
+}
+
+TEST(LooseTreeTests, Quadtree)
+{
+    Math::RNG rng(2);
+    Math::LooseQuadtree<float> tree(Bounds2f(Point2f(0, 0), Point2f(64, 64)));
+    std::vector<Handle> handles;
+    std::vector<Bounds2f> boxes;
+    for (int i = 0; i < 1000; ++i)
+    {
+        const Point2f p(rng.UniformFloatInRange(0, 64), rng.UniformFloatInRange(0, 64));
+        const float size = rng.UniformFloatInRange(0, 4);
+        boxes.emplace_back(p, p + Math::Vector2<float>(size, size));
+        handles.push_back(tree.Insert(boxes.back()));
+    }
+
+    for (int i = 0; i < 20; ++i)
+    {
+        const Point2f p(rng.UniformFloatInRange(0, 64), rng.UniformFloatInRange(0, 64));
+        const Bounds2f query(p, p + Math::Vector2<float>(8, 8));
+        std::vector<uint32_t> found;
+        tree.ForEachOverlap(query, [&](Handle handle) { found.push_back(handle.index); });
+        std::sort(found.begin(), found.end());
+        std::vector<uint32_t> expected;
+        for (uint32_t j = 0; j < boxes.size(); ++j)
+        {
+            if (Math::Overlaps(boxes[j], query))
+            {
+                expected.push_back(j);
+            }
+        }
+        EXPECT_EQ(found, expected);
+    }
+}
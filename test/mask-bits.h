@@ -0,0 +1,13 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * Bit i of a mask written by the batch tests, 64 bits per word with the lowest bit first.
+ */
+inline bool MaskBit(const std::vector<uint64_t>& mask, size_t i)
+{
+    return ((mask[i / 64] >> (i % 64)) & 1) != 0;
+}
@@ -0,0 +1,235 @@
+#include <gtest/gtest.h>
+
+#include "math/math.h"
+#include "math/rng.h"
+
+using Matrix2x2f = Math::Matrix2x2<float>;
+using Matrix2x2d = Math::Matrix2x2<double>;
+using Matrix3x3f = Math::Matrix3x3<float>;
+using Matrix3x3d = Math::Matrix3x3<double>;
+using Matrix4x4f = Math::Matrix4x4<float>;
+using Matrix4x4d = Math::Matrix4x4<double>;
+using Matrix2x3f = Math::Matrix<float, 2, 3>;
+using Matrix3x2f = Math::Matrix<float, 3, 2>;
+using Vector2f = Math::Vector2<float>;
+using Vector3f = Math::Vector3<float>;
+using Point2f = Math::Point2<float>;
+using Point3f = Math::Point3<float>;
+using Point3d = Math::Point3<double>;
+using Normal3f = Math::Normal3<float>;
+
+TEST(MatrixTests, Creation)
+{
+    const Matrix2x2f m1(3);
+    EXPECT_FLOAT_EQ(m1(0, 0), 3.0f);
+    EXPECT_FLOAT_EQ(m1(0, 1), 0.0f);
+    EXPECT_FLOAT_EQ(m1(1, 0), 0.0f);
+    EXPECT_FLOAT_EQ(m1(1, 1), 3.0f);
+
+    const Matrix3x3f m2(1, 2, 3, 4, 5, 6, 7, 8, 9);
+    EXPECT_FLOAT_EQ(m2(0, 2), 3.0f);
+    EXPECT_FLOAT_EQ(m2(1, 0), 4.0f);
+    EXPECT_FLOAT_EQ(m2(2, 1), 8.0f);
+
+    const Matrix2x3f m3({{{1, 2, 3}, {4, 5, 6}}});
+    EXPECT_FLOAT_EQ(m3(1, 2), 6.0f);
+    EXPECT_EQ(Matrix2x3f::k_row_count, 2);
+    EXPECT_EQ(Matrix2x3f::k_column_count, 3);
+
+    EXPECT_EQ(Matrix3x3f::Zero(), Matrix3x3f(0));
+    EXPECT_TRUE((std::is_same_v<Math::Matrix4x4<float>, Math::Matrix<float, 4, 4>>));
+}
+
+TEST(MatrixTests, Multiplication)
+{
+    const Matrix2x2f m1(1, 2, 3, 4);
+    const Matrix2x2f m2(5, 6, 7, 8);
+    EXPECT_EQ(m1 * m2, Matrix2x2f(19, 22, 43, 50));
+
+    Matrix2x2f m3 = m1;
+    m3 *= m2;
+    EXPECT_EQ(m3, Matrix2x2f(19, 22, 43, 50));
+
+    const Matrix3x3f m4(1, 2, 3, 4, 5, 6, 7, 8, 9);
+    const Matrix3x3f m5(9, 8, 7, 6, 5, 4, 3, 2, 1);
+    EXPECT_EQ(m4 * m5, Matrix3x3f(30, 24, 18, 84, 69, 54, 138, 114, 90));
+    EXPECT_EQ(m4 * Matrix3x3f(1), m4);
+
+    const Matrix2x3f m6({{{1, 2, 3}, {4, 5, 6}}});
+    const Matrix3x2f m7({{{7, 8}, {9, 10}, {11, 12}}});
+    const Math::Matrix<float, 2, 2> m8 = m6 * m7;
+    EXPECT_EQ(m8, Matrix2x2f(58, 64, 139, 154));
+    const Math::Matrix<float, 3, 3> m9 = m7 * m6;
+    EXPECT_EQ(m9, Matrix3x3f(39, 54, 69, 49, 68, 87, 59, 82, 105));
+
+    EXPECT_EQ(2 * m1, Matrix2x2f(2, 4, 6, 8));
+    EXPECT_EQ(m1 / 2.0f, Matrix2x2f(0.5f, 1, 1.5f, 2));
+    EXPECT_EQ(m1 + m2 - m2, m1);
+}
+
+TEST(MatrixTests, VectorTransforms)
+{
+    const Matrix2x2f rot(0, -1, 1, 0);
+    EXPECT_EQ(rot * Vector2f(1, 0), Vector2f(0, 1));
+
+    // 2D affine transform, rotate by 90 degrees and translate by (1, 2)
+    const Matrix3x3f affine(0, -1, 1, 1, 0, 2, 0, 0, 1);
+    EXPECT_EQ(affine * Point2f(1, 0), Point2f(1, 3));
+    EXPECT_EQ(affine * Vector2f(1, 0), Vector2f(0, 1));
+
+    const Matrix3x3f scale(1, 0, 0, 0, 2, 0, 0, 0, 4);
+    EXPECT_EQ(scale * Vector3f(1, 1, 1), Vector3f(1, 2, 4));
+    EXPECT_EQ(Math::Inverse(scale) * Normal3f(1, 1, 1), Normal3f(1, 0.5f, 0.25f));
+}
+
+TEST(MatrixTests, Transpose)
+{
+    const Matrix3x3f m1(1, 2, 3, 4, 5, 6, 7, 8, 9);
+    EXPECT_EQ(Math::Transpose(m1), Matrix3x3f(1, 4, 7, 2, 5, 8, 3, 6, 9));
+
+    const Matrix2x3f m2({{{1, 2, 3}, {4, 5, 6}}});
+    const Matrix3x2f m3 = Math::Transpose(m2);
+    EXPECT_EQ(m3, Matrix3x2f({{{1, 4}, {2, 5}, {3, 6}}}));
+}
+
+TEST(MatrixTests, Determinant)
+{
+    EXPECT_DOUBLE_EQ(Math::Determinant(Matrix2x2d(1, 2, 3, 4)), -2.0);
+    EXPECT_DOUBLE_EQ(Math::Determinant(Matrix3x3d(2, -3, 1, 2, 0, -1, 1, 4, 5)), 49.0);
+    EXPECT_DOUBLE_EQ(Math::Determinant(Matrix3x3d(1, 2, 3, 4, 5, 6, 7, 8, 9)), 0.0);
+
+    // clang-format off
+    const Matrix4x4d m(
+        1, 3, 5, 9,
+        1, 3, 1, 7,
+        4, 3, 9, 7,
+        5, 2, 0, 9
+    );
+    // clang-format on
+    EXPECT_DOUBLE_EQ(Math::Determinant(m), -376.0);
+    EXPECT_DOUBLE_EQ(Math::Determinant(Matrix4x4d(2)), 16.0);
+}
+
+TEST(MatrixTests, Inverse)
+{
+    const Matrix2x2d m1(4, 7, 2, 6);
+    EXPECT_TRUE(Math::IsEqual(Math::Inverse(m1), Matrix2x2d(0.6, -0.7, -0.2, 0.4), 1e-12));
+    EXPECT_TRUE(Math::IsEqual(m1 * Math::Inverse(m1), Matrix2x2d(1), 1e-12));
+
+    const Matrix3x3d m2(2, -3, 1, 2, 0, -1, 1, 4, 5);
+    EXPECT_TRUE(Math::IsEqual(m2 * Math::Inverse(m2), Matrix3x3d(1), 1e-12));
+    EXPECT_TRUE(Math::IsEqual(Math::Inverse(m2) * m2, Matrix3x3d(1), 1e-12));
+
+    // clang-format off
+    const Matrix4x4d m3(
+        1, 3, 5, 9,
+        1, 3, 1, 7,
+        4, 3, 9, 7,
+        5, 2, 0, 9
+    );
+    // clang-format on
+    EXPECT_TRUE(Math::IsEqual(m3 * Math::Inverse(m3), Matrix4x4d(1), 1e-12));
+    EXPECT_TRUE(Math::IsEqual(Math::Inverse(Math::Inverse(m3)), m3, 1e-12));
+}
+
+TEST(MatrixTests, Constexpr)
+{
+    constexpr Matrix2x2f m1(1, 2, 3, 4);
+    static_assert(m1 * Matrix2x2f(1) == m1);
+    static_assert(Math::Determinant(m1) == -2);
+    static_assert(Math::Transpose(Math::Transpose(m1)) == m1);
+    static_assert(Math::Inverse(Matrix3x3f(2)) == Matrix3x3f(0.5f));
+}
+
+TEST(MatrixTests, TransformPointError)
+{
+    Math::RNG rng(1);
+    auto to_double = [](const Matrix4x4f& m)
+    {
+        Matrix4x4d result;
+        for (size_t i = 0; i < 4; ++i)
+        {
+            for (size_t j = 0; j < 4; ++j)
+            {
+                result.elements[i][j] = m.elements[i][j];
+            }
+        }
+        return result;
+    };
+    auto expect_within = [](const Point3f& p, const Point3d& exact, const Vector3f& error)
+    {
+        EXPECT_LE(Math::Abs(p.x - exact.x), error.x);
+        EXPECT_LE(Math::Abs(p.y - exact.y), error.y);
+        EXPECT_LE(Math::Abs(p.z - exact.z), error.z);
+    };
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        Matrix4x4f m1(1);
+        Matrix4x4f m2(1);
+        for (size_t row = 0; row < 3; ++row)
+        {
+            for (size_t column = 0; column < 4; ++column)
+            {
+                m1.elements[row][column] = rng.UniformFloatInRange(-100, 100);
+                m2.elements[row][column] = rng.UniformFloatInRange(-1, 1);
+            }
+        }
+        const Point3f p(rng.UniformFloatInRange(-1000, 1000), rng.UniformFloatInRange(-1, 1),
+                        rng.UniformFloatInRange(-1e5f, 1e5f));
+        const Point3d exact1 = to_double(m1) * Point3d(p.x, p.y, p.z);
+        const Point3d exact2 = to_double(m2) * exact1;
+
+        Vector3f error1;
+        const Point3f p1 = Math::TransformPoint(m1, p, error1);
+        expect_within(p1, exact1, error1);
+        Vector3f error2;
+        const Point3f p2 = Math::TransformPoint(m2, p1, error1, error2);
+        expect_within(p2, exact2, error2);
+    }
+
+    // The bound is relative to the magnitude of the terms, even when the result is exact.
+    Vector3f error;
+    EXPECT_EQ(Math::TransformPoint(Matrix4x4f(1), Point3f(1, 2, 3), error), Point3f(1, 2, 3));
+    EXPECT_EQ(error, Vector3f(1, 2, 3) * Math::Gamma<float>(3));
+}
+
+TEST(MatrixTests, TransformBounds)
+{
+    using Bounds3f = Math::Bounds3<float>;
+    const Bounds3f b(Point3f(-1, 2, -3), Point3f(4, 5, 6));
+    EXPECT_EQ(Math::TransformBounds(Matrix4x4f(1), b), b);
+    // clang-format off
+    const Matrix4x4f swap_and_move(0, -1, 0, 10,
+                                   1,  0, 0, 20,
+                                   0,  0, 2, 30,
+                                   0,  0, 0, 1);
+    // clang-format on
+    EXPECT_EQ(Math::TransformBounds(swap_and_move, b),
+              Bounds3f(Point3f(5, 19, 24), Point3f(8, 24, 42)));
+
+    // The union of the transformed corners.
+    Math::RNG rng(2);
+    for (int i = 0; i < 100; ++i)
+    {
+        Matrix4x4f m(1);
+        for (size_t row = 0; row < 3; ++row)
+        {
+            for (size_t column = 0; column < 4; ++column)
+            {
+                m.elements[row][column] = rng.UniformFloatInRange(-10, 10);
+            }
+        }
+        Bounds3f expected(m * Math::Corner(b, 0));
+        for (uint8_t corner = 1; corner < 8; ++corner)
+        {
+            expected = Math::Union(expected, m * Math::Corner(b, corner));
+        }
+        const Bounds3f result = Math::TransformBounds(m, b);
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            EXPECT_NEAR(result.min[axis], expected.min[axis], 1e-4f);
+            EXPECT_NEAR(result.max[axis], expected.max[axis], 1e-4f);
+        }
+    }
+}
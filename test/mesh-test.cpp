@@ -0,0 +1,206 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "math/mesh.h"
+#include "math/rng.h"
+
+using Bounds3f = Math::Bounds3<float>;
+using Normal3f = Math::Normal3<float>;
+using Point2f = Math::Point2<float>;
+using Point3f = Math::Point3<float>;
+using Vector3f = Math::Vector3<float>;
+using Vector4f = Math::Vector4<float>;
+
+namespace
+{
+
+struct Mesh
+{
+    std::vector<uint32_t> indices;
+    std::vector<Point3f> positions;
+    std::vector<Point2f> uvs;
+};
+
+// A grid of size by size vertices on the z = 0 plane, counter-clockwise seen from +z, with the
+// texture coordinates computed from x and y.
+Mesh Grid(uint32_t size, const std::function<Point2f(float, float)>& uv)
+{
+    Mesh mesh;
+    for (uint32_t y = 0; y < size; ++y)
+    {
+        for (uint32_t x = 0; x < size; ++x)
+        {
+            mesh.positions.emplace_back(static_cast<float>(x), static_cast<float>(y), 0.0f);
+            mesh.uvs.push_back(uv(static_cast<float>(x), static_cast<float>(y)));
+        }
+    }
+    for (uint32_t y = 0; y + 1 < size; ++y)
+    {
+        for (uint32_t x = 0; x + 1 < size; ++x)
+        {
+            const uint32_t i = y * size + x;
+            mesh.indices.insert(mesh.indices.end(), {i, i + 1, i + size + 1});
+            mesh.indices.insert(mesh.indices.end(), {i, i + size + 1, i + size});
+        }
+    }
+    return mesh;
+}
+
+Mesh RandomMesh(uint32_t vertex_count, uint32_t triangle_count, uint64_t seed)
+{
+    Math::RNG rng(seed);
+    Mesh mesh;
+    for (uint32_t i = 0; i < vertex_count; ++i)
+    {
+        mesh.positions.emplace_back(rng.UniformFloatInRange(-10, 10),
+                                    rng.UniformFloatInRange(-10, 10),
+                                    rng.UniformFloatInRange(-10, 10));
+        mesh.uvs.emplace_back(rng.UniformFloat(), rng.UniformFloat());
+    }
+    for (uint32_t i = 0; i < 3 * triangle_count; ++i)
+    {
+        mesh.indices.push_back(rng.UniformUInt32(vertex_count));
+    }
+    return mesh;
+}
+
+}  // namespace
+
+TEST(MeshTests, Bounds)
+{
+    const Bounds3f empty = Math::ComputeBounds<float>(std::vector<Point3f>());
+    EXPECT_GT(empty.min.x, empty.max.x);
+
+    const Mesh mesh = RandomMesh(100000, 0, 1);
+    Bounds3f expected(mesh.positions[0]);
+    for (const Point3f& p : mesh.positions)
+    {
+        expected = Math::Union(expected, p);
+    }
+    for (const uint32_t thread_count : {1u, 4u})
+    {
+        Math::SetThreadCount(thread_count);
+        EXPECT_EQ(Math::ComputeBounds<float>(mesh.positions), expected);
+    }
+    Math::SetThreadCount(0);
+}
+
+TEST(MeshTests, NormalsAreaWeighted)
+{
+    // A large triangle facing +z and a small one facing +x share the first vertex, the last vertex
+    // is not used.
+    const std::vector<uint32_t> indices = {0, 1, 2, 0, 3, 4};
+    const std::vector<Point3f> positions = {Point3f(0, 0, 0), Point3f(2, 0, 0), Point3f(0, 2, 0),
+                                            Point3f(0, 1, 0), Point3f(0, 0, 1), Point3f(5, 5, 5)};
+    std::vector<Normal3f> normals(positions.size());
+    Math::ComputeNormals<float>(indices, positions, normals);
+
+    const Vector3f expected = Math::Normalize(Vector3f(1, 0, 4));
+    EXPECT_FLOAT_EQ(normals[0].x, expected.x);
+    EXPECT_FLOAT_EQ(normals[0].y, expected.y);
+    EXPECT_FLOAT_EQ(normals[0].z, expected.z);
+    EXPECT_EQ(normals[1], Normal3f(0, 0, 1));
+    EXPECT_EQ(normals[3], Normal3f(1, 0, 0));
+    EXPECT_EQ(normals[5], Normal3f(0, 0, 0));
+
+    const Mesh grid = Grid(16, [](float x, float y) { return Point2f(x, y); });
+    normals.resize(grid.positions.size());
+    Math::ComputeNormals<float>(grid.indices, grid.positions, normals);
+    for (const Normal3f& n : normals)
+    {
+        EXPECT_EQ(n, Normal3f(0, 0, 1));
+    }
+}
+
+TEST(MeshTests, NormalsRandom)
+{
+    const Mesh mesh = RandomMesh(300000, 600000, 2);
+    std::vector<Vector3f> sums(mesh.positions.size(), Vector3f(0));
+    for (size_t i = 0; i < mesh.indices.size(); i += 3)
+    {
+        const Point3f& p0 = mesh.positions[mesh.indices[i]];
+        const Point3f& p1 = mesh.positions[mesh.indices[i + 1]];
+        const Point3f& p2 = mesh.positions[mesh.indices[i + 2]];
+        const Vector3f n = Math::Cross(p1 - p0, p2 - p0);
+        for (size_t j = 0; j < 3; ++j)
+        {
+            sums[mesh.indices[i + j]] += n;
+        }
+    }
+
+    // Every vertex adds its triangles in the same order, so the threads don't change the bits.
+    std::vector<Normal3f> single_thread;
+    for (const uint32_t thread_count : {1u, 4u})
+    {
+        Math::SetThreadCount(thread_count);
+        std::vector<Normal3f> normals(mesh.positions.size());
+        Math::ComputeNormals<float>(mesh.indices, mesh.positions, normals);
+        if (thread_count == 1)
+        {
+            single_thread = normals;
+        }
+        EXPECT_EQ(normals, single_thread);
+        for (size_t i = 0; i < normals.size(); ++i)
+        {
+            const Vector3f expected =
+                sums[i] == Vector3f(0) ? Vector3f(0) : Math::Normalize(sums[i]);
+            EXPECT_NEAR(normals[i].x, expected.x, 1e-5f);
+            EXPECT_NEAR(normals[i].y, expected.y, 1e-5f);
+            EXPECT_NEAR(normals[i].z, expected.z, 1e-5f);
+        }
+    }
+    Math::SetThreadCount(0);
+}
+
+TEST(MeshTests, TangentsGrid)
+{
+    // The tangent follows increasing u and the sign makes w * Cross(n, t) follow increasing v.
+    auto check = [](const std::function<Point2f(float, float)>& uv, const Vector4f& expected)
+    {
+        const Mesh grid = Grid(8, uv);
+        std::vector<Normal3f> normals(grid.positions.size());
+        std::vector<Vector4f> tangents(grid.positions.size());
+        Math::ComputeNormals<float>(grid.indices, grid.positions, normals);
+        Math::ComputeTangents<float>(grid.indices, grid.positions, normals, grid.uvs, tangents);
+        for (const Vector4f& t : tangents)
+        {
+            EXPECT_NEAR(t.x, expected.x, 1e-6f);
+            EXPECT_NEAR(t.y, expected.y, 1e-6f);
+            EXPECT_NEAR(t.z, expected.z, 1e-6f);
+            EXPECT_EQ(t.w, expected.w);
+        }
+    };
+    check([](float x, float y) { return Point2f(x, y); }, Vector4f(1, 0, 0, 1));
+    check([](float x, float y) { return Point2f(-x, y); }, Vector4f(-1, 0, 0, -1));
+    check([](float x, float y) { return Point2f(y, -x); }, Vector4f(0, 1, 0, 1));
+    check([](float x, float y) { return Point2f(0.1f * x, -0.3f * y); }, Vector4f(1, 0, 0, -1));
+}
+
+TEST(MeshTests, TangentsRandom)
+{
+    const Mesh mesh = RandomMesh(300000, 600000, 3);
+    std::vector<Normal3f> normals(mesh.positions.size());
+    Math::ComputeNormals<float>(mesh.indices, mesh.positions, normals);
+    std::vector<Vector4f> tangents[2];
+    for (const uint32_t thread_count : {1u, 4u})
+    {
+        Math::SetThreadCount(thread_count);
+        std::vector<Vector4f>& result = tangents[thread_count == 1 ? 0 : 1];
+        result.resize(mesh.positions.size());
+        Math::ComputeTangents<float>(mesh.indices, mesh.positions, normals, mesh.uvs, result);
+    }
+    Math::SetThreadCount(0);
+
+    for (size_t i = 0; i < mesh.positions.size(); ++i)
+    {
+        const Vector4f& t = tangents[0][i];
+        const Vector3f tangent(t.x, t.y, t.z);
+        EXPECT_NEAR(Math::LengthSquared(tangent), 1.0f, 1e-5f);
+        EXPECT_NEAR(Math::Dot(normals[i], tangent), 0.0f, 1e-5f);
+        EXPECT_EQ(Math::Abs(t.w), 1.0f);
+        EXPECT_EQ(t, tangents[1][i]);
+    }
+}
@@ -0,0 +1,178 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include "math/morton.h"
+#include "math/radix-sort.h"
+#include "math/rng.h"
+
+using Point2u = Math::Point2<uint32_t>;
+using Point3u = Math::Point3<uint32_t>;
+
+namespace
+{
+
+uint32_t ManhattanDistance(const Point3u& a, const Point3u& b)
+{
+    auto distance = [](uint32_t u, uint32_t v) { return u > v ? u - v : v - u; };
+    return distance(a.x, b.x) + distance(a.y, b.y) + distance(a.z, b.z);
+}
+
+}  // namespace
+
+TEST(MortonTests, Encode)
+{
+    EXPECT_EQ(Math::EncodeMorton<uint32_t>(Point3u(0, 0, 0)), 0u);
+    EXPECT_EQ(Math::EncodeMorton<uint32_t>(Point3u(1, 0, 0)), 1u);
+    EXPECT_EQ(Math::EncodeMorton<uint32_t>(Point3u(0, 1, 0)), 2u);
+    EXPECT_EQ(Math::EncodeMorton<uint32_t>(Point3u(0, 0, 1)), 4u);
+    EXPECT_EQ(Math::EncodeMorton<uint32_t>(Point3u(3, 5, 6)), 0b110'101'011u);
+    EXPECT_EQ(Math::EncodeMorton<uint32_t>(Point3u(1023, 1023, 1023)), (1u << 30) - 1);
+    EXPECT_EQ(Math::EncodeMorton<uint64_t>(Point3u(0x1fffff, 0x1fffff, 0x1fffff)),
+              (uint64_t{1} << 63) - 1);
+    EXPECT_EQ(Math::EncodeMorton<uint64_t>(Point3u(0, 0, 1u << 20)), uint64_t{1} << 62);
+    // Bits above the code range are ignored.
+    EXPECT_EQ(Math::EncodeMorton<uint32_t>(Point3u(1024, 0, 0)), 0u);
+
+    EXPECT_EQ(Math::EncodeMorton<uint32_t>(Point2u(0b11, 0b01)), 0b0111u);
+    EXPECT_EQ(Math::EncodeMorton<uint32_t>(Point2u(0xffff, 0)), 0x55555555u);
+    EXPECT_EQ(Math::EncodeMorton<uint64_t>(Point2u(0, 0xffffffff)), 0xaaaaaaaaaaaaaaaaull);
+
+    static_assert(Math::EncodeMorton<uint32_t>(Point3u(3, 5, 6)) == 0b110'101'011u);
+    static_assert(Math::DecodeMorton2(Math::EncodeMorton<uint64_t>(Point2u(7, 9))) ==
+                  Point2u(7, 9));
+}
+
+TEST(MortonTests, RoundTrip)
+{
+    Math::RNG rng(7);
+    for (int i = 0; i < 1000; ++i)
+    {
+        const uint32_t x = rng.UniformUInt32();
+        const uint32_t y = rng.UniformUInt32();
+        const uint32_t z = rng.UniformUInt32();
+
+        const Point3u p10(x & 0x3ff, y & 0x3ff, z & 0x3ff);
+        EXPECT_EQ(Math::DecodeMorton3(Math::EncodeMorton<uint32_t>(p10)), p10);
+        const Point3u p21(x & 0x1fffff, y & 0x1fffff, z & 0x1fffff);
+        EXPECT_EQ(Math::DecodeMorton3(Math::EncodeMorton<uint64_t>(p21)), p21);
+
+        const Point2u p16(x & 0xffff, y & 0xffff);
+        EXPECT_EQ(Math::DecodeMorton2(Math::EncodeMorton<uint32_t>(p16)), p16);
+        const Point2u p32(x, y);
+        EXPECT_EQ(Math::DecodeMorton2(Math::EncodeMorton<uint64_t>(p32)), p32);
+    }
+}
+
+TEST(MortonTests, Quantize)
+{
+    const Math::Bounds3<float> bounds(Math::Point3<float>(-1, -1, -1),
+                                      Math::Point3<float>(1, 1, 1));
+    EXPECT_EQ(Math::EncodeMorton<uint32_t>(bounds, Math::Point3<float>(-1, -1, -1)), 0u);
+    EXPECT_EQ(Math::EncodeMorton<uint32_t>(bounds, Math::Point3<float>(1, 1, 1)), (1u << 30) - 1);
+    EXPECT_EQ(Math::EncodeMorton<uint64_t>(bounds, Math::Point3<float>(1, 1, 1)),
+              (uint64_t{1} << 63) - 1);
+    // Points outside of the bounds are clamped.
+    EXPECT_EQ(Math::EncodeMorton<uint32_t>(bounds, Math::Point3<float>(-5, 5, -5)),
+              Math::EncodeMorton<uint32_t>(Point3u(0, 1023, 0)));
+    EXPECT_EQ(Math::DecodeMorton3(
+                  Math::EncodeMorton<uint32_t>(bounds, Math::Point3<float>(0.0f, -0.5f, 0.5f))),
+              Point3u(512, 256, 768));
+
+    const Math::Bounds2<double> bounds2(Math::Point2<double>(0, 0), Math::Point2<double>(4, 2));
+    EXPECT_EQ(Math::DecodeMorton2(
+                  Math::EncodeMorton<uint64_t>(bounds2, Math::Point2<double>(4.0, 0.5))),
+              Point2u(0xffffffff, 0x40000000));
+}
+
+TEST(MortonTests, Hilbert)
+{
+    // The codes of a 8x8x8 cube at the origin are the first 512 steps of the curve, every step
+    // moves to a neighbouring cell.
+    constexpr uint32_t k_size = 8;
+    for (const bool wide : {false, true})
+    {
+        std::vector<Point3u> cells(k_size * k_size * k_size, Point3u(k_size, k_size, k_size));
+        for (uint32_t z = 0; z < k_size; ++z)
+        {
+            for (uint32_t y = 0; y < k_size; ++y)
+            {
+                for (uint32_t x = 0; x < k_size; ++x)
+                {
+                    const uint64_t code =
+                        wide ? Math::EncodeHilbert<uint64_t>(Point3u(x, y, z))
+                             : uint64_t{Math::EncodeHilbert<uint32_t>(Point3u(x, y, z))};
+                    ASSERT_LT(code, cells.size());
+                    EXPECT_EQ(cells[code], Point3u(k_size, k_size, k_size));
+                    cells[code] = Point3u(x, y, z);
+                }
+            }
+        }
+        EXPECT_EQ(cells[0], Point3u(0, 0, 0));
+        for (size_t i = 1; i < cells.size(); ++i)
+        {
+            EXPECT_EQ(ManhattanDistance(cells[i - 1], cells[i]), 1u);
+        }
+    }
+
+    constexpr uint32_t k_size_2d = 16;
+    std::vector<Point2u> cells(k_size_2d * k_size_2d, Point2u(k_size_2d, k_size_2d));
+    for (uint32_t y = 0; y < k_size_2d; ++y)
+    {
+        for (uint32_t x = 0; x < k_size_2d; ++x)
+        {
+            const uint32_t code = Math::EncodeHilbert<uint32_t>(Point2u(x, y));
+            ASSERT_LT(code, cells.size());
+            cells[code] = Point2u(x, y);
+        }
+    }
+    for (size_t i = 1; i < cells.size(); ++i)
+    {
+        const Point3u a(cells[i - 1].x, cells[i - 1].y, 0);
+        const Point3u b(cells[i].x, cells[i].y, 0);
+        EXPECT_EQ(ManhattanDistance(a, b), 1u);
+    }
+
+    // The full range is covered.
+    EXPECT_EQ(Math::EncodeHilbert<uint32_t>(Point3u(0, 0, 0)), 0u);
+    const Math::Bounds3<float> bounds(Math::Point3<float>(0, 0, 0), Math::Point3<float>(1, 1, 1));
+    EXPECT_LT(Math::EncodeHilbert<uint32_t>(bounds, Math::Point3<float>(1, 0, 0)), 1u << 30);
+    EXPECT_GE(Math::EncodeHilbert<uint32_t>(bounds, Math::Point3<float>(1, 0, 0)), 7u << 27);
+}
+
+TEST(RadixSortTests, Sort)
+{
+    Math::RNG rng(3);
+    for (const uint32_t thread_count : {1u, 4u})
+    {
+        Math::SetThreadCount(thread_count);
+        for (const size_t count : {size_t{0}, size_t{1}, size_t{1000}, size_t{300000}})
+        {
+            std::vector<uint32_t> keys(count);
+            for (uint32_t& key : keys)
+            {
+                // Few distinct keys so that the stability is tested.
+                key = rng.UniformUInt32() & 0x3ff003ff;
+            }
+            std::vector<uint32_t> values(count);
+            std::iota(values.begin(), values.end(), 0u);
+
+            std::vector<uint32_t> expected = values;
+            std::stable_sort(expected.begin(), expected.end(),
+                             [&](uint32_t a, uint32_t b) { return keys[a] < keys[b]; });
+
+            Math::RadixSort<uint32_t, uint32_t>(keys, values);
+            EXPECT_TRUE(std::is_sorted(keys.begin(), keys.end()));
+            EXPECT_EQ(values, expected);
+        }
+    }
+    Math::SetThreadCount(0);
+
+    std::vector<uint64_t> keys = {uint64_t{1} << 62, 5, 0, uint64_t{1} << 40, 5};
+    std::vector<char> values = {'a', 'b', 'c', 'd', 'e'};
+    Math::RadixSort<uint64_t, char>(keys, values);
+    EXPECT_EQ(keys, (std::vector<uint64_t>{0, 5, 5, uint64_t{1} << 40, uint64_t{1} << 62}));
+    EXPECT_EQ(values, (std::vector<char>{'c', 'b', 'e', 'd', 'a'}));
+}
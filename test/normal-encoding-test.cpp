@@ -0,0 +1,162 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <numbers>
+#include <vector>
+
+#include "math/normal-encoding.h"
+#include "math/rng.h"
+
+using Normal3f = Math::Normal3<float>;
+using Quaternionf = Math::Quaternion<float>;
+using Vector3f = Math::Vector3<float>;
+using Vector4f = Math::Vector4<float>;
+
+namespace
+{
+
+std::vector<Normal3f> RandomNormals(size_t count, uint64_t seed)
+{
+    Math::RNG rng(seed);
+    std::vector<Normal3f> result;
+    while (result.size() < count)
+    {
+        const Vector3f v(rng.UniformFloatInRange(-1, 1), rng.UniformFloatInRange(-1, 1),
+                         rng.UniformFloatInRange(-1, 1));
+        const float length_squared = Math::LengthSquared(v);
+        if (length_squared > 0.01f && length_squared <= 1)
+        {
+            const Vector3f n = v / std::sqrt(length_squared);
+            result.emplace_back(n.x, n.y, n.z);
+        }
+    }
+    return result;
+}
+
+// The angle between two vectors in degrees, accurate for small angles unlike acos.
+template <typename A, typename B>
+double AngleDegrees(const A& a, const B& b)
+{
+    const double ax = a.x, ay = a.y, az = a.z;
+    const double bx = b.x, by = b.y, bz = b.z;
+    const double cx = ay * bz - az * by;
+    const double cy = az * bx - ax * bz;
+    const double cz = ax * by - ay * bx;
+    const double angle =
+        std::atan2(std::sqrt(cx * cx + cy * cy + cz * cz), ax * bx + ay * by + az * bz);
+    return angle * 180 / std::numbers::pi;
+}
+
+const std::vector<Normal3f> k_axes = {Normal3f(1, 0, 0),  Normal3f(-1, 0, 0), Normal3f(0, 1, 0),
+                                      Normal3f(0, -1, 0), Normal3f(0, 0, 1),  Normal3f(0, 0, -1)};
+
+}  // namespace
+
+TEST(NormalEncodingTests, Octahedral)
+{
+    for (const Normal3f& n : k_axes)
+    {
+        EXPECT_EQ(Math::DecodeOctahedral32<float>(Math::EncodeOctahedral32(n)), n);
+        EXPECT_EQ(Math::DecodeOctahedral16<float>(Math::EncodeOctahedral16(n)), n);
+        EXPECT_EQ(Math::DecodeSnorm10<float>(Math::EncodeSnorm10(n)), n);
+    }
+    EXPECT_EQ(Math::EncodeOctahedral32(Normal3f(1, 0, 0)), 0x7fffu);
+    EXPECT_EQ(Math::EncodeOctahedral16(Normal3f(0, -1, 0)), 0x8100u);
+    EXPECT_EQ(Math::EncodeSnorm10(Normal3f(0, 0, -1)), 0x201u << 20);
+
+    double max_error32 = 0, max_error16 = 0, max_error10 = 0;
+    for (const Normal3f& n : RandomNormals(200000, 1))
+    {
+        const Normal3f decoded32 = Math::DecodeOctahedral32<float>(Math::EncodeOctahedral32(n));
+        const Normal3f decoded16 = Math::DecodeOctahedral16<float>(Math::EncodeOctahedral16(n));
+        const Normal3f decoded10 = Math::DecodeSnorm10<float>(Math::EncodeSnorm10(n));
+        max_error32 = std::max(max_error32, AngleDegrees(n, decoded32));
+        max_error16 = std::max(max_error16, AngleDegrees(n, decoded16));
+        max_error10 = std::max(max_error10, AngleDegrees(n, decoded10));
+    }
+    EXPECT_LT(max_error32, 0.005);
+    EXPECT_LT(max_error16, 1.0);
+    EXPECT_LT(max_error10, 0.1);
+
+    const Math::Normal3<double> n(0.6, -0.8, 0);
+    const uint32_t code = Math::EncodeOctahedral32(n);
+    EXPECT_LT(AngleDegrees(n, Math::DecodeOctahedral32<double>(code)), 0.005);
+}
+
+TEST(NormalEncodingTests, Batch)
+{
+    // Odd sizes exercise the scalar tail after the SIMD loop.
+    for (const size_t size : {0u, 3u, 4u, 1001u})
+    {
+        const std::vector<Normal3f> normals = RandomNormals(size, size + 2);
+        std::vector<uint32_t> codes32(size), codes10(size);
+        std::vector<uint16_t> codes16(size);
+        Math::EncodeOctahedral32<float>(normals, codes32);
+        Math::EncodeOctahedral16<float>(normals, codes16);
+        Math::EncodeSnorm10<float>(normals, codes10);
+
+        std::vector<Normal3f> decoded32(size), decoded16(size), decoded10(size);
+        Math::DecodeOctahedral32<float>(codes32, decoded32);
+        Math::DecodeOctahedral16<float>(codes16, decoded16);
+        Math::DecodeSnorm10<float>(codes10, decoded10);
+
+        for (size_t i = 0; i < size; ++i)
+        {
+            EXPECT_EQ(codes32[i], Math::EncodeOctahedral32(normals[i]));
+            EXPECT_EQ(codes16[i], Math::EncodeOctahedral16(normals[i]));
+            EXPECT_EQ(codes10[i], Math::EncodeSnorm10(normals[i]));
+            EXPECT_LT(AngleDegrees(decoded32[i], Math::DecodeOctahedral32<float>(codes32[i])),
+                      1e-4);
+            EXPECT_LT(AngleDegrees(decoded16[i], Math::DecodeOctahedral16<float>(codes16[i])),
+                      1e-4);
+            EXPECT_LT(AngleDegrees(decoded10[i], Math::DecodeSnorm10<float>(codes10[i])), 1e-4);
+        }
+    }
+}
+
+TEST(NormalEncodingTests, QTangent)
+{
+    Normal3f normal;
+    Vector4f tangent;
+    Math::DecodeQTangent(Math::EncodeQTangent(Normal3f(0, 0, 1), Vector4f(1, 0, 0, -1)), normal,
+                         tangent);
+    EXPECT_EQ(normal, Normal3f(0, 0, 1));
+    EXPECT_EQ(tangent, Vector4f(1, 0, 0, -1));
+
+    // w is kept away from zero for the rotations by half a turn, so that the handedness survives.
+    const Quaternionf half_turn = Math::EncodeQTangent(Normal3f(0, 0, -1), Vector4f(1, 0, 0, -1));
+    EXPECT_LT(half_turn.w, 0.0f);
+    EXPECT_LT(Math::UnpackQTangent<float>(Math::PackQTangent(half_turn)).w, 0.0f);
+
+    Math::RNG rng(7);
+    double max_error = 0, max_packed_error = 0;
+    for (const Normal3f& n : RandomNormals(100000, 8))
+    {
+        // Any vector that isn't parallel to the normal, the encoding makes it orthogonal.
+        const Vector3f v(rng.UniformFloatInRange(-1, 1), rng.UniformFloatInRange(-1, 1),
+                         rng.UniformFloatInRange(-1, 1));
+        const Vector3f normal_vector(n.x, n.y, n.z);
+        const Vector3f t = v - Math::Dot(normal_vector, v) * normal_vector;
+        if (Math::LengthSquared(t) < 0.01f)
+        {
+            continue;
+        }
+        const Vector3f expected_tangent = Math::Normalize(t);
+        const float handedness = rng.UniformFloat() < 0.5f ? -1.0f : 1.0f;
+
+        const Quaternionf q = Math::EncodeQTangent(n, Vector4f(v.x, v.y, v.z, handedness));
+        Math::DecodeQTangent(q, normal, tangent);
+        EXPECT_EQ(tangent.w, handedness);
+        max_error = std::max({max_error, AngleDegrees(n, normal),
+                              AngleDegrees(expected_tangent, tangent)});
+
+        Math::DecodeQTangent(Math::UnpackQTangent<float>(Math::PackQTangent(q)), normal, tangent);
+        EXPECT_EQ(tangent.w, handedness);
+        max_packed_error = std::max({max_packed_error, AngleDegrees(n, normal),
+                                     AngleDegrees(expected_tangent, tangent)});
+    }
+    EXPECT_LT(max_error, 0.005);
+    EXPECT_LT(max_packed_error, 0.01);
+}
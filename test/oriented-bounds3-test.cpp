@@ -0,0 +1,376 @@
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <vector>
+
+#include "math/oriented-bounds3.h"
+#include "math/projections.h"
+#include "math/rng.h"
+#include "math/transform.h"
+
+#include "mask-bits.h"
+
+using Bounds3f = Math::Bounds3<float>;
+using OrientedBounds3f = Math::OrientedBounds3<float>;
+using Point3f = Math::Point3<float>;
+using Vector3f = Math::Vector3<float>;
+
+namespace
+{
+
+template <typename T>
+Math::Matrix3x3<T> Rotation(T angle_degrees, const Math::Vector3<T>& axis)
+{
+    const Math::Matrix4x4<T> m = Math::Rotate(angle_degrees, axis);
+    // clang-format off
+    return Math::Matrix3x3<T>(m(0, 0), m(0, 1), m(0, 2),
+                              m(1, 0), m(1, 1), m(1, 2),
+                              m(2, 0), m(2, 1), m(2, 2));
+    // clang-format on
+}
+
+template <typename T>
+std::vector<Math::OrientedBounds3<T>> RandomBoxes(size_t count, uint64_t seed)
+{
+    Math::RNG rng(seed);
+    std::vector<Math::OrientedBounds3<T>> boxes;
+    for (size_t i = 0; i < count; ++i)
+    {
+        const Math::Vector3<T> axis(rng.UniformFloatInRange(-1, 1), rng.UniformFloatInRange(-1, 1),
+                                    rng.UniformFloatInRange(0.1f, 1));
+        boxes.emplace_back(
+            Math::Point3<T>(rng.UniformFloatInRange(-20, 20), rng.UniformFloatInRange(-20, 20),
+                            rng.UniformFloatInRange(-20, 20)),
+            Math::Vector3<T>(rng.UniformFloatInRange(0.1f, 8), rng.UniformFloatInRange(0.1f, 2),
+                             rng.UniformFloatInRange(0.1f, 2)),
+            Rotation<T>(rng.UniformFloatInRange(0, 360), Math::Normalize(axis)));
+    }
+    return boxes;
+}
+
+OrientedBounds3f Grow(const OrientedBounds3f& b, float delta)
+{
+    return OrientedBounds3f(b.center, b.half_extents + Vector3f(delta, delta, delta), b.rotation);
+}
+
+}  // namespace
+
+TEST(OrientedBounds3Tests, FromBounds)
+{
+    const Bounds3f b(Point3f(-1, -1, -1), Point3f(1, 2, 3));
+    const OrientedBounds3f aligned(b);
+    EXPECT_EQ(aligned.center, Point3f(0, 0.5f, 1));
+    EXPECT_EQ(aligned.half_extents, Vector3f(1, 1.5f, 2));
+    EXPECT_EQ(aligned.Axis(1), Vector3f(0, 1, 0));
+
+    const Math::Matrix4x4<float> rotate_scale = Math::Translate(Vector3f(1, 2, 3)) *
+                                                Math::Rotate(30.0f, Vector3f(0, 0, 1)) *
+                                                Math::Scale(2.0f, 3.0f, 4.0f);
+    const OrientedBounds3f rotated = OrientedBounds3f::FromBounds(b, rotate_scale);
+    EXPECT_TRUE(Math::IsEqual(rotated.half_extents, Vector3f(2, 4.5f, 8), 1e-5f));
+    EXPECT_TRUE(Math::IsEqual(rotated.center - rotate_scale * Point3f(0, 0.5f, 1), Vector3f(0),
+                              1e-5f));
+    EXPECT_TRUE(Math::IsEqual(rotated.Axis(0), Vector3f(0.8660254f, 0.5f, 0), 1e-6f));
+
+    // With shear and with a zero scale the box is still bounded.
+    const Math::Matrix4x4<float> shear(1, 0.5f, 0, 0, 0, 1, 0, 0, 0, 0.3f, 1, 0, 0, 0, 0, 1);
+    for (const Math::Matrix4x4<float>& m : {shear * rotate_scale, Math::Scale(0.0f, 1.0f, 2.0f)})
+    {
+        const OrientedBounds3f result = OrientedBounds3f::FromBounds(b, m);
+        for (uint8_t corner = 0; corner < 8; ++corner)
+        {
+            EXPECT_TRUE(Math::InsideInclusive(Grow(result, 1e-4f), m * Math::Corner(b, corner)));
+        }
+    }
+}
+
+TEST(OrientedBounds3Tests, FromPoints)
+{
+    // A long thin slab, rotated and far from the origin.
+    Math::RNG rng(1);
+    const Math::Matrix3x3<float> rotation = Rotation(40.0f, Math::Normalize(Vector3f(1, 2, 3)));
+    const Point3f offset(1000, -500, 200);
+    std::vector<Point3f> points;
+    Bounds3f aabb(offset);
+    for (int i = 0; i < 1000; ++i)
+    {
+        const Vector3f local(rng.UniformFloatInRange(-10, 10), rng.UniformFloatInRange(-2, 2),
+                             rng.UniformFloatInRange(-0.1f, 0.1f));
+        points.push_back(offset + rotation * local);
+        aabb = Math::Union(aabb, points.back());
+    }
+
+    const OrientedBounds3f b = OrientedBounds3f::FromPoints(points);
+    for (const Point3f& p : points)
+    {
+        EXPECT_TRUE(Math::InsideInclusive(Grow(b, 1e-3f), p));
+    }
+    EXPECT_NEAR(Math::AbsDot(b.Axis(0), rotation * Vector3f(1, 0, 0)), 1.0f, 1e-3f);
+    EXPECT_NEAR(Math::AbsDot(b.Axis(1), rotation * Vector3f(0, 1, 0)), 1.0f, 1e-3f);
+    EXPECT_NEAR(Math::Dot(Math::Cross(b.Axis(0), b.Axis(1)), b.Axis(2)), 1.0f, 1e-6f);
+    const Vector3f size = b.half_extents * 2.0f;
+    EXPECT_LT(size.x * size.y * size.z, 0.1f * Math::Volume(aabb));
+
+    const Point3f single[] = {Point3f(1, 2, 3)};
+    const OrientedBounds3f point = OrientedBounds3f::FromPoints(single);
+    EXPECT_EQ(point.center, Point3f(1, 2, 3));
+    EXPECT_EQ(point.half_extents, Vector3f(0));
+}
+
+TEST(OrientedBounds3Tests, Overlaps)
+{
+    const Math::Matrix3x3<float> identity(1);
+    const Math::Matrix3x3<float> rotated = Rotation(45.0f, Vector3f(0, 0, 1));
+    const OrientedBounds3f box(Point3f(0, 0, 0), Vector3f(1, 1, 1), identity);
+
+    // The corner of the rotated box reaches 1 + sqrt(2) along x.
+    EXPECT_TRUE(Math::Overlaps(box, OrientedBounds3f(Point3f(2.3f, 0, 0), Vector3f(1), rotated)));
+    EXPECT_FALSE(Math::Overlaps(box, OrientedBounds3f(Point3f(2.5f, 0, 0), Vector3f(1), rotated)));
+    // Axis aligned boxes near the diagonal, which the rotated box doesn't reach.
+    EXPECT_FALSE(Math::Overlaps(OrientedBounds3f(Point3f(2, 2, 0), Vector3f(1), identity),
+                                OrientedBounds3f(Point3f(0, 0, 0), Vector3f(1), rotated)));
+    // Crossing sticks, one above the other.
+    const OrientedBounds3f edge1(Point3f(0, 0, 0), Vector3f(2, 0.1f, 0.1f),
+                                 Rotation(45.0f, Vector3f(0, 1, 0)));
+    const OrientedBounds3f edge2(Point3f(0, 0.3f, 0), Vector3f(2, 0.1f, 0.1f),
+                                 Rotation(-45.0f, Vector3f(0, 1, 0)));
+    EXPECT_FALSE(Math::Overlaps(edge1, edge2));
+    EXPECT_TRUE(Math::Overlaps(
+        edge1, OrientedBounds3f(Point3f(0, 0.15f, 0), edge2.half_extents, edge2.rotation)));
+
+    // A box overlaps every box that contains one of its corners.
+    const std::vector<OrientedBounds3f> boxes = RandomBoxes<float>(300, 2);
+    for (const OrientedBounds3f& b1 : boxes)
+    {
+        for (const OrientedBounds3f& b2 : boxes)
+        {
+            for (uint8_t corner = 0; corner < 8; ++corner)
+            {
+                const Vector3f signs((corner & 1) ? 1.0f : -1.0f, (corner & 2) ? 1.0f : -1.0f,
+                                     (corner & 4) ? 1.0f : -1.0f);
+                if (Math::InsideInclusive(b2, b1.center + b1.rotation * (b1.half_extents * signs)))
+                {
+                    EXPECT_TRUE(Math::Overlaps(b1, b2));
+                    EXPECT_TRUE(Math::Overlaps(b2, b1));
+                }
+            }
+        }
+    }
+}
+
+TEST(OrientedBounds3Tests, Frustum)
+{
+    // Looking down +z with a 90 degree field of view, so the sides are the planes |x| = z, |y| = z.
+    const auto f = Math::Frustum<float>::FromMatrix_N0(
+        Math::Perspective_LH_N0(90.0f, 1.0f, 1.0f, 100.0f));
+    const Math::Matrix3x3<float> diagonal = Rotation(45.0f, Vector3f(0, -1, 0));
+
+    const OrientedBounds3f inside(Point3f(0, 0, 10), Vector3f(3, 1, 1), diagonal);
+    EXPECT_TRUE(Math::Overlaps(f, inside));
+    EXPECT_TRUE(Math::Inside(f, inside));
+
+    const OrientedBounds3f crossing(Point3f(10, 0, 10), Vector3f(3, 1, 1), diagonal);
+    EXPECT_TRUE(Math::Overlaps(f, crossing));
+    EXPECT_FALSE(Math::Inside(f, crossing));
+
+    // A stick parallel to the right plane and just outside it. Its axis aligned box reaches inside.
+    const OrientedBounds3f stick(Point3f(8, 0, 5), Vector3f(4, 0.1f, 0.1f),
+                                 Rotation(45.0f, Vector3f(0, -1, 0)));
+    EXPECT_NEAR(stick.Axis(0).x, stick.Axis(0).z, 1e-6f);
+    EXPECT_FALSE(Math::Overlaps(f, stick));
+    Bounds3f stick_bounds(stick.center);
+    for (const float end : {-4.0f, 4.0f})
+    {
+        stick_bounds = Math::Union(stick_bounds, stick.center + stick.Axis(0) * end);
+    }
+    EXPECT_TRUE(Math::Overlaps(f, stick_bounds));
+}
+
+TEST(OrientedBounds3Tests, Ray)
+{
+    const OrientedBounds3f box(Point3f(0, 0, 0), Vector3f(4, 0.5f, 0.5f),
+                               Rotation(45.0f, Vector3f(0, 0, 1)));
+    float t0 = 0;
+    float t1 = 0;
+    // Along the long axis from outside.
+    const Vector3f axis = box.Axis(0);
+    EXPECT_TRUE(Math::Intersect(Math::Ray<float>(Point3f(0) - axis * 10, axis), box, 100.0f, t0,
+                                t1));
+    EXPECT_NEAR(t0, 6, 1e-5f);
+    EXPECT_NEAR(t1, 14, 1e-5f);
+    // Through the corner of the axis aligned box of the stick, which the stick doesn't cover.
+    EXPECT_FALSE(Math::Intersect(Math::Ray<float>(Point3f(2.5f, -2.5f, -10), Vector3f(0, 0, 1)),
+                                 box, 100.0f, t0, t1));
+    EXPECT_FALSE(Math::Intersect(Math::Ray<float>(Point3f(0) - axis * 10, axis), box, 5.0f, t0,
+                                 t1));
+
+    // Without rotation the result is the one of the axis aligned box.
+    const Bounds3f b(Point3f(-1, -2, -3), Point3f(2, 1, 0));
+    const Math::Ray<float> ray(Point3f(-5, 0.5f, -1), Vector3f(1, -0.1f, 0.05f));
+    float bounds_t0 = 0;
+    float bounds_t1 = 0;
+    EXPECT_TRUE(Math::Intersect(ray, OrientedBounds3f(b), 100.0f, t0, t1));
+    EXPECT_TRUE(Math::Intersect(ray, b, 100.0f, bounds_t0, bounds_t1));
+    EXPECT_FLOAT_EQ(t0, bounds_t0);
+    EXPECT_FLOAT_EQ(t1, bounds_t1);
+}
+
+template <typename T>
+void TestBatch()
+{
+    // 203 boxes leave a partial group of four and a partial word of the mask.
+    const std::vector<Math::OrientedBounds3<T>> boxes = RandomBoxes<T>(203, 3);
+    std::vector<uint64_t> mask(4);
+
+    const Math::OrientedBounds3<T> query(Math::Point3<T>(2, -1, 3), Math::Vector3<T>(10, 4, 1),
+                                         Rotation<T>(30, Math::Vector3<T>(0, 1, 0)));
+    size_t count = Math::Overlaps<T>(query, boxes, mask);
+    size_t expected = 0;
+    for (size_t i = 0; i < boxes.size(); ++i)
+    {
+        EXPECT_EQ(MaskBit(mask, i), Math::Overlaps(query, boxes[i]));
+        expected += Math::Overlaps(query, boxes[i]) ? 1 : 0;
+    }
+    EXPECT_EQ(count, expected);
+    EXPECT_GT(count, 0u);
+    EXPECT_LT(count, boxes.size());
+    EXPECT_EQ(mask[3] >> (203 - 192), 0u);
+
+    // Looking at the boxes from outside, with some of them cut by the sides.
+    const Math::Matrix4x4<T> view = Math::LookAt_LH(
+        Math::Point3<T>(5, 0, -40), Math::Point3<T>(0, 0, 0), Math::Vector3<T>(0, 1, 0));
+    const auto f =
+        Math::Frustum<T>::FromMatrix_N0(Math::Perspective_LH_N0<T>(30, 1, 1, 100) * view);
+    count = Math::Overlaps<T>(f, boxes, mask);
+    expected = 0;
+    for (size_t i = 0; i < boxes.size(); ++i)
+    {
+        EXPECT_EQ(MaskBit(mask, i), Math::Overlaps(f, boxes[i]));
+        expected += Math::Overlaps(f, boxes[i]) ? 1 : 0;
+    }
+    EXPECT_EQ(count, expected);
+    EXPECT_GT(count, 0u);
+    EXPECT_LT(count, boxes.size());
+
+    Math::RNG rng(4);
+    for (int r = 0; r < 20; ++r)
+    {
+        const Math::Ray<T> ray(Math::Point3<T>(-30, rng.UniformFloatInRange(-20, 20),
+                                               rng.UniformFloatInRange(-20, 20)),
+                               Math::Vector3<T>(1, rng.UniformFloatInRange(-0.2f, 0.2f), 0));
+        count = Math::Intersect<T>(ray, boxes, 50, mask);
+        expected = 0;
+        for (size_t i = 0; i < boxes.size(); ++i)
+        {
+            T t0;
+            T t1;
+            const bool hit = Math::Intersect(ray, boxes[i], T(50), t0, t1);
+            EXPECT_EQ(MaskBit(mask, i), hit);
+            expected += hit ? 1 : 0;
+        }
+        EXPECT_EQ(count, expected);
+    }
+}
+
+TEST(OrientedBounds3Tests, Batch)
+{
+    TestBatch<float>();
+    TestBatch<double>();
+}
+
+TEST(OrientedBounds3Tests, BatchFrustumTouching)
+{
+    // Boxes moved onto one plane, the others accept everything. Rounding decides which side they
+    // land on, the batch test has to decide the same way as the scalar one.
+    Math::Frustum<float> f;
+    f.planes.fill(Math::Vector4<float>(0, 0, 0, 1));
+    const Vector3f normal = Math::Normalize(Vector3f(0.3f, -0.7f, 0.64f));
+    f.planes[1] = Math::Vector4<float>(normal.x, normal.y, normal.z, 0.37f);
+
+    std::vector<OrientedBounds3f> boxes = RandomBoxes<float>(203, 5);
+    for (OrientedBounds3f& b : boxes)
+    {
+        const float distance = normal.x * b.center.x + normal.y * b.center.y +
+                               normal.z * b.center.z + f.planes[1].w;
+        const float radius = b.half_extents.x * Math::AbsDot(normal, b.Axis(0)) +
+                             b.half_extents.y * Math::AbsDot(normal, b.Axis(1)) +
+                             b.half_extents.z * Math::AbsDot(normal, b.Axis(2));
+        b.center = b.center - normal * (distance + radius);
+    }
+
+    std::vector<uint64_t> mask(4);
+    const size_t count = Math::Overlaps<float>(f, boxes, mask);
+    size_t expected = 0;
+    for (size_t i = 0; i < boxes.size(); ++i)
+    {
+        EXPECT_EQ(MaskBit(mask, i), Math::Overlaps(f, boxes[i]));
+        expected += Math::Overlaps(f, boxes[i]) ? 1 : 0;
+    }
+    EXPECT_EQ(count, expected);
+    EXPECT_GT(count, 0u);
+    EXPECT_LT(count, boxes.size());
+}
+
+TEST(OrientedBounds3Tests, BatchTouching)
+{
+    // Boxes moved to touch the query along one of the 15 separating axes. Rounding decides if they
+    // overlap, the batch test has to decide the same way as the scalar one. 1003 boxes leave a
+    // partial group of four and a partial word of the mask.
+    const OrientedBounds3f query(Point3f(2, -1, 3), Vector3f(10, 4, 1),
+                                 Rotation(30.0f, Vector3f(0, 1, 0)));
+    const float epsilon = 16 * std::numeric_limits<float>::epsilon();
+    std::vector<OrientedBounds3f> boxes = RandomBoxes<float>(1003, 6);
+    for (size_t k = 0; k < boxes.size(); ++k)
+    {
+        OrientedBounds3f& b = boxes[k];
+        float abs_r[3][3];
+        for (int i = 0; i < 3; ++i)
+        {
+            for (int j = 0; j < 3; ++j)
+            {
+                abs_r[i][j] = Math::AbsDot(query.Axis(i), b.Axis(j)) + epsilon;
+            }
+        }
+        const Vector3f& e1 = query.half_extents;
+        const Vector3f& e2 = b.half_extents;
+        Vector3f axis;
+        float radius = 0;
+        const int which = static_cast<int>(k % 12);
+        if (which < 3)
+        {
+            const int j = which;
+            axis = b.Axis(j);
+            radius = e1[0] * abs_r[0][j] + e1[1] * abs_r[1][j] + e1[2] * abs_r[2][j] + e2[j];
+        }
+        else
+        {
+            const int i = (which - 3) / 3;
+            const int j = (which - 3) % 3;
+            const int i1 = (i + 1) % 3;
+            const int i2 = (i + 2) % 3;
+            const int j1 = (j + 1) % 3;
+            const int j2 = (j + 2) % 3;
+            axis = Math::Cross(query.Axis(i), b.Axis(j));
+            radius = e1[i1] * abs_r[i2][j] + e1[i2] * abs_r[i1][j] + e2[j1] * abs_r[i][j2] +
+                     e2[j2] * abs_r[i][j1];
+        }
+        const float length_squared = Math::LengthSquared(axis);
+        if (length_squared < 1e-4f)
+        {
+            continue;
+        }
+        b.center = query.center + axis * (radius / length_squared);
+    }
+
+    std::vector<uint64_t> mask(16);
+    const size_t count = Math::Overlaps<float>(query, boxes, mask);
+    size_t expected = 0;
+    for (size_t i = 0; i < boxes.size(); ++i)
+    {
+        EXPECT_EQ(MaskBit(mask, i), Math::Overlaps(query, boxes[i]));
+        expected += Math::Overlaps(query, boxes[i]) ? 1 : 0;
+    }
+    EXPECT_EQ(count, expected);
+    EXPECT_GT(count, 0u);
+    EXPECT_LT(count, boxes.size());
+}
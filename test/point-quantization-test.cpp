@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "math/point-quantization.h"
+#include "math/rng.h"
+
+using Bounds3f = Math::Bounds3<float>;
+using Point3f = Math::Point3<float>;
+using Point3u16 = Math::Point3<uint16_t>;
+using Vector3f = Math::Vector3<float>;
+
+namespace
+{
+
+std::vector<Point3f> RandomPoints(const Bounds3f& bounds, size_t count, uint64_t seed)
+{
+    Math::RNG rng(seed);
+    std::vector<Point3f> result(count);
+    for (Point3f& p : result)
+    {
+        p = Math::Lerp(bounds, Point3f(rng.UniformFloat(), rng.UniformFloat(), rng.UniformFloat()));
+    }
+    return result;
+}
+
+// Small chunks around the origin and far from it, where the float spacing is close to the steps.
+const std::vector<Bounds3f> k_bounds = {
+    Bounds3f(Point3f(-1, -1, -1), Point3f(1, 1, 1)),
+    Bounds3f(Point3f(0, 0, 0), Point3f(1000, 10, 0.01f)),
+    Bounds3f(Point3f(10000, -20000, 50000), Point3f(10064, -19936, 50001)),
+};
+
+}  // namespace
+
+TEST(PointQuantizationTests, Corners)
+{
+    const Bounds3f bounds(Point3f(-2, 1, 3), Point3f(6, 5, 4));
+    EXPECT_EQ(Math::QuantizePoint16(bounds, bounds.min), Point3u16(0, 0, 0));
+    EXPECT_EQ(Math::QuantizePoint16(bounds, bounds.max), Point3u16(65535, 65535, 65535));
+    EXPECT_EQ(Math::QuantizePoint16(bounds, Point3f(2, 3, 3.5f)), Point3u16(32768, 32768, 32768));
+    EXPECT_EQ(Math::DequantizePoint16(bounds, Point3u16(0, 0, 0)), bounds.min);
+    EXPECT_EQ(Math::DequantizePoint16(bounds, Point3u16(65535, 65535, 65535)), bounds.max);
+
+    EXPECT_EQ(Math::QuantizePoint21(bounds, bounds.min), 0u);
+    EXPECT_EQ(Math::QuantizePoint21(bounds, bounds.max), (uint64_t{1} << 63) - 1);
+    EXPECT_EQ(Math::DequantizePoint21(bounds, (uint64_t{1} << 63) - 1), bounds.max);
+    EXPECT_EQ(Math::QuantizePoint21(bounds, Point3f(6, 1, 3)), (uint64_t{1} << 21) - 1);
+
+    // Points outside are clamped, axes without extent quantize to zero.
+    EXPECT_EQ(Math::QuantizePoint16(bounds, Point3f(-10, 10, 3)), Point3u16(0, 65535, 0));
+    const Bounds3f flat(Point3f(0, 0, 2), Point3f(1, 1, 2));
+    EXPECT_EQ(Math::QuantizePoint16(flat, Point3f(1, 0, 2)), Point3u16(65535, 0, 0));
+    EXPECT_EQ(Math::DequantizePoint16(flat, Point3u16(65535, 0, 0)), Point3f(1, 0, 2));
+
+    static_assert(Math::QuantizePoint16(Math::Bounds3<double>(Math::Point3<double>(0, 0, 0),
+                                                              Math::Point3<double>(1, 1, 1)),
+                                        Math::Point3<double>(1, 0.5, 0)) ==
+                  Point3u16(65535, 32768, 0));
+}
+
+TEST(PointQuantizationTests, ErrorBound)
+{
+    for (const Bounds3f& bounds : k_bounds)
+    {
+        const Vector3f error16 = Math::QuantizationError16(bounds);
+        const Vector3f error21 = Math::QuantizationError21(bounds);
+        // The step size dominates the bound for the chunk around the origin.
+        EXPECT_LT(error21.x, error16.x);
+        for (const Point3f& p : RandomPoints(bounds, 100000, 1))
+        {
+            const Vector3f d16 =
+                Math::Abs(Math::DequantizePoint16(bounds, Math::QuantizePoint16(bounds, p)) - p);
+            const Vector3f d21 =
+                Math::Abs(Math::DequantizePoint21(bounds, Math::QuantizePoint21(bounds, p)) - p);
+            EXPECT_LE(d16.x, error16.x);
+            EXPECT_LE(d16.y, error16.y);
+            EXPECT_LE(d16.z, error16.z);
+            EXPECT_LE(d21.x, error21.x);
+            EXPECT_LE(d21.y, error21.y);
+            EXPECT_LE(d21.z, error21.z);
+        }
+    }
+
+    const Math::Bounds3<double> bounds(Math::Point3<double>(-3, 0, 1e6),
+                                       Math::Point3<double>(3, 1e-3, 1e6 + 1));
+    const Math::Point3<double> p(1.2345, 6.789e-4, 1e6 + 0.5);
+    const Math::Vector3<double> error = Math::QuantizationError21(bounds);
+    const Math::Vector3<double> d =
+        Math::Abs(Math::DequantizePoint21(bounds, Math::QuantizePoint21(bounds, p)) - p);
+    EXPECT_LE(d.x, error.x);
+    EXPECT_LE(d.y, error.y);
+    EXPECT_LE(d.z, error.z);
+}
+
+TEST(PointQuantizationTests, Batch)
+{
+    // Odd sizes exercise the scalar tail after the SIMD loop.
+    for (const Bounds3f& bounds : k_bounds)
+    {
+        for (const size_t size : {0u, 3u, 4u, 1001u})
+        {
+            std::vector<Point3f> points = RandomPoints(bounds, size, size);
+            if (size > 0)
+            {
+                points[0] = Point3f(-1e9f, 1e9f, bounds.min.z);
+            }
+            std::vector<Point3u16> quantized16(size);
+            std::vector<uint64_t> quantized21(size);
+            Math::QuantizePoint16<float>(bounds, points, quantized16);
+            Math::QuantizePoint21<float>(bounds, points, quantized21);
+
+            std::vector<Point3f> points16(size), points21(size);
+            Math::DequantizePoint16<float>(bounds, quantized16, points16);
+            Math::DequantizePoint21<float>(bounds, quantized21, points21);
+
+            for (size_t i = 0; i < size; ++i)
+            {
+                EXPECT_EQ(quantized16[i], Math::QuantizePoint16(bounds, points[i]));
+                EXPECT_EQ(quantized21[i], Math::QuantizePoint21(bounds, points[i]));
+                const Point3f expected16 = Math::DequantizePoint16(bounds, quantized16[i]);
+                const Point3f expected21 = Math::DequantizePoint21(bounds, quantized21[i]);
+                for (int axis = 0; axis < 3; ++axis)
+                {
+                    EXPECT_FLOAT_EQ(points16[i][axis], expected16[axis]);
+                    EXPECT_FLOAT_EQ(points21[i][axis], expected21[axis]);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "math/point-statistics.h"
+#include "math/rng.h"
+
+using Point3f = Math::Point3<float>;
+
+namespace
+{
+
+// Points in a tilted slab far from the origin, where raw sums of squares lose the covariance.
+std::vector<Point3f> RandomPoints(size_t count, uint64_t seed)
+{
+    Math::RNG rng(seed);
+    std::vector<Point3f> result(count);
+    for (Point3f& p : result)
+    {
+        const float u = rng.UniformFloatInRange(-10, 10);
+        const float v = rng.UniformFloatInRange(-1, 1);
+        p = Point3f(10000 + u, -20000 + u + v, 5000 + 0.1f * v);
+    }
+    return result;
+}
+
+// Two passes in double, the mean and then the deviations from it.
+void ExpectStatistics(const Math::PointStatistics<float>& statistics,
+                      const std::vector<Point3f>& points)
+{
+    ASSERT_EQ(statistics.Count(), points.size());
+    Math::Bounds3<float> bounds = Math::Internal::InvertedBounds<float>();
+    Math::Vector3<double> mean(0, 0, 0);
+    for (const Point3f& p : points)
+    {
+        bounds = Math::Union(bounds, p);
+        mean += Math::Vector3<double>(p.x, p.y, p.z) / static_cast<double>(points.size());
+    }
+    Math::Matrix3x3<double> covariance(0);
+    for (const Point3f& p : points)
+    {
+        const Math::Vector3<double> d = Math::Vector3<double>(p.x, p.y, p.z) - mean;
+        for (int r = 0; r < 3; ++r)
+        {
+            for (int c = 0; c < 3; ++c)
+            {
+                covariance.elements[r][c] += d[r] * d[c] / static_cast<double>(points.size());
+            }
+        }
+    }
+
+    EXPECT_EQ(statistics.Bounds(), bounds);
+    const Math::Matrix3x3<double> result = statistics.Covariance();
+    for (int r = 0; r < 3; ++r)
+    {
+        EXPECT_NEAR(statistics.Mean()[r], mean[r], 1e-9 * (1 + std::abs(mean[r])));
+        for (int c = 0; c < 3; ++c)
+        {
+            EXPECT_NEAR(result.elements[r][c], covariance.elements[r][c], 1e-9);
+        }
+    }
+}
+
+}  // namespace
+
+TEST(PointStatisticsTests, Simple)
+{
+    Math::PointStatistics<float> statistics;
+    EXPECT_EQ(statistics.Count(), 0u);
+    EXPECT_EQ(statistics.Mean(), Math::Point3<double>(0, 0, 0));
+    EXPECT_EQ(statistics.Covariance(), Math::Matrix3x3<double>(0));
+
+    const std::vector<Point3f> points = {Point3f(0, 0, 0), Point3f(2, 0, 0), Point3f(0, 4, 0),
+                                         Point3f(2, 4, 0)};
+    statistics.Add(points);
+    EXPECT_EQ(statistics.Count(), 4u);
+    EXPECT_EQ(statistics.Bounds(), Math::Bounds3<float>(Point3f(0, 0, 0), Point3f(2, 4, 0)));
+    EXPECT_EQ(statistics.Mean(), Math::Point3<double>(1, 2, 0));
+    EXPECT_EQ(statistics.Covariance(), Math::Matrix3x3<double>(1, 0, 0, 0, 4, 0, 0, 0, 0));
+}
+
+TEST(PointStatisticsTests, Streaming)
+{
+    // Odd sizes exercise the scalar tail and partial chunks.
+    for (const size_t size : {1u, 3u, 4u, 1025u, 5000u})
+    {
+        const std::vector<Point3f> points = RandomPoints(size, size);
+        const std::span<const Point3f> all(points);
+
+        Math::PointStatistics<float> chunked;
+        chunked.Add(all);
+        ExpectStatistics(chunked, points);
+
+        Math::PointStatistics<float> single;
+        for (const Point3f& p : points)
+        {
+            single.Add(p);
+        }
+        ExpectStatistics(single, points);
+
+        Math::PointStatistics<float> merged;
+        Math::PointStatistics<float> second;
+        merged.Add(all.first(size / 3));
+        second.Add(all.subspan(size / 3));
+        merged.Merge(second);
+        merged.Merge(Math::PointStatistics<float>());
+        ExpectStatistics(merged, points);
+    }
+
+    Math::PointStatistics<double> statistics;
+    statistics.Add(Math::Point3<double>(1, 2, 3));
+    statistics.Add(std::vector<Math::Point3<double>>{{3, 2, 1}});
+    EXPECT_EQ(statistics.Mean(), Math::Point3<double>(2, 2, 2));
+    EXPECT_EQ(statistics.Covariance().elements[0][2], -1.0);
+}
+
+TEST(PointStatisticsTests, Parallel)
+{
+    Math::SetThreadCount(4);
+    const std::vector<Point3f> points = RandomPoints(300000, 7);
+    const Math::PointStatistics<float> statistics = Math::ComputePointStatistics<float>(points);
+    ExpectStatistics(statistics, points);
+    EXPECT_EQ(Math::ComputePointStatistics<float>({}).Count(), 0u);
+
+    // The batches are merged in the same order for any thread count, so the results are identical.
+    for (const uint32_t thread_count : {1u, 3u, 4u})
+    {
+        Math::SetThreadCount(thread_count);
+        const Math::PointStatistics<float> other = Math::ComputePointStatistics<float>(points);
+        EXPECT_EQ(other.Mean(), statistics.Mean());
+        EXPECT_EQ(other.Covariance(), statistics.Covariance());
+    }
+    Math::SetThreadCount(0);
+}
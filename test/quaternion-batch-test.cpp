@@ -0,0 +1,299 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "math/math.h"
+
+using Quatf = Math::Quaternion<float>;
+using Quatd = Math::Quaternion<double>;
+using Vector3f = Math::Vector3<float>;
+
+namespace
+{
+
+template <typename T>
+struct QuaternionArrays
+{
+    std::vector<T> x;
+    std::vector<T> y;
+    std::vector<T> z;
+    std::vector<T> w;
+
+    explicit QuaternionArrays(size_t count) : x(count), y(count), z(count), w(count) {}
+
+    Math::QuaternionSoA<T> View() { return {x, y, z, w}; }
+};
+
+Quatf RandomRotation(Math::RNG& rng)
+{
+    const Vector3f axis(rng.UniformFloatInRange(-1, 1), rng.UniformFloatInRange(-1, 1),
+                        rng.UniformFloatInRange(-1, 1));
+    return Quatf::FromAxisAngleDegrees(axis, rng.UniformFloatInRange(-360, 360));
+}
+
+// Exact shortest path Slerp computed in double precision.
+Quatd ReferenceSlerp(double param, const Quatd& q1, Quatd q2)
+{
+    if (Math::Dot(q1, q2) < 0)
+    {
+        q2 *= -1.0;
+    }
+    return Math::Slerp(param, q1, q2);
+}
+
+}  // namespace
+
+TEST(QuaternionBatchTests, SoA)
+{
+    QuaternionArrays<float> arrays(3);
+    const Math::QuaternionSoA<float> view = arrays.View();
+    EXPECT_EQ(view.Size(), 3);
+
+    view.Set(1, Quatf(1, 2, 3, 4));
+    EXPECT_EQ(arrays.w[1], 1);
+    EXPECT_EQ(arrays.x[1], 2);
+    EXPECT_EQ(arrays.y[1], 3);
+    EXPECT_EQ(arrays.z[1], 4);
+
+    const Math::QuaternionSoA<const float> const_view = view;
+    EXPECT_EQ(const_view.Get(1), Quatf(1, 2, 3, 4));
+}
+
+TEST(QuaternionBatchTests, Slerp)
+{
+    // Not a multiple of the SIMD width so that the scalar tail is tested too.
+    constexpr size_t k_count = 103;
+    Math::RNG rng(7);
+    QuaternionArrays<float> q1(k_count);
+    QuaternionArrays<float> q2(k_count);
+    QuaternionArrays<float> result(k_count);
+    std::vector<float> params(k_count);
+    for (size_t i = 0; i < k_count; ++i)
+    {
+        q1.View().Set(i, RandomRotation(rng));
+        // Some pairs are nearly identical to test the Nlerp fallback.
+        q2.View().Set(i, i % 10 == 0 ? q1.View().Get(i) : RandomRotation(rng));
+        params[i] = rng.UniformFloat();
+    }
+
+    Math::Slerp<float>(params, q1.View(), q2.View(), result.View());
+
+    for (size_t i = 0; i < k_count; ++i)
+    {
+        const Quatd expected = ReferenceSlerp(params[i], q1.View().Get(i), q2.View().Get(i));
+        const Quatf actual = result.View().Get(i);
+        EXPECT_NEAR(actual.vec.x, expected.vec.x, 1e-6);
+        EXPECT_NEAR(actual.vec.y, expected.vec.y, 1e-6);
+        EXPECT_NEAR(actual.vec.z, expected.vec.z, 1e-6);
+        EXPECT_NEAR(actual.w, expected.w, 1e-6);
+    }
+}
+
+TEST(QuaternionBatchTests, SlerpDouble)
+{
+    constexpr size_t k_count = 17;
+    Math::RNG rng(11);
+    QuaternionArrays<double> q1(k_count);
+    QuaternionArrays<double> q2(k_count);
+    std::vector<double> params(k_count);
+    for (size_t i = 0; i < k_count; ++i)
+    {
+        q1.View().Set(i, RandomRotation(rng));
+        q2.View().Set(i, RandomRotation(rng));
+        params[i] = rng.UniformFloat();
+    }
+    const QuaternionArrays<double> q1_copy = q1;
+
+    // The result is allowed to alias the input.
+    Math::Slerp<double>(params, q1.View(), q2.View(), q1.View());
+
+    for (size_t i = 0; i < k_count; ++i)
+    {
+        const Quatd q = Quatd(q1_copy.w[i], q1_copy.x[i], q1_copy.y[i], q1_copy.z[i]);
+        const Quatd expected = ReferenceSlerp(params[i], q, q2.View().Get(i));
+        EXPECT_NEAR(q1.x[i], expected.vec.x, 1e-6);
+        EXPECT_NEAR(q1.y[i], expected.vec.y, 1e-6);
+        EXPECT_NEAR(q1.z[i], expected.vec.z, 1e-6);
+        EXPECT_NEAR(q1.w[i], expected.w, 1e-6);
+    }
+}
+
+TEST(QuaternionBatchTests, Nlerp)
+{
+    constexpr size_t k_count = 10;
+    Math::RNG rng(3);
+    QuaternionArrays<float> q1(k_count);
+    QuaternionArrays<float> q2(k_count);
+    QuaternionArrays<float> result(k_count);
+    std::vector<float> params(k_count);
+    for (size_t i = 0; i < k_count; ++i)
+    {
+        q1.View().Set(i, RandomRotation(rng));
+        q2.View().Set(i, RandomRotation(rng));
+        params[i] = rng.UniformFloat();
+    }
+
+    Math::Nlerp<float>(params, q1.View(), q2.View(), result.View());
+
+    for (size_t i = 0; i < k_count; ++i)
+    {
+        const Quatf a = q1.View().Get(i);
+        const Quatf b = q2.View().Get(i);
+        const Quatf expected = Math::Lerp(params[i], a, Math::Dot(a, b) < 0 ? b * -1.0f : b);
+        const Quatf actual = result.View().Get(i);
+        EXPECT_NEAR(actual.vec.x, expected.vec.x, 1e-6f);
+        EXPECT_NEAR(actual.vec.y, expected.vec.y, 1e-6f);
+        EXPECT_NEAR(actual.vec.z, expected.vec.z, 1e-6f);
+        EXPECT_NEAR(actual.w, expected.w, 1e-6f);
+    }
+}
+
+TEST(QuaternionBatchTests, ShortestPath)
+{
+    // q2 is the same rotation as q1 with the opposite sign, so every interpolation is q1.
+    std::vector<float> x = {0, 0, 0, 0, 0};
+    std::vector<float> y = {0, 0, 0, 0, 0};
+    std::vector<float> z = {0.5f, 0.5f, 0.5f, 0.5f, 0.5f};
+    std::vector<float> w = {0.8660254f, 0.8660254f, 0.8660254f, 0.8660254f, 0.8660254f};
+    std::vector<float> neg_z = {-0.5f, -0.5f, -0.5f, -0.5f, -0.5f};
+    std::vector<float> neg_w = {-0.8660254f, -0.8660254f, -0.8660254f, -0.8660254f, -0.8660254f};
+    const std::vector<float> params = {0, 0.25f, 0.5f, 0.75f, 1};
+    const Math::QuaternionSoA<float> q1(x, y, z, w);
+    const Math::QuaternionSoA<float> q2(x, y, neg_z, neg_w);
+
+    QuaternionArrays<float> result(5);
+    Math::Slerp<float>(params, q1, q2, result.View());
+    for (size_t i = 0; i < params.size(); ++i)
+    {
+        EXPECT_NEAR(result.z[i], 0.5f, 1e-6f);
+        EXPECT_NEAR(result.w[i], 0.8660254f, 1e-6f);
+    }
+
+    Math::Nlerp<float>(params, q1, q2, result.View());
+    for (size_t i = 0; i < params.size(); ++i)
+    {
+        EXPECT_NEAR(result.z[i], 0.5f, 1e-6f);
+        EXPECT_NEAR(result.w[i], 0.8660254f, 1e-6f);
+    }
+}
+
+TEST(QuaternionBatchTests, Multiply)
+{
+    constexpr size_t k_count = 11;
+    Math::RNG rng(5);
+    std::vector<Quatf> q1(k_count);
+    std::vector<Quatf> q2(k_count);
+    QuaternionArrays<float> q1_soa(k_count);
+    QuaternionArrays<float> q2_soa(k_count);
+    for (size_t i = 0; i < k_count; ++i)
+    {
+        q1[i] = RandomRotation(rng);
+        q2[i] = RandomRotation(rng);
+        q1_soa.View().Set(i, q1[i]);
+        q2_soa.View().Set(i, q2[i]);
+    }
+
+    std::vector<Quatf> result(k_count);
+    Math::Multiply<float>(q1, q2, result);
+    Math::Multiply<float>(q1_soa.View(), q2_soa.View(), q2_soa.View());
+    for (size_t i = 0; i < k_count; ++i)
+    {
+        EXPECT_EQ(result[i], q1[i] * q2[i]);
+        EXPECT_EQ(q2_soa.View().Get(i), q1[i] * q2[i]);
+    }
+
+    // In place.
+    Math::Multiply<float>(q1, result, result);
+    for (size_t i = 0; i < k_count; ++i)
+    {
+        EXPECT_EQ(result[i], q1[i] * (q1[i] * q2[i]));
+    }
+}
+
+TEST(QuaternionBatchTests, LogExpPow)
+{
+    constexpr size_t k_count = 6;
+    Math::RNG rng(13);
+    QuaternionArrays<double> q(k_count);
+    std::vector<double> exponents(k_count);
+    for (size_t i = 0; i < k_count; ++i)
+    {
+        q.View().Set(i, RandomRotation(rng));
+        exponents[i] = rng.UniformFloatInRange(-2, 2);
+    }
+
+    QuaternionArrays<double> log(k_count);
+    QuaternionArrays<double> exp(k_count);
+    QuaternionArrays<double> pow(k_count);
+    Math::Log<double>(q.View(), log.View());
+    Math::Exp<double>(log.View(), exp.View());
+    Math::Pow<double>(q.View(), exponents, pow.View());
+    for (size_t i = 0; i < k_count; ++i)
+    {
+        EXPECT_EQ(log.View().Get(i), Math::Log(q.View().Get(i)));
+        EXPECT_TRUE(Math::IsEqual(exp.View().Get(i), q.View().Get(i), 1e-14));
+        EXPECT_EQ(pow.View().Get(i), Math::Pow(q.View().Get(i), exponents[i]));
+    }
+}
+
+TEST(QuaternionBatchTests, AngleBetweenAndSwingTwist)
+{
+    constexpr size_t k_count = 6;
+    Math::RNG rng(17);
+    QuaternionArrays<float> q1(k_count);
+    QuaternionArrays<float> q2(k_count);
+    for (size_t i = 0; i < k_count; ++i)
+    {
+        q1.View().Set(i, RandomRotation(rng));
+        q2.View().Set(i, RandomRotation(rng));
+    }
+
+    std::vector<float> angles(k_count);
+    Math::AngleBetween<float>(q1.View(), q2.View(), angles);
+
+    const Vector3f axis(0, 1, 0);
+    QuaternionArrays<float> swing(k_count);
+    QuaternionArrays<float> twist(k_count);
+    Math::SwingTwist<float>(q1.View(), axis, swing.View(), twist.View());
+
+    for (size_t i = 0; i < k_count; ++i)
+    {
+        EXPECT_EQ(angles[i], Math::AngleBetween(q1.View().Get(i), q2.View().Get(i)));
+        const Math::SwingTwistDecomposition<float> expected =
+            Math::SwingTwist(q1.View().Get(i), axis);
+        EXPECT_EQ(swing.View().Get(i), expected.swing);
+        EXPECT_EQ(twist.View().Get(i), expected.twist);
+    }
+}
+
+TEST(QuaternionBatchTests, Squad)
+{
+    constexpr size_t k_count = 5;
+    Math::RNG rng(19);
+    QuaternionArrays<float> q1(k_count);
+    QuaternionArrays<float> a1(k_count);
+    QuaternionArrays<float> a2(k_count);
+    QuaternionArrays<float> q2(k_count);
+    std::vector<float> params(k_count);
+    for (size_t i = 0; i < k_count; ++i)
+    {
+        const Quatf q_prev = RandomRotation(rng);
+        const Quatf q_start = RandomRotation(rng);
+        const Quatf q_end = RandomRotation(rng);
+        const Quatf q_next = RandomRotation(rng);
+        q1.View().Set(i, q_start);
+        q2.View().Set(i, q_end);
+        a1.View().Set(i, Math::SquadControlPoint(q_prev, q_start, q_end));
+        a2.View().Set(i, Math::SquadControlPoint(q_start, q_end, q_next));
+        params[i] = rng.UniformFloat();
+    }
+
+    QuaternionArrays<float> result(k_count);
+    Math::Squad<float>(params, q1.View(), a1.View(), a2.View(), q2.View(), result.View());
+    for (size_t i = 0; i < k_count; ++i)
+    {
+        const Quatf expected = Math::Squad(params[i], q1.View().Get(i), a1.View().Get(i),
+                                           a2.View().Get(i), q2.View().Get(i));
+        EXPECT_EQ(result.View().Get(i), expected);
+    }
+}
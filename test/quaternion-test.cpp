@@ -579,3 +579,152 @@ TEST(QuaternionTests, RotatePoint)
         EXPECT_TRUE(Math::IsEqual(p2.z, 0.0f, 0.0001f));
     }
 }
+
+TEST(QuaternionTests, Composition)
+{
+    const Quatf q1 = Quatf::FromAxisAngleDegrees(Vector3f(1, 2, 3), 40);
+    const Quatf q2 = Quatf::FromAxisAngleDegrees(Vector3f(-2, 0, 1), 115);
+    const Quatd q3 = Quatd::FromAxisAngleDegrees(Vector3d(0, 1, 1), -70);
+    const Quatd q4 = Quatd::FromAxisAngleDegrees(Vector3d(3, -1, 2), 200);
+    {
+        // Composing the rotations has to match multiplying their matrices.
+        EXPECT_TRUE(
+            Math::IsEqual(Math::Rotate(q1 * q2), Math::Rotate(q1) * Math::Rotate(q2), 1e-6f));
+        EXPECT_TRUE(
+            Math::IsEqual(Math::Rotate(q2 * q1), Math::Rotate(q2) * Math::Rotate(q1), 1e-6f));
+        EXPECT_TRUE(
+            Math::IsEqual(Math::Rotate(q3 * q4), Math::Rotate(q3) * Math::Rotate(q4), 1e-14));
+    }
+    {
+        Quatf q = q1;
+        q *= q2;
+        EXPECT_EQ(q, q1 * q2);
+
+        // In-place product where the operand is the object itself.
+        Quatd q_squared = q3;
+        q_squared *= q_squared;
+        EXPECT_TRUE(
+            Math::IsEqual(Math::Rotate(q_squared), Math::Rotate(q3) * Math::Rotate(q3), 1e-14));
+    }
+    {
+        // The float product has to give the same result in constant expressions and at runtime.
+        constexpr Quatf k_q1(0.5f, 0.1f, -0.7f, 0.3f);
+        constexpr Quatf k_q2(-0.2f, 0.9f, 0.4f, -0.6f);
+        constexpr Quatf k_product = k_q1 * k_q2;
+        Quatf q_runtime = k_q1;
+        q_runtime *= k_q2;
+        EXPECT_EQ(k_product, q_runtime);
+    }
+}
+
+TEST(QuaternionTests, LogExp)
+{
+    {
+        const Quatd q = Quatd::FromAxisAngleDegrees(Vector3d(0, 0, 1), 60);
+        const Quatd log = Math::Log(q);
+        EXPECT_NEAR(log.w, 0, 1e-15);
+        EXPECT_NEAR(log.vec.x, 0, 1e-15);
+        EXPECT_NEAR(log.vec.y, 0, 1e-15);
+        EXPECT_NEAR(log.vec.z, Math::Radians(30.0), 1e-15);
+        EXPECT_TRUE(Math::IsEqual(Math::Exp(log), q, 1e-15));
+    }
+    {
+        const Quatd q(2, 0.3, -1.5, 0.7);
+        EXPECT_TRUE(Math::IsEqual(Math::Exp(Math::Log(q)), q, 1e-14));
+        EXPECT_TRUE(Math::IsEqual(Math::Log(Math::Exp(q)), q, 1e-14));
+    }
+    {
+        // Identity and very small rotations.
+        EXPECT_EQ(Math::Log(Quatf::Identity()), Quatf::Zero());
+        EXPECT_EQ(Math::Exp(Quatf::Zero()), Quatf::Identity());
+        const Quatf q = Quatf::FromAxisAngleRadians(Vector3f(1, 0, 0), 1e-6f);
+        EXPECT_FLOAT_EQ(Math::Log(q).vec.x, 0.5e-6f);
+    }
+    {
+        // Negative real numbers have no rotation axis, Exp still has to give them back.
+        const Quatd minus_one(-1, 0, 0, 0);
+        const Quatd log = Math::Log(minus_one);
+        EXPECT_EQ(log.w, 0);
+        EXPECT_DOUBLE_EQ(log.vec.x, Math::k_pi_double);
+        EXPECT_TRUE(Math::IsEqual(Math::Exp(log), minus_one, 1e-15));
+        const Quatd minus_three(-3, 0, 0, 0);
+        EXPECT_TRUE(Math::IsEqual(Math::Exp(Math::Log(minus_three)), minus_three, 1e-14));
+        EXPECT_TRUE(Math::IsEqual(Math::Pow(minus_one, 2.0), Quatd::Identity(), 1e-15));
+    }
+    {
+        const Quatd q = Quatd::FromAxisAngleDegrees(Vector3d(1, 2, 3), 80);
+        EXPECT_TRUE(Math::IsEqual(Math::Pow(q, 2.0), q * q, 1e-14));
+        EXPECT_TRUE(Math::IsEqual(Math::Pow(q, 0.25),
+                                  Quatd::FromAxisAngleDegrees(Vector3d(1, 2, 3), 20), 1e-14));
+        EXPECT_TRUE(Math::IsEqual(Math::Pow(q, 0.0), Quatd::Identity(), 1e-15));
+    }
+}
+
+TEST(QuaternionTests, AngleBetween)
+{
+    const Quatd q1 = Quatd::FromAxisAngleDegrees(Vector3d(1, 0, 0), 30);
+    const Quatd q2 = Quatd::FromAxisAngleDegrees(Vector3d(1, 0, 0), 90);
+    EXPECT_NEAR(Math::AngleBetween(q1, q2), Math::Radians(60.0), 1e-15);
+    EXPECT_NEAR(Math::AngleBetween(q2, q1), Math::Radians(60.0), 1e-15);
+    EXPECT_NEAR(Math::AngleBetween(q1, q1), 0, 1e-15);
+    EXPECT_NEAR(Math::AngleBetween(q1, q1 * -1.0), 0, 1e-15);
+
+    const Quatd q3 = Quatd::FromAxisAngleDegrees(Vector3d(0, 1, 0), 170);
+    EXPECT_NEAR(Math::AngleBetween(Quatd::Identity(), q3), Math::Radians(170.0), 1e-14);
+    EXPECT_NEAR(Math::AngleBetween(q3, q3 * q2), Math::Radians(90.0), 1e-14);
+}
+
+TEST(QuaternionTests, SwingTwist)
+{
+    {
+        const Quatd twist = Quatd::FromAxisAngleDegrees(Vector3d(0, 0, 1), 35);
+        const Quatd swing = Quatd::FromAxisAngleDegrees(Vector3d(1, 1, 0), 50);
+        const Math::SwingTwistDecomposition<double> result =
+            Math::SwingTwist(swing * twist, Vector3d(0, 0, 2));
+        EXPECT_TRUE(Math::IsEqual(result.swing, swing, 1e-14));
+        EXPECT_TRUE(Math::IsEqual(result.twist, twist, 1e-14));
+    }
+    {
+        const Quatf q = Quatf::FromAxisAngleDegrees(Vector3f(1, -2, 3), 110);
+        const Vector3f axis = Math::Normalize(Vector3f(0.5f, 1, 0));
+        const Math::SwingTwistDecomposition<float> result = Math::SwingTwist(q, axis);
+        EXPECT_TRUE(Math::IsEqual(result.swing * result.twist, q, 1e-6f));
+        // Twist rotates around the axis and swing around an axis perpendicular to it.
+        EXPECT_TRUE(Math::IsEqual(Math::Cross(result.twist.vec, axis), Vector3f::Zero(), 1e-6f));
+        EXPECT_TRUE(Math::IsEqual(Math::Dot(result.swing.vec, axis), 0.0f, 1e-6f));
+        EXPECT_TRUE(Math::IsEqual(Math::Length(result.twist), 1.0f, 1e-6f));
+    }
+    {
+        // Swing by 180 degrees, the twist is not defined.
+        const Quatd q = Quatd::FromAxisAngleDegrees(Vector3d(1, 0, 0), 180);
+        const Math::SwingTwistDecomposition<double> result =
+            Math::SwingTwist(q, Vector3d(0, 0, 1));
+        EXPECT_EQ(result.twist, Quatd::Identity());
+        EXPECT_EQ(result.swing, q);
+    }
+}
+
+TEST(QuaternionTests, Squad)
+{
+    const Quatd q0 = Quatd::FromAxisAngleDegrees(Vector3d(0, 1, 0), 0);
+    const Quatd q1 = Quatd::FromAxisAngleDegrees(Vector3d(0, 1, 0), 40);
+    const Quatd q2 = Quatd::FromAxisAngleDegrees(Vector3d(0, 1, 0), 80);
+    const Quatd q3 = Quatd::FromAxisAngleDegrees(Vector3d(0, 1, 0), 120);
+    {
+        // Rotating at a constant speed around one axis, the control points are the keys.
+        const Quatd a1 = Math::SquadControlPoint(q0, q1, q2);
+        const Quatd a2 = Math::SquadControlPoint(q1, q2, q3);
+        EXPECT_TRUE(Math::IsEqual(a1, q1, 1e-14));
+        EXPECT_TRUE(Math::IsEqual(a2, q2, 1e-14));
+        EXPECT_TRUE(Math::IsEqual(Math::Squad(0.25, q1, a1, a2, q2),
+                                  Quatd::FromAxisAngleDegrees(Vector3d(0, 1, 0), 50), 1e-14));
+    }
+    {
+        const Quatd q4 = Quatd::FromAxisAngleDegrees(Vector3d(1, 0, 1), 70);
+        const Quatd a1 = Math::SquadControlPoint(q0, q1, q4);
+        const Quatd a2 = Math::SquadControlPoint(q1, q4, q3);
+        EXPECT_TRUE(Math::IsEqual(Math::Squad(0.0, q1, a1, a2, q4), q1, 1e-14));
+        EXPECT_TRUE(Math::IsEqual(Math::Squad(1.0, q1, a1, a2, q4), q4, 1e-14));
+        EXPECT_NEAR(Math::Length(Math::Squad(0.3, q1, a1, a2, q4)), 1, 1e-14);
+    }
+}
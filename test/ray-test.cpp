@@ -0,0 +1,268 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include "math/ray.h"
+#include "math/rng.h"
+
+using Bounds3f = Math::Bounds3<float>;
+using Point3d = Math::Point3<double>;
+using Point3f = Math::Point3<float>;
+using Vector3f = Math::Vector3<float>;
+using Rayf = Math::Ray<float>;
+
+TEST(RayTests, Evaluate)
+{
+    const Rayf ray(Point3f(1, 2, 3), Vector3f(0, 0, 2));
+    EXPECT_EQ(ray(0), Point3f(1, 2, 3));
+    EXPECT_EQ(ray(1.5f), Point3f(1, 2, 6));
+}
+
+TEST(RayTests, IntersectBounds)
+{
+    const Bounds3f b(Point3f(0, 0, 0), Point3f(1, 1, 1));
+    float t0 = 0;
+    float t1 = 0;
+
+    const Rayf ray(Point3f(-1, 0.5f, 0.5f), Vector3f(1, 0, 0));
+    EXPECT_TRUE(Math::Intersect(ray, b, 10.0f, t0, t1));
+    EXPECT_FLOAT_EQ(t0, 1);
+    EXPECT_GE(t1, 2);
+    EXPECT_LT(t1, 2.00001f);
+
+    // Starting inside, and limited by t_max.
+    const Rayf inside(Point3f(0.5f, 0.5f, 0.5f), Vector3f(0, 1, 0));
+    EXPECT_TRUE(Math::Intersect(inside, b, 0.25f, t0, t1));
+    EXPECT_EQ(t0, 0);
+    EXPECT_EQ(t1, 0.25f);
+
+    EXPECT_FALSE(Math::Intersect(Rayf(ray.origin, -ray.direction), b, 10.0f, t0, t1));
+    EXPECT_FALSE(Math::Intersect(ray, b, 0.5f, t0, t1));
+    EXPECT_FALSE(Math::Intersect(Rayf(Point3f(-1, 2, 0.5f), Vector3f(1, 0, 0)), b, 10.0f, t0, t1));
+
+    // Parallel to a face and in its plane.
+    EXPECT_TRUE(Math::Intersect(Rayf(Point3f(-1, 0, 0.5f), Vector3f(1, 0, 0)), b, 10.0f, t0, t1));
+    EXPECT_TRUE(Math::Intersect(Rayf(Point3f(-1, 1, 1), Vector3f(1, 0, 0)), b, 10.0f, t0, t1));
+
+    const Rayf diagonal(Point3f(-1, -1, -1), Vector3f(1, 1, 1));
+    const Vector3f inverse_direction(1, 1, 1);
+    EXPECT_TRUE(Math::Intersect(diagonal, inverse_direction, b, 10.0f));
+    EXPECT_FALSE(Math::Intersect(diagonal, inverse_direction, b, 0.5f));
+    EXPECT_FALSE(Math::Intersect(diagonal, -inverse_direction, b, 10.0f));
+}
+
+TEST(RayTests, IntersectBoundsGrazing)
+{
+    // Rays aimed exactly at points on the edges of the box must never miss it.
+    Math::RNG rng(1);
+    const Bounds3f b(Point3f(-1.3f, 0.7f, 2.1f), Point3f(5.9f, 3.3f, 4.7f));
+    for (int i = 0; i < 10000; ++i)
+    {
+        const Point3f origin(rng.UniformFloatInRange(-100, 100), rng.UniformFloatInRange(-100, 100),
+                             rng.UniformFloatInRange(-100, 100));
+        const float s = rng.UniformFloatInRange(0, 1);
+        // The edge runs along the axis, the corners select the other two coordinates.
+        const auto axis = static_cast<int>(rng.UniformUInt32(3));
+        const uint32_t corner = rng.UniformUInt32(4);
+        Point3f target;
+        target[axis] = Math::Lerp(s, b.min[axis], b.max[axis]);
+        target[(axis + 1) % 3] = (corner & 1) ? b.max[(axis + 1) % 3] : b.min[(axis + 1) % 3];
+        target[(axis + 2) % 3] = (corner & 2) ? b.max[(axis + 2) % 3] : b.min[(axis + 2) % 3];
+
+        const Rayf ray(origin, target - origin);
+        float t0 = 0;
+        float t1 = 0;
+        EXPECT_TRUE(Math::Intersect(ray, b, 2.0f, t0, t1));
+        const Vector3f inverse_direction(1 / ray.direction.x, 1 / ray.direction.y,
+                                         1 / ray.direction.z);
+        EXPECT_TRUE(Math::Intersect(ray, inverse_direction, b, 2.0f));
+    }
+}
+
+TEST(RayTests, IntersectTriangle)
+{
+    const Point3f p0(0, 0, 1);
+    const Point3f p1(2, 0, 1);
+    const Point3f p2(0, 2, 1);
+    Math::TriangleIntersection<float> hit{};
+    EXPECT_TRUE(Math::Intersect(Rayf(Point3f(0.5f, 0.25f, -1), Vector3f(0, 0, 2)), p0, p1, p2,
+                                10.0f, hit));
+    EXPECT_FLOAT_EQ(hit.t, 1.0f);
+    EXPECT_FLOAT_EQ(hit.b0 + hit.b1 + hit.b2, 1.0f);
+    const Point3f p = p0 + hit.b1 * (p1 - p0) + hit.b2 * (p2 - p0);
+    EXPECT_FLOAT_EQ(p.x, 0.5f);
+    EXPECT_FLOAT_EQ(p.y, 0.25f);
+    EXPECT_FLOAT_EQ(p.z, 1.0f);
+
+    // Both sides are hit.
+    EXPECT_TRUE(Math::Intersect(Rayf(Point3f(0.5f, 0.5f, 3), Vector3f(0, 0, -1)), p0, p1, p2,
+                                10.0f, hit));
+    EXPECT_FLOAT_EQ(hit.t, 2.0f);
+
+    const Rayf ray(Point3f(0.5f, 0.5f, 0), Vector3f(0, 0, 1));
+    EXPECT_FALSE(Math::Intersect(ray, p0, p1, p2, 0.5f, hit));
+    EXPECT_FALSE(Math::Intersect(Rayf(ray.origin, -ray.direction), p0, p1, p2, 10.0f, hit));
+    EXPECT_FALSE(Math::Intersect(Rayf(Point3f(1.5f, 1.5f, 0), ray.direction), p0, p1, p2, 10.0f,
+                                 hit));
+    EXPECT_FALSE(Math::Intersect(Rayf(Point3f(-1, 0.5f, 1), Vector3f(1, 0, 0)), p0, p1, p2, 10.0f,
+                                 hit));
+
+    Math::TriangleIntersection<double> hit_double{};
+    const Math::Ray<double> ray_double(Point3d(0.5, 0.5, 0), Math::Vector3<double>(0, 0, 1));
+    EXPECT_TRUE(Math::Intersect(ray_double, Point3d(0, 0, 1), Point3d(2, 0, 1), Point3d(0, 2, 1),
+                                10.0, hit_double));
+    EXPECT_DOUBLE_EQ(hit_double.t, 1.0);
+}
+
+TEST(RayTests, IntersectTriangleWatertight)
+{
+    // A fan of triangles around a shared vertex, rays aimed at the shared edges and at the shared
+    // vertex must hit at least one of the triangles.
+    Math::RNG rng(2);
+    for (int i = 0; i < 1000; ++i)
+    {
+        auto random_point = [&rng](float range)
+        {
+            return Point3f(rng.UniformFloatInRange(-range, range),
+                           rng.UniformFloatInRange(-range, range),
+                           rng.UniformFloatInRange(-range, range));
+        };
+        const Point3f center = random_point(10);
+        const Vector3f u(rng.UniformFloatInRange(-1, 1), rng.UniformFloatInRange(-1, 1), 1);
+        const Vector3f v(1, rng.UniformFloatInRange(-1, 1), rng.UniformFloatInRange(-1, 1));
+        constexpr int32_t k_count = 6;
+        Point3f rim[k_count];
+        for (int32_t j = 0; j < k_count; ++j)
+        {
+            const float angle = 2 * Math::k_pi_float * static_cast<float>(j) / k_count;
+            rim[j] = center + std::cos(angle) * u + std::sin(angle) * v;
+        }
+        const Point3f origin = random_point(100);
+        for (int32_t j = 0; j <= k_count; ++j)
+        {
+            const Point3f target = j == k_count
+                                       ? center
+                                       : Math::Lerp(rng.UniformFloatInRange(0, 1), center, rim[j]);
+            const Rayf ray(origin, target - origin);
+            bool any_hit = false;
+            for (int32_t k = 0; k < k_count; ++k)
+            {
+                Math::TriangleIntersection<float> hit{};
+                any_hit |= Math::Intersect(ray, center, rim[k], rim[(k + 1) % k_count], 2.0f, hit);
+            }
+            EXPECT_TRUE(any_hit);
+        }
+    }
+}
+
+TEST(RayTests, IntersectNearest)
+{
+    Math::RNG rng(3);
+    for (const size_t count : {0, 1, 7, 8, 13, 100, 1001})
+    {
+        std::vector<float> coordinates[9];
+        for (std::vector<float>& c : coordinates)
+        {
+            c.resize(count);
+        }
+        for (size_t i = 0; i < count; ++i)
+        {
+            const Point3f center(rng.UniformFloatInRange(-10, 10), rng.UniformFloatInRange(-10, 10),
+                                 rng.UniformFloatInRange(-10, 10));
+            for (size_t c = 0; c < 9; ++c)
+            {
+                coordinates[c][i] = center[static_cast<int32_t>(c % 3)] +
+                                    rng.UniformFloatInRange(-2, 2);
+            }
+        }
+        const Math::TriangleSoA<float> triangles(coordinates[0], coordinates[1], coordinates[2],
+                                                 coordinates[3], coordinates[4], coordinates[5],
+                                                 coordinates[6], coordinates[7], coordinates[8]);
+        for (int i = 0; i < 200; ++i)
+        {
+            const Point3f origin(rng.UniformFloatInRange(-15, 15), rng.UniformFloatInRange(-15, 15),
+                                 rng.UniformFloatInRange(-15, 15));
+            const Vector3f direction(rng.UniformFloatInRange(-1, 1), rng.UniformFloatInRange(-1, 1),
+                                     rng.UniformFloatInRange(-1, 1));
+            const Rayf ray(origin, direction);
+
+            bool expected_found = false;
+            float expected_t = 100;
+            size_t expected_index = 0;
+            for (size_t j = 0; j < count; ++j)
+            {
+                Math::TriangleIntersection<float> hit{};
+                if (Math::Intersect(ray, triangles.Get(j, 0), triangles.Get(j, 1),
+                                    triangles.Get(j, 2), expected_t, hit))
+                {
+                    expected_found = true;
+                    expected_t = hit.t;
+                    expected_index = j;
+                }
+            }
+
+            Math::TriangleIntersection<float> hit{};
+            size_t index = 0;
+            ASSERT_EQ(Math::IntersectNearest(ray, triangles, 100.0f, hit, index), expected_found);
+            if (expected_found)
+            {
+                EXPECT_EQ(index, expected_index);
+                EXPECT_EQ(hit.t, expected_t);
+                EXPECT_NEAR(hit.b0 + hit.b1 + hit.b2, 1.0f, 1e-5f);
+            }
+        }
+    }
+}
+
+TEST(RayTests, IntersectNearestCoplanar)
+{
+    // Two triangles in the plane z = 5. The ray runs along an edge of the first one, which goes to
+    // the scalar test, and through the inside of the second one. Both are hit at the same t, the
+    // index has to be the one of testing the triangles in order. The other triangles are missed.
+    const Point3f first[3] = {Point3f(0, -1, 5), Point3f(0, 1, 5), Point3f(-1, 0, 5)};
+    const Point3f second[3] = {Point3f(-1, -1, 5), Point3f(1, -1, 5), Point3f(0, 1, 5)};
+    for (const size_t count : {2, 8, 16})
+    {
+        std::vector<float> coordinates[9];
+        for (std::vector<float>& c : coordinates)
+        {
+            c.resize(count);
+        }
+        for (size_t i = 0; i < count; ++i)
+        {
+            for (size_t c = 0; c < 9; ++c)
+            {
+                const int32_t axis = static_cast<int32_t>(c % 3);
+                const float far_away = axis == 0 ? 50.0f + static_cast<float>(i) : 0.0f;
+                coordinates[c][i] = i == 0   ? first[c / 3][axis]
+                                    : i == 1 ? second[c / 3][axis]
+                                             : second[c / 3][axis] + far_away;
+            }
+        }
+        const Math::TriangleSoA<float> triangles(coordinates[0], coordinates[1], coordinates[2],
+                                                 coordinates[3], coordinates[4], coordinates[5],
+                                                 coordinates[6], coordinates[7], coordinates[8]);
+        const Rayf ray(Point3f(0, 0, 0), Vector3f(0, 0, 1));
+
+        float expected_t = 100;
+        size_t expected_index = count;
+        for (size_t j = 0; j < count; ++j)
+        {
+            Math::TriangleIntersection<float> hit{};
+            if (Math::Intersect(ray, triangles.Get(j, 0), triangles.Get(j, 1), triangles.Get(j, 2),
+                                expected_t, hit))
+            {
+                expected_t = hit.t;
+                expected_index = j;
+            }
+        }
+        ASSERT_EQ(expected_t, 5.0f);
+
+        Math::TriangleIntersection<float> hit{};
+        size_t index = count;
+        ASSERT_TRUE(Math::IntersectNearest(ray, triangles, 100.0f, hit, index));
+        EXPECT_EQ(index, expected_index);
+        EXPECT_EQ(hit.t, 5.0f);
+    }
+}
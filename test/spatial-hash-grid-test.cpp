@@ -0,0 +1,158 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "math/rng.h"
+#include "math/spatial-hash-grid.h"
+
+using Point3f = Math::Point3<float>;
+
+namespace
+{
+
+std::vector<Point3f> RandomPoints(size_t count, float range, uint64_t seed)
+{
+    Math::RNG rng(seed);
+    std::vector<Point3f> points;
+    for (size_t i = 0; i < count; ++i)
+    {
+        points.emplace_back(rng.UniformFloatInRange(-range, range),
+                            rng.UniformFloatInRange(-range, range),
+                            rng.UniformFloatInRange(-range, range));
+    }
+    return points;
+}
+
+std::vector<uint32_t> BruteForceRadius(const std::vector<Point3f>& points,
+                                       const Point3f& center,
+                                       float radius)
+{
+    std::vector<uint32_t> result;
+    for (uint32_t i = 0; i < points.size(); ++i)
+    {
+        if (Math::DistanceSquared(points[i], center) <= radius * radius)
+        {
+            result.push_back(i);
+        }
+    }
+    return result;
+}
+
+}  // namespace
+
+TEST(SpatialHashGridTests, Build)
+{
+    Math::SpatialHashGrid<float> grid(1.0f);
+    for (const uint32_t thread_count : {1u, 4u})
+    {
+        Math::SetThreadCount(thread_count);
+        for (const size_t count : {size_t{0}, size_t{1}, size_t{100}, size_t{100000}})
+        {
+            const std::vector<Point3f> points = RandomPoints(count, 20, count);
+            Math::Build<float>(points, grid);
+            ASSERT_EQ(grid.points.size(), count);
+            ASSERT_EQ(grid.bucket_start.back(), count);
+            EXPECT_TRUE(std::is_sorted(grid.bucket_start.begin(), grid.bucket_start.end()));
+            std::vector<uint32_t> indices = grid.indices;
+            std::sort(indices.begin(), indices.end());
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                EXPECT_EQ(indices[i], i);
+                EXPECT_EQ(grid.points[i], points[grid.indices[i]]);
+            }
+        }
+    }
+    Math::SetThreadCount(0);
+}
+
+TEST(SpatialHashGridTests, Radius)
+{
+    const std::vector<Point3f> points = RandomPoints(20000, 50, 1);
+    Math::SpatialHashGrid<float> grid(2.0f);
+    Math::Build<float>(points, grid);
+
+    Math::RNG rng(2);
+    for (const float radius : {0.0f, 0.5f, 2.0f, 7.5f, 200.0f})
+    {
+        for (int i = 0; i < 20; ++i)
+        {
+            // Some queries are centered on a point so that zero radius finds it.
+            const Point3f center = i % 2 == 0 ? points[rng.UniformUInt32(20000)]
+                                              : Point3f(rng.UniformFloatInRange(-60, 60),
+                                                        rng.UniformFloatInRange(-60, 60),
+                                                        rng.UniformFloatInRange(-60, 60));
+            std::vector<uint32_t> found;
+            Math::ForEachInRadius(grid, center, radius,
+                                  [&](uint32_t index, float distance_squared)
+                                  {
+                                      EXPECT_FLOAT_EQ(distance_squared,
+                                                      Math::DistanceSquared(points[index], center));
+                                      found.push_back(index);
+                                  });
+            std::sort(found.begin(), found.end());
+            EXPECT_EQ(found, BruteForceRadius(points, center, radius));
+        }
+    }
+}
+
+TEST(SpatialHashGridTests, Nearest)
+{
+    const std::vector<Point3f> points = RandomPoints(5000, 50, 3);
+    Math::SpatialHashGrid<float> grid(1.0f);
+    Math::Build<float>(points, grid);
+
+    Math::RNG rng(4);
+    for (const size_t k : {size_t{1}, size_t{8}, size_t{50}})
+    {
+        for (int i = 0; i < 20; ++i)
+        {
+            // Far away queries expand the search until they cover every bucket.
+            const float range = i < 10 ? 50.0f : 500.0f;
+            const Point3f center(rng.UniformFloatInRange(-range, range),
+                                 rng.UniformFloatInRange(-range, range),
+                                 rng.UniformFloatInRange(-range, range));
+            std::vector<uint32_t> indices(k);
+            std::vector<float> distances(k);
+            ASSERT_EQ(Math::FindNearest<float>(grid, center, indices, distances), k);
+
+            std::vector<float> expected;
+            for (const Point3f& p : points)
+            {
+                expected.push_back(Math::DistanceSquared(p, center));
+            }
+            std::sort(expected.begin(), expected.end());
+            for (size_t j = 0; j < k; ++j)
+            {
+                EXPECT_EQ(distances[j], expected[j]);
+                EXPECT_EQ(distances[j], Math::DistanceSquared(points[indices[j]], center));
+            }
+        }
+    }
+
+    // Queries more cells away than int32_t can count clamp the cells and stop growing once they
+    // visit every bucket.
+    for (const Point3f center : {Point3f(1e12f, -1e12f, 3e9f), Point3f(0, 0, -1e30f)})
+    {
+        std::vector<uint32_t> indices(8);
+        std::vector<float> distances(8);
+        ASSERT_EQ(Math::FindNearest<float>(grid, center, indices, distances), 8u);
+        std::vector<float> expected;
+        for (const Point3f& p : points)
+        {
+            expected.push_back(Math::DistanceSquared(p, center));
+        }
+        std::sort(expected.begin(), expected.end());
+        EXPECT_EQ(distances[0], expected[0]);
+    }
+    size_t inside = 0;
+    Math::ForEachInRadius<float>(grid, Point3f(0, 0, 0), 1e20f, [&](uint32_t, float) { ++inside; });
+    EXPECT_EQ(inside, points.size());
+
+    // Asking for more points than there are returns all of them.
+    const std::vector<Point3f> few = RandomPoints(3, 10, 5);
+    Math::Build<float>(few, grid);
+    std::vector<uint32_t> indices(10);
+    std::vector<float> distances(10);
+    EXPECT_EQ(Math::FindNearest<float>(grid, Point3f(0, 0, 0), indices, distances), 3u);
+}
@@ -0,0 +1,257 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "math/projections.h"
+#include "math/rng.h"
+#include "math/sphere.h"
+#include "math/transform.h"
+
+#include "mask-bits.h"
+
+using Bounds3f = Math::Bounds3<float>;
+using Point3f = Math::Point3<float>;
+using Sphere3f = Math::Sphere<float>;
+using Vector3f = Math::Vector3<float>;
+
+namespace
+{
+
+template <typename T>
+std::vector<Math::Sphere<T>> RandomSpheres(size_t count, uint64_t seed)
+{
+    Math::RNG rng(seed);
+    std::vector<Math::Sphere<T>> spheres;
+    for (size_t i = 0; i < count; ++i)
+    {
+        spheres.emplace_back(
+            Math::Point3<T>(rng.UniformFloatInRange(-20, 20), rng.UniformFloatInRange(-20, 20),
+                            rng.UniformFloatInRange(-20, 20)),
+            static_cast<T>(rng.UniformFloatInRange(0.1f, 4)));
+    }
+    return spheres;
+}
+
+// Points on a tilted ellipsoid shell far from the origin, with a few inside it.
+std::vector<Point3f> RandomPoints(size_t count, uint64_t seed)
+{
+    Math::RNG rng(seed);
+    std::vector<Point3f> points;
+    while (points.size() < count)
+    {
+        const Vector3f v(rng.UniformFloatInRange(-1, 1), rng.UniformFloatInRange(-1, 1),
+                         rng.UniformFloatInRange(-1, 1));
+        if (Math::LengthSquared(v) > 1 || Math::LengthSquared(v) < 0.01f)
+        {
+            continue;
+        }
+        const Vector3f u = points.size() % 8 == 0 ? v : Math::Normalize(v);
+        points.emplace_back(1000 + 10 * u.x + 2 * u.y, -500 + 3 * u.y, 200 + u.z + u.x);
+    }
+    return points;
+}
+
+// Contains the points with the distances in double, and has points on its boundary up to the
+// rounding of the center, which is about 1e-4 for the coordinates of RandomPoints.
+void ExpectEncloses(const Sphere3f& s, const std::vector<Point3f>& points)
+{
+    double farthest = 0;
+    for (const Point3f& p : points)
+    {
+        farthest = std::max(farthest, Math::Distance(Math::Point3<double>(p.x, p.y, p.z),
+                                                     Math::Point3<double>(s.center.x, s.center.y,
+                                                                          s.center.z)));
+    }
+    EXPECT_LE(farthest, s.radius);
+    EXPECT_GT(farthest, s.radius - 2e-4);
+}
+
+}  // namespace
+
+TEST(SphereTests, Constructors)
+{
+    const Sphere3f s(Point3f(1, 2, 3), 4);
+    EXPECT_EQ(s.center, Point3f(1, 2, 3));
+    EXPECT_EQ(s.radius, 4);
+
+    const Sphere3f b(Bounds3f(Point3f(-1, -2, -2), Point3f(1, 2, 2)));
+    EXPECT_EQ(b.center, Point3f(0, 0, 0));
+    EXPECT_FLOAT_EQ(b.radius, 3);
+}
+
+TEST(SphereTests, FromPoints)
+{
+    const std::vector<Point3f> single = {Point3f(1, 2, 3)};
+    for (const Sphere3f& s :
+         {Sphere3f::FromPoints(single), Sphere3f::FromPointsApproximate(single)})
+    {
+        EXPECT_EQ(s.center, Point3f(1, 2, 3));
+        EXPECT_LE(s.radius, 1e-6f);
+    }
+
+    // The corners of a box, where every point is on the boundary and most support sets are
+    // degenerate.
+    std::vector<Point3f> corners;
+    for (int i = 0; i < 8; ++i)
+    {
+        corners.emplace_back(i & 1 ? 3.0f : -1.0f, i & 2 ? 2.0f : -2.0f, i & 4 ? 1.0f : 0.0f);
+        corners.push_back(corners.back());
+    }
+    const Sphere3f box = Sphere3f::FromPoints(corners);
+    EXPECT_NEAR(box.center.x, 1, 1e-5f);
+    EXPECT_NEAR(box.center.y, 0, 1e-5f);
+    EXPECT_NEAR(box.center.z, 0.5f, 1e-5f);
+    EXPECT_NEAR(box.radius, std::sqrt(8.25f), 1e-5f);
+    ExpectEncloses(box, corners);
+
+    // Points on a circle, where the support sets are degenerate and points that are outside the
+    // sphere by rounding errors are rejected as support points.
+    for (const uint64_t seed : {15u, 33u, 39u})
+    {
+        Math::RNG rng(seed);
+        std::vector<Math::Point3<double>> circle;
+        for (int i = 0; i < 50; ++i)
+        {
+            const double angle = rng.UniformFloatInRange(-4, 4);
+            circle.emplace_back(1000 + std::cos(angle), 1000 + std::sin(angle), 1000);
+        }
+        const Math::Sphere<double> s = Math::Sphere<double>::FromPoints(circle);
+        EXPECT_NEAR(s.radius, 1, 1e-6);
+        for (const Math::Point3<double>& p : circle)
+        {
+            EXPECT_LE(Math::Distance(p, s.center), s.radius);
+        }
+    }
+
+    // An equilateral triangle, where the sphere through the points is smaller than the one around
+    // their two farthest points.
+    const std::vector<Point3f> triangle = {Point3f(0, 0, 5), Point3f(2, 0, 5),
+                                           Point3f(1, std::sqrt(3.0f), 5)};
+    const Sphere3f circle = Sphere3f::FromPoints(triangle);
+    EXPECT_NEAR(circle.center.y, 1 / std::sqrt(3.0f), 1e-5f);
+    EXPECT_NEAR(circle.radius, 2 / std::sqrt(3.0f), 1e-5f);
+
+    for (const size_t size : {2u, 5u, 100u, 10000u})
+    {
+        const std::vector<Point3f> points = RandomPoints(size, size);
+        const Sphere3f minimal = Sphere3f::FromPoints(points);
+        const Sphere3f approximate = Sphere3f::FromPointsApproximate(points);
+        ExpectEncloses(minimal, points);
+        ExpectEncloses(approximate, points);
+        EXPECT_LE(minimal.radius, approximate.radius * (1 + 1e-6f));
+        EXPECT_LT(approximate.radius, minimal.radius * 1.3f);
+        for (const Point3f& p : points)
+        {
+            EXPECT_TRUE(Math::InsideInclusive(
+                Sphere3f(minimal.center, minimal.radius * (1 + 1e-6f)), p));
+        }
+    }
+
+    // The minimal sphere doesn't depend on the order of the points.
+    std::vector<Point3f> points = RandomPoints(1000, 2);
+    const Sphere3f forward = Sphere3f::FromPoints(points);
+    std::reverse(points.begin(), points.end());
+    const Sphere3f backward = Sphere3f::FromPoints(points);
+    EXPECT_NEAR(Math::Distance(forward.center, backward.center), 0, 1e-3);
+    EXPECT_NEAR(forward.radius, backward.radius, 1e-4f);
+
+    const std::vector<Math::Point3<double>> doubles = {{0, 0, 0}, {0, 4, 0}, {0, 0, 3}};
+    const Math::Sphere<double> right = Math::Sphere<double>::FromPoints(doubles);
+    EXPECT_NEAR(right.radius, 2.5, 1e-12);
+    EXPECT_NEAR(right.center.y, 2, 1e-12);
+    EXPECT_NEAR(right.center.z, 1.5, 1e-12);
+}
+
+TEST(SphereTests, Overlaps)
+{
+    const Sphere3f s(Point3f(0, 0, 0), 2);
+    EXPECT_TRUE(Math::Overlaps(s, Sphere3f(Point3f(3, 0, 0), 1)));
+    EXPECT_FALSE(Math::Overlaps(s, Sphere3f(Point3f(3, 0, 0), 0.9f)));
+    EXPECT_TRUE(Math::Overlaps(s, Sphere3f(Point3f(0.5f, 0, 0), 0.1f)));
+    EXPECT_TRUE(Math::InsideInclusive(s, Point3f(0, 2, 0)));
+    EXPECT_FALSE(Math::InsideInclusive(s, Point3f(1.5f, 1.5f, 0)));
+
+    const Bounds3f b(Point3f(1, 1, 1), Point3f(3, 4, 5));
+    EXPECT_TRUE(Math::Overlaps(b, Sphere3f(Point3f(2, 2, 2), 0.1f)));
+    EXPECT_TRUE(Math::Overlaps(b, Sphere3f(Point3f(2, 2, -1), 2)));
+    EXPECT_FALSE(Math::Overlaps(b, Sphere3f(Point3f(2, 2, -1), 1.9f)));
+    // Near the corner the sphere misses the box, though it overlaps its faces extended.
+    EXPECT_FALSE(Math::Overlaps(b, Sphere3f(Point3f(0, 0, 0), 1.7f)));
+    EXPECT_TRUE(Math::Overlaps(b, Sphere3f(Point3f(0, 0, 0), 1.75f)));
+}
+
+TEST(SphereTests, Frustum)
+{
+    // Looking down +z with a 90 degree field of view, so the sides are the planes |x| = z, |y| = z.
+    const auto f = Math::Frustum<float>::FromMatrix_N0(
+        Math::Perspective_LH_N0(90.0f, 1.0f, 1.0f, 100.0f));
+
+    EXPECT_TRUE(Math::Inside(f, Sphere3f(Point3f(0, 0, 10), 3)));
+    EXPECT_TRUE(Math::Overlaps(f, Sphere3f(Point3f(0, 0, 10), 3)));
+    EXPECT_FALSE(Math::Inside(f, Sphere3f(Point3f(8, 0, 10), 3)));
+    EXPECT_TRUE(Math::Overlaps(f, Sphere3f(Point3f(8, 0, 10), 3)));
+
+    // The distance to the right plane is (x - z) / sqrt(2).
+    EXPECT_FALSE(Math::Overlaps(f, Sphere3f(Point3f(14, 0, 10), 2.8f)));
+    EXPECT_TRUE(Math::Overlaps(f, Sphere3f(Point3f(14, 0, 10), 2.9f)));
+    EXPECT_FALSE(Math::Overlaps(f, Sphere3f(Point3f(0, 0, 103), 2.9f)));
+    EXPECT_FALSE(Math::Overlaps(f, Sphere3f(Point3f(0, 0, -3), 2.9f)));
+}
+
+template <typename T>
+void TestBatch()
+{
+    // 203 spheres leave a partial group of four and a partial word of the mask.
+    const std::vector<Math::Sphere<T>> spheres = RandomSpheres<T>(203, 3);
+    std::vector<uint64_t> mask(4);
+
+    const Math::Sphere<T> query(Math::Point3<T>(2, -1, 3), 10);
+    size_t count = Math::Overlaps<T>(query, spheres, mask);
+    size_t expected = 0;
+    for (size_t i = 0; i < spheres.size(); ++i)
+    {
+        EXPECT_EQ(MaskBit(mask, i), Math::Overlaps(query, spheres[i]));
+        expected += Math::Overlaps(query, spheres[i]) ? 1 : 0;
+    }
+    EXPECT_EQ(count, expected);
+    EXPECT_GT(count, 0u);
+    EXPECT_LT(count, spheres.size());
+    EXPECT_EQ(mask[3] >> (203 - 192), 0u);
+
+    const Math::Bounds3<T> box(Math::Point3<T>(-15, -3, -8), Math::Point3<T>(5, 2, 12));
+    count = Math::Overlaps<T>(box, spheres, mask);
+    expected = 0;
+    for (size_t i = 0; i < spheres.size(); ++i)
+    {
+        EXPECT_EQ(MaskBit(mask, i), Math::Overlaps(box, spheres[i]));
+        expected += Math::Overlaps(box, spheres[i]) ? 1 : 0;
+    }
+    EXPECT_EQ(count, expected);
+    EXPECT_GT(count, 0u);
+    EXPECT_LT(count, spheres.size());
+    EXPECT_EQ(mask[3] >> (203 - 192), 0u);
+
+    // Looking at the spheres from outside, with some of them cut by the sides.
+    const Math::Matrix4x4<T> view = Math::LookAt_LH(
+        Math::Point3<T>(5, 0, -40), Math::Point3<T>(0, 0, 0), Math::Vector3<T>(0, 1, 0));
+    const auto f =
+        Math::Frustum<T>::FromMatrix_N0(Math::Perspective_LH_N0<T>(30, 1, 1, 100) * view);
+    count = Math::Overlaps<T>(f, spheres, mask);
+    expected = 0;
+    for (size_t i = 0; i < spheres.size(); ++i)
+    {
+        EXPECT_EQ(MaskBit(mask, i), Math::Overlaps(f, spheres[i]));
+        expected += Math::Overlaps(f, spheres[i]) ? 1 : 0;
+    }
+    EXPECT_EQ(count, expected);
+    EXPECT_GT(count, 0u);
+    EXPECT_LT(count, spheres.size());
+}
+
+TEST(SphereTests, Batch)
+{
+    TestBatch<float>();
+    TestBatch<double>();
+}
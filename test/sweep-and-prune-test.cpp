@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "math/rng.h"
+#include "math/sweep-and-prune.h"
+
+using Bounds3f = Math::Bounds3<float>;
+using Point3f = Math::Point3<float>;
+
+namespace
+{
+
+std::vector<Math::OverlapPair> BruteForcePairs(const std::vector<Bounds3f>& boxes)
+{
+    std::vector<Math::OverlapPair> pairs;
+    for (uint32_t i = 0; i < boxes.size(); ++i)
+    {
+        for (uint32_t j = i + 1; j < boxes.size(); ++j)
+        {
+            if (Math::Overlaps(boxes[i], boxes[j]))
+            {
+                pairs.push_back({i, j});
+            }
+        }
+    }
+    return pairs;
+}
+
+}  // namespace
+
+TEST(SweepAndPruneTests, Pairs)
+{
+    Math::RNG rng(1);
+    std::vector<Bounds3f> boxes;
+    for (int i = 0; i < 1000; ++i)
+    {
+        // Spread along y so that it is the sort axis.
+        const Point3f p(rng.UniformFloatInRange(-10, 10), rng.UniformFloatInRange(-50, 50),
+                        rng.UniformFloatInRange(-10, 10));
+        const float size = rng.UniformFloatInRange(0.1f, 2);
+        boxes.emplace_back(p, p + Math::Vector3<float>(size, size, size));
+    }
+
+    Math::SweepAndPrune<float> sap;
+    std::vector<Math::OverlapPair> pairs(20000);
+    for (int frame = 0; frame < 5; ++frame)
+    {
+        const size_t count = sap.FindOverlapPairs(boxes, pairs);
+        ASSERT_LE(count, pairs.size());
+        std::vector<Math::OverlapPair> found(pairs.begin(),
+                                             pairs.begin() + static_cast<ptrdiff_t>(count));
+        std::sort(found.begin(), found.end());
+        EXPECT_EQ(found, BruteForcePairs(boxes));
+        EXPECT_EQ(sap.FindOverlapPairs(boxes, std::span(pairs.data(), 3)), count);
+
+        for (Bounds3f& box : boxes)
+        {
+            const Math::Vector3<float> offset(rng.UniformFloatInRange(-0.5f, 0.5f),
+                                              rng.UniformFloatInRange(-0.5f, 0.5f),
+                                              rng.UniformFloatInRange(-0.5f, 0.5f));
+            box = Bounds3f(box.min + offset, box.max + offset);
+        }
+    }
+
+    boxes.resize(10);
+    const size_t count = sap.FindOverlapPairs(boxes, pairs);
+    std::vector<Math::OverlapPair> found(pairs.begin(),
+                                         pairs.begin() + static_cast<ptrdiff_t>(count));
+    std::sort(found.begin(), found.end());
+    EXPECT_EQ(found, BruteForcePairs(boxes));
+}